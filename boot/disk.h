@@ -0,0 +1,63 @@
+/*
+ * IDE disk reading code shared by the boot loader's two stages.
+ *
+ * Copyright (C) 1997 Massachusetts Institute of Technology 
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Derived from the MIT Exokernel and JOS.
+ */
+#ifndef PIOS_BOOT_DISK_H
+#define PIOS_BOOT_DISK_H
+
+#include <inc/x86.h>
+
+// The functions are static, and defined here rather than in their own
+// object file, so gcc can inline them: the boot block has 510 bytes.
+
+#define SECTSIZE	512
+
+static void
+waitdisk(void)
+{
+	// wait for disk reaady
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+		/* do nothing */;
+}
+
+// Wait until the disk has the next sector ready for us to read.
+// The drive may take 400ns to raise BSY after a command or a sector,
+// so give it that long (four alternate status reads) before looking.
+static void
+waitdata(void)
+{
+	inb(0x3F6);
+	inb(0x3F6);
+	inb(0x3F6);
+	inb(0x3F6);
+	while ((inb(0x1F7) & 0x88) != 0x08)	// BSY clear, DRQ set
+		/* do nothing */;
+}
+
+// Read nsect (at most 255) sectors starting at sector 'offset' into dst.
+static void
+readsects(uint8_t *dst, uint32_t offset, uint32_t nsect)
+{
+	// wait for disk to be ready
+	waitdisk();
+
+	outb(0x1F2, nsect);	// count = nsect, at most 255
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+	outb(0x1F5, offset >> 16);
+	outb(0x1F6, (offset >> 24) | 0xE0);
+	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+	// read the sectors as the disk delivers them
+	while (nsect-- > 0) {
+		waitdata();
+		insl(0x1F0, dst, SECTSIZE/4);
+		dst += SECTSIZE;
+	}
+}
+
+#endif /* PIOS_BOOT_DISK_H */
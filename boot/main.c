@@ -9,6 +9,10 @@
 #include <inc/x86.h>
 #include <inc/elf.h>
 
+#include <kern/boottime.h>
+
+#include <boot/disk.h>
+
 /**********************************************************************
  * This a dirt simple boot loader, whose sole job is to boot
  * an ELF kernel image from the first IDE hard disk.
@@ -37,16 +41,17 @@
  *  * bootmain() in this file takes over, reads in the kernel and jumps to it.
  **********************************************************************/
 
-#define SECTSIZE	512
 #define ELFHDR		((elfhdr *) 0x10000) // scratch space
 
-void readsect(void*, uint32_t);
-void readseg(uint32_t, uint32_t, uint32_t);
+static void readseg(uint32_t, uint32_t, uint32_t);
 
 void
 bootmain(void)
 {
 	proghdr *ph, *eph;
+	uint64_t *stamps = (uint64_t *) BOOTTIME_LOWMEM;
+
+	stamps[BOOTTIME_LOADER] = rdtsc();
 
 	// read 1st page off disk
 	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
@@ -61,6 +66,8 @@ bootmain(void)
 	for (; ph < eph; ph++)
 		readseg(ph->p_va, ph->p_memsz, ph->p_offset);
 
+	stamps[BOOTTIME_LOADED] = rdtsc();
+
 	// call the entry point from the ELF header
 	// note: does not return!
 	((void (*)(void)) (ELFHDR->e_entry & 0xFFFFFF))();
@@ -74,7 +81,7 @@ bad:
 
 // Read 'count' bytes at 'offset' from kernel into virtual address 'va'.
 // Might copy more than asked
-void
+static void
 readseg(uint32_t va, uint32_t count, uint32_t offset)
 {
 	uint32_t end_va;
@@ -88,41 +95,16 @@ readseg(uint32_t va, uint32_t count, uint32_t offset)
 	// translate from bytes to sectors, and kernel starts at sector 1
 	offset = (offset / SECTSIZE) + 1;
 
-	// If this is too slow, we could read lots of sectors at a time.
+	// Read up to 255 sectors per command, since each command costs
+	// a full handshake with the disk while its sectors stream out fast.
 	// We'd write more to memory than asked, but it doesn't matter --
 	// we load in increasing order.
 	while (va < end_va) {
-		readsect((uint8_t*) va, offset);
-		va += SECTSIZE;
-		offset++;
+		uint32_t nsect = (end_va - va + SECTSIZE - 1) / SECTSIZE;
+		if (nsect > 255)
+			nsect = 255;
+		readsects((uint8_t*) va, offset, nsect);
+		va += nsect * SECTSIZE;
+		offset += nsect;
 	}
 }
-
-void
-waitdisk(void)
-{
-	// wait for disk reaady
-	while ((inb(0x1F7) & 0xC0) != 0x40)
-		/* do nothing */;
-}
-
-void
-readsect(void *dst, uint32_t offset)
-{
-	// wait for disk to be ready
-	waitdisk();
-
-	outb(0x1F2, 1);		// count = 1
-	outb(0x1F3, offset);
-	outb(0x1F4, offset >> 8);
-	outb(0x1F5, offset >> 16);
-	outb(0x1F6, (offset >> 24) | 0xE0);
-	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
-
-	// wait for disk to be ready
-	waitdisk();
-
-	// read a sector
-	insl(0x1F0, dst, SECTSIZE/4);
-}
-
@@ -0,0 +1,77 @@
+/*
+ * Second-stage boot loader for compressed kernel images.
+ *
+ * When the kernel is built with ZKERNEL defined, the boot block loads
+ * this program instead of the kernel.  We read the LZ4-compressed kernel
+ * that follows us on disk, decompress its segments into place, and start it.
+ * Fewer sectors to read makes up many times over for the decompression,
+ * since each sector read by port I/O is slow, especially under emulation.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+#include <inc/types.h>
+#include <inc/x86.h>
+
+#include <kern/boottime.h>
+
+#include <boot/disk.h>
+#include <boot/zimage.h>
+
+#define ZHDR		((zimage_hdr *) 0x10000) // scratch space
+
+void
+stage2main(void)
+{
+	uint8_t *scratch = 0;
+	int i;
+
+	// read the header in the compressed image's first sector
+	readsects((uint8_t *) ZHDR, ZIMAGE_SECTOR, 1);
+	if (ZHDR->magic != ZIMAGE_MAGIC || ZHDR->nsegs > ZIMAGE_MAXSEGS)
+		goto bad;
+
+	// read compressed data in above everything we'll decompress into
+	for (i = 0; i < ZHDR->nsegs; i++) {
+		zimage_seg *s = &ZHDR->segs[i];
+		uint8_t *end = (uint8_t *) ((s->va & 0xFFFFFF) + s->memsz);
+		if (end > scratch)
+			scratch = end;
+	}
+	scratch = (uint8_t *) ROUNDUP((uint32_t) scratch, SECTSIZE);
+
+	for (i = 0; i < ZHDR->nsegs; i++) {
+		zimage_seg *s = &ZHDR->segs[i];
+		uint8_t *va = (uint8_t *) (s->va & 0xFFFFFF);
+		uint32_t sect = ZIMAGE_SECTOR + s->zoffset / SECTSIZE;
+		uint32_t nsect = (s->zsize + SECTSIZE - 1) / SECTSIZE;
+		uint8_t *p = scratch;
+
+		while (nsect > 0) {
+			uint32_t n = MIN(nsect, 255);
+			readsects(p, sect, n);
+			p += n * SECTSIZE;
+			sect += n;
+			nsect -= n;
+		}
+
+		if (lz4_decompress(va, scratch, s->zsize) != va + s->filesz)
+			goto bad;
+		for (p = va + s->filesz; p < va + s->memsz; p++)
+			*p = 0;
+	}
+
+	// The boot block stamped BOOTTIME_LOADED when it started us,
+	// but the kernel is only now loaded: restamp it, so the timeline
+	// charges reading and decompressing the kernel to "load kernel".
+	((uint64_t *) BOOTTIME_LOWMEM)[BOOTTIME_LOADED] = rdtsc();
+
+	// call the kernel's entry point; does not return!
+	((void (*)(void)) (ZHDR->entry & 0xFFFFFF))();
+
+bad:
+	outw(0x8A00, 0x8A00);
+	outw(0x8A00, 0x8E00);
+	while (1)
+		/* do nothing */;
+}
@@ -0,0 +1,87 @@
+/*
+ * Compressed kernel image format, and the LZ4 block decompressor for it.
+ * Shared by the second-stage boot loader (boot/stage2.c)
+ * and the host tool that builds the image (tools/mkzimage.c),
+ * so it depends on nothing but the uint8_t and uint32_t types.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+#ifndef PIOS_BOOT_ZIMAGE_H
+#define PIOS_BOOT_ZIMAGE_H
+
+// Disk layout of a compressed kernel disk image:
+//	sector 0:		boot block (boot/boot.S, boot/main.c)
+//	sectors 1-16:		second-stage loader ELF image (boot/stage2.c)
+//	sector 17 onwards:	compressed kernel image, laid out as below
+// The boot block loads stage2 as if it were the kernel,
+// and stage2 then loads the kernel from the compressed image.
+// ZIMAGE_SECTOR is repeated in kern/Makefrag.
+#define ZIMAGE_SECTOR	17
+
+#define ZIMAGE_MAGIC	0x5A4B4C34	// "4LKZ" in little endian
+#define ZIMAGE_MAXSEGS	8
+
+// One loadable segment of the kernel.
+// Its compressed data starts on a sector boundary within the image.
+typedef struct zimage_seg {
+	uint32_t va;		// Address to load the segment at
+	uint32_t filesz;	// Bytes of data it decompresses to
+	uint32_t memsz;		// Bytes it occupies, zero-filled past filesz
+	uint32_t zoffset;	// Byte offset of compressed data in image
+	uint32_t zsize;		// Bytes of compressed data (one LZ4 block)
+} zimage_seg;
+
+// Header in the first sector of the compressed image.
+typedef struct zimage_hdr {
+	uint32_t magic;		// Must equal ZIMAGE_MAGIC
+	uint32_t entry;		// Kernel entry point
+	uint32_t nsegs;		// Number of segs in use
+	zimage_seg segs[ZIMAGE_MAXSEGS];
+} zimage_hdr;
+
+
+// Decompress the LZ4 block of zsize bytes at src into dst,
+// returning a pointer just past the last byte written.
+// Each sequence is a token byte holding a literal count and match length,
+// either of which may continue in following bytes, then the literals,
+// then a 2-byte offset back to the match; the last has no match.
+// The input is trusted: it's our own kernel.
+static uint8_t *
+lz4_decompress(uint8_t *dst, const uint8_t *src, uint32_t zsize)
+{
+	const uint8_t *end = src + zsize;
+
+	while (src < end) {
+		uint32_t token = *src++;
+		uint32_t len = token >> 4;
+		uint8_t b;
+
+		// Copy literals
+		if (len == 15)
+			do {
+				b = *src++;
+				len += b;
+			} while (b == 255);
+		while (len-- > 0)
+			*dst++ = *src++;
+		if (src >= end)
+			break;		// last sequence: no match follows
+
+		// Copy the match; byte by byte, since it may overlap dst.
+		const uint8_t *match = dst - (src[0] | (src[1] << 8));
+		src += 2;
+		len = token & 15;
+		if (len == 15)
+			do {
+				b = *src++;
+				len += b;
+			} while (b == 255);
+		len += 4;		// minimum match length
+		while (len-- > 0)
+			*dst++ = *match++;
+	}
+	return dst;
+}
+
+#endif /* PIOS_BOOT_ZIMAGE_H */
@@ -14,6 +14,27 @@ V = @
 #
 # GCCPREFIX=''
 
+# Serial console line speed in baud.  The kernel defaults to 115200,
+# the fastest rate the 16550 UART supports; it must divide 115200 evenly.
+#
+# SERIAL_BAUD=115200
+
+# Size in bytes of the kernel's console input buffer; a power of 2.
+# Input that arrives while the buffer is full is dropped and counted.
+#
+# CONSBUFSIZE=4096
+
+# Kernel self-tests to run at boot (see kern/selftest.h): "all" by default,
+# as the grading scripts expect.  "fast" skips mem_check(), which touches
+# every free page; "none" skips them all.
+#
+# SELFTEST=fast
+
+# Uncomment to boot from an LZ4-compressed kernel image,
+# decompressed by a second-stage loader (boot/stage2.c).
+#
+# ZKERNEL=1
+
 # If the makefile cannot find your QEMU binary, uncomment the
 # following line and set it to the full path to QEMU.
 #
@@ -19,6 +19,7 @@
 #include <kern/console.h>
 
 #include <dev/kbd.h>
+#include <dev/pic.h>
 
 
 #define NO		0
@@ -117,6 +118,18 @@ static uint8_t *charcode[4] = {
 	ctlmap
 };
 
+// Without an i8042 controller, as on some machines and emulators,
+// the status port floats at 0xFF and seems always to have data for us.
+#define KBD_MAXSTALE	32	// Most stale scan codes kbd_init() discards
+
+// Return true if the controller has a byte of input waiting.
+static bool
+kbd_ready(void)
+{
+	uint8_t stat = inb(KBSTATP);
+	return stat != 0xFF && (stat & KBS_DIB);
+}
+
 /*
  * Get data from the keyboard.  If we finish a character, return it.  Else 0.
  * Return -1 if no data.
@@ -128,7 +141,7 @@ kbd_proc_data(void)
 	uint8_t data;
 	static uint32_t shift;
 
-	if ((inb(KBSTATP) & KBS_DIB) == 0)
+	if (!kbd_ready())
 		return -1;
 
 	data = inb(KBDATAP);
@@ -172,12 +185,29 @@ kbd_proc_data(void)
 void
 kbd_intr(void)
 {
+	uint32_t eflags = read_eflags();
+	cli();
 	cons_intr(kbd_proc_data);
+	write_eflags(eflags);
 }
 
 void
 kbd_init(void)
 {
+	// Discard anything typed before we were ready for it,
+	// but no more than the controller could have buffered.
+	int i;
+	for (i = 0; i < KBD_MAXSTALE && kbd_ready(); i++)
+		(void) inb(KBDATAP);
+}
+
+void
+kbd_intenable(void)
+{
+	pic_enable(IRQ_KBD);
+
+	// Pick up any key pressed since kbd_init().
+	kbd_intr();
 }
 
 
@@ -0,0 +1,113 @@
+/*
+ * Driver code for the x86 local APIC, found on every processor.
+ *
+ * Copyright (C) 1997 Massachusetts Institute of Technology
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Derived from the MIT Exokernel and JOS.
+ * Adapted for PIOS by Bryan Ford at Yale University.
+ */
+
+#include <inc/assert.h>
+#include <inc/trap.h>
+#include <inc/x86.h>
+
+#include <dev/lapic.h>
+
+
+// Local APIC registers, divided by 4 for use as uint32_t[] indices.
+#define ID      (0x0020/4)   // ID
+#define VER     (0x0030/4)   // Version
+#define TPR     (0x0080/4)   // Task Priority
+#define SVR     (0x00F0/4)   // Spurious Interrupt Vector
+	#define ENABLE     0x00000100   // Unit Enable
+#define ESR     (0x0280/4)   // Error Status
+#define ICRLO   (0x0300/4)   // Interrupt Command
+	#define INIT       0x00000500   // INIT/RESET
+	#define STARTUP    0x00000600   // Startup IPI
+	#define DELIVS     0x00001000   // Delivery status
+	#define ASSERT     0x00004000   // Assert interrupt (vs deassert)
+	#define DEASSERT   0x00000000
+	#define LEVEL      0x00008000   // Level triggered
+	#define OTHERS     0x000C0000   // Send to all APICs but self
+#define ICRHI   (0x0310/4)   // Interrupt Command [63:32]
+#define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
+	#define MASKED     0x00010000   // Interrupt masked
+
+volatile uint32_t *lapic;
+
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+	lapic[ID];  // wait for write to finish, by reading
+}
+
+// Spin for roughly the given number of microseconds.
+// Each access to the unused POST port 0x84 takes about a microsecond.
+static void
+microdelay(int us)
+{
+	while (us-- > 0)
+		inb(0x84);
+}
+
+// Send an interprocessor interrupt and wait for it to be delivered.
+static void
+lapic_ipi(uint32_t cmd)
+{
+	lapicw(ICRHI, 0);
+	lapicw(ICRLO, cmd);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
+
+void
+lapic_init(void)
+{
+	if (!lapic) 
+		return;
+
+	// Enable local APIC; set spurious interrupt vector.
+	lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+
+	// We don't use the APIC timer yet.
+	lapicw(TIMER, MASKED);
+
+	// Clear error status register (requires back-to-back writes).
+	lapicw(ESR, 0);
+	lapicw(ESR, 0);
+
+	// Accept all interrupts.
+	lapicw(TPR, 0);
+}
+
+int
+lapic_id(void)
+{
+	if (!lapic)
+		return 0;
+	return lapic[ID] >> 24;
+}
+
+void
+lapic_startaps(uint32_t addr)
+{
+	assert(lapic && (addr & 0xFFF00FFF) == 0);
+
+	// The "universal startup algorithm" of the MP specification,
+	// but broadcast to all other processors rather than sent
+	// to each in turn: an INIT to reset them, a 10ms wait,
+	// then two STARTUP IPIs giving the page to start at.
+	lapic_ipi(OTHERS | INIT | LEVEL | ASSERT);
+	microdelay(200);
+	lapic_ipi(OTHERS | INIT | LEVEL | DEASSERT);
+	microdelay(10000);
+
+	int i;
+	for (i = 0; i < 2; i++) {
+		lapic_ipi(OTHERS | STARTUP | (addr >> 12));
+		microdelay(200);
+	}
+}
@@ -0,0 +1,36 @@
+/*
+ * Driver code for the x86 local APIC, found on every processor.
+ *
+ * Copyright (C) 1997 Massachusetts Institute of Technology
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Derived from the MIT Exokernel and JOS.
+ * Adapted for PIOS by Bryan Ford at Yale University.
+ */
+
+#ifndef PIOS_DEV_LAPIC_H
+#define PIOS_DEV_LAPIC_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+
+// Physical address of the local APIC registers, set by mp_init().
+// NULL on uniprocessors without an MP configuration table.
+extern volatile uint32_t *lapic;
+
+// Enable the current CPU's local APIC.
+// Device interrupts keep coming through the 8259A PIC to the boot CPU:
+// we leave the LINT pins the way the BIOS set them up.
+void lapic_init(void);
+
+// Return the local APIC ID of the current CPU.
+int lapic_id(void);
+
+// Start every other processor at once, running the real-mode code
+// at physical address 'addr', which must be page-aligned below 1MB.
+void lapic_startaps(uint32_t addr);
+
+#endif // !PIOS_DEV_LAPIC_H
@@ -0,0 +1,33 @@
+/*
+ * Driver code for the 8259A Programmable Interrupt Controller (PIC).
+ *
+ * Copyright (C) 1997 Massachusetts Institute of Technology
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Derived from the MIT Exokernel and JOS.
+ * Adapted for PIOS by Bryan Ford at Yale University.
+ */
+
+#ifndef PIOS_DEV_PIC_H
+#define PIOS_DEV_PIC_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+
+#define MAX_IRQS	16	// Number of IRQs
+
+// I/O Addresses of the two 8259A programmable interrupt controllers
+#define IO_PIC1		0x20	// Master (IRQs 0-7)
+#define IO_PIC2		0xA0	// Slave (IRQs 8-15)
+
+#define IRQ_SLAVE	2	// IRQ at which slave connects to master
+
+
+void pic_init(void);
+void pic_setmask(uint16_t mask);
+void pic_enable(int irq);
+
+#endif // !PIOS_DEV_PIC_H
@@ -17,9 +17,45 @@
 #include <kern/console.h>
 
 #include <dev/serial.h>
+#include <dev/pic.h>
 
 
 bool serial_exists;
+uint32_t serial_overruns;
+
+// Output queue, drained into the UART's transmit FIFO
+// a FIFO's worth at a time from the transmit-buffer-empty interrupt,
+// so that serial_putc() never has to wait for the line.
+#define SERIAL_TXBUFSIZE	4096	// must be a power of two
+
+static struct {
+	uint8_t buf[SERIAL_TXBUFSIZE];
+	uint32_t rpos;		// next byte to transmit
+	uint32_t wpos;		// next free slot
+} serial_tx;
+
+static uint8_t serial_ier;	// current contents of COM_IER
+static int serial_rxavail;	// bytes known to be in the receive FIFO
+static bool serial_txsync;	// bypass the queue (set on panic)
+
+// Whichever CPU is draining the console log calls serial_putc(),
+// while the boot CPU takes the UART's interrupts,
+// so the queue and the UART registers are guarded by this lock.
+// Holders keep interrupts off, so they never wait on their own CPU.
+static volatile uint32_t serial_locked;
+
+static void
+serial_lock(void)
+{
+	while (xchg(&serial_locked, 1) != 0)
+		pause();
+}
+
+static void
+serial_unlock(void)
+{
+	xchg(&serial_locked, 0);
+}
 
 
 // Stupid I/O delay routine necessitated by historical PC design flaws
@@ -32,19 +68,107 @@ delay(void)
 	inb(0x84);
 }
 
+// Bytes counted in serial_rxavail are read without polling COM_LSR first,
+// which halves the port I/O per byte for the bulk of a receive burst.
 static int
 serial_proc_data(void)
 {
-	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+	if (serial_rxavail > 0)
+		serial_rxavail--;
+	else if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
 		return -1;
 	return inb(COM1+COM_RX);
 }
 
+// Busy-wait (for a bounded time) until the transmit FIFO is empty.
+static void
+serial_txwait(void)
+{
+	int i;
+	for (i = 0;
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+	     i++)
+		delay();
+}
+
+// If the transmit FIFO is empty, refill it from the output queue,
+// then arm the transmit interrupt only if more output remains queued.
+// Must be called with interrupts disabled.
+// Returns false if the transmitter wasn't ready for more data.
+static bool
+serial_txkick(void)
+{
+	bool ready = (inb(COM1+COM_LSR) & COM_LSR_TXRDY) != 0;
+	int n;
+
+	if (ready)
+		for (n = 0; n < COM_FIFOSIZE && serial_tx.rpos != serial_tx.wpos;
+				n++)
+			outb(COM1+COM_TX, serial_tx.buf[serial_tx.rpos++
+						% SERIAL_TXBUFSIZE]);
+
+	uint8_t ier = serial_ier & ~COM_IER_TXRDY;
+	if (serial_tx.rpos != serial_tx.wpos)
+		ier |= COM_IER_TXRDY;
+	if (ier != serial_ier)
+		outb(COM1+COM_IER, serial_ier = ier);
+	return ready;
+}
+
+// Synchronously push out everything in the output queue.
+// Must be called with interrupts disabled.
+static void
+serial_txflush(void)
+{
+	while (serial_tx.rpos != serial_tx.wpos) {
+		serial_txwait();
+		if (!serial_txkick())
+			serial_tx.rpos = serial_tx.wpos;  // stuck: give up
+	}
+}
+
 void
 serial_intr(void)
 {
-	if (serial_exists)
-		cons_intr(serial_proc_data);
+	if (!serial_exists)
+		return;
+
+	uint32_t eflags = read_eflags();
+	cli();
+	serial_lock();
+
+	// Service every cause the UART has pending,
+	// emptying the whole receive FIFO for each receive interrupt.
+	uint8_t iir;
+	while (!((iir = inb(COM1+COM_IIR)) & COM_IIR_NOPEND)) {
+		switch (iir & COM_IIR_ID) {
+		case COM_IIR_RXRDY:	// at least COM_RXTRIGGER bytes waiting
+			serial_rxavail = COM_RXTRIGGER;
+			cons_intr(serial_proc_data);
+			break;
+		case COM_IIR_RLS:	// reading COM_LSR clears this one
+			if (inb(COM1+COM_LSR) & COM_LSR_OE)
+				serial_overruns++;
+			/* fallthru */
+		case COM_IIR_RXTOUT:
+			cons_intr(serial_proc_data);
+			break;
+		case COM_IIR_TXRDY:
+			serial_txkick();
+			break;
+		default:		// modem status change: just clear it
+			(void) inb(COM1+COM_MSR);
+			break;
+		}
+	}
+
+	// When polled rather than interrupted, the transmitter
+	// may be idle with output queued and no interrupt armed.
+	if (!(serial_ier & COM_IER_TXRDY))
+		serial_txkick();
+
+	serial_unlock();
+	write_eflags(eflags);
 }
 
 void
@@ -53,33 +177,65 @@ serial_putc(int c)
 	if (!serial_exists)
 		return;
 
-	int i;
-	for (i = 0;
-	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
-	     i++)
-		delay();
-	
-	outb(COM1 + COM_TX, c);
+	uint32_t eflags = read_eflags();
+	cli();
+	serial_lock();
+
+	// If the queue is full, wait for the transmitter to make room;
+	// if it never does, drop the oldest byte rather than hang.
+	if (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+		serial_txwait();
+		if (!serial_txkick())
+			serial_tx.rpos++;
+	}
+	serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = c;
+
+	// Unless an armed transmit interrupt will get to it shortly,
+	// start the transmitter ourselves.
+	if (serial_txsync)
+		serial_txflush();
+	else if (!(serial_ier & COM_IER_TXRDY) || !(eflags & FL_IF))
+		serial_txkick();
+
+	serial_unlock();
+	write_eflags(eflags);
+}
+
+void
+serial_sync(void)
+{
+	if (!serial_exists)
+		return;
+
+	uint32_t eflags = read_eflags();
+	cli();
+	serial_lock();
+	serial_txsync = 1;
+	serial_txflush();
+	serial_unlock();
+	write_eflags(eflags);
 }
 
 void
 serial_init(void)
 {
-	// Turn off the FIFO
-	outb(COM1+COM_FCR, 0);
+	// Turn on and clear the FIFOs
+	outb(COM1+COM_FCR, COM_FCR_ENABLE | COM_FCR_RCV_RESET
+			| COM_FCR_XMT_RESET | COM_FCR_TRIGGER_14);
 	
 	// Set speed; requires DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_DLAB);
-	outb(COM1+COM_DLL, (uint8_t) (115200 / 9600));
-	outb(COM1+COM_DLM, 0);
+	outb(COM1+COM_DLL, (uint8_t) (COM_BAUDBASE / SERIAL_BAUD));
+	outb(COM1+COM_DLM, (uint8_t) ((COM_BAUDBASE / SERIAL_BAUD) >> 8));
 
 	// 8 data bits, 1 stop bit, parity off; turn off DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_WLEN8 & ~COM_LCR_DLAB);
 
 	// No modem controls
 	outb(COM1+COM_MCR, 0);
-	// Enable rcv interrupts
-	outb(COM1+COM_IER, COM_IER_RDI);
+	// Enable rcv interrupts, and line status ones to hear of overruns
+	serial_ier = COM_IER_RDI | COM_IER_RLSI;
+	outb(COM1+COM_IER, serial_ier);
 
 	// Clear any preexisting overrun indications and interrupts
 	// Serial port doesn't exist if COM_LSR returns 0xFF
@@ -88,4 +244,17 @@ serial_init(void)
 	(void) inb(COM1+COM_RX);
 }
 
+void
+serial_intenable(void)
+{
+	if (!serial_exists)
+		return;
+
+	// OUT2 connects the UART's interrupt output to IRQ 4 on the PC.
+	outb(COM1+COM_MCR, COM_MCR_OUT2);
+	pic_enable(IRQ_SERIAL);
+
+	// Catch up on anything that arrived or queued up before now.
+	serial_intr();
+}
 
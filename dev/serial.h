@@ -28,8 +28,21 @@
 #define COM_DLM		1	// Out: Divisor Latch High (DLAB=1)
 #define COM_IER		1	// Out: Interrupt Enable Register
 #define   COM_IER_RDI	0x01	//   Enable receiver data interrupt
+#define   COM_IER_TXRDY	0x02	//   Enable transmit buffer empty interrupt
+#define   COM_IER_RLSI	0x04	//   Enable receiver line status interrupt
 #define COM_IIR		2	// In:	Interrupt ID Register
+#define   COM_IIR_NOPEND	0x01	//   No interrupt pending
+#define   COM_IIR_ID		0x0E	//   Interrupt ID mask:
+#define   COM_IIR_MLSC		0x00	//     Modem status change
+#define   COM_IIR_TXRDY		0x02	//     Transmit buffer empty
+#define   COM_IIR_RXRDY		0x04	//     Receive FIFO at trigger level
+#define   COM_IIR_RLS		0x06	//     Receiver line status
+#define   COM_IIR_RXTOUT	0x0C	//     Receive timeout, FIFO not empty
 #define COM_FCR		2	// Out: FIFO Control Register
+#define   COM_FCR_ENABLE	0x01	//   Enable the FIFOs
+#define   COM_FCR_RCV_RESET	0x02	//   Clear the receive FIFO
+#define   COM_FCR_XMT_RESET	0x04	//   Clear the transmit FIFO
+#define   COM_FCR_TRIGGER_14	0xC0	//   Receive interrupt at 14 bytes
 #define COM_LCR		3	// Out: Line Control Register
 #define	  COM_LCR_DLAB	0x80	//   Divisor latch access bit
 #define	  COM_LCR_WLEN8	0x03	//   Wordlength: 8 bits
@@ -39,15 +52,38 @@
 #define	  COM_MCR_OUT2	0x08	// Out2 complement
 #define COM_LSR		5	// In:	Line Status Register
 #define   COM_LSR_DATA	0x01	//   Data available
+#define   COM_LSR_OE	0x02	//   Overrun error: received data lost
 #define   COM_LSR_TXRDY	0x20	//   Transmit buffer avail
 #define   COM_LSR_TSRE	0x40	//   Transmitter off
+#define COM_MSR		6	// In:	Modem Status Register
+
+#define COM_FIFOSIZE	16	// Bytes the 16550's transmit FIFO holds
+#define COM_RXTRIGGER	14	// Receive FIFO level for COM_FCR_TRIGGER_14
+
+// The divisor latch counts down from a 115200 baud clock,
+// so that is the fastest rate a standard 16550 (or QEMU's) can run.
+#define COM_BAUDBASE	115200
+
+// Line speed: override with SERIAL_BAUD in conf/env.mk.
+// Must divide COM_BAUDBASE evenly.
+#ifndef SERIAL_BAUD
+#define SERIAL_BAUD	115200
+#endif
+#if COM_BAUDBASE % SERIAL_BAUD != 0
+# error "SERIAL_BAUD must evenly divide COM_BAUDBASE"
+#endif
 
 
 extern bool serial_exists;
+extern uint32_t serial_overruns;	// Times the receive FIFO overflowed
 
 void serial_init(void);
 void serial_putc(int c);
 void serial_intenable(void);
 void serial_intr(void); // irq 4
 
+// Flush any queued output and write all further output synchronously.
+// Used on panic, when interrupts may never drain the queue.
+void serial_sync(void);
+
 #endif /* PIOS_KERN_SERIAL_H_ */
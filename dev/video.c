@@ -12,6 +12,7 @@
  */
 
 #include <inc/string.h>
+#include <inc/gcc.h>
 
 #include <kern/mem.h>
 
@@ -19,15 +20,40 @@
 
 
 static unsigned addr_6845;
-static uint16_t *crt_buf;
-static uint16_t crt_pos;
+static uint16_t *crt_hwbuf;	// memory-mapped text display buffer
+static uint16_t *crt_buf;	// shadow of crt_hwbuf that we write into
+static uint16_t crt_pos;	// cursor position, relative to crt_buf
+static uint16_t crt_start;	// first cell shown on the screen
+static uint16_t crt_hwstart;	// crt_start as last given to the 6845
+static uint16_t crt_bufsize;	// cells of text memory we can scroll over
+
+// Display writes go to this RAM shadow first: under virtualization
+// every store to video memory is expensive, so we track the range of
+// cells changed since the last flush and copy it over in bulk.
+// Aligned like text memory itself, so that once video_update()
+// widens a copy to whole words, both ends of it are word-aligned.
+static uint16_t crt_shadow[CGA_BUFSIZE] gcc_aligned(64);
+static uint16_t crt_dirtylo;	// first changed cell
+static uint16_t crt_dirtyhi;	// one past the last changed cell
+
+static void video_scroll(void);
+
+// Note that cells [lo,hi) of crt_buf need copying to crt_hwbuf.
+static inline void
+video_dirty(uint16_t lo, uint16_t hi)
+{
+	if (lo < crt_dirtylo)
+		crt_dirtylo = lo;
+	if (hi > crt_dirtyhi)
+		crt_dirtyhi = hi;
+}
 
 void
 video_init(void)
 {
 	volatile uint16_t *cp;
 	uint16_t was;
-	unsigned pos;
+	unsigned pos, start;
 
 	/* Get a pointer to the memory-mapped text display buffer. */
 	cp = (uint16_t*) mem_ptr(CGA_BUF);
@@ -36,9 +62,11 @@ video_init(void)
 	if (*cp != 0xA55A) {
 		cp = (uint16_t*) mem_ptr(MONO_BUF);
 		addr_6845 = MONO_BASE;
+		crt_bufsize = CRT_SIZE;		// no room to scroll in
 	} else {
 		*cp = was;
 		addr_6845 = CGA_BASE;
+		crt_bufsize = CGA_BUFSIZE;
 	}
 	
 	/* Extract cursor location */
@@ -47,14 +75,31 @@ video_init(void)
 	outb(addr_6845, 15);
 	pos |= inb(addr_6845 + 1);
 
-	crt_buf = (uint16_t*) cp;
+	/* Extract display start address */
+	outb(addr_6845, 12);
+	start = inb(addr_6845 + 1) << 8;
+	outb(addr_6845, 13);
+	start |= inb(addr_6845 + 1);
+	if (start + CRT_SIZE > crt_bufsize || pos < start
+			|| pos >= start + CRT_SIZE)
+		start = pos = 0;	// not a state we left: start over
+
+	crt_hwbuf = (uint16_t*) cp;
+	crt_buf = crt_shadow;
+	memmove(crt_buf, crt_hwbuf, crt_bufsize * sizeof(uint16_t));
+	crt_dirtylo = crt_bufsize;
+	crt_dirtyhi = 0;
+
 	crt_pos = pos;
+	crt_start = crt_hwstart = start;
 }
 
 
 
-void
-video_putc(int c)
+// Store one character in the display buffer,
+// scrolling if necessary, but without moving the hardware cursor.
+static void
+video_emit(int c)
 {
 	// if no attribute given, then use black on white
 	if (!(c & ~0xFF))
@@ -62,39 +107,86 @@ video_putc(int c)
 
 	switch (c & 0xff) {
 	case '\b':
-		if (crt_pos > 0) {
+		if (crt_pos > crt_start) {
 			crt_pos--;
 			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+			video_dirty(crt_pos, crt_pos + 1);
 		}
 		break;
 	case '\n':
 		crt_pos += CRT_COLS;
 		/* fallthru */
 	case '\r':
-		crt_pos -= (crt_pos % CRT_COLS);
+		crt_pos -= ((crt_pos - crt_start) % CRT_COLS);
 		break;
 	case '\t': {
-		/*The following loop was earlier implemented as 5 consecutive calls to video_putc(). This just seemed so wrong that I fixed it, adding a constant for storing a customisable tab width.*/
+		// Expand to TAB_SIZE spaces in place.
 		int i;
-		for (i=0;i<TAB_SIZE;i=i+1) { 
-			video_putc(' ');
+		for (i = 0; i < TAB_SIZE; i++) {
+			video_dirty(crt_pos, crt_pos + 1);
+			crt_buf[crt_pos++] = (c & ~0xff) | ' ';
+			video_scroll();
 		}
 		break;
 	}
 	default:
+		video_dirty(crt_pos, crt_pos + 1);
 		crt_buf[crt_pos++] = c;		/* write the character */
 		break;
 	}
 
-	// What is the purpose of this?
-	if (crt_pos >= CRT_SIZE) {
+	video_scroll();
+}
+
+// Scroll the display up a line once output runs off the bottom.
+// We scroll by moving the 6845's display start address down through
+// text memory, and only copy the screen back to the beginning
+// when the window reaches the end of text memory.
+static void
+video_scroll(void)
+{
+	if (crt_pos >= crt_start + CRT_SIZE) {
 		int i;
 
-		memmove(crt_buf, crt_buf + CRT_COLS,
-			(CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
-		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+		if (crt_start + CRT_SIZE + CRT_COLS <= crt_bufsize)
+			crt_start += CRT_COLS;
+		else {
+			memmove(crt_buf, crt_buf + crt_start + CRT_COLS,
+				(CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+			crt_pos -= crt_start + CRT_COLS;
+			crt_start = 0;
+			video_dirty(0, CRT_SIZE);
+		}
+		for (i = crt_start + CRT_SIZE - CRT_COLS;
+				i < crt_start + CRT_SIZE; i++)
 			crt_buf[i] = 0x0700 | ' ';
-		crt_pos -= CRT_COLS;
+		video_dirty(crt_start + CRT_SIZE - CRT_COLS,
+				crt_start + CRT_SIZE);
+	}
+}
+
+// Copy changed cells to video memory, then move the display window
+// to crt_start if we've scrolled and the hardware cursor to crt_pos.
+// Each outb is a VM exit when virtualized, so do this once per write.
+static void
+video_update(void)
+{
+	if (crt_dirtylo < crt_dirtyhi) {
+		// Widen to whole 32-bit words so memmove can use movsl.
+		uint16_t lo = crt_dirtylo & ~1;
+		uint16_t hi = MIN((crt_dirtyhi + 1) & ~1, crt_bufsize);
+		memmove(crt_hwbuf + lo, crt_buf + lo,
+			(hi - lo) * sizeof(uint16_t));
+		crt_dirtylo = crt_bufsize;
+		crt_dirtyhi = 0;
+	}
+
+	if (crt_start != crt_hwstart) {
+		outb(addr_6845, 12);
+		outb(addr_6845 + 1, crt_start >> 8);
+		outb(addr_6845, 13);
+		outb(addr_6845 + 1, crt_start);
+		crt_hwstart = crt_start;
 	}
 
 	/* move that little blinky thing */
@@ -104,4 +196,18 @@ video_putc(int c)
 	outb(addr_6845 + 1, crt_pos);
 }
 
+void
+video_putc(int c)
+{
+	video_emit(c);
+	video_update();
+}
+
+void
+video_write(const char *s, size_t len)
+{
+	while (len-- > 0)
+		video_emit(*(const uint8_t *) s++);
+	video_update();
+}
 
@@ -25,6 +25,7 @@
 #define MONO_BUF	0xB0000
 #define CGA_BASE	0x3D4
 #define CGA_BUF		0xB8000
+#define CGA_BUFSIZE	16384	// 32KB of color text memory, in cells
 
 #define CRT_ROWS	25
 #define CRT_COLS	80
@@ -36,4 +37,7 @@
 void video_init(void);
 void video_putc(int c);
 
+// Write a string of 'len' characters, then update the cursor just once.
+void video_write(const char *s, size_t len);
+
 #endif /* PIOS_KERN_VIDEO_H_ */
@@ -22,6 +22,7 @@
 #define SYS_RET		0x00000003	// Return to parent
 
 #define SYS_START	0x00000010	// Put: start child running
+#define SYS_RING	0x00000100	// Run the submission ring at EBX instead
 
 #define SYS_REGS	0x00001000	// Get/put register state
 #define SYS_FPU		0x00002000	// Get/put FPU state
@@ -43,6 +44,20 @@
 //	EBP:	reserved
 
 
+// Register conventions for the SYS_RING system call:
+//	EAX:	SYS_RING (the SYS_TYPE bits are ignored)
+//	EBX:	User pointer to the caller's sysring, or NULL to unregister
+// The kernel runs every request queued in the ring's submission queue,
+// in order, and posts one completion entry per request.
+// If the ring's flags include SYS_RING_POLL, the kernel also remembers
+// the ring and drains it again on each later system call,
+// and on each device interrupt taken while in user mode,
+// so the process can keep queueing requests without trapping itself.
+// The ring must lie entirely within the user address space.
+#define SYS_RING_SIZE	64	// Entries per queue; must be a power of two
+#define SYS_RING_POLL	0x0001	// sysring.flags: kernel polls the ring
+
+
 #ifndef __ASSEMBLER__
 
 // CPU state save area format for GET/PUT with SYS_REGS flags
@@ -51,6 +66,37 @@ typedef struct cpustate {
 	fxsave		fx;		// x87/MMX/XMM registers
 } cpustate;
 
+// One queued system call, in the same register image
+// the corresponding trap-based system call would take.
+typedef struct sysreq {
+	uint32_t	eax;		// System call command/flags (SYS_*)
+	uint32_t	ebx;
+	uint32_t	ecx;
+	uint32_t	edx;
+	uint32_t	esi;
+	uint32_t	edi;
+	uint32_t	tag;		// Opaque to the kernel; echoed in syscomp
+} sysreq;
+
+// Completion entry the kernel posts for each request it has run.
+typedef struct syscomp {
+	uint32_t	tag;		// Tag from the corresponding sysreq
+	int32_t		status;		// 0 on success, -1 if not performed
+} syscomp;
+
+// Shared submission/completion ring.
+// The process owns sq_tail and cq_head; the kernel owns sq_head and cq_tail.
+// Indexes increase freely and are reduced mod SYS_RING_SIZE on access.
+typedef struct sysring {
+	volatile uint32_t sq_head;	// Next request the kernel will run
+	volatile uint32_t sq_tail;	// Next free submission slot
+	volatile uint32_t cq_head;	// Next completion the process will read
+	volatile uint32_t cq_tail;	// Next free completion slot
+	uint32_t	flags;		// SYS_RING_* flags
+	sysreq		sq[SYS_RING_SIZE];
+	syscomp		cq[SYS_RING_SIZE];
+} sysring;
+
 
 // Prototypes for user-level syscalls stubs defined in lib/syscall.c
 void sys_cputs(const char *s);
@@ -59,6 +105,7 @@ void sys_put(uint32_t flags, uint16_t child, cpustate *cpu,
 void sys_get(uint32_t flags, uint16_t child, cpustate *cpu,
 		void *childsrc, void *localdest, size_t size);
 void sys_ret(void);
+void sys_ring(sysring *ring);
 
 #endif /* !__ASSEMBLER__ */
 
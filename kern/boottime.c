@@ -0,0 +1,109 @@
+/*
+ * Boot timeline profiling: TSC stamps taken at each phase of booting.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#include <inc/stdio.h>
+#include <inc/x86.h>
+
+#include <kern/boottime.h>
+
+
+#define BOOTTIME_MAX	16	// Most phases we keep stamps for
+
+// i8254 programmable interval timer, channel 2, used for calibration
+#define PIT_FREQ	1193182	// Input clock rate in Hz
+#define PIT_CNTR2	0x42	// Channel 2 counter
+#define PIT_MODE	0x43	// Mode/command register
+#define   PIT_SEL2	0x80	//   Select channel 2
+#define   PIT_16BIT	0x30	//   Write low then high counter byte
+#define PIT_PORTB	0x61	// Keyboard controller port B
+#define   PORTB_GATE2	0x01	//   Channel 2 gate
+#define   PORTB_SPKR	0x02	//   Speaker enable
+#define   PORTB_OUT2	0x20	//   Channel 2 output (read only)
+
+static struct {
+	const char *phase;	// Phase that ended at this time
+	uint64_t tsc;
+} boottimes[BOOTTIME_MAX];
+static int nboottimes;
+
+
+void
+boottime_init(void)
+{
+	static const char *lowphases[BOOTTIME_NLOWMEM] = {
+		[BOOTTIME_LOADER] = "bootmain",
+		[BOOTTIME_LOADED] = "load kernel",
+		[BOOTTIME_ENTRY] = "enter kernel",
+	};
+	volatile uint64_t *low = (uint64_t *) BOOTTIME_LOWMEM;
+	int i;
+
+	// Anything but our own boot loader (e.g., GRUB) leaves
+	// whatever it likes in the loader's slots: believe them only
+	// if they're nonzero and in order.
+	for (i = 0; i < BOOTTIME_NLOWMEM; i++) {
+		if (i < BOOTTIME_ENTRY && (low[i] == 0
+				|| low[i] > low[i+1]
+				|| low[i+1] > low[BOOTTIME_ENTRY]))
+			continue;
+		boottimes[nboottimes].phase = lowphases[i];
+		boottimes[nboottimes].tsc = low[i];
+		nboottimes++;
+	}
+	boottime_mark("BSS clear");
+}
+
+void
+boottime_mark(const char *phase)
+{
+	if (nboottimes == BOOTTIME_MAX)
+		return;
+	boottimes[nboottimes].phase = phase;
+	boottimes[nboottimes].tsc = rdtsc();
+	nboottimes++;
+}
+
+// Count TSC ticks over 10ms timed by PIT channel 2,
+// and return the TSC rate in ticks per microsecond.
+static uint64_t
+boottime_calibrate(void)
+{
+	uint32_t latch = PIT_FREQ / 100;
+	uint64_t t0, t1;
+
+	// Gate channel 2 on with the speaker off, and count down once.
+	outb(PIT_PORTB, (inb(PIT_PORTB) & ~PORTB_SPKR) | PORTB_GATE2);
+	outb(PIT_MODE, PIT_SEL2 | PIT_16BIT);	// mode 0: one shot
+	outb(PIT_CNTR2, latch & 0xff);
+	outb(PIT_CNTR2, latch >> 8);
+
+	t0 = rdtsc();
+	while (!(inb(PIT_PORTB) & PORTB_OUT2))
+		/* do nothing */;
+	t1 = rdtsc();
+
+	if (t1 - t0 < 10000)
+		return 1;	// unreasonably slow: avoid dividing by zero
+	return (t1 - t0) / 10000;
+}
+
+void
+boottime_print(void)
+{
+	uint64_t perus = boottime_calibrate();
+	uint64_t t0 = boottimes[0].tsc;
+	int i;
+
+	cprintf("Boot timeline (TSC at %llu MHz):\n", perus);
+	cprintf("   time (us)  phase (us)\n");
+	for (i = 0; i < nboottimes; i++) {
+		uint64_t t = boottimes[i].tsc;
+		uint64_t prev = i > 0 ? boottimes[i-1].tsc : t;
+		cprintf("%12llu  %10llu  %s\n", (t - t0) / perus,
+			(t - prev) / perus, boottimes[i].phase);
+	}
+}
@@ -0,0 +1,41 @@
+/*
+ * Boot timeline profiling: TSC stamps taken at each phase of booting.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#ifndef PIOS_KERN_BOOTTIME_H
+#define PIOS_KERN_BOOTTIME_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+// The boot loader and kern/entry.S can't use the kernel's table,
+// since the BSS it lives in doesn't exist yet or is about to be cleared,
+// so they leave their 64-bit stamps in these slots in free low memory,
+// just past the boot block (and, unlike the first page, not an address
+// gcc would take for a null pointer dereference).
+#define BOOTTIME_LOWMEM		0x8000
+#define BOOTTIME_LOADER		0	// bootmain() started
+#define BOOTTIME_LOADED		1	// kernel loaded: bootmain(), or stage2
+					// with ZKERNEL, jumped to the kernel
+#define BOOTTIME_ENTRY		2	// kernel started at entry.S's start
+#define BOOTTIME_NLOWMEM	3
+
+#ifndef __ASSEMBLER__
+
+// Start the table with the stamps left in low memory.
+// Called on the boot CPU as soon as the BSS has been cleared.
+void boottime_init(void);
+
+// Note that the named boot phase has just finished.  Boot CPU only.
+void boottime_mark(const char *phase);
+
+// Print the timeline so far, in microseconds by a TSC calibrated
+// against the PIT; the calibration takes about 10ms.
+void boottime_print(void);
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !PIOS_KERN_BOOTTIME_H */
@@ -29,7 +29,6 @@
 #include <dev/serial.h>
 
 void cons_intr(int (*proc)(void));
-static void cons_putc(int c);
 
 
 /***** General device-independent console code *****/
@@ -37,17 +36,34 @@ static void cons_putc(int c);
 // where we stash characters received from the keyboard or serial port
 // whenever the corresponding interrupt occurs.
 
-#define CONSBUFSIZE 512
+// The buffer is a single-producer, single-consumer ring.
+// The producer is whatever device code is feeding input through cons_intr(),
+// always with interrupts disabled on the boot CPU, which gets all device
+// interrupts and is the only one that polls; so producers never overlap.
+// Readers must take turns among themselves, e.g., by being the one
+// process that owns the console.  Neither side takes a lock.
+#ifndef CONSBUFSIZE
+#define CONSBUFSIZE	4096	// Override with CONSBUFSIZE in conf/env.mk
+#endif
+#if CONSBUFSIZE & (CONSBUFSIZE-1)
+# error "CONSBUFSIZE must be a power of 2"
+#endif
 
 static struct {
 	uint8_t buf[CONSBUFSIZE];
-	uint32_t rpos;
-	uint32_t wpos;
+	volatile uint32_t rpos;		// Bytes ever read; only readers write
+	volatile uint32_t wpos;		// Bytes ever stored; only cons_intr
+	uint32_t dropped;		// Bytes discarded because buf was full
+	uint32_t dropreported;		// Value of dropped last warned about
+	uint32_t overreported;		// Likewise for serial_overruns
 } cons;
 
+static bool cons_intenabled;	// Input arrives by interrupt, not polling
+
 
 // called by device interrupt routines to feed input characters
 // into the circular console input buffer.
+// When it's full we drop new input rather than overwrite unread input.
 void
 cons_intr(int (*proc)(void))
 {
@@ -56,40 +72,129 @@ cons_intr(int (*proc)(void))
 	while ((c = (*proc)()) != -1) {
 		if (c == 0)
 			continue;
-		cons.buf[cons.wpos++] = c;
-		if (cons.wpos == CONSBUFSIZE)
-			cons.wpos = 0;
+		uint32_t wpos = cons.wpos;
+		if (wpos - cons.rpos == CONSBUFSIZE) {
+			cons.dropped++;
+			continue;
+		}
+		cons.buf[wpos & (CONSBUFSIZE-1)] = c;
+
+		// Release: x86 doesn't reorder stores with other stores,
+		// so once the compiler puts the byte first,
+		// a reader that sees the new wpos sees the byte.
+		asm volatile("" ::: "memory");
+		cons.wpos = wpos + 1;
+	}
+}
+
+// Let the reader know if input has been lost since it last looked.
+static void
+cons_checkdrops(void)
+{
+	uint32_t dropped = cons.dropped, overruns = serial_overruns;
+
+	if (dropped != cons.dropreported) {
+		warn("console input buffer full: %u bytes dropped",
+			dropped - cons.dropreported);
+		cons.dropreported = dropped;
+	}
+	if (overruns != cons.overreported) {
+		warn("serial receive FIFO overran %u times",
+			overruns - cons.overreported);
+		cons.overreported = overruns;
 	}
 }
 
-// return the next input character from the console, or 0 if none waiting
 int
-cons_getc(void)
+cons_read(char *buf, int n)
 {
-	int c;
+	if (n <= 0)
+		return 0;
 
-	// poll for any pending input characters,
-	// so that this function works even when interrupts are disabled
-	// (e.g., when called from the kernel monitor).
-	serial_intr();
-	kbd_intr();
-
-	// grab the next character from the input buffer.
-	if (cons.rpos != cons.wpos) {
-		c = cons.buf[cons.rpos++];
-		if (cons.rpos == CONSBUFSIZE)
-			cons.rpos = 0;
-		return c;
+	// Once the devices interrupt us, their handlers fill the buffer;
+	// until then, or while interrupts are disabled
+	// (e.g., when called from the kernel monitor), poll for input.
+	// Only the boot CPU reads input from the devices; output goes out
+	// from whichever CPU drains the log rings.  User code doesn't run on
+	// a kernel stack, so cpu_cur() won't work for it, but in lab 1
+	// it only ever runs on the boot CPU.
+	bool onboot = (read_cs() & 3) || cpu_onboot();
+	if ((!cons_intenabled || !(read_eflags() & FL_IF)) && onboot) {
+		serial_intr();
+		kbd_intr();
 	}
-	return 0;
+
+	// Acquire: the loads below are ordered after the load of wpos,
+	// and x86 doesn't reorder loads with other loads.
+	uint32_t rpos = cons.rpos;
+	uint32_t avail = cons.wpos - rpos;
+	asm volatile("" ::: "memory");
+
+	if ((uint32_t) n > avail)
+		n = avail;
+	if (n > 0) {
+		// Copy out in at most two pieces, split where the ring wraps.
+		uint32_t ofs = rpos & (CONSBUFSIZE-1);
+		uint32_t first = MIN(n, CONSBUFSIZE - ofs);
+		memmove(buf, cons.buf + ofs, first);
+		memmove(buf + first, cons.buf, n - first);
+
+		// Release: finish reading the bytes before freeing their space.
+		asm volatile("" ::: "memory");
+		cons.rpos = rpos + n;
+	}
+
+	cons_checkdrops();
+	return n;
 }
 
-// output a character to the console
-static void
-cons_putc(int c)
+int
+cons_readwait(char *buf, int n)
 {
-	serial_putc(c);
-	video_putc(c);
+	int got;
+
+	if (n <= 0)
+		return 0;
+
+	while ((got = cons_read(buf, n)) == 0) {
+		// Only the boot CPU gets device interrupts, and HLT is
+		// privileged, so anyone else, or anyone who'd be polling
+		// anyway, just spins on cons_read().
+		uint32_t eflags = read_eflags();
+		if (!cons_intenabled || !(eflags & FL_IF)
+				|| (read_cs() & 3) || !cpu_onboot()) {
+			pause();
+			continue;
+		}
+
+		// Sleep until the next interrupt, unless input arrived
+		// since we looked: STI takes effect only after the HLT
+		// has started, so no interrupt can slip in between.
+		cli();
+		if (cons.rpos == cons.wpos)
+			asm volatile("sti; hlt" ::: "memory");
+		write_eflags(eflags);
+	}
+	return got;
+}
+
+int
+cons_getc(void)
+{
+	char c;
+
+	if (cons_read(&c, 1) == 0)
+		return 0;
+	return (uint8_t) c;
+}
+
+int
+cons_waitc(void)
+{
+	char c;
+
+	cons_readwait(&c, 1);
+	return (uint8_t) c;
 }
 
 // initialize the console devices
@@ -107,6 +212,190 @@ cons_init(void)
 		warn("Serial port does not exist!\n");
 }
 
+// Enable console interrupts.
+void
+cons_intenable(void)
+{
+	if (!cpu_onboot())	// only do once, on the boot CPU
+		return;
+
+	kbd_intenable();
+	serial_intenable();
+	cons_intenabled = 1;
+}
+
+
+
+/***** Kernel log rings *****/
+// Console output goes first into a log ring belonging to the CPU
+// that produced it, which that CPU appends to without taking any lock.
+// Whichever CPU manages to become the drainer then merges all the rings
+// in timestamp order and feeds the text to the console devices,
+// while other CPUs go on with their work instead of waiting their turn.
+
+#define CONSLOG_SIZE	4096	// Bytes per ring; must be a power of 2
+#define CONSLOG_MAXREC	256	// Max bytes of text per log record
+
+// Each record in a log ring is this header followed by the text.
+typedef struct conslog_rec {
+	uint64_t tsc;			// Timestamp at which it was logged
+	uint32_t len;			// Bytes of text following the header
+} conslog_rec;
+
+// Only the owning CPU advances head, and only the drainer advances tail.
+// Aligned so that no two CPUs' rings share a cache line.
+typedef struct conslog {
+	uint8_t buf[CONSLOG_SIZE];
+	volatile uint32_t head;		// Producer's next write offset
+	volatile uint32_t tail;		// Drainer's next read offset
+} gcc_aligned(64) conslog;
+
+static conslog conslogs[MAX_CPUS];
+static volatile uint32_t cons_draining;	// Set while some CPU is draining
+static bool cons_synchronous;		// Bypass the log rings entirely
+
+// Copy data into or out of a log ring at a free-running offset.
+static void
+conslog_put(conslog *l, uint32_t ofs, const void *data, int len)
+{
+	const uint8_t *p = data;
+	while (len-- > 0)
+		l->buf[ofs++ & (CONSLOG_SIZE-1)] = *p++;
+}
+
+static void
+conslog_get(conslog *l, uint32_t ofs, void *data, int len)
+{
+	uint8_t *p = data;
+	while (len-- > 0)
+		*p++ = l->buf[ofs++ & (CONSLOG_SIZE-1)];
+}
+
+// Write text straight to the console output devices.
+// The serial driver locks its own queue against the boot CPU's UART
+// interrupts; the video state is only ever touched here, by the one
+// CPU holding cons_draining, or after cons_sync() when we're panicking.
+static void
+cons_write(const char *str, int len)
+{
+	int i;
+	for (i = 0; i < len; i++)
+		serial_putc(str[i]);
+	video_write(str, len);
+}
+
+// Pass every logged record to the devices, oldest first across all CPUs.
+// The caller must be the only one draining.
+static void
+conslog_drainall(void)
+{
+	char text[CONSLOG_MAXREC];
+
+	while (1) {
+		conslog *l, *oldest = NULL;
+		conslog_rec r, oldestr;
+		int i;
+
+		for (i = 0; i < MAX_CPUS; i++) {
+			l = &conslogs[i];
+			if (l->head == l->tail)
+				continue;
+			conslog_get(l, l->tail, &r, sizeof(r));
+			if (oldest == NULL || r.tsc < oldestr.tsc)
+				oldest = l, oldestr = r;
+		}
+		if (oldest == NULL)
+			return;
+
+		conslog_get(oldest, oldest->tail + sizeof(oldestr),
+				text, oldestr.len);
+		asm volatile("" ::: "memory");	// read the text before freeing it
+		oldest->tail += sizeof(oldestr) + oldestr.len;
+
+		cons_write(text, oldestr.len);
+	}
+}
+
+static bool
+conslog_pending(void)
+{
+	int i;
+	for (i = 0; i < MAX_CPUS; i++)
+		if (conslogs[i].head != conslogs[i].tail)
+			return 1;
+	return 0;
+}
+
+// Drain the log rings if no other CPU is already doing so.
+// So output is written out on the calling CPU whenever it wins the flag,
+// and is deferred only to whichever other CPU is draining at the time.
+// Interrupts stay off while we drain, so that an interrupt handler
+// that logs on this CPU can't end up waiting for us to make room.
+static void
+cons_drain(void)
+{
+	uint32_t eflags = read_eflags();
+	cli();
+	while (xchg(&cons_draining, 1) == 0) {
+		conslog_drainall();
+
+		// Let go with a locked instruction, not a plain store:
+		// x86 may let a plain store pass our later loads of the heads,
+		// so a producer could still see the flag set after we'd missed
+		// its new head, and its record would sit until the next cputs.
+		xchg(&cons_draining, 0);
+
+		// Someone may have logged something after we looked
+		// but before we let go; if so, it's still our job.
+		if (!conslog_pending())
+			break;
+	}
+	write_eflags(eflags);
+}
+
+// Append text to the current CPU's log ring.
+static void
+conslog_append(const char *str, int len)
+{
+	// User code running in lab 1 doesn't run on a kernel stack,
+	// and only ever runs on the boot CPU.
+	conslog *l = &conslogs[(read_cs() & 3) ? cpu_boot.num : cpu_cur()->num];
+	conslog_rec r;
+
+	// Keep this CPU's interrupt handlers out while we're appending,
+	// since they log into this same ring.
+	uint32_t eflags = read_eflags();
+	cli();
+	while (len > 0) {
+		int n = MIN(len, CONSLOG_MAXREC);
+		while (CONSLOG_SIZE - (l->head - l->tail) < sizeof(r) + n)
+			cons_drain();	// full: make room or wait for the drainer
+
+		r.tsc = rdtsc();
+		r.len = n;
+		conslog_put(l, l->head, &r, sizeof(r));
+		conslog_put(l, l->head + sizeof(r), str, n);
+		asm volatile("" ::: "memory");	// x86 keeps the stores in order
+		l->head += sizeof(r) + n;
+
+		str += n;
+		len -= n;
+	}
+	write_eflags(eflags);
+}
+
+// Make all console output synchronous from now on,
+// after flushing anything still logged or queued for the devices.
+// For use when panicking, so we don't wait on the drainer flag:
+// whoever holds it may be stuck, or may be us.
+void
+cons_sync(void)
+{
+	cons_synchronous = 1;
+	conslog_drainall();
+	serial_sync();
+}
+
 
 // `High'-level console I/O.  Used by readline and cprintf.
 void
@@ -115,9 +404,13 @@ cputs(const char *str)
 //	if (read_cs() & 3) //This line is commented because there's a glitch somewhere...
 //		return ;//LAB1 sys_cputs(str);	// use syscall from user mode
 
-	char ch;
-	while (*str)
-		cons_putc(*str++);
+	if (cons_synchronous) {
+		cons_write(str, strlen(str));
+		return;
+	}
+
+	conslog_append(str, strlen(str));
+	cons_drain();
 }
 
 // Synchronize the root process's console special files
@@ -34,9 +34,28 @@ void cons_init(void);
 // and returns that character or 0 if no more available from device.
 void cons_intr(int (*proc)(void));
 
+// Read up to n bytes of console input into buf without waiting,
+// returning the number read.  Readers must not run concurrently.
+int cons_read(char *buf, int n);
+
+// Like cons_read(), but wait until at least one byte is available.
+// On the boot CPU with console interrupts enabled, sleeps in HLT
+// until an input interrupt arrives instead of polling the devices.
+int cons_readwait(char *buf, int n);
+
+// Return the next input character from the console, or 0 if none waiting.
+int cons_getc(void);
+
+// Return the next input character, waiting for one if necessary.
+int cons_waitc(void);
+
 // Called by init() when the kernel is ready to receive console interrupts.
 void cons_intenable(void);
 
+// Flush queued console output and write all further output synchronously.
+// Called on panic, since interrupts might never drain the output queues.
+void cons_sync(void);
+
 // Called from file_io() in the context of the root process,
 // to synchronize the root process's console special I/O files
 // with the kernel's console I/O buffers.
@@ -9,11 +9,15 @@
  */
 
 #include <inc/assert.h>
+#include <inc/stdio.h>
 #include <inc/string.h>
 
 #include <kern/mem.h>
 #include <kern/cpu.h>
 #include <kern/init.h>
+#include <kern/mp.h>
+
+#include <dev/lapic.h>
 
 
 
@@ -84,4 +88,90 @@ void cpu_init()
 	
 }
 
+cpu *
+cpu_alloc(void)
+{
+	// Pointer to the cpu.next pointer of the last CPU on the list,
+	// for chaining on new CPUs in cpu_alloc().  Note: static.
+	static cpu **cpu_tail = &cpu_boot.next;
+	static uint8_t cpu_nextnum = 1;
+
+	pageinfo *pi = mem_alloc();
+	assert(pi != 0);	// shouldn't be out of memory just yet!
+
+	cpu *c = (cpu*) mem_pi2ptr(pi);
+
+	// Clear the whole page for good measure: cpu struct and kernel stack
+	memset(c, 0, PAGESIZE);
+
+	// Now we need to initialize the new cpu struct
+	// just to the extent that's required for cpu_init() to work.
+	// The GDT can be the same as the boot CPU's, and cpu_init()
+	// fills in its own TSS descriptor.
+	memmove(c->gdt, cpu_boot.gdt, sizeof(c->gdt));
+	c->magic = CPU_MAGIC;
+	c->num = cpu_nextnum++;
+
+	// Chain the new CPU onto the tail of the list.
+	*cpu_tail = c;
+	cpu_tail = &c->next;
+
+	return c;
+}
+
+// Start all the other processors at once, and wait until every one
+// of them has finished its own per-CPU setup.
+// Everything the APs share (IDT, memory allocator, console) must be
+// set up before this, since they start using it without asking.
+void
+cpu_bootothers(void)
+{
+	extern uint8_t _binary_obj_boot_bootother_start[],
+			_binary_obj_boot_bootother_size[];
+	static uint32_t stacks[MAX_CPUS];
+	cpu *c;
+	int i, n;
+
+	assert(cpu_onboot());
+	cpu_boot.booted = 1;
+	mp_init();
+	cpu_boot.id = lapic_id();	// now that mp_init() has found the LAPIC
+	if (!ismp || ncpu == 1)
+		return;
+
+	// Write bootstrap code to unused memory at 0x1000,
+	// with the parameters bootother.S expects just below it.
+	uint8_t *code = (uint8_t*)mem_ptr(0x1000);
+	memmove(code, _binary_obj_boot_bootother_start,
+		(uint32_t) _binary_obj_boot_bootother_size);
+
+	for (n = 0; n < ncpu - 1; n++)
+		stacks[n] = (uint32_t) cpu_alloc()->kstackhi;
+	((uint32_t*)code)[-1] = (uint32_t) init;
+	((uint32_t*)code)[-2] = (uint32_t) stacks;
+	((uint32_t*)code)[-3] = 0;
+	((uint32_t*)code)[-4] = n;
+
+	// One broadcast INIT/STARTUP sequence wakes every AP,
+	// instead of a full round trip per CPU.
+	lapic_startaps(0x1000);
+
+	// Wait for them all, but give up on any that never show:
+	// the MP table may list processors that don't respond.
+	for (i = 0; i < 1000000; i++) {	// about one second
+		for (c = cpu_boot.next; c != NULL && c->booted; c = c->next)
+			;
+		if (c == NULL)
+			break;
+		inb(0x84);
+	}
+
+	n = 0;
+	for (c = &cpu_boot; c != NULL; c = c->next)
+		if (c->booted)
+			n++;
+		else
+			warn("cpu_bootothers: CPU %d did not start\n", c->num);
+	cprintf("%d of %d CPUs running\n", n, ncpu);
+}
 
@@ -22,6 +22,9 @@
 #define CPU_GDT_TSS	0x28	// task state segment
 #define CPU_GDT_NDESC	6	// number of GDT entries used, including null
 
+// Maximum number of CPUs, bounding per-CPU arrays indexed by cpu.num
+#define MAX_CPUS	16
+
 
 #ifndef __ASSEMBLER__
 
@@ -51,6 +54,24 @@ typedef struct cpu {
 	gcc_noreturn void (*recover)(trapframe *tf, void *recoverdata);
 	void		*recoverdata;
 
+	// Sequential number of this CPU, 0 for the boot CPU,
+	// used to index per-CPU state kept outside this struct.
+	uint8_t		num;
+
+	// Local APIC ID of this CPU, set when it starts up.
+	uint8_t		id;
+
+	// Set by this CPU once its per-CPU setup is complete.
+	volatile uint32_t booted;
+
+	// Next in the chain of all CPUs, starting at cpu_boot.
+	struct cpu	*next;
+
+	// Submission ring registered in SYS_RING_POLL mode, or NULL.
+	// Drained by syscall_poll() on each system call on this CPU,
+	// and on each device interrupt taken from user mode.
+	struct sysring	*sysring;
+
 	// Magic verification tag (CPU_MAGIC) to help detect corruption,
 	// e.g., if the CPU's ring 0 stack overflows down onto the cpu struct.
 	uint32_t	magic;
@@ -15,6 +15,8 @@
 
 #include <kern/console.h>
 #include <kern/debug.h>
+#include <kern/trap.h>
+#include <kern/trace.h>
 
 
 // Variable panicstr contains argument to first call to panic; used as flag
@@ -36,6 +38,10 @@ debug_panic(const char *file, int line, const char *fmt,...)
 		panicstr = fmt;
 	}
 
+	// We may never take another interrupt or get to drain the log again,
+	// so flush what's been logged and stop queueing output.
+	cons_sync();
+
 	// First print the requested message
 	va_start(ap, fmt);
 	cprintf("kernel panic at %s:%d: ", file, line);
@@ -49,6 +55,13 @@ debug_panic(const char *file, int line, const char *fmt,...)
 	for (i = 0; i < DEBUG_TRACEFRAMES && eips[i] != 0; i++)
 		cprintf("  from %08x\n", eips[i]);
 
+	// And what traps this CPU has been handling, if we can tell which CPU
+	// we're on: cpu_cur() only works on a kernel stack.
+	// Then the recent trace records from all CPUs.
+	if ((read_cs() & 3) == 0)
+		trap_print_stats();
+	trace_dump();
+
 dead:
 	while (1) ;	// just spin
 }
@@ -20,6 +20,13 @@
 #include <kern/mem.h>
 #include <kern/cpu.h>
 #include <kern/trap.h>
+#include <kern/boottime.h>
+#include <kern/selftest.h>
+#include <kern/multiboot.h>
+#include <kern/pmap.h>
+
+#include <dev/pic.h>
+#include <dev/lapic.h>
 
 
 
@@ -36,6 +43,28 @@ void inittests() {
 }
 
 
+// Each additional processor comes here from init() on its own stack,
+// with interrupts still disabled from boot/bootother.S.
+// The APs all get here at once and run in parallel:
+// nothing below touches state shared with another CPU
+// except the final store to our own booted flag.
+static void gcc_noreturn
+init_ap(void)
+{
+	cpu *c = cpu_cur();
+
+	cpu_init();	// our own GDT and TSS
+	trap_init();	// load the shared IDT
+	pmap_init();	// start paging with the shared page directory
+	lapic_init();
+	c->id = lapic_id();
+	c->booted = 1;
+
+	// Nothing for us to do yet.
+	while (1)
+		asm volatile("hlt");
+}
+
 // Called first from entry.S on the bootstrap processor,
 // and later from boot/bootother.S on all other processors.
 // As a rule, "init" functions in PIOS are called once on EACH processor.
@@ -44,29 +73,75 @@ init(void)
 {
 	extern char start[], edata[], end[];
 
+	// Other processors only set up their own state:
+	// everything they share, the boot CPU has already done.
+	if (!cpu_onboot())
+		init_ap();
+
 	// Before anything else, complete the ELF loading process.
 	// Clear all uninitialized global data (BSS) in our program,
 	// ensuring that all static/global variables start out zero.
-	if (cpu_onboot())
+	if (cpu_onboot()) {
 		memset(edata, 0, end - edata);
+		boottime_init();
+		selftest_select(SELFTEST);
+	}
 
 	// Initialize the console.
 	// Can't call cprintf until after we do this!
 	cons_init();
+	if (cpu_onboot()) {
+		boottime_mark("cons_init");
+
+		// Take what a multiboot loader told us, if one loaded us,
+		// before mem_init() reuses the memory it's in.
+		multiboot_init();
+	}
 
 	// Lab 1: test cprintf and debug_trace
 	cprintf("1234 decimal is %o octal!\n", 1234);
 	inittests();
-	debug_check();
+	if (cpu_onboot()) {
+		selftest_run(SELFTEST_CONSOLE);
+		boottime_mark("debug_check");
+	}
 
 	// Initialize and load the bootstrap CPU's GDT, TSS, and IDT.
 	cpu_init();
+	if (cpu_onboot())
+		boottime_mark("cpu_init");
 	trap_init();
+	if (cpu_onboot()) {
+		selftest_run(SELFTEST_TRAP);
+		boottime_mark("trap_init");
+	}
 
 	// Physical memory detection/initialization.
 	// Can't call mem_alloc until after we do this!
 	mem_init();
-
+	if (cpu_onboot()) {
+		selftest_run(SELFTEST_MEM);
+		boottime_mark("mem_init");
+	}
+
+	// Turn on paging, with the kernel mapped in large pages.
+	pmap_init();
+	if (cpu_onboot()) {
+		selftest_run(SELFTEST_PMAP);
+		boottime_mark("pmap_init");
+
+		// Find and start the other processors.
+		cpu_bootothers();
+		boottime_mark("AP bring-up");
+	}
+
+	// Initialize the PIC and start taking console interrupts.
+	pic_init();
+	cons_intenable();
+	if (cpu_onboot()) {
+		boottime_mark("interrupts");
+		boottime_print();
+	}
 
 	// Lab 1: change this so it enters user() in user mode,
 	// running on the user_stack declared above,
@@ -88,7 +163,7 @@ init(void)
 	tf.tf_ds = (CPU_GDT_UDATA) | 3;
 	tf.tf_es = tf.tf_ds;
 	tf.tf_ss = tf.tf_ds;
-	tf.tf_eflags = FL_IOPL_3;
+	tf.tf_eflags = FL_IOPL_3 | FL_IF;	// take device interrupts
 	tf.tf_esp = (uintptr_t)user_stack+PAGESIZE;
 	tf.tf_eip = (uint32_t)&user;
 	//
@@ -107,7 +182,7 @@ user()
 	assert(read_esp() < (uint32_t) &user_stack[sizeof(user_stack)]);
 
 	// Check that we're in user mode and can handle traps from there.
-	trap_check_user();
+	selftest_run(SELFTEST_USER);
 
 	done();
 }
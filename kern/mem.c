@@ -15,6 +15,8 @@
 
 #include <kern/cpu.h>
 #include <kern/mem.h>
+#include <kern/multiboot.h>
+#include <kern/pmap.h>
 
 #include <dev/nvram.h>
 
@@ -33,8 +35,6 @@ pageinfo *mem_pageinfo;		// Metadata array indexed by page number
 
 pageinfo *mem_freelist;		// Start of free page list
 
-void mem_check(void);
-
 void
 mem_init(void)
 {
@@ -53,6 +53,23 @@ mem_init(void)
 	// The maximum physical address is the top of extended memory.
 	mem_max = MEM_EXT + extmem;
 
+	// A multiboot loader's memory map is better, when we have one:
+	// it covers memory beyond 64MB, and holes within it.
+	if (multiboot_nregions > 0) {
+		int r;
+		mem_max = 0;
+		for (r = 0; r < multiboot_nregions; r++)
+			mem_max = MAX(mem_max, multiboot_regions[r].end);
+		extmem = mem_max > MEM_EXT ? mem_max - MEM_EXT : 0;
+	}
+
+	// Pages at or above VM_USERLO aren't mapped in the kernel
+	// while a user address space is loaded (see kern/pmap.h).
+	if (mem_max > VM_USERLO) {
+		mem_max = VM_USERLO;
+		extmem = mem_max - MEM_EXT;
+	}
+
 	// Compute the total number of physical pages (including I/O holes)
 	mem_npage = mem_max / PAGESIZE;
 
@@ -81,7 +98,10 @@ mem_init(void)
 	//     Which pages hold the kernel and the pageinfo array?
 	//     (See the comment on the start[] and end[] symbols above.)
 	// Change the code to reflect this.
-	mem_pageinfo=(pageinfo *)ROUNDUP(((int)end), sizeof(pageinfo)); //The page table is now supposed to start from the beginning of memory.
+	// The pageinfo array goes just past the kernel,
+	// or past any modules a multiboot loader put there.
+	char *pistart = MAX((char *) end, (char *) mem_ptr(multiboot_end()));
+	mem_pageinfo=(pageinfo *)ROUNDUP(((int)pistart), sizeof(pageinfo)); //The page table is now supposed to start from the beginning of memory.
 	memset(mem_pageinfo, 0, mem_npage*sizeof(pageinfo));
 	pageinfo **freetail = &mem_freelist;
 	int i;
@@ -95,7 +115,8 @@ mem_init(void)
 			(i!=0) && 
 			(i!=1) && 
 			((i<(MEM_IO / PAGESIZE)) || (i>=(MEM_EXT/PAGESIZE))) && 
-			((i<((int)start / PAGESIZE)) || (i>(ROUNDUP((int)end,sizeof(pageinfo))+mem_npage*sizeof(pageinfo))/PAGESIZE))
+			((i<((int)start / PAGESIZE)) || (i>(ROUNDUP((int)pistart,sizeof(pageinfo))+mem_npage*sizeof(pageinfo))/PAGESIZE)) &&
+			multiboot_avail(i * PAGESIZE, PAGESIZE)
 		) {
 			//cprintf("i=0x%x taken.\n", i);
 			// A free page has no references to it.
@@ -129,9 +150,6 @@ mem_init(void)
 
 	// ...and remove this when you're ready.
 	//panic("mem_init() not implemented");
-
-	// Check to make sure the page allocator seems to work correctly.
-	mem_check();
 }
 
 //
@@ -181,7 +199,7 @@ void
 mem_incref(pageinfo *pi)
 {
 	assert(pi > &mem_pageinfo[1] && pi < &mem_pageinfo[mem_npage]);
-	//LAB1 assert(pi != mem_ptr2pi(pmap_zero));	// Don't alloc/free zero page!
+	assert(pi != mem_ptr2pi(pmap_zero));	// Don't alloc/free zero page!
 	assert(pi < mem_ptr2pi(start) || pi > mem_ptr2pi(end-1));
 
 	lockadd(&pi->refcount, 1);
@@ -193,7 +211,7 @@ void
 mem_decref(pageinfo* pi)
 {
 	assert(pi > &mem_pageinfo[1] && pi < &mem_pageinfo[mem_npage]);
-	//LAB1 assert(pi != mem_ptr2pi(pmap_zero));	// Don't alloc/free zero page!
+	assert(pi != mem_ptr2pi(pmap_zero));	// Don't alloc/free zero page!
 	assert(pi < mem_ptr2pi(start) || pi > mem_ptr2pi(end-1));
 
 	if (lockaddz(&pi->refcount, -1))
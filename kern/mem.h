@@ -72,6 +72,10 @@ void mem_free(pageinfo *pi);
 void mem_incref(pageinfo *pp);
 void mem_decref(pageinfo* pp);
 
+// Check that the page allocator seems to work correctly.
+// Writes to every free page: run only as a self-test (kern/selftest.c).
+void mem_check(void);
+
 
 #endif /* !PIOS_KERN_MEM_H */
 
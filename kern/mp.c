@@ -0,0 +1,142 @@
+/*
+ * Multiprocessor configuration table discovery.
+ * See MultiProcessor Specification Version 1.[14].
+ *
+ * Copyright (C) 1997 Massachusetts Institute of Technology
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Derived from the MIT Exokernel and JOS.
+ * Adapted for PIOS by Bryan Ford at Yale University.
+ */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include <kern/cpu.h>
+#include <kern/mem.h>
+#include <kern/mp.h>
+
+#include <dev/lapic.h>
+
+
+int ismp;
+int ncpu = 1;
+
+
+static uint8_t
+sum(uint8_t * addr, int len)
+{
+	int i, sum;
+
+	sum = 0;
+	for (i = 0; i < len; i++)
+		sum += addr[i];
+	return sum;
+}
+
+// Look for an MP structure in the len bytes at addr.
+static mp *
+mpsearch1(uint8_t * addr, int len)
+{
+	uint8_t *e, *p;
+
+	e = addr + len;
+	for (p = addr; p < e; p += sizeof(mp))
+		if (memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(mp)) == 0)
+			return (mp *) p;
+	return 0;
+}
+
+// Search for the MP Floating Pointer Structure, which according to the
+// spec is in one of the following three locations:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static mp *
+mpsearch(void)
+{
+	uint8_t *bda;
+	uint32_t p;
+	mp *mp;
+
+	bda = (uint8_t *) mem_ptr(0x400);
+	if ((p = ((bda[0x0F] << 8) | bda[0x0E]) << 4)) {
+		if ((mp = mpsearch1((uint8_t *) mem_ptr(p), 1024)))
+			return mp;
+	} else {
+		p = ((bda[0x14] << 8) | bda[0x13]) * 1024;
+		if ((mp = mpsearch1((uint8_t *) mem_ptr(p - 1024), 1024)))
+			return mp;
+	}
+	return mpsearch1((uint8_t *) mem_ptr(0xF0000), 0x10000);
+}
+
+// Search for an MP configuration table.  For now,
+// don't accept the default configurations (physaddr == 0).
+// Check for correct signature, checksum, and version.
+static mpconf *
+mpconfig(mp **pmp)
+{
+	mpconf *conf;
+	mp *mp;
+
+	if ((mp = mpsearch()) == 0 || mp->physaddr == 0)
+		return 0;
+	conf = (mpconf *) mem_ptr(mp->physaddr);
+	if (memcmp(conf, "PCMP", 4) != 0)
+		return 0;
+	if (conf->version != 1 && conf->version != 4)
+		return 0;
+	if (sum((uint8_t *) conf, conf->length) != 0)
+		return 0;
+	*pmp = mp;
+	return conf;
+}
+
+void
+mp_init(void)
+{
+	uint8_t *p, *e;
+	mp *mp;
+	mpconf *conf;
+	mpproc *proc;
+	int n = 0;
+
+	if ((conf = mpconfig(&mp)) == 0)
+		return; // Not a multiprocessor machine - just use boot CPU.
+
+	ismp = 1;
+	lapic = (volatile uint32_t *) mem_ptr(conf->lapicaddr);
+	for (p = conf->entries, e = (uint8_t *) conf + conf->length; p < e; ) {
+		switch (*p) {
+		case MPPROC:
+			proc = (mpproc *) p;
+			p += sizeof(mpproc);
+			if (proc->flags & MPENAB)
+				n++;
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+			continue;
+		default:
+			warn("mp_init: unknown config type %x\n", *p);
+			ismp = 0;
+			lapic = NULL;
+			return;
+		}
+	}
+
+	if (n > MAX_CPUS) {
+		warn("mp_init: %d CPUs, only using %d\n", n, MAX_CPUS);
+		n = MAX_CPUS;
+	}
+	if (n > 0)
+		ncpu = n;
+
+	// We keep the 8259A PIC in charge of device interrupts and
+	// leave the IMCR alone, so they still go only to the boot CPU.
+}
@@ -0,0 +1,81 @@
+/*
+ * Multiprocessor configuration table discovery.
+ * See MultiProcessor Specification Version 1.[14].
+ *
+ * Copyright (C) 1997 Massachusetts Institute of Technology
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Derived from the MIT Exokernel and JOS.
+ * Adapted for PIOS by Bryan Ford at Yale University.
+ */
+
+#ifndef PIOS_KERN_MP_H
+#define PIOS_KERN_MP_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+
+// Floating pointer structure, found in the first 1MB of memory.
+typedef struct mp {
+	uint8_t signature[4];		// "_MP_"
+	uint32_t physaddr;		// phys addr of MP config table
+	uint8_t length;			// 1
+	uint8_t specrev;		// [14]
+	uint8_t checksum;		// all bytes must add up to 0
+	uint8_t type;			// MP system config type
+	uint8_t imcrp;
+	uint8_t reserved[3];
+} mp;
+
+// Configuration table header, pointed to by mp.physaddr.
+typedef struct mpconf {
+	uint8_t signature[4];		// "PCMP"
+	uint16_t length;		// total table length
+	uint8_t version;		// [14]
+	uint8_t checksum;		// all bytes must add up to 0
+	uint8_t product[20];		// product id
+	uint32_t oemtable;		// OEM table pointer
+	uint16_t oemlength;		// OEM table length
+	uint16_t entry;			// entry count
+	uint32_t lapicaddr;		// address of local APIC
+	uint16_t xlength;		// extended table length
+	uint8_t xchecksum;		// extended table checksum
+	uint8_t reserved;
+	uint8_t entries[0];		// table entries
+} mpconf;
+
+// Processor table entry
+typedef struct mpproc {
+	uint8_t type;			// entry type (0)
+	uint8_t apicid;			// local APIC id
+	uint8_t version;		// local APIC version
+	uint8_t flags;			// CPU flags
+	uint8_t signature[4];		// CPU signature
+	uint32_t feature;		// feature flags from CPUID instruction
+	uint8_t reserved[8];
+} mpproc;
+
+// mpproc flags
+#define MPENAB		0x01		// This processor is enabled
+#define MPBOOT		0x02		// This is the bootstrap processor
+
+// Table entry types
+#define MPPROC		0x00		// One per processor
+#define MPBUS		0x01		// One per bus
+#define MPIOAPIC	0x02		// One per I/O APIC
+#define MPIOINTR	0x03		// One per bus interrupt source
+#define MPLINTR		0x04		// One per system interrupt source
+
+
+extern int ismp;	// True if this is an MP system
+extern int ncpu;	// Number of enabled CPUs found, including the boot CPU
+
+// Search for an MP configuration table, and if we find one,
+// count the enabled processors and find the local APIC.
+// Leaves ncpu at 1 and lapic NULL on a uniprocessor.
+void mp_init(void);
+
+#endif // !PIOS_KERN_MP_H
@@ -0,0 +1,143 @@
+/*
+ * Handling of the information passed by a multiboot loader.
+ *
+ * When GRUB or "qemu -kernel" loads the kernel directly, skipping our
+ * boot block, it tells us about memory, modules, and a command line
+ * in a multiboot_info structure in memory just past the kernel,
+ * which mem_init() would otherwise hand out or overwrite.
+ * So we copy what we need into the kernel's own data first.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/mmu.h>
+
+#include <kern/mem.h>
+#include <kern/multiboot.h>
+#include <kern/selftest.h>
+
+
+// Left by kern/entry.S from the loader's EAX and EBX.
+extern uint32_t multiboot_magic, multiboot_infopa;
+
+bool multiboot;
+char multiboot_cmdline[256];
+int multiboot_nmods;
+multiboot_module multiboot_mods[MULTIBOOT_MAXMODS];
+int multiboot_nregions;
+struct multiboot_region multiboot_regions[MULTIBOOT_MAXREGIONS];
+
+
+// Apply the options we recognize on the kernel command line:
+//	selftest=<spec>		choose self-tests, as for selftest_select()
+static void
+multiboot_options(char *cmd)
+{
+	while (*cmd) {
+		while (*cmd == ' ')
+			cmd++;
+		char *word = cmd;
+		while (*cmd && *cmd != ' ')
+			cmd++;
+
+		char save = *cmd;
+		*cmd = 0;
+		if (strncmp(word, "selftest=", 9) == 0)
+			selftest_select(word + 9);
+		*cmd = save;
+	}
+}
+
+void
+multiboot_init(void)
+{
+	if (multiboot_magic != MULTIBOOT_BOOTLOADER_MAGIC)
+		return;		// loaded by boot/main.c
+	multiboot = 1;
+
+	const multiboot_info *mbi = mem_ptr(multiboot_infopa);
+
+	if (mbi->flags & MULTIBOOT_INFO_CMDLINE)
+		strlcpy(multiboot_cmdline, mem_ptr(mbi->cmdline),
+			sizeof(multiboot_cmdline));
+
+	if (mbi->flags & MULTIBOOT_INFO_MODS) {
+		const multiboot_mod *mod = mem_ptr(mbi->mods_addr);
+		int i;
+		for (i = 0; i < mbi->mods_count; i++, mod++) {
+			if (multiboot_nmods == MULTIBOOT_MAXMODS) {
+				warn("multiboot: ignoring modules past %d",
+					MULTIBOOT_MAXMODS);
+				break;
+			}
+			multiboot_module *m = &multiboot_mods[multiboot_nmods++];
+			m->start = mod->mod_start;
+			m->end = mod->mod_end;
+			if (mod->string)
+				strlcpy(m->name, mem_ptr(mod->string),
+					sizeof(m->name));
+		}
+	}
+
+	// Keep the available regions in the low 4GB, shrunk to whole pages,
+	// less the top page so that their ends fit in 32 bits.
+	if (mbi->flags & MULTIBOOT_INFO_MEM_MAP) {
+		const uint64_t top = 0x100000000ULL - PAGESIZE;
+		uint32_t pa = mbi->mmap_addr;
+		while (pa < mbi->mmap_addr + mbi->mmap_length) {
+			const multiboot_mmap *mm = mem_ptr(pa);
+			pa += mm->size + sizeof(mm->size);
+
+			if (mm->type != MULTIBOOT_MEMORY_AVAILABLE
+					|| mm->addr >= top)
+				continue;
+			uint64_t end = MIN(mm->addr + mm->len, top);
+			uint64_t lo = ROUNDUP(mm->addr, PAGESIZE);
+			uint64_t hi = ROUNDDOWN(end, PAGESIZE);
+			if (lo >= hi)
+				continue;
+			if (multiboot_nregions == MULTIBOOT_MAXREGIONS) {
+				warn("multiboot: ignoring memory past %llx", lo);
+				break;
+			}
+			multiboot_regions[multiboot_nregions].start = lo;
+			multiboot_regions[multiboot_nregions].end = hi;
+			multiboot_nregions++;
+		}
+	}
+
+	cprintf("multiboot: command line '%s', %d module(s), "
+		"%d memory region(s)\n", multiboot_cmdline,
+		multiboot_nmods, multiboot_nregions);
+	multiboot_options(multiboot_cmdline);
+}
+
+bool
+multiboot_avail(uint32_t pa, uint32_t size)
+{
+	int i;
+
+	if (multiboot_nregions == 0)
+		return 1;
+	for (i = 0; i < multiboot_nregions; i++)
+		if (pa >= multiboot_regions[i].start
+				&& pa + size <= multiboot_regions[i].end)
+			return 1;
+	return 0;
+}
+
+uint32_t
+multiboot_end(void)
+{
+	uint32_t end = 0;
+	int i;
+
+	for (i = 0; i < multiboot_nmods; i++)
+		if (multiboot_mods[i].end > end)
+			end = multiboot_mods[i].end;
+	return end;
+}
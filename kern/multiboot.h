@@ -0,0 +1,101 @@
+/*
+ * Multiboot specification definitions, and the information
+ * the kernel keeps from a multiboot loader such as GRUB or "qemu -kernel".
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#ifndef PIOS_KERN_MULTIBOOT_H
+#define PIOS_KERN_MULTIBOOT_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+// Multiboot header flags, for the header in kern/entry.S
+#define MULTIBOOT_HEADER_MAGIC	0x1BADB002
+#define MULTIBOOT_PAGE_ALIGN	(1<<0)	// Align modules on page boundaries
+#define MULTIBOOT_MEMORY_INFO	(1<<1)	// Pass us memory information
+
+// Value the loader leaves in EAX when it starts the kernel
+#define MULTIBOOT_BOOTLOADER_MAGIC	0x2BADB002
+
+// Flags saying which multiboot_info fields are valid
+#define MULTIBOOT_INFO_MEMORY	0x001	// mem_lower, mem_upper
+#define MULTIBOOT_INFO_CMDLINE	0x004	// cmdline
+#define MULTIBOOT_INFO_MODS	0x008	// mods_count, mods_addr
+#define MULTIBOOT_INFO_MEM_MAP	0x040	// mmap_length, mmap_addr
+
+// Memory map entry types
+#define MULTIBOOT_MEMORY_AVAILABLE	1
+
+#ifndef __ASSEMBLER__
+
+#include <inc/types.h>
+#include <inc/gcc.h>
+
+// Boot information structure the loader passes us a pointer to in EBX.
+typedef struct multiboot_info {
+	uint32_t flags;
+	uint32_t mem_lower;	// KB of base memory
+	uint32_t mem_upper;	// KB of extended memory above 1MB
+	uint32_t boot_device;
+	uint32_t cmdline;	// Physical address of command line string
+	uint32_t mods_count;
+	uint32_t mods_addr;	// Physical address of multiboot_mod array
+	uint32_t syms[4];
+	uint32_t mmap_length;	// Bytes of memory map
+	uint32_t mmap_addr;	// Physical address of memory map
+} multiboot_info;
+
+typedef struct multiboot_mod {
+	uint32_t mod_start;	// Physical address range of module
+	uint32_t mod_end;
+	uint32_t string;	// Physical address of its command line
+	uint32_t reserved;
+} multiboot_mod;
+
+// Memory map entries are variable-length: size excludes itself.
+typedef struct multiboot_mmap {
+	uint32_t size;
+	uint64_t addr;
+	uint64_t len;
+	uint32_t type;
+} gcc_packed multiboot_mmap;
+
+
+#define MULTIBOOT_MAXMODS	8	// Modules we keep track of
+#define MULTIBOOT_MAXREGIONS	16	// Available memory regions we keep
+
+// What we keep of the multiboot information once we've read it,
+// since the loader left it in memory the kernel is about to reuse.
+typedef struct multiboot_module {
+	uint32_t start, end;	// Physical address range
+	char name[64];		// The module's command line
+} multiboot_module;
+
+extern bool multiboot;		// Booted by a multiboot loader
+extern char multiboot_cmdline[256];
+extern int multiboot_nmods;
+extern multiboot_module multiboot_mods[MULTIBOOT_MAXMODS];
+extern int multiboot_nregions;	// 0 if the loader gave us no memory map
+extern struct multiboot_region {
+	uint32_t start, end;	// Available physical address range
+} multiboot_regions[MULTIBOOT_MAXREGIONS];
+
+// Copy out the boot information, if a multiboot loader started us,
+// and apply any options on the command line.
+// Called on the boot CPU once the BSS has been cleared.
+void multiboot_init(void);
+
+// Return true if physical pages [pa,pa+size) are all available memory
+// according to the loader's memory map, or if there is no map.
+bool multiboot_avail(uint32_t pa, uint32_t size);
+
+// Return the physical address just past everything the loader put in
+// memory beyond the kernel that we still need, namely the modules.
+uint32_t multiboot_end(void);
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !PIOS_KERN_MULTIBOOT_H */
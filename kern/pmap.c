@@ -0,0 +1,435 @@
+/*
+ * Page directory and page table management.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/x86.h>
+#include <inc/mmu.h>
+
+#include <kern/cpu.h>
+#include <kern/mem.h>
+#include <kern/pmap.h>
+#include <kern/trap.h>
+#include <kern/trace.h>
+
+
+// The bootstrap page directory, statically allocated and page-aligned.
+pde_t pmap_bootpdir[NPDENTRIES] gcc_aligned(PAGESIZE);
+
+// The shared zero page, in the BSS so it's cleared along with it.
+uint8_t pmap_zero[PAGESIZE] gcc_aligned(PAGESIZE);
+
+// Does this present PTE map the zero page?  Those hold no page reference.
+#define PTE_ISZERO(pte)	(PGADDR(pte) == mem_phys(pmap_zero))
+
+
+void
+pmap_init(void)
+{
+	if (cpu_onboot()) {
+		// Identity-map physical memory below VM_USERLO and
+		// device memory such as the local APIC above VM_USERHI,
+		// using one 4MB page per page directory entry:
+		// this takes no page tables at all, and only a handful of
+		// TLB entries cover the kernel's code, data, and stacks.
+		// The user area in between is left unmapped:
+		// each address space maps its own (see pmap_newpdir()).
+		//
+		// The low memory holding the kernel image is user-accessible,
+		// since user() runs out of it, on a stack in the BSS,
+		// but only in this page directory.  So it can't be global:
+		// a global entry would carry user access to it into address
+		// spaces that don't allow it.  That means the kernel's own
+		// code, data, and stacks still drop out of the TLB on every
+		// CR3 reload, until user code gets an alias of its own.
+		// Only the rest of physical memory and device memory,
+		// which no page directory lets user code reach, is global.
+		extern char end[];
+		uint32_t userend = ROUNDUP(mem_phys(end), PTSIZE);
+		int i;
+		for (i = 0; i < NPDENTRIES; i++) {
+			uint32_t va = (uint32_t) i << PDXSHIFT;
+			if (va >= VM_USERLO && va < VM_USERHI)
+				pmap_bootpdir[i] = 0;
+			else if (va < userend)
+				pmap_bootpdir[i] = va | PTE_P | PTE_W | PTE_U
+						| PTE_PS;
+			else
+				pmap_bootpdir[i] = va | PTE_P | PTE_W | PTE_PS
+						| PTE_G;
+		}
+	}
+
+	// Enable 4MB pages and global pages before we use either.
+	lcr4(rcr4() | CR4_PSE | CR4_PGE);
+
+	// Install the bootstrap page directory into the PDBR.
+	lcr3(mem_phys(pmap_bootpdir));
+
+	// Turn on paging, and make the kernel honor read-only mappings too.
+	lcr0(rcr0() | CR0_PE | CR0_PG | CR0_WP);
+}
+
+pde_t *
+pmap_newpdir(void)
+{
+	pageinfo *pi = mem_alloc();
+	if (pi == NULL)
+		return NULL;
+	mem_incref(pi);
+	pde_t *pdir = mem_pi2ptr(pi);
+
+	// Share the kernel's large-page mappings, but supervisor-only:
+	// only the boot page directory lets user() into the kernel image.
+	// Start with nothing in the user area.
+	int i;
+	for (i = 0; i < NPDENTRIES; i++)
+		pdir[i] = pmap_bootpdir[i] & ~PTE_U;
+	memset(&pdir[PDX(VM_USERLO)], 0,
+		(PDX(VM_USERHI) - PDX(VM_USERLO)) * sizeof(pde_t));
+
+	return pdir;
+}
+
+void
+pmap_freepdir(pde_t *pdir)
+{
+	pmap_remove(pdir, VM_USERLO, VM_USERHI - VM_USERLO);
+	mem_decref(mem_ptr2pi(pdir));
+}
+
+pte_t *
+pmap_walk(pde_t *pdir, uint32_t va, bool writing)
+{
+	assert(va >= VM_USERLO && va < VM_USERHI);
+
+	pde_t *pde = &pdir[PDX(va)];
+	if (!(*pde & PTE_P)) {
+		if (!writing)
+			return NULL;
+		assert(pdir != pmap_bootpdir);	// live on every CPU
+		pageinfo *pi = mem_alloc();
+		if (pi == NULL)
+			return NULL;
+		mem_incref(pi);
+		memset(mem_pi2ptr(pi), 0, PAGESIZE);
+
+		// Permissions are up to the PTEs: allow everything here.
+		*pde = mem_pi2phys(pi) | PTE_P | PTE_W | PTE_U;
+	}
+
+	pte_t *pt = mem_ptr(PGADDR(*pde));
+	return &pt[PTX(va)];
+}
+
+pte_t *
+pmap_insert(pde_t *pdir, pageinfo *pi, uint32_t va, int perm)
+{
+	pte_t *pte = pmap_walk(pdir, va, 1);
+	if (pte == NULL)
+		return NULL;
+
+	// Take the new reference first, in case pi is already mapped here.
+	mem_incref(pi);
+	if (*pte & PTE_P)
+		pmap_remove(pdir, va, PAGESIZE);
+
+	*pte = mem_pi2phys(pi) | perm | PTE_P;
+	return pte;
+}
+
+int
+pmap_zerofill(pde_t *pdir, uint32_t va, size_t size, int perm)
+{
+	assert(PGOFF(va) == 0 && PGOFF(size) == 0);
+	assert(va >= VM_USERLO && va < VM_USERHI);
+	assert(size <= VM_USERHI - va);
+
+	pmap_remove(pdir, va, size);
+
+	// Writable zero-fill pages are copy-on-write copies of pmap_zero.
+	pte_t zpte = mem_phys(pmap_zero) | PTE_P | (perm & ~PTE_W);
+	if (perm & PTE_W)
+		zpte |= PTE_COW;
+
+	uint32_t eva = va + size;
+	for (; va < eva; va += PAGESIZE) {
+		pte_t *pte = pmap_walk(pdir, va, 1);
+		if (pte == NULL)
+			return 0;
+		*pte = zpte;
+	}
+	return 1;
+}
+
+void
+pmap_remove(pde_t *pdir, uint32_t va, size_t size)
+{
+	assert(PGOFF(size) == 0);	// must be page-aligned
+	assert(va >= VM_USERLO && va < VM_USERHI);
+	assert(size <= VM_USERHI - va);
+
+	uint32_t eva = va + size;
+	while (va < eva) {
+		pde_t *pde = &pdir[PDX(va)];
+		if (!(*pde & PTE_P)) {		// no page table: skip it
+			va = PTADDR(va + PTSIZE);
+			continue;
+		}
+
+		// Drop a whole page table at once if we're removing all of it.
+		if (PTOFF(va) == 0 && eva - va >= PTSIZE) {
+			pte_t *pt = mem_ptr(PGADDR(*pde));
+			int i;
+			for (i = 0; i < NPTENTRIES; i++)
+				if ((pt[i] & PTE_P) && !PTE_ISZERO(pt[i]))
+					mem_decref(mem_phys2pi(PGADDR(pt[i])));
+			mem_decref(mem_phys2pi(PGADDR(*pde)));
+			*pde = 0;
+			va += PTSIZE;
+			continue;
+		}
+
+		pte_t *pte = pmap_walk(pdir, va, 0);
+		if ((*pte & PTE_P) && !PTE_ISZERO(*pte))
+			mem_decref(mem_phys2pi(PGADDR(*pte)));
+		*pte = 0;
+		va += PAGESIZE;
+	}
+
+	pmap_inval(pdir, eva - size, size);
+}
+
+// There are no TLB shootdowns yet, so this covers only the current CPU:
+// callers changing a page directory must make sure no other CPU has it
+// loaded (see kern/pmap.h).
+void
+pmap_inval(pde_t *pdir, uint32_t va, size_t size)
+{
+	if (PGADDR(rcr3()) != mem_phys(pdir))
+		return;		// not this CPU's current address space
+
+	// A single page is cheap to flush on its own.  Otherwise reload CR3,
+	// which keeps the global mappings above the kernel image in the TLB
+	// but flushes the image itself (see pmap_init()).
+	if (size == PAGESIZE)
+		invlpg(mem_ptr(va));
+	else
+		lcr3(mem_phys(pdir));
+}
+
+int
+pmap_copy(pde_t *spdir, uint32_t sva, pde_t *dpdir, uint32_t dva,
+		size_t size)
+{
+	assert(PTOFF(sva) == 0);	// must be 4MB-aligned
+	assert(PTOFF(dva) == 0);
+	assert(PTOFF(size) == 0);
+	assert(sva >= VM_USERLO && sva < VM_USERHI);
+	assert(dva >= VM_USERLO && dva < VM_USERHI);
+	assert(size <= VM_USERHI - sva);
+	assert(size <= VM_USERHI - dva);
+	assert(spdir != pmap_bootpdir);	// can't flush it on other CPUs
+
+	pmap_remove(dpdir, dva, size);
+
+	// Copy page tables only: the pages themselves become shared,
+	// and writable ones copy-on-write on both sides.
+	uint32_t off;
+	for (off = 0; off < size; off += PTSIZE) {
+		pde_t spde = spdir[PDX(sva + off)];
+		if (!(spde & PTE_P))
+			continue;
+
+		pte_t *spt = mem_ptr(PGADDR(spde));
+		pte_t *dpt = pmap_walk(dpdir, dva + off, 1);
+		if (dpt == NULL)
+			return 0;
+
+		int i;
+		for (i = 0; i < NPTENTRIES; i++) {
+			pte_t pte = spt[i];
+			if (!(pte & PTE_P))
+				continue;
+			if (pte & PTE_W)
+				pte = (pte & ~PTE_W) | PTE_COW;
+			if (!PTE_ISZERO(pte))
+				mem_incref(mem_phys2pi(PGADDR(pte)));
+			spt[i] = dpt[i] = pte;
+		}
+	}
+
+	// Source pages we just made read-only may still be writable in the TLB.
+	pmap_inval(spdir, sva, size);
+	return 1;
+}
+
+bool
+pmap_checkuser(pde_t *pdir, uint32_t va, size_t size, bool writing)
+{
+	if (size == 0)
+		return 1;
+	if (va + size - 1 < va)
+		return 0;		// wraps around the top of memory
+
+	uint32_t eva = va + size - 1;	// last byte, to avoid overflow
+	va = PGADDR(va);
+	while (1) {
+		pde_t pde = pdir[PDX(va)];
+		if ((pde & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+			return 0;
+
+		if (pde & PTE_PS) {	// 4MB page, as in pmap_bootpdir
+			if (writing && !(pde & PTE_W))
+				return 0;
+			if (eva - PTADDR(va) < PTSIZE)
+				return 1;
+			va = PTADDR(va) + PTSIZE;
+			continue;
+		}
+
+		// The kernel may write to copy-on-write pages too:
+		// with CR0_WP it faults, and pmap_pagefault() copies them.
+		pte_t pte = ((pte_t *) mem_ptr(PGADDR(pde)))[PTX(va)];
+		if ((pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+			return 0;
+		if (writing && !(pte & (PTE_W | PTE_COW)))
+			return 0;
+		if (eva - va < PAGESIZE)
+			return 1;
+		va += PAGESIZE;
+	}
+}
+
+void
+pmap_pagefault(trapframe *tf)
+{
+	uint32_t fva = rcr2();
+
+	if (fva < VM_USERLO || fva >= VM_USERHI || !(tf->tf_err & PFE_WR))
+		return;		// not a write to the user area
+
+	pde_t *pdir = mem_ptr(PGADDR(rcr3()));
+	pte_t *pte = pmap_walk(pdir, fva, 0);
+	if (pte == NULL || (*pte & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW))
+		return;		// not a copy-on-write page
+
+	if (PTE_ISZERO(*pte)) {
+		// First write to zero-fill memory: give it a page of its own.
+		pageinfo *npi = mem_alloc();
+		if (npi == NULL) {
+			warn("pmap_pagefault: out of memory for zero-fill");
+			return;
+		}
+		mem_incref(npi);
+		memset(mem_pi2ptr(npi), 0, PAGESIZE);
+		trace("pmap_pagefault: zero-fill at %x", fva);
+		*pte = mem_pi2phys(npi) | (PGOFF(*pte) & ~PTE_COW) | PTE_W;
+		invlpg(mem_ptr(fva));
+		trap_return(tf);
+	}
+
+	pageinfo *pi = mem_phys2pi(PGADDR(*pte));
+	if (pi->refcount == 1) {
+		// Everyone else has let go of the page already:
+		// it's ours, so no need to copy it.
+		*pte = (*pte & ~PTE_COW) | PTE_W;
+	} else {
+		pageinfo *npi = mem_alloc();
+		if (npi == NULL) {
+			warn("pmap_pagefault: out of memory for copy-on-write");
+			return;
+		}
+		mem_incref(npi);
+		memmove(mem_pi2ptr(npi), mem_pi2ptr(pi), PAGESIZE);
+		trace("pmap_pagefault: copy-on-write at %x", fva);
+		*pte = mem_pi2phys(npi) | (PGOFF(*pte) & ~PTE_COW) | PTE_W;
+		mem_decref(pi);
+	}
+	invlpg(mem_ptr(fva));
+
+	trap_return(tf);
+}
+
+// Check copy-on-write between two address spaces,
+// writing to the shared page from the kernel, which CR0_WP makes fault too.
+void
+pmap_check(void)
+{
+	uint32_t va = VM_USERLO;
+	uint32_t cr3 = rcr3();
+
+	pde_t *parent = pmap_newpdir();
+	pde_t *child = pmap_newpdir();
+	pageinfo *pi = mem_alloc();
+	pageinfo *ro = mem_alloc();
+	assert(parent && child && pi && ro);
+
+	// A writable page and a read-only one in the parent
+	memset(mem_pi2ptr(pi), 'p', PAGESIZE);
+	assert(pmap_insert(parent, pi, va, PTE_W | PTE_U));
+	assert(pmap_insert(parent, ro, va + PAGESIZE, PTE_U));
+	assert(pi->refcount == 1 && ro->refcount == 1);
+
+	// Cloning shares both pages, and only the writable one becomes COW.
+	assert(pmap_copy(parent, VM_USERLO, child, VM_USERLO, PTSIZE));
+	assert(pi->refcount == 2 && ro->refcount == 2);
+	pte_t *ppte = pmap_walk(parent, va, 0);
+	pte_t *cpte = pmap_walk(child, va, 0);
+	assert(PGADDR(*ppte) == mem_pi2phys(pi));
+	assert(PGADDR(*cpte) == mem_pi2phys(pi));
+	assert((*ppte & (PTE_W | PTE_COW)) == PTE_COW);
+	assert((*cpte & (PTE_W | PTE_COW)) == PTE_COW);
+	assert(!(*pmap_walk(child, va + PAGESIZE, 0) & (PTE_W | PTE_COW)));
+
+	// The child's first write gets it a copy of its own.
+	lcr3(mem_phys(child));
+	*(volatile char *) va = 'c';
+	asm volatile("" ::: "memory");	// the fault changed memory under us
+	assert(pi->refcount == 1);
+	assert(PGADDR(*cpte) != mem_pi2phys(pi));
+	assert((*cpte & (PTE_W | PTE_COW)) == PTE_W);
+	assert(((char *) mem_ptr(PGADDR(*cpte)))[0] == 'c');
+	assert(((char *) mem_ptr(PGADDR(*cpte)))[1] == 'p');
+	assert(((char *) mem_pi2ptr(pi))[0] == 'p');
+
+	// The parent now holds the only reference, so it keeps the page.
+	lcr3(mem_phys(parent));
+	*(volatile char *) va = 'q';
+	asm volatile("" ::: "memory");
+	assert(PGADDR(*ppte) == mem_pi2phys(pi));
+	assert((*ppte & (PTE_W | PTE_COW)) == PTE_W);
+	assert(((char *) mem_pi2ptr(pi))[0] == 'q');
+
+	// Zero-fill memory reads as zeros from the shared page,
+	// and gets a page of its own only where written.
+	uint32_t zva = va + 2*PAGESIZE;
+	assert(pmap_zerofill(parent, zva, 2*PAGESIZE, PTE_W | PTE_U));
+	pte_t *zpte0 = pmap_walk(parent, zva, 0);
+	pte_t *zpte1 = pmap_walk(parent, zva + PAGESIZE, 0);
+	assert(((volatile char *) zva)[PAGESIZE-1] == 0);
+	assert(PGADDR(*zpte0) == mem_phys(pmap_zero));
+	*(volatile char *) zva = 'z';
+	asm volatile("" ::: "memory");
+	assert(PGADDR(*zpte0) != mem_phys(pmap_zero));
+	assert(mem_phys2pi(PGADDR(*zpte0))->refcount == 1);
+	assert(((char *) mem_ptr(PGADDR(*zpte0)))[0] == 'z');
+	assert(((char *) mem_ptr(PGADDR(*zpte0)))[1] == 0);
+	assert(PGADDR(*zpte1) == mem_phys(pmap_zero));
+	assert(pmap_zero[0] == 0);
+	lcr3(cr3);
+
+	pmap_freepdir(child);
+	pmap_freepdir(parent);
+	assert(pi->refcount == 0 && ro->refcount == 0);
+
+	cprintf("pmap_check() succeeded!\n");
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Page mapping and page directory/table management definitions.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#ifndef PIOS_KERN_PMAP_H
+#define PIOS_KERN_PMAP_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/mmu.h>
+#include <inc/trap.h>
+
+#include <kern/mem.h>
+
+
+// Each address space made with pmap_newpdir() has its own mappings
+// between VM_USERLO and VM_USERHI, built from ordinary 4KB pages.
+// Everywhere else it shares the kernel's identity map from pmap_bootpdir,
+// so while such an address space is loaded the kernel can reach
+// physical memory only below VM_USERLO: mem_init() uses no more than that.
+//
+// There are no TLB shootdowns yet: the functions below that change
+// an address space flush only the current CPU's TLB, so they must not be
+// used on one that another CPU has loaded.  In particular, pmap_copy()
+// makes the source's writable pages read-only, and another CPU running in
+// it would keep writing through stale TLB entries to now-shared pages.
+// pmap_bootpdir, loaded on every CPU, has no user area to change.
+#define VM_USERLO	0x40000000
+#define VM_USERHI	0xF0000000	// device memory lies above
+
+
+// Page directory and page table entries
+typedef uint32_t pte_t;
+typedef uint32_t pde_t;
+
+// Software-defined PTE flag (one of the PTE_AVAIL bits):
+// the page is logically writable, but shared with another address space,
+// so it is mapped read-only and gets copied on the first write to it.
+// For pmap_zero, the "copy" is just a newly allocated zeroed page.
+#define PTE_COW		0x200
+
+// The bootstrap page directory, shared by all CPUs.
+// It identity-maps the address space outside the user area with 4MB pages,
+// so the kernel can keep treating physical addresses as pointers (mem_ptr).
+// Only the 4MB regions holding the kernel image are user-accessible,
+// for user() to run in, and so those aren't global, kernel image included.
+extern pde_t pmap_bootpdir[NPDENTRIES];
+
+// A page of zeros, shared read-only by every untouched anonymous page.
+// It's part of the kernel image, so mappings of it take no references,
+// and a write to one gets a fresh zeroed page in its place (see PTE_COW).
+extern uint8_t pmap_zero[PAGESIZE];
+
+
+// Set up the bootstrap page directory on the boot CPU,
+// then turn on paging with it on the current CPU.
+// Called once on EACH processor, after mem_init().
+void pmap_init(void);
+
+// Allocate a new page directory for an address space,
+// with the kernel's mappings and nothing in the user area.
+// Returns NULL if out of memory.
+pde_t *pmap_newpdir(void);
+
+// Free a page directory made by pmap_newpdir(),
+// dropping all of its user-area mappings and page tables.
+void pmap_freepdir(pde_t *pdir);
+
+// Find the page table entry for user-area address va in pdir.
+// If there is no page table for it, allocate one if 'writing' is true,
+// or else return NULL.  Also returns NULL if out of memory.
+pte_t *pmap_walk(pde_t *pdir, uint32_t va, bool writing);
+
+// Map the physical page pi at user-area address va in pdir,
+// with permissions perm, replacing any page mapped there before.
+// Takes a reference to pi.  Returns the PTE, or NULL if out of memory.
+pte_t *pmap_insert(pde_t *pdir, pageinfo *pi, uint32_t va, int perm);
+
+// Map size bytes of zero-filled memory at page-aligned user-area
+// address va in pdir, with permissions perm, replacing what was there.
+// Every page starts out mapped to pmap_zero, and gets memory of its own
+// only when first written.  Returns 1 on success, 0 if out of memory
+// for page tables.
+int pmap_zerofill(pde_t *pdir, uint32_t va, size_t size, int perm);
+
+// Unmap size bytes of user-area address space at page-aligned va,
+// dropping the references to the pages and page tables it used.
+void pmap_remove(pde_t *pdir, uint32_t va, size_t size);
+
+// Flush any stale TLB entries for the given range of pdir,
+// if pdir is the one this CPU is using.
+void pmap_inval(pde_t *pdir, uint32_t va, size_t size);
+
+// Copy-on-write the size bytes of user-area mappings at sva in spdir
+// to dva in dpdir, replacing what was there.  Both addresses and the size
+// must be multiples of PTSIZE.  Writable pages end up mapped read-only
+// with PTE_COW in both address spaces, each with one more reference;
+// no page data is copied.  Returns 1 on success, 0 if out of memory.
+int pmap_copy(pde_t *spdir, uint32_t sva, pde_t *dpdir, uint32_t dva,
+		size_t size);
+
+// Return true if user code could access all of [va, va+size) in pdir,
+// for writing too if 'writing' is set, so the kernel can safely do it
+// on the user's behalf.  Unlike the other functions here, va may be
+// anywhere, including in pmap_bootpdir's 4MB pages.
+bool pmap_checkuser(pde_t *pdir, uint32_t va, size_t size, bool writing);
+
+// Handle a page fault if it's a write to a copy-on-write page,
+// by giving the current address space its own copy, and return from trap.
+// Returns to the caller, in trap(), if the fault is some other kind.
+void pmap_pagefault(trapframe *tf);
+
+// Check the page mapping and copy-on-write code (kern/selftest.c).
+void pmap_check(void);
+
+#endif /* !PIOS_KERN_PMAP_H */
@@ -0,0 +1,98 @@
+/*
+ * Registry of the kernel's boot-time self-tests.
+ *
+ * Each kernel module used to call its own check function during boot.
+ * Listing them here instead lets a production boot skip them,
+ * especially mem_check(), which writes to every free page in memory,
+ * while the grading scripts and CI still run the lot.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+
+#include <kern/selftest.h>
+#include <kern/debug.h>
+#include <kern/trap.h>
+#include <kern/mem.h>
+#include <kern/pmap.h>
+
+
+#define SELFTEST_SLOW	0x01	// Takes time proportional to RAM size
+
+static struct selftest {
+	const char	*name;
+	void		(*func)(void);
+	int		when;		// SELFTEST_* point at which to run
+	int		flags;
+	bool		selected;
+} selftests[] = {
+	{ "debug",	debug_check,		SELFTEST_CONSOLE,	0 },
+	{ "trap",	trap_check_kernel,	SELFTEST_TRAP,		0 },
+	{ "mem",	mem_check,		SELFTEST_MEM,	SELFTEST_SLOW },
+	{ "pmap",	pmap_check,		SELFTEST_PMAP,		0 },
+	{ "user",	trap_check_user,	SELFTEST_USER,		0 },
+};
+#define NSELFTESTS	(sizeof(selftests) / sizeof(selftests[0]))
+
+
+void
+selftest_select(const char *spec)
+{
+	char word[16];
+	int i;
+
+	while (*spec) {
+		// Pick out the next word.
+		int len = 0;
+		while (*spec && *spec != ',' && *spec != ' ') {
+			if (len < sizeof(word) - 1)
+				word[len++] = *spec;
+			spec++;
+		}
+		word[len] = 0;
+		if (*spec)
+			spec++;
+		if (len == 0)
+			continue;
+
+		bool on = word[0] != '-';
+		const char *name = on ? word : word + 1;
+		bool found = 0;
+		for (i = 0; i < NSELFTESTS; i++) {
+			struct selftest *t = &selftests[i];
+			if (strcmp(name, "all") == 0)
+				t->selected = on;
+			else if (strcmp(name, "none") == 0)
+				t->selected = !on;
+			else if (strcmp(name, "fast") == 0) {
+				// "fast" picks exactly the quick tests;
+				// "-fast" just drops the slow ones.
+				if (t->flags & SELFTEST_SLOW)
+					t->selected = 0;
+				else if (on)
+					t->selected = 1;
+			}
+			else if (strcmp(name, t->name) == 0)
+				t->selected = on;
+			else
+				continue;
+			found = 1;
+		}
+		if (!found)
+			warn("selftest_select: no self-test named '%s'", name);
+	}
+}
+
+void
+selftest_run(int when)
+{
+	int i;
+
+	for (i = 0; i < NSELFTESTS; i++)
+		if (selftests[i].when == when && selftests[i].selected)
+			selftests[i].func();
+}
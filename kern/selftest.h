@@ -0,0 +1,41 @@
+/*
+ * Registry of the kernel's boot-time self-tests.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#ifndef PIOS_KERN_SELFTEST_H
+#define PIOS_KERN_SELFTEST_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+
+// Points during boot at which self-tests run,
+// each once the facilities its tests check are set up.
+#define SELFTEST_CONSOLE	0	// after cons_init(), from init()
+#define SELFTEST_TRAP		1	// after trap_init(), from init()
+#define SELFTEST_MEM		2	// after mem_init(), from init()
+#define SELFTEST_PMAP		3	// after pmap_init(), from init()
+#define SELFTEST_USER		4	// from user(), in user mode
+
+// Self-tests to run unless something selects otherwise:
+// override with SELFTEST in conf/env.mk.
+#ifndef SELFTEST
+#define SELFTEST		"all"
+#endif
+
+// Choose which self-tests to run from a list of words separated by
+// commas or spaces, applied in order: a test name selects that test,
+// "-name" deselects it, "all" and "none" select or deselect every test,
+// "fast" selects all tests except those that take time O(RAM),
+// and "-fast" just deselects those slow ones.
+// Called with SELFTEST on the boot CPU before any tests run,
+// and again later with anything given at boot to refine the choice.
+void selftest_select(const char *spec);
+
+// Run the selected self-tests registered for the given point in boot.
+void selftest_run(int when);
+
+#endif /* !PIOS_KERN_SELFTEST_H */
@@ -0,0 +1,154 @@
+/*
+ * System call handling.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/x86.h>
+#include <inc/syscall.h>
+
+#include <kern/cpu.h>
+#include <kern/trap.h>
+#include <kern/syscall.h>
+#include <kern/pmap.h>
+
+
+// Check that user code could itself access [va, va+size)
+// in the current address space, so a system call can't be pointed
+// at the kernel's own memory or at nothing at all.
+static bool
+checkva(uint32_t va, size_t size, bool writing)
+{
+	pde_t *pdir = mem_ptr(PGADDR(rcr3()));
+	return pmap_checkuser(pdir, va, size, writing);
+}
+
+// Print a user-supplied string to the console.
+// The string is copied into a bounded kernel buffer first,
+// so a missing terminator can't make us print forever,
+// checking each page before we read from it.
+static int
+do_cputs(uint32_t ebx)
+{
+	char buf[SYS_CPUTS_MAX];
+	size_t len;
+
+	for (len = 0; len < SYS_CPUTS_MAX - 1; len++) {
+		uint32_t va = ebx + len;
+		if ((len == 0 || PGOFF(va) == 0) && !checkva(va, 1, 0))
+			return -1;
+		if ((buf[len] = *(const char *) va) == 0)
+			break;
+	}
+	buf[len] = 0;
+	cputs(buf);
+	return 0;
+}
+
+// Perform one system call described by a register image,
+// shared by the trap path and the submission ring.
+// Returns 0 on success, or -1 if the operation can't be performed here:
+// GET, PUT and RET need child processes, which this kernel doesn't have yet.
+static int
+do_op(uint32_t eax, uint32_t ebx)
+{
+	switch (eax & SYS_TYPE) {
+	case SYS_CPUTS:
+		return do_cputs(ebx);
+	default:
+		return -1;
+	}
+}
+
+// Run every request queued in a submission ring,
+// stopping early if the completion queue fills up.
+static void
+do_ring_drain(sysring *r)
+{
+	while (r->sq_head != r->sq_tail
+			&& r->cq_tail - r->cq_head < SYS_RING_SIZE) {
+		// Don't let the compiler read the entry before the tail index.
+		asm volatile("" : : : "memory");
+
+		sysreq *rq = &r->sq[r->sq_head & (SYS_RING_SIZE-1)];
+		syscomp *cp = &r->cq[r->cq_tail & (SYS_RING_SIZE-1)];
+		cp->tag = rq->tag;
+		cp->status = (rq->eax & SYS_RING) ? -1	// no nested rings
+				: do_op(rq->eax, rq->ebx);
+
+		// Publish the completion before consuming the request,
+		// so the process never sees a free slot without its result.
+		asm volatile("" : : : "memory");
+		r->cq_tail++;
+		r->sq_head++;
+	}
+}
+
+static void
+do_ring(uint32_t ebx)
+{
+	cpu *c = cpu_cur();
+	sysring *r = (sysring *) ebx;
+
+	c->sysring = NULL;
+	if (r == NULL || !checkva(ebx, sizeof(sysring), 1))
+		return;
+	do_ring_drain(r);
+	if (r->flags & SYS_RING_POLL)
+		c->sysring = r;
+}
+
+void
+syscall(trapframe *tf)
+{
+	uint32_t cmd = tf->tf_regs.reg_eax;
+
+	// Run any requests a polling process has queued since we last looked.
+	syscall_poll();
+
+	if (cmd & SYS_RING) {
+		do_ring(tf->tf_regs.reg_ebx);
+		trap_return(tf);
+	}
+	switch (cmd & SYS_TYPE) {
+	case SYS_CPUTS:
+		do_cputs(tf->tf_regs.reg_ebx);
+		trap_return(tf);
+	default:
+		return;		// handle as a regular trap
+	}
+}
+
+void
+syscall_fast(sysframe *sf)
+{
+	trapstats *ts = &trap_stats[cpu_cur()->num];
+	uint64_t start = rdtsc();
+
+	// There's no trap() or trap_return() on this path,
+	// so keep the per-vector trap statistics here.
+	ts->count[T_SYSCALL]++;
+
+	syscall_poll();
+	if (sf->sf_eax & SYS_RING)
+		do_ring(sf->sf_ebx);
+	else
+		do_cputs(sf->sf_ebx);
+
+	ts->cycles[T_SYSCALL] += rdtsc() - start;
+}
+
+void
+syscall_poll(void)
+{
+	cpu *c = cpu_cur();
+
+	if (c->sysring != NULL)
+		do_ring_drain(c->sysring);
+}
@@ -0,0 +1,63 @@
+/*
+ * System call handling definitions.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#ifndef PIOS_KERN_SYSCALL_H
+#define PIOS_KERN_SYSCALL_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+#include <inc/trap.h>
+#include <inc/syscall.h>
+
+
+// Lean frame built by sysentry in kern/trapasm.S for system calls
+// that don't need a full trapframe.  EBX, ESI and EDI are saved only
+// so they can be read as arguments: C code preserves them anyway.
+typedef struct sysframe {
+	uint32_t sf_eax;
+	uint32_t sf_ebx;
+	uint32_t sf_ecx;
+	uint32_t sf_edx;
+	uint32_t sf_esi;
+	uint32_t sf_edi;
+	uint16_t sf_es;
+	uint16_t sf_padding1;
+	uint16_t sf_ds;
+	uint16_t sf_padding2;
+
+	// format from here on determined by x86 hardware architecture
+	uintptr_t sf_eip;
+	uint16_t sf_cs;
+	uint16_t sf_padding3;
+	uint32_t sf_eflags;
+
+	// rest included only when crossing rings, e.g., user to kernel
+	uintptr_t sf_esp;
+	uint16_t sf_ss;
+	uint16_t sf_padding4;
+} sysframe;
+
+
+// Handle a system call trap.
+// Returns to the caller via trap_return() if the call was handled;
+// returns normally only if the trap should be treated as a regular trap.
+void syscall(trapframe *tf);
+
+// Handle a CPUTS or SYS_RING system call taken through the lean entry path.
+// Returns normally; sysentry restores the saved registers and irets.
+void syscall_fast(sysframe *sf);
+
+// Drain the submission ring the current CPU is polling, if any.
+// Called on every system call and on device interrupts from user mode,
+// so a process in SYS_RING_POLL mode gets its queued requests run
+// without trapping for each one.
+void syscall_poll(void);
+
+#endif /* PIOS_KERN_SYSCALL_H */
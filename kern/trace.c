@@ -0,0 +1,92 @@
+/*
+ * Binary kernel trace log.
+ *
+ * Formatting output with vprintfmt is too slow for tracing hot paths,
+ * so trace() just stores the format string pointer, a timestamp,
+ * and the raw argument words in a per-CPU ring of records.
+ * Records are only formatted when dumped: by trace_dump() here,
+ * or off-line by tools/tracedump from a memory image of tracebufs.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#include <inc/stdio.h>
+#include <inc/stdarg.h>
+#include <inc/x86.h>
+
+#include <kern/cpu.h>
+#include <kern/trace.h>
+
+
+tracebuf tracebufs[MAX_CPUS];
+
+
+void
+trace_log(const char *fmt, ...)
+{
+	tracebuf *t = &tracebufs[cpu_cur()->num];
+	tracerec *r;
+	va_list ap;
+	int i;
+
+	// Keep this CPU's interrupt handlers from claiming the same slot.
+	uint32_t eflags = read_eflags();
+	cli();
+	r = &t->recs[t->head & (TRACE_NRECS-1)];
+	r->fmt = (uint32_t) fmt;
+	r->tsc = rdtsc();
+
+	// The trace() macro passes at least TRACE_MAXARGS words after fmt.
+	// Only the words the format string calls for get used.
+	va_start(ap, fmt);
+	for (i = 0; i < TRACE_MAXARGS; i++)
+		r->args[i] = va_arg(ap, uint32_t);
+	va_end(ap);
+
+	asm volatile("" ::: "memory");	// fill the record before counting it
+	t->head++;
+	write_eflags(eflags);
+}
+
+void
+trace_dump(void)
+{
+	uint32_t next[MAX_CPUS];
+	uint64_t t0 = 0;
+	int i;
+
+	for (i = 0; i < MAX_CPUS; i++) {
+		uint32_t head = tracebufs[i].head;
+		next[i] = head > TRACE_NRECS ? head - TRACE_NRECS : 0;
+	}
+
+	while (1) {
+		tracerec *r, *oldest = NULL;
+		int oldestcpu = 0;
+
+		for (i = 0; i < MAX_CPUS; i++) {
+			if (next[i] == tracebufs[i].head)
+				continue;
+			r = &tracebufs[i].recs[next[i] & (TRACE_NRECS-1)];
+			if (oldest == NULL || r->tsc < oldest->tsc)
+				oldest = r, oldestcpu = i;
+		}
+		if (oldest == NULL)
+			break;
+		next[oldestcpu]++;
+
+		if (t0 == 0)
+			t0 = oldest->tsc;
+		cprintf("[%d %10llu] ", oldestcpu, oldest->tsc - t0);
+
+		// Pass the raw words back as if they were the original
+		// arguments; on x86 they land on the stack the same way.
+		cprintf((const char *) oldest->fmt, oldest->args[0], oldest->args[1],
+			oldest->args[2], oldest->args[3], oldest->args[4]);
+		cprintf("\n");
+	}
+}
+
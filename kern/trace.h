@@ -0,0 +1,39 @@
+/*
+ * Binary kernel trace log.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#ifndef PIOS_KERN_TRACE_H
+#define PIOS_KERN_TRACE_H
+#ifndef PIOS_KERNEL
+# error "This is a kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/gcc.h>
+
+#include <kern/cpu.h>
+#include <kern/tracerec.h>
+
+
+extern tracebuf tracebufs[MAX_CPUS];
+
+
+// Log a trace record for later formatting by trace_dump() or tracedump.
+// Takes up to TRACE_MAXARGS arguments, each an int, unsigned or pointer:
+// pass a 64-bit value for a %ll conversion as two words, low word first.
+// Any %s arguments must point to strings that will still be there then,
+// such as constant strings in the kernel image.
+// We pad the arguments with zeros, so that trace_log() can always take
+// TRACE_MAXARGS words without reading past the ones actually passed.
+#define trace(...)	trace_log(__VA_ARGS__, 0, 0, 0, 0, 0)
+void trace_log(const char *fmt, ...);
+
+// Format and print all logged trace records, oldest first across CPUs.
+void trace_dump(void);
+
+#endif // PIOS_KERN_TRACE_H
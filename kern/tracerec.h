@@ -0,0 +1,31 @@
+/*
+ * Binary trace log format, shared by the kernel (kern/trace.c)
+ * and the host tool that formats dumps of it (tools/tracedump.c),
+ * so it depends on nothing but the uint32_t and uint64_t types,
+ * and lays out the same in the 32-bit kernel and a 64-bit host.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+#ifndef PIOS_KERN_TRACEREC_H
+#define PIOS_KERN_TRACEREC_H
+
+#define TRACE_NRECS	128	// Records per CPU; must be a power of 2
+#define TRACE_MAXARGS	5	// 32-bit argument words kept per record
+
+// One trace record: unformatted, so logging it costs a few stores.
+// A 64-bit argument takes two argument words.
+typedef struct tracerec {
+	uint64_t	tsc;		// Timestamp at which it was logged
+	uint32_t	fmt;		// Kernel address of printf-style format
+	uint32_t	args[TRACE_MAXARGS]; // Raw argument words
+} tracerec;
+
+// Each CPU's trace ring: the last TRACE_NRECS records it logged.
+// The kernel keeps an array of these, one per CPU, called tracebufs.
+typedef struct tracebuf {
+	tracerec	recs[TRACE_NRECS];
+	volatile uint32_t head;		// Records ever logged on this CPU
+} __attribute__((aligned(64))) tracebuf;
+
+#endif /* PIOS_KERN_TRACEREC_H */
@@ -16,13 +16,24 @@
 #include <kern/trap.h>
 #include <kern/console.h>
 #include <kern/init.h>
+#include <kern/syscall.h>
+#include <kern/pmap.h>
+#include <kern/trace.h>
+
+#include <dev/pic.h>
+#include <dev/serial.h>
+#include <dev/kbd.h>
 
 extern int vectors[];
+extern int irqvectors[];
+extern char sysentry[];
 
 // Interrupt descriptor table.  Must be built at run time because
 // shifted function addresses can't be represented in relocation records.
 static struct gatedesc idt[256];
 
+trapstats trap_stats[MAX_CPUS];
+
 // This "pseudo-descriptor" is needed only by the LIDT instruction,
 // to specify both the size and address of th IDT at once.
 static struct pseudodesc idt_pd = {
@@ -41,6 +52,13 @@ trap_init_idt(void)
 	}
 	SETGATE(idt[3], 0, 1<<3, vectors[3], 3); //This is T_BRKPT, that 1<<3 corresponds to SEG_KCODE<<3 from xv6.
 	SETGATE(idt[4], 0, 1<<3, vectors[4], 3); //This is T_OFLOW, that 1<<3 corresponds to SEG_KCODE<<3 from xv6.
+
+	// Hardware interrupts from the PIC
+	for (i = 0; i < MAX_IRQS; i++)
+		SETGATE(idt[T_IRQ0 + i], 0, CPU_GDT_KCODE, irqvectors[i], 0);
+
+	// System call gate, reachable from user mode via 'int $T_SYSCALL'.
+	SETGATE(idt[T_SYSCALL], 0, CPU_GDT_KCODE, sysentry, 3);
 	//panic("trap_init() not implemented.");
 }
 
@@ -55,10 +73,6 @@ trap_init(void)
 
 	// Load the IDT into this processor's IDT register.
 	asm volatile("lidt %0" : : "m" (idt_pd));
-
-	// Check for the correct IDT and trap handler operation.
-	if (cpu_onboot())
-		trap_check_kernel();
 }
 
 const char *trap_name(int trapno)
@@ -88,6 +102,10 @@ const char *trap_name(int trapno)
 
 	if (trapno < sizeof(excnames)/sizeof(excnames[0]))
 		return excnames[trapno];
+	if (trapno == T_SYSCALL)
+		return "System call";
+	if (trapno >= T_IRQ0 && trapno < T_IRQ0 + MAX_IRQS)
+		return "Hardware Interrupt";
 	return "(unknown trap)";
 }
 
@@ -127,15 +145,85 @@ trap(trapframe *tf)
 	// and some versions of GCC rely on DF being clear.
 	asm volatile("cld" ::: "cc");
 
-	// If this trap was anticipated, just use the designated handler.
+	// Count the trap and start charging cycles to its vector.
+	// A nested trap restarts the clock; the outer trap's
+	// remaining cycles then go uncounted, which is rare enough.
 	cpu *c = cpu_cur();
+	trapstats *ts = &trap_stats[c->num];
+	if (tf->tf_trapno < TRAP_NSTATS) {
+		ts->count[tf->tf_trapno]++;
+		ts->vec = tf->tf_trapno;
+		ts->start = rdtsc();
+	}
+	trace("trap %d (%s) at eip %x", tf->tf_trapno,
+		trap_name(tf->tf_trapno), tf->tf_eip);
+
+	// Device interrupts are never the trap a recovery handler expects,
+	// so service them first.  The PIC runs in automatic-EOI mode.
+	if (tf->tf_trapno >= T_IRQ0 && tf->tf_trapno < T_IRQ0 + MAX_IRQS) {
+		if (tf->tf_trapno == T_IRQ0 + IRQ_KBD)
+			kbd_intr();
+		else if (tf->tf_trapno == T_IRQ0 + IRQ_SERIAL)
+			serial_intr();
+
+		// A device interrupt from user mode is also a chance to run
+		// requests a polling process has queued since we last looked.
+		if ((tf->tf_cs & 3) == 3)
+			syscall_poll();
+		trap_return(tf);	// ignore spurious and unexpected IRQs
+	}
+
+	// Copy-on-write faults are part of normal operation:
+	// pmap_pagefault() returns only if this isn't one.
+	if (tf->tf_trapno == T_PGFLT)
+		pmap_pagefault(tf);
+
+	// If this trap was anticipated, just use the designated handler.
 	if (c->recover)
 		c->recover(tf, c->recoverdata);
 
+	if (tf->tf_trapno == T_SYSCALL)
+		syscall(tf);	// returns only if it couldn't handle the call
+
 	trap_print(tf);
 	panic("unhandled trap");
 }
 
+// Charge the cycles spent since trap() was entered to the trap's vector.
+// Called by trap_return() on every way back out of the kernel.
+void
+trap_account(void)
+{
+	trapstats *ts = &trap_stats[cpu_cur()->num];
+	if (ts->start == 0)
+		return;		// not returning from a counted trap
+	ts->cycles[ts->vec] += rdtsc() - ts->start;
+	ts->start = 0;
+}
+
+// Print the current CPU's per-vector trap statistics as a table.
+void
+trap_print_stats(void)
+{
+	trapstats *ts = &trap_stats[cpu_cur()->num];
+	uint64_t totcycles = 0;
+	uint32_t totcount = 0;
+	int v;
+
+	cprintf("vec name                              count"
+		"           cycles      avg\n");
+	for (v = 0; v < TRAP_NSTATS; v++) {
+		if (ts->count[v] == 0)
+			continue;
+		cprintf("%3d %-30s %10u %16llu %8llu\n", v, trap_name(v),
+			ts->count[v], ts->cycles[v],
+			ts->cycles[v] / ts->count[v]);
+		totcount += ts->count[v];
+		totcycles += ts->cycles[v];
+	}
+	cprintf("    %-30s %10u %16llu\n", "total", totcount, totcycles);
+}
+
 
 // Helper function for trap_check_recover(), below:
 // handles "anticipated" traps by simply resuming at a new EIP.
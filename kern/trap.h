@@ -18,6 +18,8 @@
 #include <inc/mmu.h>
 #include <inc/gcc.h>
 
+#include <kern/cpu.h>
+
 
 // Arguments that trap_check() passes to trap recovery code,
 // so that the latter can resume the trapping code
@@ -30,6 +32,24 @@ typedef struct trap_check_args {
 } trap_check_args;
 
 
+// Number of trap vectors (0 through T_SYSCALL) we keep statistics on
+#define TRAP_NSTATS	49
+
+// Per-vector trap counts and cumulative cycles spent handling them,
+// for one CPU.  Kept outside the cpu struct, so they don't take room
+// from the kernel stack sharing its page, and one per cache line,
+// so that counting a trap never writes to a line another CPU writes.
+typedef struct trapstats {
+	uint32_t	count[TRAP_NSTATS];
+	uint64_t	cycles[TRAP_NSTATS];
+	uint64_t	start;		// TSC at entry to trap(), 0 if none
+	uint32_t	vec;		// Vector start applies to
+} gcc_aligned(64) trapstats;
+
+// Trap statistics for each CPU, indexed by cpu.num
+extern trapstats trap_stats[MAX_CPUS];
+
+
 // Initialize the trap-handling module and the processor's IDT.
 void trap_init(void);
 
@@ -46,6 +66,14 @@ void trap_print(trapframe *tf);
 void trap(trapframe *tf) gcc_noreturn;
 void trap_return(trapframe *tf) gcc_noreturn;
 
+// Charge the cycles since trap() was entered to the trap being handled.
+// Called from trap_return() on the way back out of the kernel.
+void trap_account(void);
+
+// Print this CPU's per-vector trap counts and cycles, using trap_name().
+// Called from panic(), to show what the kernel was busy with.
+void trap_print_stats(void);
+
 // Check for correct operation of trap handling.
 void trap_check_kernel(void);
 void trap_check_user(void);
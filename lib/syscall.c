@@ -0,0 +1,71 @@
+/*
+ * User-level system call stubs,
+ * which load the register conventions described in inc/syscall.h
+ * and trap into the kernel.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ *
+ * Primary author: Bryan Ford
+ */
+
+#include <inc/syscall.h>
+
+
+void
+sys_cputs(const char *s)
+{
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_CPUTS),
+		  "b" (s)
+		: "cc", "memory");
+}
+
+void
+sys_put(uint32_t flags, uint16_t child, cpustate *cpu,
+	void *localsrc, void *childdest, size_t size)
+{
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_PUT | flags),
+		  "b" (cpu),
+		  "d" (child),
+		  "S" (localsrc),
+		  "D" (childdest),
+		  "c" (size)
+		: "cc", "memory");
+}
+
+void
+sys_get(uint32_t flags, uint16_t child, cpustate *cpu,
+	void *childsrc, void *localdest, size_t size)
+{
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_GET | flags),
+		  "b" (cpu),
+		  "d" (child),
+		  "S" (childsrc),
+		  "D" (localdest),
+		  "c" (size)
+		: "cc", "memory");
+}
+
+void
+sys_ret(void)
+{
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_RET));
+}
+
+void
+sys_ring(sysring *ring)
+{
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_RING),
+		  "b" (ring)
+		: "cc", "memory");
+}
@@ -0,0 +1,359 @@
+
+obj/boot/bootblock.elf:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+.set CR0_PE_ON,      0x1         # protected mode enable flag
+
+.globl start
+start:
+  .code16                     # Assemble for 16-bit mode
+  cli                         # Disable interrupts
+    7c00:	fa                   	cli
+  cld                         # String operations increment
+    7c01:	fc                   	cld
+
+  # Set up the important data segment registers (DS, ES, SS).
+  xorw    %ax,%ax             # Segment number zero
+    7c02:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c04:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c06:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c08:	8e d0                	mov    %eax,%ss
+
+00007c0a <seta20.1>:
+  # Enable A20:
+  #   For backwards compatibility with the earliest PCs, physical
+  #   address line 20 is tied low, so that addresses higher than
+  #   1MB wrap around to zero by default.  This code undoes this.
+seta20.1:
+  inb     $0x64,%al               # Wait for not busy
+    7c0a:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c0c:	a8 02                	test   $0x2,%al
+  jnz     seta20.1
+    7c0e:	75 fa                	jne    7c0a <seta20.1>
+
+  movb    $0xd1,%al               # 0xd1 -> port 0x64
+    7c10:	b0 d1                	mov    $0xd1,%al
+  outb    %al,$0x64
+    7c12:	e6 64                	out    %al,$0x64
+
+00007c14 <seta20.2>:
+
+seta20.2:
+  inb     $0x64,%al               # Wait for not busy
+    7c14:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c16:	a8 02                	test   $0x2,%al
+  jnz     seta20.2
+    7c18:	75 fa                	jne    7c14 <seta20.2>
+
+  movb    $0xdf,%al               # 0xdf -> port 0x60
+    7c1a:	b0 df                	mov    $0xdf,%al
+  outb    %al,$0x60
+    7c1c:	e6 60                	out    %al,$0x60
+
+  # Switch from real to protected mode, using a bootstrap GDT
+  # and segment translation that makes virtual addresses 
+  # identical to their physical addresses, so that the 
+  # effective memory map does not change during the switch.
+  lgdt    gdtdesc
+    7c1e:	0f 01 16             	lgdtl  (%esi)
+    7c21:	64 7c 0f             	fs jl  7c33 <protcseg+0x1>
+  movl    %cr0, %eax
+    7c24:	20 c0                	and    %al,%al
+  orl     $CR0_PE_ON, %eax
+    7c26:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7c2a:	0f 22 c0             	mov    %eax,%cr0
+  
+  # Jump to next instruction, but in 32-bit code segment.
+  # Switches processor into 32-bit mode.
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    7c2d:	ea                   	.byte 0xea
+    7c2e:	32 7c 08 00          	xor    0x0(%eax,%ecx,1),%bh
+
+00007c32 <protcseg>:
+
+  .code32                     # Assemble for 32-bit mode
+protcseg:
+  # Set up the protected-mode data segment registers
+  movw    $PROT_MODE_DSEG, %ax    # Our data segment selector
+    7c32:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7c36:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7c38:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    7c3a:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c3c:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7c3e:	8e d0                	mov    %eax,%ss
+  
+  # Set up the stack pointer and call into C.
+  movl    $start, %esp
+    7c40:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  call bootmain
+    7c45:	e8 11 01 00 00       	call   7d5b <bootmain>
+
+00007c4a <spin>:
+
+  # If bootmain returns (it shouldn't), loop.
+spin:
+  jmp spin
+    7c4a:	eb fe                	jmp    7c4a <spin>
+
+00007c4c <gdt>:
+	...
+    7c54:	ff                   	(bad)
+    7c55:	ff 00                	incl   (%eax)
+    7c57:	00 00                	add    %al,(%eax)
+    7c59:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7c60:	00                   	.byte 0x0
+    7c61:	92                   	xchg   %eax,%edx
+    7c62:	cf                   	iret
+	...
+
+00007c64 <gdtdesc>:
+    7c64:	17                   	pop    %ss
+    7c65:	00 4c 7c 00          	add    %cl,0x0(%esp,%edi,2)
+	...
+
+00007c6a <readseg>:
+
+// Read 'count' bytes at 'offset' from kernel into virtual address 'va'.
+// Might copy more than asked
+static void
+readseg(uint32_t va, uint32_t count, uint32_t offset)
+{
+    7c6a:	55                   	push   %ebp
+	
+	// round down to sector boundary
+	va &= ~(SECTSIZE - 1);
+
+	// translate from bytes to sectors, and kernel starts at sector 1
+	offset = (offset / SECTSIZE) + 1;
+    7c6b:	c1 e9 09             	shr    $0x9,%ecx
+{
+    7c6e:	89 e5                	mov    %esp,%ebp
+    7c70:	57                   	push   %edi
+    7c71:	56                   	push   %esi
+    7c72:	53                   	push   %ebx
+	va &= 0xFFFFFF;
+    7c73:	89 c3                	mov    %eax,%ebx
+	va &= ~(SECTSIZE - 1);
+    7c75:	25 00 fe ff 00       	and    $0xfffe00,%eax
+	va &= 0xFFFFFF;
+    7c7a:	81 e3 ff ff ff 00    	and    $0xffffff,%ebx
+	va &= ~(SECTSIZE - 1);
+    7c80:	89 c6                	mov    %eax,%esi
+	end_va = va + count;
+    7c82:	8d 3c 13             	lea    (%ebx,%edx,1),%edi
+	offset = (offset / SECTSIZE) + 1;
+    7c85:	8d 59 01             	lea    0x1(%ecx),%ebx
+{
+    7c88:	83 ec 10             	sub    $0x10,%esp
+	end_va = va + count;
+    7c8b:	89 7d ec             	mov    %edi,-0x14(%ebp)
+
+	// Read up to 255 sectors per command, since each command costs
+	// a full handshake with the disk while its sectors stream out fast.
+	// We'd write more to memory than asked, but it doesn't matter --
+	// we load in increasing order.
+	while (va < end_va) {
+    7c8e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    7c91:	39 c6                	cmp    %eax,%esi
+    7c93:	0f 83 ba 00 00 00    	jae    7d53 <readseg+0xe9>
+		uint32_t nsect = (end_va - va + SECTSIZE - 1) / SECTSIZE;
+    7c99:	8b 45 ec             	mov    -0x14(%ebp),%eax
+		if (nsect > 255)
+			nsect = 255;
+    7c9c:	c7 45 f0 ff 00 00 00 	movl   $0xff,-0x10(%ebp)
+		uint32_t nsect = (end_va - va + SECTSIZE - 1) / SECTSIZE;
+    7ca3:	05 ff 01 00 00       	add    $0x1ff,%eax
+    7ca8:	29 f0                	sub    %esi,%eax
+		if (nsect > 255)
+    7caa:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    7caf:	77 06                	ja     7cb7 <readseg+0x4d>
+		uint32_t nsect = (end_va - va + SECTSIZE - 1) / SECTSIZE;
+    7cb1:	c1 e8 09             	shr    $0x9,%eax
+    7cb4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		readsects((uint8_t*) va, offset, nsect);
+    7cb7:	89 75 e8             	mov    %esi,-0x18(%ebp)
+
+static gcc_inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7cba:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+    7cbf:	89 ca                	mov    %ecx,%edx
+    7cc1:	ec                   	in     (%dx),%al
+
+static void
+waitdisk(void)
+{
+	// wait for disk reaady
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7cc2:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cc5:	3c 40                	cmp    $0x40,%al
+    7cc7:	75 f6                	jne    7cbf <readseg+0x55>
+}
+
+static gcc_inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7cc9:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7cce:	8a 45 f0             	mov    -0x10(%ebp),%al
+    7cd1:	ee                   	out    %al,(%dx)
+    7cd2:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cd7:	89 d8                	mov    %ebx,%eax
+    7cd9:	ee                   	out    %al,(%dx)
+	// wait for disk to be ready
+	waitdisk();
+
+	outb(0x1F2, nsect);	// count = nsect, at most 255
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+    7cda:	89 d8                	mov    %ebx,%eax
+    7cdc:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7ce1:	c1 e8 08             	shr    $0x8,%eax
+    7ce4:	ee                   	out    %al,(%dx)
+	outb(0x1F5, offset >> 16);
+    7ce5:	89 d8                	mov    %ebx,%eax
+    7ce7:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cec:	c1 e8 10             	shr    $0x10,%eax
+    7cef:	ee                   	out    %al,(%dx)
+	outb(0x1F6, (offset >> 24) | 0xE0);
+    7cf0:	89 d8                	mov    %ebx,%eax
+    7cf2:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cf7:	c1 e8 18             	shr    $0x18,%eax
+    7cfa:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cfd:	ee                   	out    %al,(%dx)
+    7cfe:	b0 20                	mov    $0x20,%al
+    7d00:	89 ca                	mov    %ecx,%edx
+    7d02:	ee                   	out    %al,(%dx)
+}
+    7d03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    7d06:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+	// read the sectors as the disk delivers them
+	while (nsect-- > 0) {
+    7d09:	ff 4d e4             	decl   -0x1c(%ebp)
+    7d0c:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    7d10:	74 2f                	je     7d41 <readseg+0xd7>
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7d12:	ba f6 03 00 00       	mov    $0x3f6,%edx
+    7d17:	ec                   	in     (%dx),%al
+    7d18:	ec                   	in     (%dx),%al
+    7d19:	ec                   	in     (%dx),%al
+    7d1a:	ec                   	in     (%dx),%al
+    7d1b:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d20:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0x88) != 0x08)	// BSY clear, DRQ set
+    7d21:	83 e0 88             	and    $0xffffff88,%eax
+    7d24:	3c 08                	cmp    $0x8,%al
+    7d26:	75 f3                	jne    7d1b <readseg+0xb1>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+    7d28:	8b 7d e8             	mov    -0x18(%ebp),%edi
+    7d2b:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d30:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d35:	fc                   	cld
+    7d36:	f2 6d                	repnz insl (%dx),%es:(%edi)
+		waitdata();
+		insl(0x1F0, dst, SECTSIZE/4);
+		dst += SECTSIZE;
+    7d38:	81 45 e8 00 02 00 00 	addl   $0x200,-0x18(%ebp)
+    7d3f:	eb c8                	jmp    7d09 <readseg+0x9f>
+		va += nsect * SECTSIZE;
+    7d41:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    7d44:	c1 e0 09             	shl    $0x9,%eax
+    7d47:	01 c6                	add    %eax,%esi
+		offset += nsect;
+    7d49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    7d4c:	01 c3                	add    %eax,%ebx
+    7d4e:	e9 3b ff ff ff       	jmp    7c8e <readseg+0x24>
+	}
+}
+    7d53:	83 c4 10             	add    $0x10,%esp
+    7d56:	5b                   	pop    %ebx
+    7d57:	5e                   	pop    %esi
+    7d58:	5f                   	pop    %edi
+    7d59:	5d                   	pop    %ebp
+    7d5a:	c3                   	ret
+
+00007d5b <bootmain>:
+{
+    7d5b:	55                   	push   %ebp
+    7d5c:	89 e5                	mov    %esp,%ebp
+    7d5e:	56                   	push   %esi
+    7d5f:	53                   	push   %ebx
+
+static gcc_inline uint64_t
+rdtsc(void)
+{
+        uint64_t tsc;
+        asm volatile("rdtsc" : "=A" (tsc));
+    7d60:	0f 31                	rdtsc
+	stamps[BOOTTIME_LOADER] = rdtsc();
+    7d62:	a3 00 80 00 00       	mov    %eax,0x8000
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7d67:	31 c9                	xor    %ecx,%ecx
+    7d69:	b8 00 00 01 00       	mov    $0x10000,%eax
+	stamps[BOOTTIME_LOADER] = rdtsc();
+    7d6e:	89 15 04 80 00 00    	mov    %edx,0x8004
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7d74:	ba 00 10 00 00       	mov    $0x1000,%edx
+    7d79:	e8 ec fe ff ff       	call   7c6a <readseg>
+	if (ELFHDR->e_magic != ELF_MAGIC)
+    7d7e:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7d85:	45 4c 46 
+    7d88:	75 47                	jne    7dd1 <bootmain+0x76>
+	ph = (proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7d8a:	a1 1c 00 01 00       	mov    0x1001c,%eax
+	eph = ph + ELFHDR->e_phnum;
+    7d8f:	0f b7 35 2c 00 01 00 	movzwl 0x1002c,%esi
+	ph = (proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7d96:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+	eph = ph + ELFHDR->e_phnum;
+    7d9c:	c1 e6 05             	shl    $0x5,%esi
+    7d9f:	01 de                	add    %ebx,%esi
+	for (; ph < eph; ph++)
+    7da1:	39 f3                	cmp    %esi,%ebx
+    7da3:	73 13                	jae    7db8 <bootmain+0x5d>
+		readseg(ph->p_va, ph->p_memsz, ph->p_offset);
+    7da5:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    7da8:	8b 53 14             	mov    0x14(%ebx),%edx
+	for (; ph < eph; ph++)
+    7dab:	83 c3 20             	add    $0x20,%ebx
+		readseg(ph->p_va, ph->p_memsz, ph->p_offset);
+    7dae:	8b 43 e8             	mov    -0x18(%ebx),%eax
+    7db1:	e8 b4 fe ff ff       	call   7c6a <readseg>
+	for (; ph < eph; ph++)
+    7db6:	eb e9                	jmp    7da1 <bootmain+0x46>
+    7db8:	0f 31                	rdtsc
+	stamps[BOOTTIME_LOADED] = rdtsc();
+    7dba:	a3 08 80 00 00       	mov    %eax,0x8008
+	((void (*)(void)) (ELFHDR->e_entry & 0xFFFFFF))();
+    7dbf:	a1 18 00 01 00       	mov    0x10018,%eax
+	stamps[BOOTTIME_LOADED] = rdtsc();
+    7dc4:	89 15 0c 80 00 00    	mov    %edx,0x800c
+	((void (*)(void)) (ELFHDR->e_entry & 0xFFFFFF))();
+    7dca:	25 ff ff ff 00       	and    $0xffffff,%eax
+    7dcf:	ff d0                	call   *%eax
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+    7dd1:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+    7dd6:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+    7ddb:	66 ef                	out    %ax,(%dx)
+    7ddd:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+    7de2:	66 ef                	out    %ax,(%dx)
+	while (1)
+    7de4:	eb fe                	jmp    7de4 <bootmain+0x89>
@@ -0,0 +1,112 @@
+
+obj/boot/bootother.elf:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <start>:
+.set BOOT_NSTACKS,   start-16
+
+.globl start
+start:
+  .code16                     # Assemble for 16-bit mode
+  cli                         # Disable interrupts
+    1000:	fa                   	cli
+  cld                         # String operations increment
+    1001:	fc                   	cld
+
+  # Set up the important data segment registers (DS, ES, SS).
+  xorw    %ax,%ax             # Segment number zero
+    1002:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    1004:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    1006:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    1008:	8e d0                	mov    %eax,%ss
+  # Switch from real to protected mode, using a bootstrap GDT
+  # and segment translation that makes virtual addresses 
+  # identical to their physical addresses, so that the 
+  # effective memory map does not change during the switch.
+  # The boot CPU already enabled A20.
+  lgdt    gdtdesc
+    100a:	0f 01 16             	lgdtl  (%esi)
+    100d:	70 10                	jo     101f <protcseg+0x1>
+  movl    %cr0, %eax
+    100f:	0f 20 c0             	mov    %cr0,%eax
+  orl     $CR0_PE_ON, %eax
+    1012:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    1016:	0f 22 c0             	mov    %eax,%cr0
+
+  # Jump to next instruction, but in 32-bit code segment.
+  # Switches processor into 32-bit mode.
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    1019:	ea                   	.byte 0xea
+    101a:	1e                   	push   %ds
+    101b:	10 08                	adc    %cl,(%eax)
+	...
+
+0000101e <protcseg>:
+
+  .code32                     # Assemble for 32-bit mode
+protcseg:
+  # Set up the protected-mode data segment registers
+  movw    $PROT_MODE_DSEG, %ax    # Our data segment selector
+    101e:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    1022:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    1024:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    1026:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    1028:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: Stack Segment
+    102a:	8e d0                	mov    %eax,%ss
+
+  # Claim a stack: the top of a cpu struct's page, so cpu_cur() works.
+  # Any CPU the boot CPU didn't expect gets none, and stops here.
+  movl    $1, %eax
+    102c:	b8 01 00 00 00       	mov    $0x1,%eax
+  lock
+    1031:	f0 0f c1 05 f4 0f 00 	lock xadd %eax,0xff4
+    1038:	00 
+  xaddl   %eax, BOOT_NEXT
+  cmpl    BOOT_NSTACKS, %eax
+    1039:	3b 05 f0 0f 00 00    	cmp    0xff0,%eax
+  jae     spin
+    103f:	73 14                	jae    1055 <spin>
+  movl    BOOT_STACKS, %ebx
+    1041:	8b 1d f8 0f 00 00    	mov    0xff8,%ebx
+  movl    (%ebx,%eax,4), %esp
+    1047:	8b 24 83             	mov    (%ebx,%eax,4),%esp
+  movl    $0, %ebp                # nuke frame pointer for backtraces
+    104a:	bd 00 00 00 00       	mov    $0x0,%ebp
+  call    *(BOOT_ENTRY)
+    104f:	ff 15 fc 0f 00 00    	call   *0xffc
+
+00001055 <spin>:
+
+  # If the C code returns (it shouldn't), loop.
+spin:
+  hlt
+    1055:	f4                   	hlt
+  jmp spin
+    1056:	eb fd                	jmp    1055 <spin>
+
+00001058 <gdt>:
+	...
+    1060:	ff                   	(bad)
+    1061:	ff 00                	incl   (%eax)
+    1063:	00 00                	add    %al,(%eax)
+    1065:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    106c:	00                   	.byte 0x0
+    106d:	92                   	xchg   %eax,%edx
+    106e:	cf                   	iret
+	...
+
+00001070 <gdtdesc>:
+    1070:	17                   	pop    %ss
+    1071:	00 58 10             	add    %bl,0x10(%eax)
+	...
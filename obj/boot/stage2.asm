@@ -0,0 +1,373 @@
+
+obj/boot/stage2.elf:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00020000 <readsects>:
+			scratch = end;
+	}
+	scratch = (uint8_t *) ROUNDUP((uint32_t) scratch, SECTSIZE);
+
+	for (i = 0; i < ZHDR->nsegs; i++) {
+		zimage_seg *s = &ZHDR->segs[i];
+   20000:	55                   	push   %ebp
+   20001:	89 e5                	mov    %esp,%ebp
+   20003:	57                   	push   %edi
+
+static gcc_inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+   20004:	bf f7 01 00 00       	mov    $0x1f7,%edi
+}
+
+// Read nsect (at most 255) sectors starting at sector 'offset' into dst.
+static void
+readsects(uint8_t *dst, uint32_t offset, uint32_t nsect)
+{
+   20009:	56                   	push   %esi
+   2000a:	89 c6                	mov    %eax,%esi
+   2000c:	53                   	push   %ebx
+   2000d:	89 d3                	mov    %edx,%ebx
+   2000f:	89 fa                	mov    %edi,%edx
+   20011:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+   20012:	83 e0 c0             	and    $0xffffffc0,%eax
+   20015:	3c 40                	cmp    $0x40,%al
+   20017:	75 f6                	jne    2000f <readsects+0xf>
+}
+
+static gcc_inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+   20019:	ba f2 01 00 00       	mov    $0x1f2,%edx
+   2001e:	89 c8                	mov    %ecx,%eax
+   20020:	ee                   	out    %al,(%dx)
+   20021:	ba f3 01 00 00       	mov    $0x1f3,%edx
+   20026:	89 d8                	mov    %ebx,%eax
+   20028:	ee                   	out    %al,(%dx)
+	// wait for disk to be ready
+	waitdisk();
+
+	outb(0x1F2, nsect);	// count = nsect, at most 255
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+   20029:	89 d8                	mov    %ebx,%eax
+   2002b:	ba f4 01 00 00       	mov    $0x1f4,%edx
+   20030:	c1 e8 08             	shr    $0x8,%eax
+   20033:	ee                   	out    %al,(%dx)
+	outb(0x1F5, offset >> 16);
+   20034:	89 d8                	mov    %ebx,%eax
+   20036:	ba f5 01 00 00       	mov    $0x1f5,%edx
+   2003b:	c1 e8 10             	shr    $0x10,%eax
+   2003e:	ee                   	out    %al,(%dx)
+	outb(0x1F6, (offset >> 24) | 0xE0);
+   2003f:	89 d8                	mov    %ebx,%eax
+   20041:	ba f6 01 00 00       	mov    $0x1f6,%edx
+   20046:	c1 e8 18             	shr    $0x18,%eax
+   20049:	83 c8 e0             	or     $0xffffffe0,%eax
+   2004c:	ee                   	out    %al,(%dx)
+   2004d:	b0 20                	mov    $0x20,%al
+   2004f:	89 fa                	mov    %edi,%edx
+   20051:	ee                   	out    %al,(%dx)
+	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+	// read the sectors as the disk delivers them
+	while (nsect-- > 0) {
+   20052:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+   20055:	ba f6 03 00 00       	mov    $0x3f6,%edx
+   2005a:	ec                   	in     (%dx),%al
+   2005b:	ec                   	in     (%dx),%al
+   2005c:	ec                   	in     (%dx),%al
+   2005d:	ec                   	in     (%dx),%al
+   2005e:	ba f7 01 00 00       	mov    $0x1f7,%edx
+   20063:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0x88) != 0x08)	// BSY clear, DRQ set
+   20064:	83 e0 88             	and    $0xffffff88,%eax
+   20067:	3c 08                	cmp    $0x8,%al
+   20069:	75 f3                	jne    2005e <readsects+0x5e>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+   2006b:	89 f7                	mov    %esi,%edi
+   2006d:	b9 80 00 00 00       	mov    $0x80,%ecx
+   20072:	ba f0 01 00 00       	mov    $0x1f0,%edx
+   20077:	fc                   	cld
+   20078:	f2 6d                	repnz insl (%dx),%es:(%edi)
+		waitdata();
+		insl(0x1F0, dst, SECTSIZE/4);
+		dst += SECTSIZE;
+   2007a:	81 c6 00 02 00 00    	add    $0x200,%esi
+	while (nsect-- > 0) {
+   20080:	83 eb 01             	sub    $0x1,%ebx
+   20083:	73 d0                	jae    20055 <readsects+0x55>
+	}
+}
+   20085:	5b                   	pop    %ebx
+   20086:	5e                   	pop    %esi
+   20087:	5f                   	pop    %edi
+   20088:	5d                   	pop    %ebp
+   20089:	c3                   	ret
+
+0002008a <stage2main>:
+{
+   2008a:	55                   	push   %ebp
+	readsects((uint8_t *) ZHDR, ZIMAGE_SECTOR, 1);
+   2008b:	b9 01 00 00 00       	mov    $0x1,%ecx
+   20090:	ba 11 00 00 00       	mov    $0x11,%edx
+   20095:	b8 00 00 01 00       	mov    $0x10000,%eax
+{
+   2009a:	89 e5                	mov    %esp,%ebp
+   2009c:	57                   	push   %edi
+   2009d:	56                   	push   %esi
+   2009e:	53                   	push   %ebx
+   2009f:	83 ec 2c             	sub    $0x2c,%esp
+	readsects((uint8_t *) ZHDR, ZIMAGE_SECTOR, 1);
+   200a2:	e8 59 ff ff ff       	call   20000 <readsects>
+	if (ZHDR->magic != ZIMAGE_MAGIC || ZHDR->nsegs > ZIMAGE_MAXSEGS)
+   200a7:	81 3d 00 00 01 00 34 	cmpl   $0x5a4b4c34,0x10000
+   200ae:	4c 4b 5a 
+   200b1:	0f 85 83 01 00 00    	jne    2023a <stage2main+0x1b0>
+   200b7:	8b 1d 08 00 01 00    	mov    0x10008,%ebx
+   200bd:	83 fb 08             	cmp    $0x8,%ebx
+   200c0:	0f 87 74 01 00 00    	ja     2023a <stage2main+0x1b0>
+	for (i = 0; i < ZHDR->nsegs; i++) {
+   200c6:	31 c9                	xor    %ecx,%ecx
+	uint8_t *scratch = 0;
+   200c8:	31 c0                	xor    %eax,%eax
+	for (i = 0; i < ZHDR->nsegs; i++) {
+   200ca:	39 d9                	cmp    %ebx,%ecx
+   200cc:	74 1d                	je     200eb <stage2main+0x61>
+		zimage_seg *s = &ZHDR->segs[i];
+   200ce:	6b f1 14             	imul   $0x14,%ecx,%esi
+		uint8_t *end = (uint8_t *) ((s->va & 0xFFFFFF) + s->memsz);
+   200d1:	8b 96 0c 00 01 00    	mov    0x1000c(%esi),%edx
+   200d7:	81 e2 ff ff ff 00    	and    $0xffffff,%edx
+   200dd:	03 96 14 00 01 00    	add    0x10014(%esi),%edx
+   200e3:	39 d0                	cmp    %edx,%eax
+   200e5:	0f 42 c2             	cmovb  %edx,%eax
+	for (i = 0; i < ZHDR->nsegs; i++) {
+   200e8:	41                   	inc    %ecx
+   200e9:	eb df                	jmp    200ca <stage2main+0x40>
+	scratch = (uint8_t *) ROUNDUP((uint32_t) scratch, SECTSIZE);
+   200eb:	05 ff 01 00 00       	add    $0x1ff,%eax
+   200f0:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+   200f5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (i = 0; i < ZHDR->nsegs; i++) {
+   200f8:	31 c0                	xor    %eax,%eax
+   200fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+   200fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+   20100:	3b 05 08 00 01 00    	cmp    0x10008,%eax
+   20106:	0f 83 15 01 00 00    	jae    20221 <stage2main+0x197>
+		zimage_seg *s = &ZHDR->segs[i];
+   2010c:	6b 45 e0 14          	imul   $0x14,-0x20(%ebp),%eax
+   20110:	8d b8 0c 00 01 00    	lea    0x1000c(%eax),%edi
+		uint8_t *va = (uint8_t *) (s->va & 0xFFFFFF);
+   20116:	8b 80 0c 00 01 00    	mov    0x1000c(%eax),%eax
+		zimage_seg *s = &ZHDR->segs[i];
+   2011c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+		uint8_t *va = (uint8_t *) (s->va & 0xFFFFFF);
+   2011f:	25 ff ff ff 00       	and    $0xffffff,%eax
+   20124:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		uint32_t sect = ZIMAGE_SECTOR + s->zoffset / SECTSIZE;
+   20127:	8b 47 0c             	mov    0xc(%edi),%eax
+   2012a:	c1 e8 09             	shr    $0x9,%eax
+   2012d:	83 c0 11             	add    $0x11,%eax
+   20130:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		uint32_t nsect = (s->zsize + SECTSIZE - 1) / SECTSIZE;
+   20133:	8b 47 10             	mov    0x10(%edi),%eax
+		uint8_t *p = scratch;
+   20136:	8b 7d dc             	mov    -0x24(%ebp),%edi
+		uint32_t nsect = (s->zsize + SECTSIZE - 1) / SECTSIZE;
+   20139:	89 45 d0             	mov    %eax,-0x30(%ebp)
+   2013c:	8d 98 ff 01 00 00    	lea    0x1ff(%eax),%ebx
+   20142:	c1 eb 09             	shr    $0x9,%ebx
+
+		while (nsect > 0) {
+   20145:	85 db                	test   %ebx,%ebx
+   20147:	74 24                	je     2016d <stage2main+0xe3>
+			uint32_t n = MIN(nsect, 255);
+   20149:	be ff 00 00 00       	mov    $0xff,%esi
+			readsects(p, sect, n);
+   2014e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+   20151:	89 f8                	mov    %edi,%eax
+			uint32_t n = MIN(nsect, 255);
+   20153:	39 f3                	cmp    %esi,%ebx
+   20155:	0f 46 f3             	cmovbe %ebx,%esi
+			readsects(p, sect, n);
+   20158:	89 f1                	mov    %esi,%ecx
+			p += n * SECTSIZE;
+			sect += n;
+			nsect -= n;
+   2015a:	29 f3                	sub    %esi,%ebx
+			readsects(p, sect, n);
+   2015c:	e8 9f fe ff ff       	call   20000 <readsects>
+			p += n * SECTSIZE;
+   20161:	89 f0                	mov    %esi,%eax
+			sect += n;
+   20163:	01 75 d4             	add    %esi,-0x2c(%ebp)
+			p += n * SECTSIZE;
+   20166:	c1 e0 09             	shl    $0x9,%eax
+   20169:	01 c7                	add    %eax,%edi
+			nsect -= n;
+   2016b:	eb d8                	jmp    20145 <stage2main+0xbb>
+// then a 2-byte offset back to the match; the last has no match.
+// The input is trusted: it's our own kernel.
+static uint8_t *
+lz4_decompress(uint8_t *dst, const uint8_t *src, uint32_t zsize)
+{
+	const uint8_t *end = src + zsize;
+   2016d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+   20170:	8b 45 dc             	mov    -0x24(%ebp),%eax
+
+	while (src < end) {
+   20173:	8b 55 d8             	mov    -0x28(%ebp),%edx
+	const uint8_t *end = src + zsize;
+   20176:	03 47 10             	add    0x10(%edi),%eax
+   20179:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	while (src < end) {
+   2017c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+   2017f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+   20182:	39 f8                	cmp    %edi,%eax
+   20184:	73 73                	jae    201f9 <stage2main+0x16f>
+		uint32_t token = *src++;
+   20186:	8d 58 01             	lea    0x1(%eax),%ebx
+   20189:	0f b6 00             	movzbl (%eax),%eax
+   2018c:	88 45 d4             	mov    %al,-0x2c(%ebp)
+		uint32_t len = token >> 4;
+   2018f:	c1 e8 04             	shr    $0x4,%eax
+		uint8_t b;
+
+		// Copy literals
+		if (len == 15)
+   20192:	83 f8 0f             	cmp    $0xf,%eax
+   20195:	74 07                	je     2019e <stage2main+0x114>
+   20197:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+		uint8_t *p = scratch;
+   2019a:	89 de                	mov    %ebx,%esi
+   2019c:	eb 0c                	jmp    201aa <stage2main+0x120>
+			do {
+				b = *src++;
+   2019e:	0f b6 33             	movzbl (%ebx),%esi
+   201a1:	43                   	inc    %ebx
+   201a2:	89 f1                	mov    %esi,%ecx
+				len += b;
+   201a4:	01 f0                	add    %esi,%eax
+			} while (b == 255);
+   201a6:	fe c1                	inc    %cl
+   201a8:	eb eb                	jmp    20195 <stage2main+0x10b>
+		while (len-- > 0)
+   201aa:	39 ca                	cmp    %ecx,%edx
+   201ac:	74 07                	je     201b5 <stage2main+0x12b>
+			*dst++ = *src++;
+   201ae:	89 d7                	mov    %edx,%edi
+   201b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+   201b1:	89 fa                	mov    %edi,%edx
+   201b3:	eb f5                	jmp    201aa <stage2main+0x120>
+		if (src >= end)
+   201b5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+   201b8:	01 d8                	add    %ebx,%eax
+   201ba:	39 f8                	cmp    %edi,%eax
+   201bc:	73 3b                	jae    201f9 <stage2main+0x16f>
+			break;		// last sequence: no match follows
+
+		// Copy the match; byte by byte, since it may overlap dst.
+		const uint8_t *match = dst - (src[0] | (src[1] << 8));
+   201be:	0f b7 10             	movzwl (%eax),%edx
+   201c1:	89 ce                	mov    %ecx,%esi
+		src += 2;
+		len = token & 15;
+   201c3:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+		src += 2;
+   201c6:	83 c0 02             	add    $0x2,%eax
+		const uint8_t *match = dst - (src[0] | (src[1] << 8));
+   201c9:	29 d6                	sub    %edx,%esi
+		len = token & 15;
+   201cb:	8a 55 d4             	mov    -0x2c(%ebp),%dl
+   201ce:	83 e3 0f             	and    $0xf,%ebx
+   201d1:	83 e2 0f             	and    $0xf,%edx
+		if (len == 15)
+   201d4:	80 fa 0f             	cmp    $0xf,%dl
+   201d7:	75 11                	jne    201ea <stage2main+0x160>
+   201d9:	bb 0f 00 00 00       	mov    $0xf,%ebx
+			do {
+				b = *src++;
+				len += b;
+   201de:	0f b6 10             	movzbl (%eax),%edx
+				b = *src++;
+   201e1:	40                   	inc    %eax
+				len += b;
+   201e2:	01 d3                	add    %edx,%ebx
+			} while (b == 255);
+   201e4:	80 78 ff ff          	cmpb   $0xff,-0x1(%eax)
+   201e8:	74 f4                	je     201de <stage2main+0x154>
+		len += 4;		// minimum match length
+		while (len-- > 0)
+   201ea:	8d 54 19 04          	lea    0x4(%ecx,%ebx,1),%edx
+   201ee:	39 d1                	cmp    %edx,%ecx
+   201f0:	74 8d                	je     2017f <stage2main+0xf5>
+			*dst++ = *match++;
+   201f2:	89 cf                	mov    %ecx,%edi
+   201f4:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+   201f5:	89 f9                	mov    %edi,%ecx
+   201f7:	eb f5                	jmp    201ee <stage2main+0x164>
+		}
+
+		if (lz4_decompress(va, scratch, s->zsize) != va + s->filesz)
+   201f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+   201fc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+   201ff:	03 41 04             	add    0x4(%ecx),%eax
+   20202:	39 d0                	cmp    %edx,%eax
+   20204:	75 34                	jne    2023a <stage2main+0x1b0>
+			goto bad;
+		for (p = va + s->filesz; p < va + s->memsz; p++)
+   20206:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+   20209:	8b 55 d8             	mov    -0x28(%ebp),%edx
+   2020c:	03 57 08             	add    0x8(%edi),%edx
+   2020f:	39 d0                	cmp    %edx,%eax
+   20211:	73 06                	jae    20219 <stage2main+0x18f>
+			*p = 0;
+   20213:	c6 00 00             	movb   $0x0,(%eax)
+		for (p = va + s->filesz; p < va + s->memsz; p++)
+   20216:	40                   	inc    %eax
+   20217:	eb ed                	jmp    20206 <stage2main+0x17c>
+	for (i = 0; i < ZHDR->nsegs; i++) {
+   20219:	ff 45 e0             	incl   -0x20(%ebp)
+   2021c:	e9 dc fe ff ff       	jmp    200fd <stage2main+0x73>
+
+static gcc_inline uint64_t
+rdtsc(void)
+{
+        uint64_t tsc;
+        asm volatile("rdtsc" : "=A" (tsc));
+   20221:	0f 31                	rdtsc
+	}
+
+	// The boot block stamped BOOTTIME_LOADED when it started us,
+	// but the kernel is only now loaded: restamp it, so the timeline
+	// charges reading and decompressing the kernel to "load kernel".
+	((uint64_t *) BOOTTIME_LOWMEM)[BOOTTIME_LOADED] = rdtsc();
+   20223:	a3 08 80 00 00       	mov    %eax,0x8008
+
+	// call the kernel's entry point; does not return!
+	((void (*)(void)) (ZHDR->entry & 0xFFFFFF))();
+   20228:	a1 04 00 01 00       	mov    0x10004,%eax
+	((uint64_t *) BOOTTIME_LOWMEM)[BOOTTIME_LOADED] = rdtsc();
+   2022d:	89 15 0c 80 00 00    	mov    %edx,0x800c
+	((void (*)(void)) (ZHDR->entry & 0xFFFFFF))();
+   20233:	25 ff ff ff 00       	and    $0xffffff,%eax
+   20238:	ff d0                	call   *%eax
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+   2023a:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+   2023f:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+   20244:	66 ef                	out    %ax,(%dx)
+   20246:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+   2024b:	66 ef                	out    %ax,(%dx)
+
+bad:
+	outw(0x8A00, 0x8A00);
+	outw(0x8A00, 0x8E00);
+	while (1)
+   2024d:	eb fe                	jmp    2024d <stage2main+0x1c3>
@@ -0,0 +1,14601 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00100000 <start-0xc>:
+  100000:	02 b0 ad 1b 03 00    	add    0x31bad(%eax),%dh
+  100006:	00 00                	add    %al,(%eax)
+  100008:	fb                   	sti
+  100009:	4f                   	dec    %edi
+  10000a:	52                   	push   %edx
+  10000b:	e4                   	.byte 0xe4
+
+0010000c <start>:
+.long MULTIBOOT_HEADER_FLAGS
+.long CHECKSUM
+
+.globl		start
+start:
+	movw	$0x1234,0x472			# warm boot BIOS flag
+  10000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+  100013:	34 12 
+
+	# Save what a multiboot loader passed us (kern/multiboot.c).
+	movl	%eax,multiboot_magic
+  100015:	a3 00 e0 10 00       	mov    %eax,0x10e000
+	movl	%ebx,multiboot_infopa
+  10001a:	89 1d 04 e0 10 00    	mov    %ebx,0x10e004
+
+	# Note the time for the boot timeline (kern/boottime.c).
+	rdtsc
+  100020:	0f 31                	rdtsc
+	movl	%eax,BOOTTIME_LOWMEM+BOOTTIME_ENTRY*8
+  100022:	a3 10 80 00 00       	mov    %eax,0x8010
+	movl	%edx,BOOTTIME_LOWMEM+BOOTTIME_ENTRY*8+4
+  100027:	89 15 14 80 00 00    	mov    %edx,0x8014
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+  10002d:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(cpu_boot+4096),%esp
+  100032:	bc 00 00 11 00       	mov    $0x110000,%esp
+
+	# now to C code
+	call	init
+  100037:	e8 09 01 00 00       	call   100145 <init>
+
+0010003c <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+  10003c:	eb fe                	jmp    10003c <spin>
+
+0010003e <cpu_cur>:
+	cons_init();
+	if (cpu_onboot()) {
+		boottime_mark("cons_init");
+
+		// Take what a multiboot loader told us, if one loaded us,
+		// before mem_init() reuses the memory it's in.
+  10003e:	55                   	push   %ebp
+  10003f:	89 e5                	mov    %esp,%ebp
+  100041:	53                   	push   %ebx
+  100042:	83 ec 14             	sub    $0x14,%esp
+  100045:	e8 c6 03 00 00       	call   100410 <__x86.get_pc_thunk.ax>
+  10004a:	05 aa df 00 00       	add    $0xdfaa,%eax
+
+static gcc_inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  10004f:	89 e2                	mov    %esp,%edx
+  100051:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  100054:	8b 55 ec             	mov    -0x14(%ebp),%edx
+
+// Find the CPU struct representing the current CPU.
+// It always resides at the bottom of the page containing the CPU's stack.
+static inline cpu *
+cpu_cur() {
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  100057:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  10005a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  10005d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  100063:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	//Following stuff is for debugging purposes.
+	//cpu d=*c;
+	assert(c->magic == CPU_MAGIC);
+  100066:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  100069:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  10006f:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  100075:	74 1e                	je     100095 <cpu_cur+0x57>
+  100077:	8d 90 0c b0 ff ff    	lea    -0x4ff4(%eax),%edx
+  10007d:	52                   	push   %edx
+  10007e:	8d 90 22 b0 ff ff    	lea    -0x4fde(%eax),%edx
+  100084:	52                   	push   %edx
+  100085:	6a 65                	push   $0x65
+  100087:	8d 90 37 b0 ff ff    	lea    -0x4fc9(%eax),%edx
+  10008d:	52                   	push   %edx
+  10008e:	89 c3                	mov    %eax,%ebx
+  100090:	e8 3d 0d 00 00       	call   100dd2 <debug_panic>
+	return c;
+  100095:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  100098:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10009b:	c9                   	leave
+  10009c:	c3                   	ret
+
+0010009d <cpu_onboot>:
+
+// Returns true if we're running on the bootstrap CPU.
+static inline int
+cpu_onboot() {
+  10009d:	55                   	push   %ebp
+  10009e:	89 e5                	mov    %esp,%ebp
+  1000a0:	53                   	push   %ebx
+  1000a1:	83 ec 04             	sub    $0x4,%esp
+  1000a4:	e8 6b 03 00 00       	call   100414 <__x86.get_pc_thunk.bx>
+  1000a9:	81 c3 4b df 00 00    	add    $0xdf4b,%ebx
+	return cpu_cur() == &cpu_boot;
+  1000af:	e8 8a ff ff ff       	call   10003e <cpu_cur>
+  1000b4:	c7 c2 00 f0 10 00    	mov    $0x10f000,%edx
+  1000ba:	39 d0                	cmp    %edx,%eax
+  1000bc:	0f 94 c0             	sete   %al
+  1000bf:	0f b6 c0             	movzbl %al,%eax
+}
+  1000c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1000c5:	c9                   	leave
+  1000c6:	c3                   	ret
+
+001000c7 <inittests>:
+void inittests() {
+  1000c7:	55                   	push   %ebp
+  1000c8:	89 e5                	mov    %esp,%ebp
+  1000ca:	53                   	push   %ebx
+  1000cb:	83 ec 04             	sub    $0x4,%esp
+  1000ce:	e8 3d 03 00 00       	call   100410 <__x86.get_pc_thunk.ax>
+  1000d3:	05 21 df 00 00       	add    $0xdf21,%eax
+	cprintf("1024=%d\n", 1024);
+  1000d8:	83 ec 08             	sub    $0x8,%esp
+  1000db:	68 00 04 00 00       	push   $0x400
+  1000e0:	8d 90 44 b0 ff ff    	lea    -0x4fbc(%eax),%edx
+  1000e6:	52                   	push   %edx
+  1000e7:	89 c3                	mov    %eax,%ebx
+  1000e9:	e8 27 7b 00 00       	call   107c15 <cprintf>
+  1000ee:	83 c4 10             	add    $0x10,%esp
+}
+  1000f1:	90                   	nop
+  1000f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1000f5:	c9                   	leave
+  1000f6:	c3                   	ret
+
+001000f7 <init_ap>:
+{
+  1000f7:	55                   	push   %ebp
+  1000f8:	89 e5                	mov    %esp,%ebp
+  1000fa:	53                   	push   %ebx
+  1000fb:	83 ec 14             	sub    $0x14,%esp
+  1000fe:	e8 11 03 00 00       	call   100414 <__x86.get_pc_thunk.bx>
+  100103:	81 c3 f1 de 00 00    	add    $0xdef1,%ebx
+	cpu *c = cpu_cur();
+  100109:	e8 30 ff ff ff       	call   10003e <cpu_cur>
+  10010e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	cpu_init();	// our own GDT and TSS
+  100111:	e8 e3 1d 00 00       	call   101ef9 <cpu_init>
+	trap_init();	// load the shared IDT
+  100116:	e8 ee 25 00 00       	call   102709 <trap_init>
+	pmap_init();	// start paging with the shared page directory
+  10011b:	e8 db 47 00 00       	call   1048fb <pmap_init>
+	lapic_init();
+  100120:	e8 a8 71 00 00       	call   1072cd <lapic_init>
+	c->id = lapic_id();
+  100125:	e8 0a 72 00 00       	call   107334 <lapic_id>
+  10012a:	89 c2                	mov    %eax,%edx
+  10012c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10012f:	88 90 a1 00 00 00    	mov    %dl,0xa1(%eax)
+	c->booted = 1;
+  100135:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100138:	c7 80 a4 00 00 00 01 	movl   $0x1,0xa4(%eax)
+  10013f:	00 00 00 
+		asm volatile("hlt");
+  100142:	f4                   	hlt
+  100143:	eb fd                	jmp    100142 <init_ap+0x4b>
+
+00100145 <init>:
+{
+  100145:	55                   	push   %ebp
+  100146:	89 e5                	mov    %esp,%ebp
+  100148:	53                   	push   %ebx
+  100149:	83 ec 54             	sub    $0x54,%esp
+  10014c:	e8 c3 02 00 00       	call   100414 <__x86.get_pc_thunk.bx>
+  100151:	81 c3 a3 de 00 00    	add    $0xdea3,%ebx
+	if (!cpu_onboot())
+  100157:	e8 41 ff ff ff       	call   10009d <cpu_onboot>
+  10015c:	85 c0                	test   %eax,%eax
+  10015e:	75 05                	jne    100165 <init+0x20>
+		init_ap();
+  100160:	e8 92 ff ff ff       	call   1000f7 <init_ap>
+	if (cpu_onboot()) {
+  100165:	e8 33 ff ff ff       	call   10009d <cpu_onboot>
+  10016a:	85 c0                	test   %eax,%eax
+  10016c:	74 40                	je     1001ae <init+0x69>
+		memset(edata, 0, end - edata);
+  10016e:	c7 c0 a0 20 14 00    	mov    $0x1420a0,%eax
+  100174:	89 c1                	mov    %eax,%ecx
+  100176:	c7 c0 c8 06 11 00    	mov    $0x1106c8,%eax
+  10017c:	89 c2                	mov    %eax,%edx
+  10017e:	89 c8                	mov    %ecx,%eax
+  100180:	29 d0                	sub    %edx,%eax
+  100182:	83 ec 04             	sub    $0x4,%esp
+  100185:	50                   	push   %eax
+  100186:	6a 00                	push   $0x0
+  100188:	c7 c0 c8 06 11 00    	mov    $0x1106c8,%eax
+  10018e:	50                   	push   %eax
+  10018f:	e8 1a 7d 00 00       	call   107eae <memset>
+  100194:	83 c4 10             	add    $0x10,%esp
+		boottime_init();
+  100197:	e8 b6 3b 00 00       	call   103d52 <boottime_init>
+		selftest_select(SELFTEST);
+  10019c:	83 ec 0c             	sub    $0xc,%esp
+  10019f:	8d 83 4d b0 ff ff    	lea    -0x4fb3(%ebx),%eax
+  1001a5:	50                   	push   %eax
+  1001a6:	e8 cb 3f 00 00       	call   104176 <selftest_select>
+  1001ab:	83 c4 10             	add    $0x10,%esp
+	cons_init();
+  1001ae:	e8 6c 06 00 00       	call   10081f <cons_init>
+	if (cpu_onboot()) {
+  1001b3:	e8 e5 fe ff ff       	call   10009d <cpu_onboot>
+  1001b8:	85 c0                	test   %eax,%eax
+  1001ba:	74 17                	je     1001d3 <init+0x8e>
+		boottime_mark("cons_init");
+  1001bc:	83 ec 0c             	sub    $0xc,%esp
+  1001bf:	8d 83 51 b0 ff ff    	lea    -0x4faf(%ebx),%eax
+  1001c5:	50                   	push   %eax
+  1001c6:	e8 bf 3c 00 00       	call   103e8a <boottime_mark>
+  1001cb:	83 c4 10             	add    $0x10,%esp
+		multiboot_init();
+  1001ce:	e8 94 42 00 00       	call   104467 <multiboot_init>
+	}
+
+	// Lab 1: test cprintf and debug_trace
+	cprintf("1234 decimal is %o octal!\n", 1234);
+  1001d3:	83 ec 08             	sub    $0x8,%esp
+  1001d6:	68 d2 04 00 00       	push   $0x4d2
+  1001db:	8d 83 5b b0 ff ff    	lea    -0x4fa5(%ebx),%eax
+  1001e1:	50                   	push   %eax
+  1001e2:	e8 2e 7a 00 00       	call   107c15 <cprintf>
+  1001e7:	83 c4 10             	add    $0x10,%esp
+	inittests();
+  1001ea:	e8 d8 fe ff ff       	call   1000c7 <inittests>
+	if (cpu_onboot()) {
+  1001ef:	e8 a9 fe ff ff       	call   10009d <cpu_onboot>
+  1001f4:	85 c0                	test   %eax,%eax
+  1001f6:	74 1f                	je     100217 <init+0xd2>
+		selftest_run(SELFTEST_CONSOLE);
+  1001f8:	83 ec 0c             	sub    $0xc,%esp
+  1001fb:	6a 00                	push   $0x0
+  1001fd:	e8 4c 41 00 00       	call   10434e <selftest_run>
+  100202:	83 c4 10             	add    $0x10,%esp
+		boottime_mark("debug_check");
+  100205:	83 ec 0c             	sub    $0xc,%esp
+  100208:	8d 83 76 b0 ff ff    	lea    -0x4f8a(%ebx),%eax
+  10020e:	50                   	push   %eax
+  10020f:	e8 76 3c 00 00       	call   103e8a <boottime_mark>
+  100214:	83 c4 10             	add    $0x10,%esp
+	}
+
+	// Initialize and load the bootstrap CPU's GDT, TSS, and IDT.
+	cpu_init();
+  100217:	e8 dd 1c 00 00       	call   101ef9 <cpu_init>
+	if (cpu_onboot())
+  10021c:	e8 7c fe ff ff       	call   10009d <cpu_onboot>
+  100221:	85 c0                	test   %eax,%eax
+  100223:	74 12                	je     100237 <init+0xf2>
+		boottime_mark("cpu_init");
+  100225:	83 ec 0c             	sub    $0xc,%esp
+  100228:	8d 83 82 b0 ff ff    	lea    -0x4f7e(%ebx),%eax
+  10022e:	50                   	push   %eax
+  10022f:	e8 56 3c 00 00       	call   103e8a <boottime_mark>
+  100234:	83 c4 10             	add    $0x10,%esp
+	trap_init();
+  100237:	e8 cd 24 00 00       	call   102709 <trap_init>
+	if (cpu_onboot()) {
+  10023c:	e8 5c fe ff ff       	call   10009d <cpu_onboot>
+  100241:	85 c0                	test   %eax,%eax
+  100243:	74 1f                	je     100264 <init+0x11f>
+		selftest_run(SELFTEST_TRAP);
+  100245:	83 ec 0c             	sub    $0xc,%esp
+  100248:	6a 01                	push   $0x1
+  10024a:	e8 ff 40 00 00       	call   10434e <selftest_run>
+  10024f:	83 c4 10             	add    $0x10,%esp
+		boottime_mark("trap_init");
+  100252:	83 ec 0c             	sub    $0xc,%esp
+  100255:	8d 83 8b b0 ff ff    	lea    -0x4f75(%ebx),%eax
+  10025b:	50                   	push   %eax
+  10025c:	e8 29 3c 00 00       	call   103e8a <boottime_mark>
+  100261:	83 c4 10             	add    $0x10,%esp
+	}
+
+	// Physical memory detection/initialization.
+	// Can't call mem_alloc until after we do this!
+	mem_init();
+  100264:	e8 c7 10 00 00       	call   101330 <mem_init>
+	if (cpu_onboot()) {
+  100269:	e8 2f fe ff ff       	call   10009d <cpu_onboot>
+  10026e:	85 c0                	test   %eax,%eax
+  100270:	74 1f                	je     100291 <init+0x14c>
+		selftest_run(SELFTEST_MEM);
+  100272:	83 ec 0c             	sub    $0xc,%esp
+  100275:	6a 02                	push   $0x2
+  100277:	e8 d2 40 00 00       	call   10434e <selftest_run>
+  10027c:	83 c4 10             	add    $0x10,%esp
+		boottime_mark("mem_init");
+  10027f:	83 ec 0c             	sub    $0xc,%esp
+  100282:	8d 83 95 b0 ff ff    	lea    -0x4f6b(%ebx),%eax
+  100288:	50                   	push   %eax
+  100289:	e8 fc 3b 00 00       	call   103e8a <boottime_mark>
+  10028e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	// Turn on paging, with the kernel mapped in large pages.
+	pmap_init();
+  100291:	e8 65 46 00 00       	call   1048fb <pmap_init>
+	if (cpu_onboot()) {
+  100296:	e8 02 fe ff ff       	call   10009d <cpu_onboot>
+  10029b:	85 c0                	test   %eax,%eax
+  10029d:	74 36                	je     1002d5 <init+0x190>
+		selftest_run(SELFTEST_PMAP);
+  10029f:	83 ec 0c             	sub    $0xc,%esp
+  1002a2:	6a 03                	push   $0x3
+  1002a4:	e8 a5 40 00 00       	call   10434e <selftest_run>
+  1002a9:	83 c4 10             	add    $0x10,%esp
+		boottime_mark("pmap_init");
+  1002ac:	83 ec 0c             	sub    $0xc,%esp
+  1002af:	8d 83 9e b0 ff ff    	lea    -0x4f62(%ebx),%eax
+  1002b5:	50                   	push   %eax
+  1002b6:	e8 cf 3b 00 00       	call   103e8a <boottime_mark>
+  1002bb:	83 c4 10             	add    $0x10,%esp
+
+		// Find and start the other processors.
+		cpu_bootothers();
+  1002be:	e8 42 1e 00 00       	call   102105 <cpu_bootothers>
+		boottime_mark("AP bring-up");
+  1002c3:	83 ec 0c             	sub    $0xc,%esp
+  1002c6:	8d 83 a8 b0 ff ff    	lea    -0x4f58(%ebx),%eax
+  1002cc:	50                   	push   %eax
+  1002cd:	e8 b8 3b 00 00       	call   103e8a <boottime_mark>
+  1002d2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	// Initialize the PIC and start taking console interrupts.
+	pic_init();
+  1002d5:	e8 5a 6c 00 00       	call   106f34 <pic_init>
+	cons_intenable();
+  1002da:	e8 9c 05 00 00       	call   10087b <cons_intenable>
+	if (cpu_onboot()) {
+  1002df:	e8 b9 fd ff ff       	call   10009d <cpu_onboot>
+  1002e4:	85 c0                	test   %eax,%eax
+  1002e6:	74 17                	je     1002ff <init+0x1ba>
+		boottime_mark("interrupts");
+  1002e8:	83 ec 0c             	sub    $0xc,%esp
+  1002eb:	8d 83 b4 b0 ff ff    	lea    -0x4f4c(%ebx),%eax
+  1002f1:	50                   	push   %eax
+  1002f2:	e8 93 3b 00 00       	call   103e8a <boottime_mark>
+  1002f7:	83 c4 10             	add    $0x10,%esp
+		boottime_print();
+  1002fa:	e8 34 3d 00 00       	call   104033 <boottime_print>
+	asm volatile ("mov %0 %1" : "=r"(sp) : "X"(loc));
+	*/
+	trapframe tf;
+	//register int *csreg asm ("cs");
+	//tf.tf_cs=(*csreg)|3; //setting the privilege mode
+	tf.tf_esp=(uintptr_t)user_stack;
+  1002ff:	8d 83 0c 30 00 00    	lea    0x300c(%ebx),%eax
+  100305:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  100308:	9c                   	pushf
+  100309:	58                   	pop    %eax
+  10030a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        return eflags;
+  10030d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+	tf.tf_eflags=read_eflags();
+  100310:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+static gcc_inline uint16_t
+read_cs(void)
+{
+        uint16_t cs;
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  100313:	66 8c c8             	mov    %cs,%ax
+  100316:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+        return cs;
+  10031a:	0f b7 45 f6          	movzwl -0xa(%ebp),%eax
+	//tf.tf_ebp=read_ebp();
+	tf.tf_cs=read_cs();
+  10031e:	66 89 45 e0          	mov    %ax,-0x20(%ebp)
+	//
+	tf.tf_cs = (CPU_GDT_UCODE) | 3;
+  100322:	66 c7 45 e0 1b 00    	movw   $0x1b,-0x20(%ebp)
+	tf.tf_ds = (CPU_GDT_UDATA) | 3;
+  100328:	66 c7 45 d0 23 00    	movw   $0x23,-0x30(%ebp)
+	tf.tf_es = tf.tf_ds;
+  10032e:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+  100332:	66 89 45 cc          	mov    %ax,-0x34(%ebp)
+	tf.tf_ss = tf.tf_ds;
+  100336:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+  10033a:	66 89 45 ec          	mov    %ax,-0x14(%ebp)
+	tf.tf_eflags = FL_IOPL_3 | FL_IF;	// take device interrupts
+  10033e:	c7 45 e4 00 32 00 00 	movl   $0x3200,-0x1c(%ebp)
+	tf.tf_esp = (uintptr_t)user_stack+PAGESIZE;
+  100345:	8d 83 0c 30 00 00    	lea    0x300c(%ebx),%eax
+  10034b:	05 00 10 00 00       	add    $0x1000,%eax
+  100350:	89 45 e8             	mov    %eax,-0x18(%ebp)
+	tf.tf_eip = (uint32_t)&user;
+  100353:	8d 83 74 23 ff ff    	lea    -0xdc8c(%ebx),%eax
+  100359:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	//
+	trap_return(&tf);
+  10035c:	83 ec 0c             	sub    $0xc,%esp
+  10035f:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  100362:	50                   	push   %eax
+  100363:	e8 38 2f 00 00       	call   1032a0 <trap_return>
+
+00100368 <user>:
+// This is the first function that gets run in user mode (ring 3).
+// It acts as PIOS's "root process",
+// of which all other processes are descendants.
+void
+user()
+{
+  100368:	55                   	push   %ebp
+  100369:	89 e5                	mov    %esp,%ebp
+  10036b:	53                   	push   %ebx
+  10036c:	83 ec 14             	sub    $0x14,%esp
+  10036f:	e8 a0 00 00 00       	call   100414 <__x86.get_pc_thunk.bx>
+  100374:	81 c3 80 dc 00 00    	add    $0xdc80,%ebx
+	cprintf("in user()\n");
+  10037a:	83 ec 0c             	sub    $0xc,%esp
+  10037d:	8d 83 bf b0 ff ff    	lea    -0x4f41(%ebx),%eax
+  100383:	50                   	push   %eax
+  100384:	e8 8c 78 00 00       	call   107c15 <cprintf>
+  100389:	83 c4 10             	add    $0x10,%esp
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  10038c:	89 e0                	mov    %esp,%eax
+  10038e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        return esp;
+  100391:	8b 45 f4             	mov    -0xc(%ebp),%eax
+	assert(read_esp() > (uint32_t) &user_stack[0]);
+  100394:	8d 93 0c 30 00 00    	lea    0x300c(%ebx),%edx
+  10039a:	39 c2                	cmp    %eax,%edx
+  10039c:	72 1f                	jb     1003bd <user+0x55>
+  10039e:	8d 83 cc b0 ff ff    	lea    -0x4f34(%ebx),%eax
+  1003a4:	50                   	push   %eax
+  1003a5:	8d 83 22 b0 ff ff    	lea    -0x4fde(%ebx),%eax
+  1003ab:	50                   	push   %eax
+  1003ac:	68 b5 00 00 00       	push   $0xb5
+  1003b1:	8d 83 f3 b0 ff ff    	lea    -0x4f0d(%ebx),%eax
+  1003b7:	50                   	push   %eax
+  1003b8:	e8 15 0a 00 00       	call   100dd2 <debug_panic>
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  1003bd:	89 e0                	mov    %esp,%eax
+  1003bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        return esp;
+  1003c2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+	assert(read_esp() < (uint32_t) &user_stack[sizeof(user_stack)]);
+  1003c5:	8d 83 0c 40 00 00    	lea    0x400c(%ebx),%eax
+  1003cb:	39 c2                	cmp    %eax,%edx
+  1003cd:	72 1f                	jb     1003ee <user+0x86>
+  1003cf:	8d 83 00 b1 ff ff    	lea    -0x4f00(%ebx),%eax
+  1003d5:	50                   	push   %eax
+  1003d6:	8d 83 22 b0 ff ff    	lea    -0x4fde(%ebx),%eax
+  1003dc:	50                   	push   %eax
+  1003dd:	68 b6 00 00 00       	push   $0xb6
+  1003e2:	8d 83 f3 b0 ff ff    	lea    -0x4f0d(%ebx),%eax
+  1003e8:	50                   	push   %eax
+  1003e9:	e8 e4 09 00 00       	call   100dd2 <debug_panic>
+
+	// Check that we're in user mode and can handle traps from there.
+	selftest_run(SELFTEST_USER);
+  1003ee:	83 ec 0c             	sub    $0xc,%esp
+  1003f1:	6a 04                	push   $0x4
+  1003f3:	e8 56 3f 00 00       	call   10434e <selftest_run>
+  1003f8:	83 c4 10             	add    $0x10,%esp
+
+	done();
+  1003fb:	e8 00 00 00 00       	call   100400 <done>
+
+00100400 <done>:
+}
+
+void gcc_noreturn
+done()
+{
+  100400:	55                   	push   %ebp
+  100401:	89 e5                	mov    %esp,%ebp
+  100403:	e8 08 00 00 00       	call   100410 <__x86.get_pc_thunk.ax>
+  100408:	05 ec db 00 00       	add    $0xdbec,%eax
+	while (1)
+  10040d:	90                   	nop
+  10040e:	eb fd                	jmp    10040d <done+0xd>
+
+00100410 <__x86.get_pc_thunk.ax>:
+  100410:	8b 04 24             	mov    (%esp),%eax
+  100413:	c3                   	ret
+
+00100414 <__x86.get_pc_thunk.bx>:
+  100414:	8b 1c 24             	mov    (%esp),%ebx
+  100417:	c3                   	ret
+
+00100418 <xchg>:
+	while (len-- > 0)
+		l->buf[ofs++ & (CONSLOG_SIZE-1)] = *p++;
+}
+
+static void
+conslog_get(conslog *l, uint32_t ofs, void *data, int len)
+  100418:	55                   	push   %ebp
+  100419:	89 e5                	mov    %esp,%ebp
+  10041b:	83 ec 10             	sub    $0x10,%esp
+  10041e:	e8 ed ff ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100423:	05 d1 db 00 00       	add    $0xdbd1,%eax
+{
+	uint8_t *p = data;
+	while (len-- > 0)
+		*p++ = l->buf[ofs++ & (CONSLOG_SIZE-1)];
+  100428:	8b 55 08             	mov    0x8(%ebp),%edx
+  10042b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10042e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  100431:	f0 87 02             	lock xchg %eax,(%edx)
+  100434:	89 45 fc             	mov    %eax,-0x4(%ebp)
+}
+
+// Write text straight to the console output devices.
+// The serial driver locks its own queue against the boot CPU's UART
+  100437:	8b 45 fc             	mov    -0x4(%ebp),%eax
+// interrupts; the video state is only ever touched here, by the one
+  10043a:	c9                   	leave
+  10043b:	c3                   	ret
+
+0010043c <pause>:
+			return;
+
+		conslog_get(oldest, oldest->tail + sizeof(oldestr),
+				text, oldestr.len);
+		asm volatile("" ::: "memory");	// read the text before freeing it
+		oldest->tail += sizeof(oldestr) + oldestr.len;
+  10043c:	55                   	push   %ebp
+  10043d:	89 e5                	mov    %esp,%ebp
+  10043f:	e8 cc ff ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100444:	05 b0 db 00 00       	add    $0xdbb0,%eax
+
+  100449:	f3 90                	pause
+		cons_write(text, oldestr.len);
+  10044b:	90                   	nop
+  10044c:	5d                   	pop    %ebp
+  10044d:	c3                   	ret
+
+0010044e <cpu_cur>:
+cpu_cur() {
+  10044e:	55                   	push   %ebp
+  10044f:	89 e5                	mov    %esp,%ebp
+  100451:	53                   	push   %ebx
+  100452:	83 ec 14             	sub    $0x14,%esp
+  100455:	e8 b6 ff ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10045a:	05 9a db 00 00       	add    $0xdb9a,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  10045f:	89 e2                	mov    %esp,%edx
+  100461:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  100464:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  100467:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  10046a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  10046d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  100473:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  100476:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  100479:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  10047f:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  100485:	74 1e                	je     1004a5 <cpu_cur+0x57>
+  100487:	8d 90 38 b1 ff ff    	lea    -0x4ec8(%eax),%edx
+  10048d:	52                   	push   %edx
+  10048e:	8d 90 4e b1 ff ff    	lea    -0x4eb2(%eax),%edx
+  100494:	52                   	push   %edx
+  100495:	6a 65                	push   $0x65
+  100497:	8d 90 63 b1 ff ff    	lea    -0x4e9d(%eax),%edx
+  10049d:	52                   	push   %edx
+  10049e:	89 c3                	mov    %eax,%ebx
+  1004a0:	e8 2d 09 00 00       	call   100dd2 <debug_panic>
+	return c;
+  1004a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  1004a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1004ab:	c9                   	leave
+  1004ac:	c3                   	ret
+
+001004ad <cpu_onboot>:
+cpu_onboot() {
+  1004ad:	55                   	push   %ebp
+  1004ae:	89 e5                	mov    %esp,%ebp
+  1004b0:	53                   	push   %ebx
+  1004b1:	83 ec 04             	sub    $0x4,%esp
+  1004b4:	e8 5b ff ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1004b9:	81 c3 3b db 00 00    	add    $0xdb3b,%ebx
+	return cpu_cur() == &cpu_boot;
+  1004bf:	e8 8a ff ff ff       	call   10044e <cpu_cur>
+  1004c4:	c7 c2 00 f0 10 00    	mov    $0x10f000,%edx
+  1004ca:	39 d0                	cmp    %edx,%eax
+  1004cc:	0f 94 c0             	sete   %al
+  1004cf:	0f b6 c0             	movzbl %al,%eax
+}
+  1004d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1004d5:	c9                   	leave
+  1004d6:	c3                   	ret
+
+001004d7 <cons_intr>:
+{
+  1004d7:	55                   	push   %ebp
+  1004d8:	89 e5                	mov    %esp,%ebp
+  1004da:	53                   	push   %ebx
+  1004db:	83 ec 14             	sub    $0x14,%esp
+  1004de:	e8 31 ff ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1004e3:	81 c3 11 db 00 00    	add    $0xdb11,%ebx
+	while ((c = (*proc)()) != -1) {
+  1004e9:	eb 54                	jmp    10053f <cons_intr+0x68>
+		if (c == 0)
+  1004eb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  1004ef:	74 4d                	je     10053e <cons_intr+0x67>
+		uint32_t wpos = cons.wpos;
+  1004f1:	8b 83 10 50 00 00    	mov    0x5010(%ebx),%eax
+  1004f7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		if (wpos - cons.rpos == CONSBUFSIZE) {
+  1004fa:	8b 83 0c 50 00 00    	mov    0x500c(%ebx),%eax
+  100500:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  100503:	29 c2                	sub    %eax,%edx
+  100505:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  10050b:	75 11                	jne    10051e <cons_intr+0x47>
+			cons.dropped++;
+  10050d:	8b 83 14 50 00 00    	mov    0x5014(%ebx),%eax
+  100513:	83 c0 01             	add    $0x1,%eax
+  100516:	89 83 14 50 00 00    	mov    %eax,0x5014(%ebx)
+			continue;
+  10051c:	eb 21                	jmp    10053f <cons_intr+0x68>
+		cons.buf[wpos & (CONSBUFSIZE-1)] = c;
+  10051e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100521:	25 ff 0f 00 00       	and    $0xfff,%eax
+  100526:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  100529:	88 94 03 0c 40 00 00 	mov    %dl,0x400c(%ebx,%eax,1)
+		cons.wpos = wpos + 1;
+  100530:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100533:	83 c0 01             	add    $0x1,%eax
+  100536:	89 83 10 50 00 00    	mov    %eax,0x5010(%ebx)
+  10053c:	eb 01                	jmp    10053f <cons_intr+0x68>
+			continue;
+  10053e:	90                   	nop
+	while ((c = (*proc)()) != -1) {
+  10053f:	8b 45 08             	mov    0x8(%ebp),%eax
+  100542:	ff d0                	call   *%eax
+  100544:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  100547:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+  10054b:	75 9e                	jne    1004eb <cons_intr+0x14>
+}
+  10054d:	90                   	nop
+  10054e:	90                   	nop
+  10054f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100552:	c9                   	leave
+  100553:	c3                   	ret
+
+00100554 <cons_checkdrops>:
+{
+  100554:	55                   	push   %ebp
+  100555:	89 e5                	mov    %esp,%ebp
+  100557:	53                   	push   %ebx
+  100558:	83 ec 14             	sub    $0x14,%esp
+  10055b:	e8 b4 fe ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100560:	81 c3 94 da 00 00    	add    $0xda94,%ebx
+	uint32_t dropped = cons.dropped, overruns = serial_overruns;
+  100566:	8b 83 14 50 00 00    	mov    0x5014(%ebx),%eax
+  10056c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  10056f:	c7 c0 64 10 14 00    	mov    $0x141064,%eax
+  100575:	8b 00                	mov    (%eax),%eax
+  100577:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	if (dropped != cons.dropreported) {
+  10057a:	8b 83 18 50 00 00    	mov    0x5018(%ebx),%eax
+  100580:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  100583:	74 2d                	je     1005b2 <cons_checkdrops+0x5e>
+		warn("console input buffer full: %u bytes dropped",
+  100585:	8b 83 18 50 00 00    	mov    0x5018(%ebx),%eax
+  10058b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  10058e:	29 c2                	sub    %eax,%edx
+  100590:	52                   	push   %edx
+  100591:	8d 83 70 b1 ff ff    	lea    -0x4e90(%ebx),%eax
+  100597:	50                   	push   %eax
+  100598:	6a 61                	push   $0x61
+  10059a:	8d 83 9c b1 ff ff    	lea    -0x4e64(%ebx),%eax
+  1005a0:	50                   	push   %eax
+  1005a1:	e8 2a 09 00 00       	call   100ed0 <debug_warn>
+  1005a6:	83 c4 10             	add    $0x10,%esp
+		cons.dropreported = dropped;
+  1005a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1005ac:	89 83 18 50 00 00    	mov    %eax,0x5018(%ebx)
+	if (overruns != cons.overreported) {
+  1005b2:	8b 83 1c 50 00 00    	mov    0x501c(%ebx),%eax
+  1005b8:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+  1005bb:	74 2d                	je     1005ea <cons_checkdrops+0x96>
+		warn("serial receive FIFO overran %u times",
+  1005bd:	8b 83 1c 50 00 00    	mov    0x501c(%ebx),%eax
+  1005c3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1005c6:	29 c2                	sub    %eax,%edx
+  1005c8:	52                   	push   %edx
+  1005c9:	8d 83 ac b1 ff ff    	lea    -0x4e54(%ebx),%eax
+  1005cf:	50                   	push   %eax
+  1005d0:	6a 66                	push   $0x66
+  1005d2:	8d 83 9c b1 ff ff    	lea    -0x4e64(%ebx),%eax
+  1005d8:	50                   	push   %eax
+  1005d9:	e8 f2 08 00 00       	call   100ed0 <debug_warn>
+  1005de:	83 c4 10             	add    $0x10,%esp
+		cons.overreported = overruns;
+  1005e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1005e4:	89 83 1c 50 00 00    	mov    %eax,0x501c(%ebx)
+}
+  1005ea:	90                   	nop
+  1005eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1005ee:	c9                   	leave
+  1005ef:	c3                   	ret
+
+001005f0 <cons_read>:
+{
+  1005f0:	55                   	push   %ebp
+  1005f1:	89 e5                	mov    %esp,%ebp
+  1005f3:	53                   	push   %ebx
+  1005f4:	83 ec 34             	sub    $0x34,%esp
+  1005f7:	e8 18 fe ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1005fc:	81 c3 f8 d9 00 00    	add    $0xd9f8,%ebx
+	if (n <= 0)
+  100602:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  100606:	7f 0a                	jg     100612 <cons_read+0x22>
+		return 0;
+  100608:	b8 00 00 00 00       	mov    $0x0,%eax
+  10060d:	e9 00 01 00 00       	jmp    100712 <cons_read+0x122>
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  100612:	66 8c c8             	mov    %cs,%ax
+  100615:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+        return cs;
+  100619:	0f b7 45 da          	movzwl -0x26(%ebp),%eax
+	bool onboot = (read_cs() & 3) || cpu_onboot();
+  10061d:	0f b7 c0             	movzwl %ax,%eax
+  100620:	83 e0 03             	and    $0x3,%eax
+  100623:	85 c0                	test   %eax,%eax
+  100625:	75 09                	jne    100630 <cons_read+0x40>
+  100627:	e8 81 fe ff ff       	call   1004ad <cpu_onboot>
+  10062c:	85 c0                	test   %eax,%eax
+  10062e:	74 07                	je     100637 <cons_read+0x47>
+  100630:	b8 01 00 00 00       	mov    $0x1,%eax
+  100635:	eb 05                	jmp    10063c <cons_read+0x4c>
+  100637:	b8 00 00 00 00       	mov    $0x0,%eax
+  10063c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if ((!cons_intenabled || !(read_eflags() & FL_IF)) && onboot) {
+  10063f:	8b 83 20 50 00 00    	mov    0x5020(%ebx),%eax
+  100645:	85 c0                	test   %eax,%eax
+  100647:	74 11                	je     10065a <cons_read+0x6a>
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  100649:	9c                   	pushf
+  10064a:	58                   	pop    %eax
+  10064b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        return eflags;
+  10064e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100651:	25 00 02 00 00       	and    $0x200,%eax
+  100656:	85 c0                	test   %eax,%eax
+  100658:	75 10                	jne    10066a <cons_read+0x7a>
+  10065a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  10065e:	74 0a                	je     10066a <cons_read+0x7a>
+		serial_intr();
+  100660:	e8 4a 65 00 00       	call   106baf <serial_intr>
+		kbd_intr();
+  100665:	e8 da 61 00 00       	call   106844 <kbd_intr>
+	uint32_t rpos = cons.rpos;
+  10066a:	8b 83 0c 50 00 00    	mov    0x500c(%ebx),%eax
+  100670:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	uint32_t avail = cons.wpos - rpos;
+  100673:	8b 83 10 50 00 00    	mov    0x5010(%ebx),%eax
+  100679:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  10067c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	if ((uint32_t) n > avail)
+  10067f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  100682:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+  100685:	73 06                	jae    10068d <cons_read+0x9d>
+		n = avail;
+  100687:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10068a:	89 45 0c             	mov    %eax,0xc(%ebp)
+	if (n > 0) {
+  10068d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  100691:	7e 77                	jle    10070a <cons_read+0x11a>
+		uint32_t ofs = rpos & (CONSBUFSIZE-1);
+  100693:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100696:	25 ff 0f 00 00       	and    $0xfff,%eax
+  10069b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		uint32_t first = MIN(n, CONSBUFSIZE - ofs);
+  10069e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1006a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  1006a4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  1006a9:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  1006ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  1006af:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  1006b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1006b5:	39 c2                	cmp    %eax,%edx
+  1006b7:	0f 46 c2             	cmovbe %edx,%eax
+  1006ba:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		memmove(buf, cons.buf + ofs, first);
+  1006bd:	8d 93 0c 40 00 00    	lea    0x400c(%ebx),%edx
+  1006c3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  1006c6:	01 d0                	add    %edx,%eax
+  1006c8:	83 ec 04             	sub    $0x4,%esp
+  1006cb:	ff 75 dc             	push   -0x24(%ebp)
+  1006ce:	50                   	push   %eax
+  1006cf:	ff 75 08             	push   0x8(%ebp)
+  1006d2:	e8 51 78 00 00       	call   107f28 <memmove>
+  1006d7:	83 c4 10             	add    $0x10,%esp
+		memmove(buf + first, cons.buf, n - first);
+  1006da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1006dd:	2b 45 dc             	sub    -0x24(%ebp),%eax
+  1006e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  1006e3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  1006e6:	01 ca                	add    %ecx,%edx
+  1006e8:	83 ec 04             	sub    $0x4,%esp
+  1006eb:	50                   	push   %eax
+  1006ec:	8d 83 0c 40 00 00    	lea    0x400c(%ebx),%eax
+  1006f2:	50                   	push   %eax
+  1006f3:	52                   	push   %edx
+  1006f4:	e8 2f 78 00 00       	call   107f28 <memmove>
+  1006f9:	83 c4 10             	add    $0x10,%esp
+		cons.rpos = rpos + n;
+  1006fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1006ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100702:	01 d0                	add    %edx,%eax
+  100704:	89 83 0c 50 00 00    	mov    %eax,0x500c(%ebx)
+	cons_checkdrops();
+  10070a:	e8 45 fe ff ff       	call   100554 <cons_checkdrops>
+	return n;
+  10070f:	8b 45 0c             	mov    0xc(%ebp),%eax
+}
+  100712:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100715:	c9                   	leave
+  100716:	c3                   	ret
+
+00100717 <cons_readwait>:
+{
+  100717:	55                   	push   %ebp
+  100718:	89 e5                	mov    %esp,%ebp
+  10071a:	53                   	push   %ebx
+  10071b:	83 ec 24             	sub    $0x24,%esp
+  10071e:	e8 f1 fc ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100723:	81 c3 d1 d8 00 00    	add    $0xd8d1,%ebx
+	if (n <= 0)
+  100729:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  10072d:	7f 6f                	jg     10079e <cons_readwait+0x87>
+		return 0;
+  10072f:	b8 00 00 00 00       	mov    $0x0,%eax
+  100734:	e9 82 00 00 00       	jmp    1007bb <cons_readwait+0xa4>
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  100739:	9c                   	pushf
+  10073a:	58                   	pop    %eax
+  10073b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        return eflags;
+  10073e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+		uint32_t eflags = read_eflags();
+  100741:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		if (!cons_intenabled || !(eflags & FL_IF)
+  100744:	8b 83 20 50 00 00    	mov    0x5020(%ebx),%eax
+  10074a:	85 c0                	test   %eax,%eax
+  10074c:	74 2a                	je     100778 <cons_readwait+0x61>
+  10074e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100751:	25 00 02 00 00       	and    $0x200,%eax
+  100756:	85 c0                	test   %eax,%eax
+  100758:	74 1e                	je     100778 <cons_readwait+0x61>
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  10075a:	66 8c c8             	mov    %cs,%ax
+  10075d:	66 89 45 ea          	mov    %ax,-0x16(%ebp)
+        return cs;
+  100761:	0f b7 45 ea          	movzwl -0x16(%ebp),%eax
+				|| (read_cs() & 3) || !cpu_onboot()) {
+  100765:	0f b7 c0             	movzwl %ax,%eax
+  100768:	83 e0 03             	and    $0x3,%eax
+  10076b:	85 c0                	test   %eax,%eax
+  10076d:	75 09                	jne    100778 <cons_readwait+0x61>
+  10076f:	e8 39 fd ff ff       	call   1004ad <cpu_onboot>
+  100774:	85 c0                	test   %eax,%eax
+  100776:	75 07                	jne    10077f <cons_readwait+0x68>
+			pause();
+  100778:	e8 bf fc ff ff       	call   10043c <pause>
+			continue;
+  10077d:	eb 1f                	jmp    10079e <cons_readwait+0x87>
+
+// Disable external device interrupts.
+static gcc_inline void
+cli(void)
+{
+	asm volatile("cli");
+  10077f:	fa                   	cli
+}
+  100780:	90                   	nop
+		if (cons.rpos == cons.wpos)
+  100781:	8b 93 0c 50 00 00    	mov    0x500c(%ebx),%edx
+  100787:	8b 83 10 50 00 00    	mov    0x5010(%ebx),%eax
+  10078d:	39 c2                	cmp    %eax,%edx
+  10078f:	75 02                	jne    100793 <cons_readwait+0x7c>
+			asm volatile("sti; hlt" ::: "memory");
+  100791:	fb                   	sti
+  100792:	f4                   	hlt
+  100793:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100796:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  100799:	ff 75 e4             	push   -0x1c(%ebp)
+  10079c:	9d                   	popf
+}
+  10079d:	90                   	nop
+	while ((got = cons_read(buf, n)) == 0) {
+  10079e:	83 ec 08             	sub    $0x8,%esp
+  1007a1:	ff 75 0c             	push   0xc(%ebp)
+  1007a4:	ff 75 08             	push   0x8(%ebp)
+  1007a7:	e8 44 fe ff ff       	call   1005f0 <cons_read>
+  1007ac:	83 c4 10             	add    $0x10,%esp
+  1007af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1007b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  1007b6:	74 81                	je     100739 <cons_readwait+0x22>
+	return got;
+  1007b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  1007bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1007be:	c9                   	leave
+  1007bf:	c3                   	ret
+
+001007c0 <cons_getc>:
+{
+  1007c0:	55                   	push   %ebp
+  1007c1:	89 e5                	mov    %esp,%ebp
+  1007c3:	83 ec 18             	sub    $0x18,%esp
+  1007c6:	e8 45 fc ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1007cb:	05 29 d8 00 00       	add    $0xd829,%eax
+	if (cons_read(&c, 1) == 0)
+  1007d0:	83 ec 08             	sub    $0x8,%esp
+  1007d3:	6a 01                	push   $0x1
+  1007d5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  1007d8:	50                   	push   %eax
+  1007d9:	e8 12 fe ff ff       	call   1005f0 <cons_read>
+  1007de:	83 c4 10             	add    $0x10,%esp
+  1007e1:	85 c0                	test   %eax,%eax
+  1007e3:	75 07                	jne    1007ec <cons_getc+0x2c>
+		return 0;
+  1007e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  1007ea:	eb 07                	jmp    1007f3 <cons_getc+0x33>
+	return (uint8_t) c;
+  1007ec:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  1007f0:	0f b6 c0             	movzbl %al,%eax
+}
+  1007f3:	c9                   	leave
+  1007f4:	c3                   	ret
+
+001007f5 <cons_waitc>:
+{
+  1007f5:	55                   	push   %ebp
+  1007f6:	89 e5                	mov    %esp,%ebp
+  1007f8:	83 ec 18             	sub    $0x18,%esp
+  1007fb:	e8 10 fc ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100800:	05 f4 d7 00 00       	add    $0xd7f4,%eax
+	cons_readwait(&c, 1);
+  100805:	83 ec 08             	sub    $0x8,%esp
+  100808:	6a 01                	push   $0x1
+  10080a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  10080d:	50                   	push   %eax
+  10080e:	e8 04 ff ff ff       	call   100717 <cons_readwait>
+  100813:	83 c4 10             	add    $0x10,%esp
+	return (uint8_t) c;
+  100816:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  10081a:	0f b6 c0             	movzbl %al,%eax
+}
+  10081d:	c9                   	leave
+  10081e:	c3                   	ret
+
+0010081f <cons_init>:
+{
+  10081f:	55                   	push   %ebp
+  100820:	89 e5                	mov    %esp,%ebp
+  100822:	53                   	push   %ebx
+  100823:	83 ec 04             	sub    $0x4,%esp
+  100826:	e8 e9 fb ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10082b:	81 c3 c9 d7 00 00    	add    $0xd7c9,%ebx
+	if (!cpu_onboot())	// only do once, on the boot CPU
+  100831:	e8 77 fc ff ff       	call   1004ad <cpu_onboot>
+  100836:	85 c0                	test   %eax,%eax
+  100838:	74 3b                	je     100875 <cons_init+0x56>
+	video_init();
+  10083a:	e8 ca 56 00 00       	call   105f09 <video_init>
+	kbd_init();
+  10083f:	e8 43 60 00 00       	call   106887 <kbd_init>
+	serial_init();
+  100844:	e8 ad 65 00 00       	call   106df6 <serial_init>
+	if (!serial_exists)
+  100849:	c7 c0 60 10 14 00    	mov    $0x141060,%eax
+  10084f:	8b 00                	mov    (%eax),%eax
+  100851:	85 c0                	test   %eax,%eax
+  100853:	75 21                	jne    100876 <cons_init+0x57>
+		warn("Serial port does not exist!\n");
+  100855:	83 ec 04             	sub    $0x4,%esp
+  100858:	8d 83 d1 b1 ff ff    	lea    -0x4e2f(%ebx),%eax
+  10085e:	50                   	push   %eax
+  10085f:	68 d4 00 00 00       	push   $0xd4
+  100864:	8d 83 9c b1 ff ff    	lea    -0x4e64(%ebx),%eax
+  10086a:	50                   	push   %eax
+  10086b:	e8 60 06 00 00       	call   100ed0 <debug_warn>
+  100870:	83 c4 10             	add    $0x10,%esp
+  100873:	eb 01                	jmp    100876 <cons_init+0x57>
+		return;
+  100875:	90                   	nop
+}
+  100876:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100879:	c9                   	leave
+  10087a:	c3                   	ret
+
+0010087b <cons_intenable>:
+{
+  10087b:	55                   	push   %ebp
+  10087c:	89 e5                	mov    %esp,%ebp
+  10087e:	53                   	push   %ebx
+  10087f:	83 ec 04             	sub    $0x4,%esp
+  100882:	e8 8d fb ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100887:	81 c3 6d d7 00 00    	add    $0xd76d,%ebx
+	if (!cpu_onboot())	// only do once, on the boot CPU
+  10088d:	e8 1b fc ff ff       	call   1004ad <cpu_onboot>
+  100892:	85 c0                	test   %eax,%eax
+  100894:	74 16                	je     1008ac <cons_intenable+0x31>
+	kbd_intenable();
+  100896:	e8 2c 60 00 00       	call   1068c7 <kbd_intenable>
+	serial_intenable();
+  10089b:	e8 48 66 00 00       	call   106ee8 <serial_intenable>
+	cons_intenabled = 1;
+  1008a0:	c7 83 20 50 00 00 01 	movl   $0x1,0x5020(%ebx)
+  1008a7:	00 00 00 
+  1008aa:	eb 01                	jmp    1008ad <cons_intenable+0x32>
+		return;
+  1008ac:	90                   	nop
+}
+  1008ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1008b0:	c9                   	leave
+  1008b1:	c3                   	ret
+
+001008b2 <conslog_put>:
+{
+  1008b2:	55                   	push   %ebp
+  1008b3:	89 e5                	mov    %esp,%ebp
+  1008b5:	83 ec 10             	sub    $0x10,%esp
+  1008b8:	e8 53 fb ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1008bd:	05 37 d7 00 00       	add    $0xd737,%eax
+	const uint8_t *p = data;
+  1008c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  1008c5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	while (len-- > 0)
+  1008c8:	eb 23                	jmp    1008ed <conslog_put+0x3b>
+		l->buf[ofs++ & (CONSLOG_SIZE-1)] = *p++;
+  1008ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  1008cd:	8d 50 01             	lea    0x1(%eax),%edx
+  1008d0:	89 55 fc             	mov    %edx,-0x4(%ebp)
+  1008d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1008d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  1008d9:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+  1008dc:	89 d1                	mov    %edx,%ecx
+  1008de:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  1008e4:	0f b6 10             	movzbl (%eax),%edx
+  1008e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1008ea:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+	while (len-- > 0)
+  1008ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  1008f0:	8d 50 ff             	lea    -0x1(%eax),%edx
+  1008f3:	89 55 14             	mov    %edx,0x14(%ebp)
+  1008f6:	85 c0                	test   %eax,%eax
+  1008f8:	7f d0                	jg     1008ca <conslog_put+0x18>
+}
+  1008fa:	90                   	nop
+  1008fb:	90                   	nop
+  1008fc:	c9                   	leave
+  1008fd:	c3                   	ret
+
+001008fe <conslog_get>:
+{
+  1008fe:	55                   	push   %ebp
+  1008ff:	89 e5                	mov    %esp,%ebp
+  100901:	83 ec 10             	sub    $0x10,%esp
+  100904:	e8 07 fb ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100909:	05 eb d6 00 00       	add    $0xd6eb,%eax
+	uint8_t *p = data;
+  10090e:	8b 45 10             	mov    0x10(%ebp),%eax
+  100911:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	while (len-- > 0)
+  100914:	eb 22                	jmp    100938 <conslog_get+0x3a>
+		*p++ = l->buf[ofs++ & (CONSLOG_SIZE-1)];
+  100916:	8b 45 0c             	mov    0xc(%ebp),%eax
+  100919:	8d 50 01             	lea    0x1(%eax),%edx
+  10091c:	89 55 0c             	mov    %edx,0xc(%ebp)
+  10091f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  100924:	89 c1                	mov    %eax,%ecx
+  100926:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  100929:	8d 50 01             	lea    0x1(%eax),%edx
+  10092c:	89 55 fc             	mov    %edx,-0x4(%ebp)
+  10092f:	8b 55 08             	mov    0x8(%ebp),%edx
+  100932:	0f b6 14 0a          	movzbl (%edx,%ecx,1),%edx
+  100936:	88 10                	mov    %dl,(%eax)
+	while (len-- > 0)
+  100938:	8b 45 14             	mov    0x14(%ebp),%eax
+  10093b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  10093e:	89 55 14             	mov    %edx,0x14(%ebp)
+  100941:	85 c0                	test   %eax,%eax
+  100943:	7f d1                	jg     100916 <conslog_get+0x18>
+}
+  100945:	90                   	nop
+  100946:	90                   	nop
+  100947:	c9                   	leave
+  100948:	c3                   	ret
+
+00100949 <cons_write>:
+{
+  100949:	55                   	push   %ebp
+  10094a:	89 e5                	mov    %esp,%ebp
+  10094c:	53                   	push   %ebx
+  10094d:	83 ec 14             	sub    $0x14,%esp
+  100950:	e8 bf fa ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100955:	81 c3 9f d6 00 00    	add    $0xd69f,%ebx
+	for (i = 0; i < len; i++)
+  10095b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  100962:	eb 1e                	jmp    100982 <cons_write+0x39>
+		serial_putc(str[i]);
+  100964:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  100967:	8b 45 08             	mov    0x8(%ebp),%eax
+  10096a:	01 d0                	add    %edx,%eax
+  10096c:	0f b6 00             	movzbl (%eax),%eax
+  10096f:	0f be c0             	movsbl %al,%eax
+  100972:	83 ec 0c             	sub    $0xc,%esp
+  100975:	50                   	push   %eax
+  100976:	e8 5a 63 00 00       	call   106cd5 <serial_putc>
+  10097b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < len; i++)
+  10097e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  100982:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100985:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  100988:	7c da                	jl     100964 <cons_write+0x1b>
+	video_write(str, len);
+  10098a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10098d:	83 ec 08             	sub    $0x8,%esp
+  100990:	50                   	push   %eax
+  100991:	ff 75 08             	push   0x8(%ebp)
+  100994:	e8 87 5c 00 00       	call   106620 <video_write>
+  100999:	83 c4 10             	add    $0x10,%esp
+}
+  10099c:	90                   	nop
+  10099d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1009a0:	c9                   	leave
+  1009a1:	c3                   	ret
+
+001009a2 <conslog_drainall>:
+{
+  1009a2:	55                   	push   %ebp
+  1009a3:	89 e5                	mov    %esp,%ebp
+  1009a5:	56                   	push   %esi
+  1009a6:	53                   	push   %ebx
+  1009a7:	81 ec 30 01 00 00    	sub    $0x130,%esp
+  1009ad:	e8 1c 04 00 00       	call   100dce <__x86.get_pc_thunk.si>
+  1009b2:	81 c6 42 d6 00 00    	add    $0xd642,%esi
+		conslog *l, *oldest = NULL;
+  1009b8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+		for (i = 0; i < MAX_CPUS; i++) {
+  1009bf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  1009c6:	e9 9d 00 00 00       	jmp    100a68 <conslog_drainall+0xc6>
+			l = &conslogs[i];
+  1009cb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1009ce:	69 d0 40 10 00 00    	imul   $0x1040,%eax,%edx
+  1009d4:	8d 86 4c 50 00 00    	lea    0x504c(%esi),%eax
+  1009da:	01 d0                	add    %edx,%eax
+  1009dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+			if (l->head == l->tail)
+  1009df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1009e2:	8b 90 00 10 00 00    	mov    0x1000(%eax),%edx
+  1009e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1009eb:	8b 80 04 10 00 00    	mov    0x1004(%eax),%eax
+  1009f1:	39 c2                	cmp    %eax,%edx
+  1009f3:	74 6e                	je     100a63 <conslog_drainall+0xc1>
+			conslog_get(l, l->tail, &r, sizeof(r));
+  1009f5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1009f8:	8b 80 04 10 00 00    	mov    0x1004(%eax),%eax
+  1009fe:	6a 0c                	push   $0xc
+  100a00:	8d 95 e0 fe ff ff    	lea    -0x120(%ebp),%edx
+  100a06:	52                   	push   %edx
+  100a07:	50                   	push   %eax
+  100a08:	ff 75 ec             	push   -0x14(%ebp)
+  100a0b:	e8 ee fe ff ff       	call   1008fe <conslog_get>
+  100a10:	83 c4 10             	add    $0x10,%esp
+			if (oldest == NULL || r.tsc < oldestr.tsc)
+  100a13:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  100a17:	74 1e                	je     100a37 <conslog_drainall+0x95>
+  100a19:	8b 8d e0 fe ff ff    	mov    -0x120(%ebp),%ecx
+  100a1f:	8b 9d e4 fe ff ff    	mov    -0x11c(%ebp),%ebx
+  100a25:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+  100a2b:	8b 95 d8 fe ff ff    	mov    -0x128(%ebp),%edx
+  100a31:	39 c1                	cmp    %eax,%ecx
+  100a33:	19 d3                	sbb    %edx,%ebx
+  100a35:	73 2d                	jae    100a64 <conslog_drainall+0xc2>
+				oldest = l, oldestr = r;
+  100a37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  100a3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  100a3d:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+  100a43:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  100a49:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+  100a4f:	89 85 d8 fe ff ff    	mov    %eax,-0x128(%ebp)
+  100a55:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+  100a5b:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+  100a61:	eb 01                	jmp    100a64 <conslog_drainall+0xc2>
+				continue;
+  100a63:	90                   	nop
+		for (i = 0; i < MAX_CPUS; i++) {
+  100a64:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  100a68:	83 7d f0 0f          	cmpl   $0xf,-0x10(%ebp)
+  100a6c:	0f 8e 59 ff ff ff    	jle    1009cb <conslog_drainall+0x29>
+		if (oldest == NULL)
+  100a72:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  100a76:	74 63                	je     100adb <conslog_drainall+0x139>
+				text, oldestr.len);
+  100a78:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+		conslog_get(oldest, oldest->tail + sizeof(oldestr),
+  100a7e:	89 c1                	mov    %eax,%ecx
+  100a80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100a83:	8b 80 04 10 00 00    	mov    0x1004(%eax),%eax
+  100a89:	8d 50 0c             	lea    0xc(%eax),%edx
+  100a8c:	51                   	push   %ecx
+  100a8d:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+  100a93:	50                   	push   %eax
+  100a94:	52                   	push   %edx
+  100a95:	ff 75 f4             	push   -0xc(%ebp)
+  100a98:	e8 61 fe ff ff       	call   1008fe <conslog_get>
+  100a9d:	83 c4 10             	add    $0x10,%esp
+		oldest->tail += sizeof(oldestr) + oldestr.len;
+  100aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100aa3:	8b 90 04 10 00 00    	mov    0x1004(%eax),%edx
+  100aa9:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+  100aaf:	01 d0                	add    %edx,%eax
+  100ab1:	8d 50 0c             	lea    0xc(%eax),%edx
+  100ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100ab7:	89 90 04 10 00 00    	mov    %edx,0x1004(%eax)
+		cons_write(text, oldestr.len);
+  100abd:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+  100ac3:	83 ec 08             	sub    $0x8,%esp
+  100ac6:	50                   	push   %eax
+  100ac7:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+  100acd:	50                   	push   %eax
+  100ace:	e8 76 fe ff ff       	call   100949 <cons_write>
+  100ad3:	83 c4 10             	add    $0x10,%esp
+	while (1) {
+  100ad6:	e9 dd fe ff ff       	jmp    1009b8 <conslog_drainall+0x16>
+			return;
+  100adb:	90                   	nop
+	}
+}
+  100adc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  100adf:	5b                   	pop    %ebx
+  100ae0:	5e                   	pop    %esi
+  100ae1:	5d                   	pop    %ebp
+  100ae2:	c3                   	ret
+
+00100ae3 <conslog_pending>:
+
+static bool
+conslog_pending(void)
+{
+  100ae3:	55                   	push   %ebp
+  100ae4:	89 e5                	mov    %esp,%ebp
+  100ae6:	53                   	push   %ebx
+  100ae7:	83 ec 10             	sub    $0x10,%esp
+  100aea:	e8 21 f9 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100aef:	05 05 d5 00 00       	add    $0xd505,%eax
+	int i;
+	for (i = 0; i < MAX_CPUS; i++)
+  100af4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  100afb:	eb 41                	jmp    100b3e <conslog_pending+0x5b>
+		if (conslogs[i].head != conslogs[i].tail)
+  100afd:	8b 4d f8             	mov    -0x8(%ebp),%ecx
+  100b00:	8d 90 4c 50 00 00    	lea    0x504c(%eax),%edx
+  100b06:	69 c9 40 10 00 00    	imul   $0x1040,%ecx,%ecx
+  100b0c:	01 ca                	add    %ecx,%edx
+  100b0e:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  100b14:	8b 0a                	mov    (%edx),%ecx
+  100b16:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+  100b19:	8d 90 50 50 00 00    	lea    0x5050(%eax),%edx
+  100b1f:	69 db 40 10 00 00    	imul   $0x1040,%ebx,%ebx
+  100b25:	01 da                	add    %ebx,%edx
+  100b27:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  100b2d:	8b 12                	mov    (%edx),%edx
+  100b2f:	39 d1                	cmp    %edx,%ecx
+  100b31:	74 07                	je     100b3a <conslog_pending+0x57>
+			return 1;
+  100b33:	b8 01 00 00 00       	mov    $0x1,%eax
+  100b38:	eb 0f                	jmp    100b49 <conslog_pending+0x66>
+	for (i = 0; i < MAX_CPUS; i++)
+  100b3a:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  100b3e:	83 7d f8 0f          	cmpl   $0xf,-0x8(%ebp)
+  100b42:	7e b9                	jle    100afd <conslog_pending+0x1a>
+	return 0;
+  100b44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  100b49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100b4c:	c9                   	leave
+  100b4d:	c3                   	ret
+
+00100b4e <cons_drain>:
+// and is deferred only to whichever other CPU is draining at the time.
+// Interrupts stay off while we drain, so that an interrupt handler
+// that logs on this CPU can't end up waiting for us to make room.
+static void
+cons_drain(void)
+{
+  100b4e:	55                   	push   %ebp
+  100b4f:	89 e5                	mov    %esp,%ebp
+  100b51:	53                   	push   %ebx
+  100b52:	83 ec 14             	sub    $0x14,%esp
+  100b55:	e8 ba f8 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100b5a:	81 c3 9a d4 00 00    	add    $0xd49a,%ebx
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  100b60:	9c                   	pushf
+  100b61:	58                   	pop    %eax
+  100b62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        return eflags;
+  100b65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+	uint32_t eflags = read_eflags();
+  100b68:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	asm volatile("cli");
+  100b6b:	fa                   	cli
+}
+  100b6c:	90                   	nop
+	cli();
+	while (xchg(&cons_draining, 1) == 0) {
+  100b6d:	eb 22                	jmp    100b91 <cons_drain+0x43>
+		conslog_drainall();
+  100b6f:	e8 2e fe ff ff       	call   1009a2 <conslog_drainall>
+
+		// Let go with a locked instruction, not a plain store:
+		// x86 may let a plain store pass our later loads of the heads,
+		// so a producer could still see the flag set after we'd missed
+		// its new head, and its record would sit until the next cputs.
+		xchg(&cons_draining, 0);
+  100b74:	83 ec 08             	sub    $0x8,%esp
+  100b77:	6a 00                	push   $0x0
+  100b79:	8d 83 4c 54 01 00    	lea    0x1544c(%ebx),%eax
+  100b7f:	50                   	push   %eax
+  100b80:	e8 93 f8 ff ff       	call   100418 <xchg>
+  100b85:	83 c4 10             	add    $0x10,%esp
+
+		// Someone may have logged something after we looked
+		// but before we let go; if so, it's still our job.
+		if (!conslog_pending())
+  100b88:	e8 56 ff ff ff       	call   100ae3 <conslog_pending>
+  100b8d:	85 c0                	test   %eax,%eax
+  100b8f:	74 1a                	je     100bab <cons_drain+0x5d>
+	while (xchg(&cons_draining, 1) == 0) {
+  100b91:	83 ec 08             	sub    $0x8,%esp
+  100b94:	6a 01                	push   $0x1
+  100b96:	8d 83 4c 54 01 00    	lea    0x1544c(%ebx),%eax
+  100b9c:	50                   	push   %eax
+  100b9d:	e8 76 f8 ff ff       	call   100418 <xchg>
+  100ba2:	83 c4 10             	add    $0x10,%esp
+  100ba5:	85 c0                	test   %eax,%eax
+  100ba7:	74 c6                	je     100b6f <cons_drain+0x21>
+  100ba9:	eb 01                	jmp    100bac <cons_drain+0x5e>
+			break;
+  100bab:	90                   	nop
+  100bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100baf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  100bb2:	ff 75 ec             	push   -0x14(%ebp)
+  100bb5:	9d                   	popf
+}
+  100bb6:	90                   	nop
+	}
+	write_eflags(eflags);
+}
+  100bb7:	90                   	nop
+  100bb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100bbb:	c9                   	leave
+  100bbc:	c3                   	ret
+
+00100bbd <conslog_append>:
+
+// Append text to the current CPU's log ring.
+static void
+conslog_append(const char *str, int len)
+{
+  100bbd:	55                   	push   %ebp
+  100bbe:	89 e5                	mov    %esp,%ebp
+  100bc0:	53                   	push   %ebx
+  100bc1:	83 ec 44             	sub    $0x44,%esp
+  100bc4:	e8 4b f8 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100bc9:	81 c3 2b d4 00 00    	add    $0xd42b,%ebx
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  100bcf:	66 8c c8             	mov    %cs,%ax
+  100bd2:	66 89 45 e2          	mov    %ax,-0x1e(%ebp)
+        return cs;
+  100bd6:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+	// User code running in lab 1 doesn't run on a kernel stack,
+	// and only ever runs on the boot CPU.
+	conslog *l = &conslogs[(read_cs() & 3) ? cpu_boot.num : cpu_cur()->num];
+  100bda:	0f b7 c0             	movzwl %ax,%eax
+  100bdd:	83 e0 03             	and    $0x3,%eax
+  100be0:	85 c0                	test   %eax,%eax
+  100be2:	74 12                	je     100bf6 <conslog_append+0x39>
+  100be4:	c7 c0 00 f0 10 00    	mov    $0x10f000,%eax
+  100bea:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  100bf1:	0f b6 c0             	movzbl %al,%eax
+  100bf4:	eb 0f                	jmp    100c05 <conslog_append+0x48>
+  100bf6:	e8 53 f8 ff ff       	call   10044e <cpu_cur>
+  100bfb:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  100c02:	0f b6 c0             	movzbl %al,%eax
+  100c05:	69 d0 40 10 00 00    	imul   $0x1040,%eax,%edx
+  100c0b:	8d 83 4c 50 00 00    	lea    0x504c(%ebx),%eax
+  100c11:	01 d0                	add    %edx,%eax
+  100c13:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  100c16:	9c                   	pushf
+  100c17:	58                   	pop    %eax
+  100c18:	89 45 dc             	mov    %eax,-0x24(%ebp)
+        return eflags;
+  100c1b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+	conslog_rec r;
+
+	// Keep this CPU's interrupt handlers out while we're appending,
+	// since they log into this same ring.
+	uint32_t eflags = read_eflags();
+  100c1e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("cli");
+  100c21:	fa                   	cli
+}
+  100c22:	90                   	nop
+	cli();
+	while (len > 0) {
+  100c23:	e9 bf 00 00 00       	jmp    100ce7 <conslog_append+0x12a>
+		int n = MIN(len, CONSLOG_MAXREC);
+  100c28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  100c2b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  100c2e:	c7 45 e8 00 01 00 00 	movl   $0x100,-0x18(%ebp)
+  100c35:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  100c38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  100c3b:	39 c2                	cmp    %eax,%edx
+  100c3d:	0f 4e c2             	cmovle %edx,%eax
+  100c40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		while (CONSLOG_SIZE - (l->head - l->tail) < sizeof(r) + n)
+  100c43:	eb 05                	jmp    100c4a <conslog_append+0x8d>
+			cons_drain();	// full: make room or wait for the drainer
+  100c45:	e8 04 ff ff ff       	call   100b4e <cons_drain>
+		while (CONSLOG_SIZE - (l->head - l->tail) < sizeof(r) + n)
+  100c4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100c4d:	8b 90 04 10 00 00    	mov    0x1004(%eax),%edx
+  100c53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100c56:	8b 80 00 10 00 00    	mov    0x1000(%eax),%eax
+  100c5c:	29 c2                	sub    %eax,%edx
+  100c5e:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  100c64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  100c67:	83 c0 0c             	add    $0xc,%eax
+  100c6a:	39 c2                	cmp    %eax,%edx
+  100c6c:	72 d7                	jb     100c45 <conslog_append+0x88>
+        asm volatile("rdtsc" : "=A" (tsc));
+  100c6e:	0f 31                	rdtsc
+  100c70:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  100c73:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+        return tsc;
+  100c76:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  100c79:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+
+		r.tsc = rdtsc();
+  100c7c:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  100c7f:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		r.len = n;
+  100c82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  100c85:	89 45 c8             	mov    %eax,-0x38(%ebp)
+		conslog_put(l, l->head, &r, sizeof(r));
+  100c88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100c8b:	8b 80 00 10 00 00    	mov    0x1000(%eax),%eax
+  100c91:	6a 0c                	push   $0xc
+  100c93:	8d 55 c0             	lea    -0x40(%ebp),%edx
+  100c96:	52                   	push   %edx
+  100c97:	50                   	push   %eax
+  100c98:	ff 75 f4             	push   -0xc(%ebp)
+  100c9b:	e8 12 fc ff ff       	call   1008b2 <conslog_put>
+  100ca0:	83 c4 10             	add    $0x10,%esp
+		conslog_put(l, l->head + sizeof(r), str, n);
+  100ca3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100ca6:	8b 80 00 10 00 00    	mov    0x1000(%eax),%eax
+  100cac:	83 c0 0c             	add    $0xc,%eax
+  100caf:	ff 75 e4             	push   -0x1c(%ebp)
+  100cb2:	ff 75 08             	push   0x8(%ebp)
+  100cb5:	50                   	push   %eax
+  100cb6:	ff 75 f4             	push   -0xc(%ebp)
+  100cb9:	e8 f4 fb ff ff       	call   1008b2 <conslog_put>
+  100cbe:	83 c4 10             	add    $0x10,%esp
+		asm volatile("" ::: "memory");	// x86 keeps the stores in order
+		l->head += sizeof(r) + n;
+  100cc1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100cc4:	8b 90 00 10 00 00    	mov    0x1000(%eax),%edx
+  100cca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  100ccd:	01 d0                	add    %edx,%eax
+  100ccf:	8d 50 0c             	lea    0xc(%eax),%edx
+  100cd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100cd5:	89 90 00 10 00 00    	mov    %edx,0x1000(%eax)
+
+		str += n;
+  100cdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  100cde:	01 45 08             	add    %eax,0x8(%ebp)
+		len -= n;
+  100ce1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  100ce4:	29 45 0c             	sub    %eax,0xc(%ebp)
+	while (len > 0) {
+  100ce7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  100ceb:	0f 8f 37 ff ff ff    	jg     100c28 <conslog_append+0x6b>
+  100cf1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  100cf4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  100cf7:	ff 75 cc             	push   -0x34(%ebp)
+  100cfa:	9d                   	popf
+}
+  100cfb:	90                   	nop
+	}
+	write_eflags(eflags);
+}
+  100cfc:	90                   	nop
+  100cfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100d00:	c9                   	leave
+  100d01:	c3                   	ret
+
+00100d02 <cons_sync>:
+// after flushing anything still logged or queued for the devices.
+// For use when panicking, so we don't wait on the drainer flag:
+// whoever holds it may be stuck, or may be us.
+void
+cons_sync(void)
+{
+  100d02:	55                   	push   %ebp
+  100d03:	89 e5                	mov    %esp,%ebp
+  100d05:	53                   	push   %ebx
+  100d06:	83 ec 04             	sub    $0x4,%esp
+  100d09:	e8 06 f7 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100d0e:	81 c3 e6 d2 00 00    	add    $0xd2e6,%ebx
+	cons_synchronous = 1;
+  100d14:	c7 83 50 54 01 00 01 	movl   $0x1,0x15450(%ebx)
+  100d1b:	00 00 00 
+	conslog_drainall();
+  100d1e:	e8 7f fc ff ff       	call   1009a2 <conslog_drainall>
+	serial_sync();
+  100d23:	e8 7a 60 00 00       	call   106da2 <serial_sync>
+}
+  100d28:	90                   	nop
+  100d29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100d2c:	c9                   	leave
+  100d2d:	c3                   	ret
+
+00100d2e <cputs>:
+
+
+// `High'-level console I/O.  Used by readline and cprintf.
+void
+cputs(const char *str)
+{
+  100d2e:	55                   	push   %ebp
+  100d2f:	89 e5                	mov    %esp,%ebp
+  100d31:	53                   	push   %ebx
+  100d32:	83 ec 04             	sub    $0x4,%esp
+  100d35:	e8 d6 f6 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100d3a:	05 ba d2 00 00       	add    $0xd2ba,%eax
+//	if (read_cs() & 3) //This line is commented because there's a glitch somewhere...
+//		return ;//LAB1 sys_cputs(str);	// use syscall from user mode
+
+	if (cons_synchronous) {
+  100d3f:	8b 90 50 54 01 00    	mov    0x15450(%eax),%edx
+  100d45:	85 d2                	test   %edx,%edx
+  100d47:	74 21                	je     100d6a <cputs+0x3c>
+		cons_write(str, strlen(str));
+  100d49:	83 ec 0c             	sub    $0xc,%esp
+  100d4c:	ff 75 08             	push   0x8(%ebp)
+  100d4f:	89 c3                	mov    %eax,%ebx
+  100d51:	e8 ef 6e 00 00       	call   107c45 <strlen>
+  100d56:	83 c4 10             	add    $0x10,%esp
+  100d59:	83 ec 08             	sub    $0x8,%esp
+  100d5c:	50                   	push   %eax
+  100d5d:	ff 75 08             	push   0x8(%ebp)
+  100d60:	e8 e4 fb ff ff       	call   100949 <cons_write>
+  100d65:	83 c4 10             	add    $0x10,%esp
+		return;
+  100d68:	eb 24                	jmp    100d8e <cputs+0x60>
+	}
+
+	conslog_append(str, strlen(str));
+  100d6a:	83 ec 0c             	sub    $0xc,%esp
+  100d6d:	ff 75 08             	push   0x8(%ebp)
+  100d70:	89 c3                	mov    %eax,%ebx
+  100d72:	e8 ce 6e 00 00       	call   107c45 <strlen>
+  100d77:	83 c4 10             	add    $0x10,%esp
+  100d7a:	83 ec 08             	sub    $0x8,%esp
+  100d7d:	50                   	push   %eax
+  100d7e:	ff 75 08             	push   0x8(%ebp)
+  100d81:	e8 37 fe ff ff       	call   100bbd <conslog_append>
+  100d86:	83 c4 10             	add    $0x10,%esp
+	cons_drain();
+  100d89:	e8 c0 fd ff ff       	call   100b4e <cons_drain>
+}
+  100d8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100d91:	c9                   	leave
+  100d92:	c3                   	ret
+
+00100d93 <cons_io>:
+
+// Synchronize the root process's console special files
+// with the actual console I/O device.
+bool
+cons_io(void)
+{
+  100d93:	55                   	push   %ebp
+  100d94:	89 e5                	mov    %esp,%ebp
+  100d96:	53                   	push   %ebx
+  100d97:	83 ec 04             	sub    $0x4,%esp
+  100d9a:	e8 71 f6 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100d9f:	05 55 d2 00 00       	add    $0xd255,%eax
+	// Lab 4: your console I/O code here.
+	warn("cons_io() not implemented");
+  100da4:	83 ec 04             	sub    $0x4,%esp
+  100da7:	8d 90 ee b1 ff ff    	lea    -0x4e12(%eax),%edx
+  100dad:	52                   	push   %edx
+  100dae:	68 a6 01 00 00       	push   $0x1a6
+  100db3:	8d 90 9c b1 ff ff    	lea    -0x4e64(%eax),%edx
+  100db9:	52                   	push   %edx
+  100dba:	89 c3                	mov    %eax,%ebx
+  100dbc:	e8 0f 01 00 00       	call   100ed0 <debug_warn>
+  100dc1:	83 c4 10             	add    $0x10,%esp
+	return 0;	// 0 indicates no I/O done
+  100dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  100dc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100dcc:	c9                   	leave
+  100dcd:	c3                   	ret
+
+00100dce <__x86.get_pc_thunk.si>:
+  100dce:	8b 34 24             	mov    (%esp),%esi
+  100dd1:	c3                   	ret
+
+00100dd2 <debug_panic>:
+
+// Panic is called on unresolvable fatal errors.
+// It prints "panic: mesg", and then enters the kernel monitor.
+void
+debug_panic(const char *file, int line, const char *fmt,...)
+{
+  100dd2:	55                   	push   %ebp
+  100dd3:	89 e5                	mov    %esp,%ebp
+  100dd5:	53                   	push   %ebx
+  100dd6:	83 ec 44             	sub    $0x44,%esp
+  100dd9:	e8 36 f6 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100dde:	81 c3 16 d2 00 00    	add    $0xd216,%ebx
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  100de4:	66 8c c8             	mov    %cs,%ax
+  100de7:	66 89 45 ee          	mov    %ax,-0x12(%ebp)
+        return cs;
+  100deb:	0f b7 45 ee          	movzwl -0x12(%ebp),%eax
+	va_list ap;
+	int i;
+
+	// Avoid infinite recursion if we're panicking from kernel mode.
+	if ((read_cs() & 3) == 0) {
+  100def:	0f b7 c0             	movzwl %ax,%eax
+  100df2:	83 e0 03             	and    $0x3,%eax
+  100df5:	85 c0                	test   %eax,%eax
+  100df7:	75 17                	jne    100e10 <debug_panic+0x3e>
+		if (panicstr)
+  100df9:	8b 83 54 54 01 00    	mov    0x15454(%ebx),%eax
+  100dff:	85 c0                	test   %eax,%eax
+  100e01:	0f 85 c4 00 00 00    	jne    100ecb <debug_panic+0xf9>
+			goto dead;
+		panicstr = fmt;
+  100e07:	8b 45 10             	mov    0x10(%ebp),%eax
+  100e0a:	89 83 54 54 01 00    	mov    %eax,0x15454(%ebx)
+	}
+
+	// We may never take another interrupt or get to drain the log again,
+	// so flush what's been logged and stop queueing output.
+	cons_sync();
+  100e10:	e8 ed fe ff ff       	call   100d02 <cons_sync>
+
+	// First print the requested message
+	va_start(ap, fmt);
+  100e15:	8d 45 10             	lea    0x10(%ebp),%eax
+  100e18:	83 c0 04             	add    $0x4,%eax
+  100e1b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	cprintf("kernel panic at %s:%d: ", file, line);
+  100e1e:	83 ec 04             	sub    $0x4,%esp
+  100e21:	ff 75 0c             	push   0xc(%ebp)
+  100e24:	ff 75 08             	push   0x8(%ebp)
+  100e27:	8d 83 08 b2 ff ff    	lea    -0x4df8(%ebx),%eax
+  100e2d:	50                   	push   %eax
+  100e2e:	e8 e2 6d 00 00       	call   107c15 <cprintf>
+  100e33:	83 c4 10             	add    $0x10,%esp
+	vcprintf(fmt, ap);
+  100e36:	8b 45 10             	mov    0x10(%ebp),%eax
+  100e39:	83 ec 08             	sub    $0x8,%esp
+  100e3c:	ff 75 f0             	push   -0x10(%ebp)
+  100e3f:	50                   	push   %eax
+  100e40:	e8 5d 6d 00 00       	call   107ba2 <vcprintf>
+  100e45:	83 c4 10             	add    $0x10,%esp
+	cprintf("\n");
+  100e48:	83 ec 0c             	sub    $0xc,%esp
+  100e4b:	8d 83 20 b2 ff ff    	lea    -0x4de0(%ebx),%eax
+  100e51:	50                   	push   %eax
+  100e52:	e8 be 6d 00 00       	call   107c15 <cprintf>
+  100e57:	83 c4 10             	add    $0x10,%esp
+        __asm __volatile("movl %%ebp,%0" : "=rm" (ebp));
+  100e5a:	89 e8                	mov    %ebp,%eax
+  100e5c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        return ebp;
+  100e5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+	va_end(ap);
+
+	// Then print a backtrace of the kernel call chain
+	uint32_t eips[DEBUG_TRACEFRAMES];
+	debug_trace(read_ebp(), eips);
+  100e62:	83 ec 08             	sub    $0x8,%esp
+  100e65:	8d 55 bc             	lea    -0x44(%ebp),%edx
+  100e68:	52                   	push   %edx
+  100e69:	50                   	push   %eax
+  100e6a:	e8 be 00 00 00       	call   100f2d <debug_trace>
+  100e6f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < DEBUG_TRACEFRAMES && eips[i] != 0; i++)
+  100e72:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  100e79:	eb 1e                	jmp    100e99 <debug_panic+0xc7>
+		cprintf("  from %08x\n", eips[i]);
+  100e7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100e7e:	8b 44 85 bc          	mov    -0x44(%ebp,%eax,4),%eax
+  100e82:	83 ec 08             	sub    $0x8,%esp
+  100e85:	50                   	push   %eax
+  100e86:	8d 83 22 b2 ff ff    	lea    -0x4dde(%ebx),%eax
+  100e8c:	50                   	push   %eax
+  100e8d:	e8 83 6d 00 00       	call   107c15 <cprintf>
+  100e92:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < DEBUG_TRACEFRAMES && eips[i] != 0; i++)
+  100e95:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  100e99:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+  100e9d:	7f 0b                	jg     100eaa <debug_panic+0xd8>
+  100e9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  100ea2:	8b 44 85 bc          	mov    -0x44(%ebp,%eax,4),%eax
+  100ea6:	85 c0                	test   %eax,%eax
+  100ea8:	75 d1                	jne    100e7b <debug_panic+0xa9>
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  100eaa:	66 8c c8             	mov    %cs,%ax
+  100ead:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+        return cs;
+  100eb1:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+
+	// And what traps this CPU has been handling, if we can tell which CPU
+	// we're on: cpu_cur() only works on a kernel stack.
+	// Then the recent trace records from all CPUs.
+	if ((read_cs() & 3) == 0)
+  100eb5:	0f b7 c0             	movzwl %ax,%eax
+  100eb8:	83 e0 03             	and    $0x3,%eax
+  100ebb:	85 c0                	test   %eax,%eax
+  100ebd:	75 05                	jne    100ec4 <debug_panic+0xf2>
+		trap_print_stats();
+  100ebf:	e8 2e 1d 00 00       	call   102bf2 <trap_print_stats>
+	trace_dump();
+  100ec4:	e8 ce 2c 00 00       	call   103b97 <trace_dump>
+  100ec9:	eb 02                	jmp    100ecd <debug_panic+0xfb>
+			goto dead;
+  100ecb:	90                   	nop
+
+dead:
+	while (1) ;	// just spin
+  100ecc:	90                   	nop
+  100ecd:	90                   	nop
+  100ece:	eb fd                	jmp    100ecd <debug_panic+0xfb>
+
+00100ed0 <debug_warn>:
+}
+
+/* like panic, but don't */
+void
+debug_warn(const char *file, int line, const char *fmt,...)
+{
+  100ed0:	55                   	push   %ebp
+  100ed1:	89 e5                	mov    %esp,%ebp
+  100ed3:	53                   	push   %ebx
+  100ed4:	83 ec 14             	sub    $0x14,%esp
+  100ed7:	e8 38 f5 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  100edc:	81 c3 18 d1 00 00    	add    $0xd118,%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  100ee2:	8d 45 10             	lea    0x10(%ebp),%eax
+  100ee5:	83 c0 04             	add    $0x4,%eax
+  100ee8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	cprintf("kernel warning at %s:%d: ", file, line);
+  100eeb:	83 ec 04             	sub    $0x4,%esp
+  100eee:	ff 75 0c             	push   0xc(%ebp)
+  100ef1:	ff 75 08             	push   0x8(%ebp)
+  100ef4:	8d 83 2f b2 ff ff    	lea    -0x4dd1(%ebx),%eax
+  100efa:	50                   	push   %eax
+  100efb:	e8 15 6d 00 00       	call   107c15 <cprintf>
+  100f00:	83 c4 10             	add    $0x10,%esp
+	vcprintf(fmt, ap);
+  100f03:	8b 45 10             	mov    0x10(%ebp),%eax
+  100f06:	83 ec 08             	sub    $0x8,%esp
+  100f09:	ff 75 f4             	push   -0xc(%ebp)
+  100f0c:	50                   	push   %eax
+  100f0d:	e8 90 6c 00 00       	call   107ba2 <vcprintf>
+  100f12:	83 c4 10             	add    $0x10,%esp
+	cprintf("\n");
+  100f15:	83 ec 0c             	sub    $0xc,%esp
+  100f18:	8d 83 20 b2 ff ff    	lea    -0x4de0(%ebx),%eax
+  100f1e:	50                   	push   %eax
+  100f1f:	e8 f1 6c 00 00       	call   107c15 <cprintf>
+  100f24:	83 c4 10             	add    $0x10,%esp
+	va_end(ap);
+}
+  100f27:	90                   	nop
+  100f28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100f2b:	c9                   	leave
+  100f2c:	c3                   	ret
+
+00100f2d <debug_trace>:
+
+// Record the current call stack in eips[] by following the %ebp chain.
+void gcc_noinline
+debug_trace(uint32_t ebp, uint32_t eips[DEBUG_TRACEFRAMES])
+{
+  100f2d:	55                   	push   %ebp
+  100f2e:	89 e5                	mov    %esp,%ebp
+  100f30:	83 ec 10             	sub    $0x10,%esp
+  100f33:	e8 d8 f4 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100f38:	05 bc d0 00 00       	add    $0xd0bc,%eax
+	uint32_t eip=*(((uint32_t *)ebp)+1);
+  100f3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  100f40:	83 c0 04             	add    $0x4,%eax
+  100f43:	8b 00                	mov    (%eax),%eax
+  100f45:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	int i=0;
+  100f48:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+	while ((ebp!=0x000000)&&(i<DEBUG_TRACEFRAMES)) {
+  100f4f:	eb 2b                	jmp    100f7c <debug_trace+0x4f>
+		eips[i]=eip;
+  100f51:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  100f54:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  100f5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  100f5e:	01 c2                	add    %eax,%edx
+  100f60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  100f63:	89 02                	mov    %eax,(%edx)
+		ebp=*((uint32_t *)ebp);
+  100f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  100f68:	8b 00                	mov    (%eax),%eax
+  100f6a:	89 45 08             	mov    %eax,0x8(%ebp)
+		eip=*(((uint32_t *)ebp)+1);
+  100f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  100f70:	83 c0 04             	add    $0x4,%eax
+  100f73:	8b 00                	mov    (%eax),%eax
+  100f75:	89 45 fc             	mov    %eax,-0x4(%ebp)
+		i=i+1;
+  100f78:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+	while ((ebp!=0x000000)&&(i<DEBUG_TRACEFRAMES)) {
+  100f7c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  100f80:	74 21                	je     100fa3 <debug_trace+0x76>
+  100f82:	83 7d f8 09          	cmpl   $0x9,-0x8(%ebp)
+  100f86:	7e c9                	jle    100f51 <debug_trace+0x24>
+	}
+	while (i<DEBUG_TRACEFRAMES) {
+  100f88:	eb 19                	jmp    100fa3 <debug_trace+0x76>
+		eips[i]=0x000000;
+  100f8a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  100f8d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  100f94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  100f97:	01 d0                	add    %edx,%eax
+  100f99:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		i=i+1;
+  100f9f:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+	while (i<DEBUG_TRACEFRAMES) {
+  100fa3:	83 7d f8 09          	cmpl   $0x9,-0x8(%ebp)
+  100fa7:	7e e1                	jle    100f8a <debug_trace+0x5d>
+	}
+}
+  100fa9:	90                   	nop
+  100faa:	90                   	nop
+  100fab:	c9                   	leave
+  100fac:	c3                   	ret
+
+00100fad <f3>:
+
+
+static void gcc_noinline f3(int r, uint32_t *e) { debug_trace(read_ebp(), e); }
+  100fad:	55                   	push   %ebp
+  100fae:	89 e5                	mov    %esp,%ebp
+  100fb0:	83 ec 10             	sub    $0x10,%esp
+  100fb3:	e8 58 f4 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100fb8:	05 3c d0 00 00       	add    $0xd03c,%eax
+        __asm __volatile("movl %%ebp,%0" : "=rm" (ebp));
+  100fbd:	89 e8                	mov    %ebp,%eax
+  100fbf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return ebp;
+  100fc2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  100fc5:	ff 75 0c             	push   0xc(%ebp)
+  100fc8:	50                   	push   %eax
+  100fc9:	e8 5f ff ff ff       	call   100f2d <debug_trace>
+  100fce:	83 c4 08             	add    $0x8,%esp
+  100fd1:	90                   	nop
+  100fd2:	c9                   	leave
+  100fd3:	c3                   	ret
+
+00100fd4 <f2>:
+static void gcc_noinline f2(int r, uint32_t *e) { r & 2 ? f3(r,e) : f3(r,e); }
+  100fd4:	55                   	push   %ebp
+  100fd5:	89 e5                	mov    %esp,%ebp
+  100fd7:	e8 34 f4 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  100fdc:	05 18 d0 00 00       	add    $0xd018,%eax
+  100fe1:	8b 45 08             	mov    0x8(%ebp),%eax
+  100fe4:	83 e0 02             	and    $0x2,%eax
+  100fe7:	85 c0                	test   %eax,%eax
+  100fe9:	74 10                	je     100ffb <f2+0x27>
+  100feb:	ff 75 0c             	push   0xc(%ebp)
+  100fee:	ff 75 08             	push   0x8(%ebp)
+  100ff1:	e8 b7 ff ff ff       	call   100fad <f3>
+  100ff6:	83 c4 08             	add    $0x8,%esp
+  100ff9:	eb 0e                	jmp    101009 <f2+0x35>
+  100ffb:	ff 75 0c             	push   0xc(%ebp)
+  100ffe:	ff 75 08             	push   0x8(%ebp)
+  101001:	e8 a7 ff ff ff       	call   100fad <f3>
+  101006:	83 c4 08             	add    $0x8,%esp
+  101009:	90                   	nop
+  10100a:	c9                   	leave
+  10100b:	c3                   	ret
+
+0010100c <f1>:
+static void gcc_noinline f1(int r, uint32_t *e) { r & 1 ? f2(r,e) : f2(r,e); }
+  10100c:	55                   	push   %ebp
+  10100d:	89 e5                	mov    %esp,%ebp
+  10100f:	e8 fc f3 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  101014:	05 e0 cf 00 00       	add    $0xcfe0,%eax
+  101019:	8b 45 08             	mov    0x8(%ebp),%eax
+  10101c:	83 e0 01             	and    $0x1,%eax
+  10101f:	85 c0                	test   %eax,%eax
+  101021:	74 10                	je     101033 <f1+0x27>
+  101023:	ff 75 0c             	push   0xc(%ebp)
+  101026:	ff 75 08             	push   0x8(%ebp)
+  101029:	e8 a6 ff ff ff       	call   100fd4 <f2>
+  10102e:	83 c4 08             	add    $0x8,%esp
+  101031:	eb 0e                	jmp    101041 <f1+0x35>
+  101033:	ff 75 0c             	push   0xc(%ebp)
+  101036:	ff 75 08             	push   0x8(%ebp)
+  101039:	e8 96 ff ff ff       	call   100fd4 <f2>
+  10103e:	83 c4 08             	add    $0x8,%esp
+  101041:	90                   	nop
+  101042:	c9                   	leave
+  101043:	c3                   	ret
+
+00101044 <debug_check>:
+
+// Test the backtrace implementation for correct operation
+void
+debug_check(void)
+{
+  101044:	55                   	push   %ebp
+  101045:	89 e5                	mov    %esp,%ebp
+  101047:	53                   	push   %ebx
+  101048:	81 ec b4 00 00 00    	sub    $0xb4,%esp
+  10104e:	e8 c1 f3 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  101053:	81 c3 a1 cf 00 00    	add    $0xcfa1,%ebx
+	uint32_t eips[4][DEBUG_TRACEFRAMES];
+	int r, i;
+
+	// produce several related backtraces...
+	for (i = 0; i < 4; i++)
+  101059:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  101060:	eb 25                	jmp    101087 <debug_check+0x43>
+		f1(i, eips[i]);
+  101062:	8d 8d 50 ff ff ff    	lea    -0xb0(%ebp),%ecx
+  101068:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  10106b:	89 d0                	mov    %edx,%eax
+  10106d:	c1 e0 02             	shl    $0x2,%eax
+  101070:	01 d0                	add    %edx,%eax
+  101072:	c1 e0 03             	shl    $0x3,%eax
+  101075:	01 c8                	add    %ecx,%eax
+  101077:	50                   	push   %eax
+  101078:	ff 75 f0             	push   -0x10(%ebp)
+  10107b:	e8 8c ff ff ff       	call   10100c <f1>
+  101080:	83 c4 08             	add    $0x8,%esp
+	for (i = 0; i < 4; i++)
+  101083:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  101087:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+  10108b:	7e d5                	jle    101062 <debug_check+0x1e>
+
+	// ...and make sure they come out correctly.
+	for (r = 0; r < 4; r++)
+  10108d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  101094:	e9 ac 00 00 00       	jmp    101145 <debug_check+0x101>
+		for (i = 0; i < DEBUG_TRACEFRAMES; i++) {
+  101099:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  1010a0:	e9 92 00 00 00       	jmp    101137 <debug_check+0xf3>
+			assert((eips[r][i] != 0) == (i < 5));
+  1010a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1010a8:	89 d0                	mov    %edx,%eax
+  1010aa:	c1 e0 02             	shl    $0x2,%eax
+  1010ad:	01 d0                	add    %edx,%eax
+  1010af:	01 c0                	add    %eax,%eax
+  1010b1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1010b4:	01 d0                	add    %edx,%eax
+  1010b6:	8b 84 85 50 ff ff ff 	mov    -0xb0(%ebp,%eax,4),%eax
+  1010bd:	85 c0                	test   %eax,%eax
+  1010bf:	0f 95 c2             	setne  %dl
+  1010c2:	83 7d f0 04          	cmpl   $0x4,-0x10(%ebp)
+  1010c6:	0f 9e c0             	setle  %al
+  1010c9:	31 d0                	xor    %edx,%eax
+  1010cb:	84 c0                	test   %al,%al
+  1010cd:	74 1c                	je     1010eb <debug_check+0xa7>
+  1010cf:	8d 83 49 b2 ff ff    	lea    -0x4db7(%ebx),%eax
+  1010d5:	50                   	push   %eax
+  1010d6:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  1010dc:	50                   	push   %eax
+  1010dd:	6a 77                	push   $0x77
+  1010df:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  1010e5:	50                   	push   %eax
+  1010e6:	e8 e7 fc ff ff       	call   100dd2 <debug_panic>
+			if (i >= 2)
+  1010eb:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+  1010ef:	7e 42                	jle    101133 <debug_check+0xef>
+				assert(eips[r][i] == eips[0][i]);
+  1010f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1010f4:	89 d0                	mov    %edx,%eax
+  1010f6:	c1 e0 02             	shl    $0x2,%eax
+  1010f9:	01 d0                	add    %edx,%eax
+  1010fb:	01 c0                	add    %eax,%eax
+  1010fd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  101100:	01 d0                	add    %edx,%eax
+  101102:	8b 94 85 50 ff ff ff 	mov    -0xb0(%ebp,%eax,4),%edx
+  101109:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  10110c:	8b 84 85 50 ff ff ff 	mov    -0xb0(%ebp,%eax,4),%eax
+  101113:	39 c2                	cmp    %eax,%edx
+  101115:	74 1c                	je     101133 <debug_check+0xef>
+  101117:	8d 83 88 b2 ff ff    	lea    -0x4d78(%ebx),%eax
+  10111d:	50                   	push   %eax
+  10111e:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  101124:	50                   	push   %eax
+  101125:	6a 79                	push   $0x79
+  101127:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  10112d:	50                   	push   %eax
+  10112e:	e8 9f fc ff ff       	call   100dd2 <debug_panic>
+		for (i = 0; i < DEBUG_TRACEFRAMES; i++) {
+  101133:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  101137:	83 7d f0 09          	cmpl   $0x9,-0x10(%ebp)
+  10113b:	0f 8e 64 ff ff ff    	jle    1010a5 <debug_check+0x61>
+	for (r = 0; r < 4; r++)
+  101141:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  101145:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  101149:	0f 8e 4a ff ff ff    	jle    101099 <debug_check+0x55>
+		}
+	assert(eips[0][0] == eips[1][0]);
+  10114f:	8b 95 50 ff ff ff    	mov    -0xb0(%ebp),%edx
+  101155:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+  10115b:	39 c2                	cmp    %eax,%edx
+  10115d:	74 1c                	je     10117b <debug_check+0x137>
+  10115f:	8d 83 a1 b2 ff ff    	lea    -0x4d5f(%ebx),%eax
+  101165:	50                   	push   %eax
+  101166:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  10116c:	50                   	push   %eax
+  10116d:	6a 7b                	push   $0x7b
+  10116f:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  101175:	50                   	push   %eax
+  101176:	e8 57 fc ff ff       	call   100dd2 <debug_panic>
+	assert(eips[2][0] == eips[3][0]);
+  10117b:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  10117e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  101181:	39 c2                	cmp    %eax,%edx
+  101183:	74 1c                	je     1011a1 <debug_check+0x15d>
+  101185:	8d 83 ba b2 ff ff    	lea    -0x4d46(%ebx),%eax
+  10118b:	50                   	push   %eax
+  10118c:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  101192:	50                   	push   %eax
+  101193:	6a 7c                	push   $0x7c
+  101195:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  10119b:	50                   	push   %eax
+  10119c:	e8 31 fc ff ff       	call   100dd2 <debug_panic>
+	assert(eips[1][0] != eips[2][0]);
+  1011a1:	8b 95 78 ff ff ff    	mov    -0x88(%ebp),%edx
+  1011a7:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  1011aa:	39 c2                	cmp    %eax,%edx
+  1011ac:	75 1c                	jne    1011ca <debug_check+0x186>
+  1011ae:	8d 83 d3 b2 ff ff    	lea    -0x4d2d(%ebx),%eax
+  1011b4:	50                   	push   %eax
+  1011b5:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  1011bb:	50                   	push   %eax
+  1011bc:	6a 7d                	push   $0x7d
+  1011be:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  1011c4:	50                   	push   %eax
+  1011c5:	e8 08 fc ff ff       	call   100dd2 <debug_panic>
+	assert(eips[0][1] == eips[2][1]);
+  1011ca:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  1011d0:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  1011d3:	39 c2                	cmp    %eax,%edx
+  1011d5:	74 1c                	je     1011f3 <debug_check+0x1af>
+  1011d7:	8d 83 ec b2 ff ff    	lea    -0x4d14(%ebx),%eax
+  1011dd:	50                   	push   %eax
+  1011de:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  1011e4:	50                   	push   %eax
+  1011e5:	6a 7e                	push   $0x7e
+  1011e7:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  1011ed:	50                   	push   %eax
+  1011ee:	e8 df fb ff ff       	call   100dd2 <debug_panic>
+	assert(eips[1][1] == eips[3][1]);
+  1011f3:	8b 95 7c ff ff ff    	mov    -0x84(%ebp),%edx
+  1011f9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  1011fc:	39 c2                	cmp    %eax,%edx
+  1011fe:	74 1c                	je     10121c <debug_check+0x1d8>
+  101200:	8d 83 05 b3 ff ff    	lea    -0x4cfb(%ebx),%eax
+  101206:	50                   	push   %eax
+  101207:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  10120d:	50                   	push   %eax
+  10120e:	6a 7f                	push   $0x7f
+  101210:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  101216:	50                   	push   %eax
+  101217:	e8 b6 fb ff ff       	call   100dd2 <debug_panic>
+	assert(eips[0][1] != eips[1][1]);
+  10121c:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  101222:	8b 85 7c ff ff ff    	mov    -0x84(%ebp),%eax
+  101228:	39 c2                	cmp    %eax,%edx
+  10122a:	75 1f                	jne    10124b <debug_check+0x207>
+  10122c:	8d 83 1e b3 ff ff    	lea    -0x4ce2(%ebx),%eax
+  101232:	50                   	push   %eax
+  101233:	8d 83 66 b2 ff ff    	lea    -0x4d9a(%ebx),%eax
+  101239:	50                   	push   %eax
+  10123a:	68 80 00 00 00       	push   $0x80
+  10123f:	8d 83 7b b2 ff ff    	lea    -0x4d85(%ebx),%eax
+  101245:	50                   	push   %eax
+  101246:	e8 87 fb ff ff       	call   100dd2 <debug_panic>
+
+	cprintf("debug_check() succeeded!\n");
+  10124b:	83 ec 0c             	sub    $0xc,%esp
+  10124e:	8d 83 37 b3 ff ff    	lea    -0x4cc9(%ebx),%eax
+  101254:	50                   	push   %eax
+  101255:	e8 bb 69 00 00       	call   107c15 <cprintf>
+  10125a:	83 c4 10             	add    $0x10,%esp
+}
+  10125d:	90                   	nop
+  10125e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  101261:	c9                   	leave
+  101262:	c3                   	ret
+
+00101263 <lockadd>:
+	assert(pp1 && pp1 != pp0);
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+	assert(mem_alloc() == 0);
+
+	// give free list back
+	mem_freelist = fl;
+  101263:	55                   	push   %ebp
+  101264:	89 e5                	mov    %esp,%ebp
+  101266:	e8 a5 f1 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10126b:	05 89 cd 00 00       	add    $0xcd89,%eax
+
+  101270:	8b 45 08             	mov    0x8(%ebp),%eax
+  101273:	8b 55 0c             	mov    0xc(%ebp),%edx
+  101276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  101279:	f0 01 10             	lock add %edx,(%eax)
+	// free the pages we took
+  10127c:	90                   	nop
+  10127d:	5d                   	pop    %ebp
+  10127e:	c3                   	ret
+
+0010127f <lockaddz>:
+	mem_free(pp0);
+	mem_free(pp1);
+	mem_free(pp2);
+
+	cprintf("mem_check() succeeded!\n");
+  10127f:	55                   	push   %ebp
+  101280:	89 e5                	mov    %esp,%ebp
+  101282:	83 ec 10             	sub    $0x10,%esp
+  101285:	e8 86 f1 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10128a:	05 6a cd 00 00       	add    $0xcd6a,%eax
+}
+
+  10128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  101292:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101295:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  101298:	f0 01 02             	lock add %eax,(%edx)
+  10129b:	0f 94 c0             	sete   %al
+  10129e:	88 45 ff             	mov    %al,-0x1(%ebp)
+  1012a1:	0f b6 45 ff          	movzbl -0x1(%ebp),%eax
+  1012a5:	c9                   	leave
+  1012a6:	c3                   	ret
+
+001012a7 <cpu_cur>:
+cpu_cur() {
+  1012a7:	55                   	push   %ebp
+  1012a8:	89 e5                	mov    %esp,%ebp
+  1012aa:	53                   	push   %ebx
+  1012ab:	83 ec 14             	sub    $0x14,%esp
+  1012ae:	e8 5d f1 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1012b3:	05 41 cd 00 00       	add    $0xcd41,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  1012b8:	89 e2                	mov    %esp,%edx
+  1012ba:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  1012bd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  1012c0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  1012c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1012c6:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  1012cc:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  1012cf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1012d2:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  1012d8:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  1012de:	74 1e                	je     1012fe <cpu_cur+0x57>
+  1012e0:	8d 90 54 b3 ff ff    	lea    -0x4cac(%eax),%edx
+  1012e6:	52                   	push   %edx
+  1012e7:	8d 90 6a b3 ff ff    	lea    -0x4c96(%eax),%edx
+  1012ed:	52                   	push   %edx
+  1012ee:	6a 65                	push   $0x65
+  1012f0:	8d 90 7f b3 ff ff    	lea    -0x4c81(%eax),%edx
+  1012f6:	52                   	push   %edx
+  1012f7:	89 c3                	mov    %eax,%ebx
+  1012f9:	e8 d4 fa ff ff       	call   100dd2 <debug_panic>
+	return c;
+  1012fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  101301:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  101304:	c9                   	leave
+  101305:	c3                   	ret
+
+00101306 <cpu_onboot>:
+cpu_onboot() {
+  101306:	55                   	push   %ebp
+  101307:	89 e5                	mov    %esp,%ebp
+  101309:	53                   	push   %ebx
+  10130a:	83 ec 04             	sub    $0x4,%esp
+  10130d:	e8 02 f1 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  101312:	81 c3 e2 cc 00 00    	add    $0xcce2,%ebx
+	return cpu_cur() == &cpu_boot;
+  101318:	e8 8a ff ff ff       	call   1012a7 <cpu_cur>
+  10131d:	c7 c2 00 f0 10 00    	mov    $0x10f000,%edx
+  101323:	39 d0                	cmp    %edx,%eax
+  101325:	0f 94 c0             	sete   %al
+  101328:	0f b6 c0             	movzbl %al,%eax
+}
+  10132b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10132e:	c9                   	leave
+  10132f:	c3                   	ret
+
+00101330 <mem_init>:
+{
+  101330:	55                   	push   %ebp
+  101331:	89 e5                	mov    %esp,%ebp
+  101333:	53                   	push   %ebx
+  101334:	83 ec 54             	sub    $0x54,%esp
+  101337:	e8 d8 f0 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10133c:	81 c3 b8 cc 00 00    	add    $0xccb8,%ebx
+	if (!cpu_onboot())	// only do once, on the boot CPU
+  101342:	e8 bf ff ff ff       	call   101306 <cpu_onboot>
+  101347:	85 c0                	test   %eax,%eax
+  101349:	0f 84 e2 03 00 00    	je     101731 <mem_init+0x401>
+	size_t basemem = ROUNDDOWN(nvram_read16(NVRAM_BASELO)*1024, PAGESIZE);
+  10134f:	83 ec 0c             	sub    $0xc,%esp
+  101352:	6a 15                	push   $0x15
+  101354:	e8 4c 5e 00 00       	call   1071a5 <nvram_read16>
+  101359:	83 c4 10             	add    $0x10,%esp
+  10135c:	c1 e0 0a             	shl    $0xa,%eax
+  10135f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  101362:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  101365:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  10136a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	size_t extmem = ROUNDDOWN(nvram_read16(NVRAM_EXTLO)*1024, PAGESIZE);
+  10136d:	83 ec 0c             	sub    $0xc,%esp
+  101370:	6a 17                	push   $0x17
+  101372:	e8 2e 5e 00 00       	call   1071a5 <nvram_read16>
+  101377:	83 c4 10             	add    $0x10,%esp
+  10137a:	c1 e0 0a             	shl    $0xa,%eax
+  10137d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  101380:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  101383:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  101388:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	mem_max = MEM_EXT + extmem;
+  10138b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10138e:	05 00 00 10 00       	add    $0x100000,%eax
+  101393:	89 83 58 54 01 00    	mov    %eax,0x15458(%ebx)
+	if (multiboot_nregions > 0) {
+  101399:	c7 c0 60 6d 13 00    	mov    $0x136d60,%eax
+  10139f:	8b 00                	mov    (%eax),%eax
+  1013a1:	85 c0                	test   %eax,%eax
+  1013a3:	7e 66                	jle    10140b <mem_init+0xdb>
+		mem_max = 0;
+  1013a5:	c7 83 58 54 01 00 00 	movl   $0x0,0x15458(%ebx)
+  1013ac:	00 00 00 
+		for (r = 0; r < multiboot_nregions; r++)
+  1013af:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  1013b6:	eb 2e                	jmp    1013e6 <mem_init+0xb6>
+			mem_max = MAX(mem_max, multiboot_regions[r].end);
+  1013b8:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  1013be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  1013c1:	c7 c0 80 6d 13 00    	mov    $0x136d80,%eax
+  1013c7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1013ca:	8b 44 d0 04          	mov    0x4(%eax,%edx,8),%eax
+  1013ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  1013d1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  1013d4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1013d7:	39 c2                	cmp    %eax,%edx
+  1013d9:	0f 43 c2             	cmovae %edx,%eax
+  1013dc:	89 83 58 54 01 00    	mov    %eax,0x15458(%ebx)
+		for (r = 0; r < multiboot_nregions; r++)
+  1013e2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  1013e6:	c7 c0 60 6d 13 00    	mov    $0x136d60,%eax
+  1013ec:	8b 00                	mov    (%eax),%eax
+  1013ee:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+  1013f1:	7c c5                	jl     1013b8 <mem_init+0x88>
+		extmem = mem_max > MEM_EXT ? mem_max - MEM_EXT : 0;
+  1013f3:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  1013f9:	ba 00 00 10 00       	mov    $0x100000,%edx
+  1013fe:	39 d0                	cmp    %edx,%eax
+  101400:	0f 42 c2             	cmovb  %edx,%eax
+  101403:	2d 00 00 10 00       	sub    $0x100000,%eax
+  101408:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if (mem_max > VM_USERLO) {
+  10140b:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  101411:	3d 00 00 00 40       	cmp    $0x40000000,%eax
+  101416:	76 18                	jbe    101430 <mem_init+0x100>
+		mem_max = VM_USERLO;
+  101418:	c7 83 58 54 01 00 00 	movl   $0x40000000,0x15458(%ebx)
+  10141f:	00 00 40 
+		extmem = mem_max - MEM_EXT;
+  101422:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  101428:	2d 00 00 10 00       	sub    $0x100000,%eax
+  10142d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	mem_npage = mem_max / PAGESIZE;
+  101430:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  101436:	c1 e8 0c             	shr    $0xc,%eax
+  101439:	89 83 5c 54 01 00    	mov    %eax,0x1545c(%ebx)
+	cprintf("Physical memory: %dK available, ", (int)(mem_max/1024));
+  10143f:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  101445:	c1 e8 0a             	shr    $0xa,%eax
+  101448:	83 ec 08             	sub    $0x8,%esp
+  10144b:	50                   	push   %eax
+  10144c:	8d 83 8c b3 ff ff    	lea    -0x4c74(%ebx),%eax
+  101452:	50                   	push   %eax
+  101453:	e8 bd 67 00 00       	call   107c15 <cprintf>
+  101458:	83 c4 10             	add    $0x10,%esp
+		(int)(basemem/1024), (int)(extmem/1024));
+  10145b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10145e:	c1 e8 0a             	shr    $0xa,%eax
+	cprintf("base = %dK, extended = %dK\n",
+  101461:	89 c2                	mov    %eax,%edx
+		(int)(basemem/1024), (int)(extmem/1024));
+  101463:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  101466:	c1 e8 0a             	shr    $0xa,%eax
+	cprintf("base = %dK, extended = %dK\n",
+  101469:	83 ec 04             	sub    $0x4,%esp
+  10146c:	52                   	push   %edx
+  10146d:	50                   	push   %eax
+  10146e:	8d 83 ad b3 ff ff    	lea    -0x4c53(%ebx),%eax
+  101474:	50                   	push   %eax
+  101475:	e8 9b 67 00 00       	call   107c15 <cprintf>
+  10147a:	83 c4 10             	add    $0x10,%esp
+	char *pistart = MAX((char *) end, (char *) mem_ptr(multiboot_end()));
+  10147d:	c7 c0 a0 20 14 00    	mov    $0x1420a0,%eax
+  101483:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  101486:	e8 74 33 00 00       	call   1047ff <multiboot_end>
+  10148b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  10148e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  101491:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  101494:	39 c2                	cmp    %eax,%edx
+  101496:	0f 43 c2             	cmovae %edx,%eax
+  101499:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	mem_pageinfo=(pageinfo *)ROUNDUP(((int)pistart), sizeof(pageinfo)); //The page table is now supposed to start from the beginning of memory.
+  10149c:	c7 45 c4 08 00 00 00 	movl   $0x8,-0x3c(%ebp)
+  1014a3:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  1014a6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  1014a9:	01 d0                	add    %edx,%eax
+  1014ab:	83 e8 01             	sub    $0x1,%eax
+  1014ae:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  1014b1:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  1014b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  1014b9:	f7 75 c4             	divl   -0x3c(%ebp)
+  1014bc:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  1014bf:	29 d0                	sub    %edx,%eax
+  1014c1:	89 83 60 54 01 00    	mov    %eax,0x15460(%ebx)
+	memset(mem_pageinfo, 0, mem_npage*sizeof(pageinfo));
+  1014c7:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  1014cd:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  1014d4:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1014da:	83 ec 04             	sub    $0x4,%esp
+  1014dd:	52                   	push   %edx
+  1014de:	6a 00                	push   $0x0
+  1014e0:	50                   	push   %eax
+  1014e1:	e8 c8 69 00 00       	call   107eae <memset>
+  1014e6:	83 c4 10             	add    $0x10,%esp
+	pageinfo **freetail = &mem_freelist;
+  1014e9:	8d 83 64 54 01 00    	lea    0x15464(%ebx),%eax
+  1014ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	cprintf("Starting to build the free list.\n");
+  1014f2:	83 ec 0c             	sub    $0xc,%esp
+  1014f5:	8d 83 cc b3 ff ff    	lea    -0x4c34(%ebx),%eax
+  1014fb:	50                   	push   %eax
+  1014fc:	e8 14 67 00 00       	call   107c15 <cprintf>
+  101501:	83 c4 10             	add    $0x10,%esp
+	int headflag=1; 
+  101504:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%ebp)
+	for (i = 0; i < mem_npage; i++) {
+  10150b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  101512:	e9 38 01 00 00       	jmp    10164f <mem_init+0x31f>
+		if (
+  101517:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  10151b:	0f 84 15 01 00 00    	je     101636 <mem_init+0x306>
+			(i!=0) && 
+  101521:	83 7d e8 01          	cmpl   $0x1,-0x18(%ebp)
+  101525:	0f 84 0b 01 00 00    	je     101636 <mem_init+0x306>
+			(i!=1) && 
+  10152b:	81 7d e8 9f 00 00 00 	cmpl   $0x9f,-0x18(%ebp)
+  101532:	7e 0d                	jle    101541 <mem_init+0x211>
+			((i<(MEM_IO / PAGESIZE)) || (i>=(MEM_EXT/PAGESIZE))) && 
+  101534:	81 7d e8 ff 00 00 00 	cmpl   $0xff,-0x18(%ebp)
+  10153b:	0f 8e f5 00 00 00    	jle    101636 <mem_init+0x306>
+			((i<((int)start / PAGESIZE)) || (i>(ROUNDUP((int)pistart,sizeof(pageinfo))+mem_npage*sizeof(pageinfo))/PAGESIZE)) &&
+  101541:	c7 c0 0c 00 10 00    	mov    $0x10000c,%eax
+  101547:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  10154d:	85 c0                	test   %eax,%eax
+  10154f:	0f 48 c2             	cmovs  %edx,%eax
+  101552:	c1 f8 0c             	sar    $0xc,%eax
+			((i<(MEM_IO / PAGESIZE)) || (i>=(MEM_EXT/PAGESIZE))) && 
+  101555:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+  101558:	7c 42                	jl     10159c <mem_init+0x26c>
+			((i<((int)start / PAGESIZE)) || (i>(ROUNDUP((int)pistart,sizeof(pageinfo))+mem_npage*sizeof(pageinfo))/PAGESIZE)) &&
+  10155a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%ebp)
+  101561:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  101564:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  101567:	01 d0                	add    %edx,%eax
+  101569:	83 e8 01             	sub    $0x1,%eax
+  10156c:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  10156f:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  101572:	ba 00 00 00 00       	mov    $0x0,%edx
+  101577:	f7 75 b8             	divl   -0x48(%ebp)
+  10157a:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  10157d:	29 d0                	sub    %edx,%eax
+  10157f:	89 c2                	mov    %eax,%edx
+  101581:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  101587:	c1 e0 03             	shl    $0x3,%eax
+  10158a:	01 d0                	add    %edx,%eax
+  10158c:	c1 e8 0c             	shr    $0xc,%eax
+  10158f:	89 c2                	mov    %eax,%edx
+  101591:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  101594:	39 c2                	cmp    %eax,%edx
+  101596:	0f 83 9a 00 00 00    	jae    101636 <mem_init+0x306>
+			multiboot_avail(i * PAGESIZE, PAGESIZE)
+  10159c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10159f:	c1 e0 0c             	shl    $0xc,%eax
+  1015a2:	83 ec 08             	sub    $0x8,%esp
+  1015a5:	68 00 10 00 00       	push   $0x1000
+  1015aa:	50                   	push   %eax
+  1015ab:	e8 e3 31 00 00       	call   104793 <multiboot_avail>
+  1015b0:	83 c4 10             	add    $0x10,%esp
+			((i<((int)start / PAGESIZE)) || (i>(ROUNDUP((int)pistart,sizeof(pageinfo))+mem_npage*sizeof(pageinfo))/PAGESIZE)) &&
+  1015b3:	85 c0                	test   %eax,%eax
+  1015b5:	74 7f                	je     101636 <mem_init+0x306>
+			mem_pageinfo[i].refcount = 0;
+  1015b7:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1015bd:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  1015c0:	c1 e2 03             	shl    $0x3,%edx
+  1015c3:	01 d0                	add    %edx,%eax
+  1015c5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+			*freetail = &mem_pageinfo[i];
+  1015cc:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1015d2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  1015d5:	c1 e2 03             	shl    $0x3,%edx
+  1015d8:	01 c2                	add    %eax,%edx
+  1015da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1015dd:	89 10                	mov    %edx,(%eax)
+			freetail = &mem_pageinfo[i].free_next;
+  1015df:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1015e5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  1015e8:	c1 e2 03             	shl    $0x3,%edx
+  1015eb:	01 d0                	add    %edx,%eax
+  1015ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+			if ((int)freetail==0x10a000) {cprintf("i=%d is the culprit! %x\n", i,(int)(freetail));}
+  1015f0:	81 7d ec 00 a0 10 00 	cmpl   $0x10a000,-0x14(%ebp)
+  1015f7:	75 19                	jne    101612 <mem_init+0x2e2>
+  1015f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1015fc:	83 ec 04             	sub    $0x4,%esp
+  1015ff:	50                   	push   %eax
+  101600:	ff 75 e8             	push   -0x18(%ebp)
+  101603:	8d 83 ee b3 ff ff    	lea    -0x4c12(%ebx),%eax
+  101609:	50                   	push   %eax
+  10160a:	e8 06 66 00 00       	call   107c15 <cprintf>
+  10160f:	83 c4 10             	add    $0x10,%esp
+			if(i == 513) cprintf("i=%d is the culprit! %x\n", i,(int)(freetail));;
+  101612:	81 7d e8 01 02 00 00 	cmpl   $0x201,-0x18(%ebp)
+  101619:	75 30                	jne    10164b <mem_init+0x31b>
+  10161b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10161e:	83 ec 04             	sub    $0x4,%esp
+  101621:	50                   	push   %eax
+  101622:	ff 75 e8             	push   -0x18(%ebp)
+  101625:	8d 83 ee b3 ff ff    	lea    -0x4c12(%ebx),%eax
+  10162b:	50                   	push   %eax
+  10162c:	e8 e4 65 00 00       	call   107c15 <cprintf>
+  101631:	83 c4 10             	add    $0x10,%esp
+  101634:	eb 15                	jmp    10164b <mem_init+0x31b>
+			mem_pageinfo[i].refcount = 1;
+  101636:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  10163c:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  10163f:	c1 e2 03             	shl    $0x3,%edx
+  101642:	01 d0                	add    %edx,%eax
+  101644:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	for (i = 0; i < mem_npage; i++) {
+  10164b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+  10164f:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  101652:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  101658:	39 c2                	cmp    %eax,%edx
+  10165a:	0f 82 b7 fe ff ff    	jb     101517 <mem_init+0x1e7>
+	*freetail = NULL;	// null-terminate the freelist
+  101660:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101663:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	cprintf("Finished building the free list.\n");
+  101669:	83 ec 0c             	sub    $0xc,%esp
+  10166c:	8d 83 08 b4 ff ff    	lea    -0x4bf8(%ebx),%eax
+  101672:	50                   	push   %eax
+  101673:	e8 9d 65 00 00       	call   107c15 <cprintf>
+  101678:	83 c4 10             	add    $0x10,%esp
+	cprintf("MEM_IO=0x%x\n", MEM_IO);
+  10167b:	83 ec 08             	sub    $0x8,%esp
+  10167e:	68 00 00 0a 00       	push   $0xa0000
+  101683:	8d 83 2a b4 ff ff    	lea    -0x4bd6(%ebx),%eax
+  101689:	50                   	push   %eax
+  10168a:	e8 86 65 00 00       	call   107c15 <cprintf>
+  10168f:	83 c4 10             	add    $0x10,%esp
+	cprintf("MEM_EXT=0x%x\n", MEM_EXT);
+  101692:	83 ec 08             	sub    $0x8,%esp
+  101695:	68 00 00 10 00       	push   $0x100000
+  10169a:	8d 83 37 b4 ff ff    	lea    -0x4bc9(%ebx),%eax
+  1016a0:	50                   	push   %eax
+  1016a1:	e8 6f 65 00 00       	call   107c15 <cprintf>
+  1016a6:	83 c4 10             	add    $0x10,%esp
+	cprintf("extmem=0x%x\n", extmem);
+  1016a9:	83 ec 08             	sub    $0x8,%esp
+  1016ac:	ff 75 f4             	push   -0xc(%ebp)
+  1016af:	8d 83 45 b4 ff ff    	lea    -0x4bbb(%ebx),%eax
+  1016b5:	50                   	push   %eax
+  1016b6:	e8 5a 65 00 00       	call   107c15 <cprintf>
+  1016bb:	83 c4 10             	add    $0x10,%esp
+	cprintf("mem_max=0x%x\n", mem_max);
+  1016be:	8b 83 58 54 01 00    	mov    0x15458(%ebx),%eax
+  1016c4:	83 ec 08             	sub    $0x8,%esp
+  1016c7:	50                   	push   %eax
+  1016c8:	8d 83 52 b4 ff ff    	lea    -0x4bae(%ebx),%eax
+  1016ce:	50                   	push   %eax
+  1016cf:	e8 41 65 00 00       	call   107c15 <cprintf>
+  1016d4:	83 c4 10             	add    $0x10,%esp
+	cprintf("PAGESIZE=0x%x\n", PAGESIZE);
+  1016d7:	83 ec 08             	sub    $0x8,%esp
+  1016da:	68 00 10 00 00       	push   $0x1000
+  1016df:	8d 83 60 b4 ff ff    	lea    -0x4ba0(%ebx),%eax
+  1016e5:	50                   	push   %eax
+  1016e6:	e8 2a 65 00 00       	call   107c15 <cprintf>
+  1016eb:	83 c4 10             	add    $0x10,%esp
+	cprintf("mem_npage=0x%x\n", mem_npage);
+  1016ee:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  1016f4:	83 ec 08             	sub    $0x8,%esp
+  1016f7:	50                   	push   %eax
+  1016f8:	8d 83 6f b4 ff ff    	lea    -0x4b91(%ebx),%eax
+  1016fe:	50                   	push   %eax
+  1016ff:	e8 11 65 00 00       	call   107c15 <cprintf>
+  101704:	83 c4 10             	add    $0x10,%esp
+	cprintf("sizeof(struct pageinfo)=0x%x\n", sizeof(struct pageinfo));
+  101707:	83 ec 08             	sub    $0x8,%esp
+  10170a:	6a 08                	push   $0x8
+  10170c:	8d 83 7f b4 ff ff    	lea    -0x4b81(%ebx),%eax
+  101712:	50                   	push   %eax
+  101713:	e8 fd 64 00 00       	call   107c15 <cprintf>
+  101718:	83 c4 10             	add    $0x10,%esp
+	cprintf("sizeof(pageinfo)=0x%x\n", sizeof(pageinfo));
+  10171b:	83 ec 08             	sub    $0x8,%esp
+  10171e:	6a 08                	push   $0x8
+  101720:	8d 83 9d b4 ff ff    	lea    -0x4b63(%ebx),%eax
+  101726:	50                   	push   %eax
+  101727:	e8 e9 64 00 00       	call   107c15 <cprintf>
+  10172c:	83 c4 10             	add    $0x10,%esp
+  10172f:	eb 01                	jmp    101732 <mem_init+0x402>
+		return;
+  101731:	90                   	nop
+}
+  101732:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  101735:	c9                   	leave
+  101736:	c3                   	ret
+
+00101737 <mem_alloc>:
+{
+  101737:	55                   	push   %ebp
+  101738:	89 e5                	mov    %esp,%ebp
+  10173a:	83 ec 10             	sub    $0x10,%esp
+  10173d:	e8 ce ec ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  101742:	05 b2 c8 00 00       	add    $0xc8b2,%eax
+	if (mem_freelist==NULL) {
+  101747:	8b 90 64 54 01 00    	mov    0x15464(%eax),%edx
+  10174d:	85 d2                	test   %edx,%edx
+  10174f:	75 07                	jne    101758 <mem_alloc+0x21>
+		return NULL;
+  101751:	b8 00 00 00 00       	mov    $0x0,%eax
+  101756:	eb 17                	jmp    10176f <mem_alloc+0x38>
+		pageinfo *ret=mem_freelist;
+  101758:	8b 90 64 54 01 00    	mov    0x15464(%eax),%edx
+  10175e:	89 55 fc             	mov    %edx,-0x4(%ebp)
+		mem_freelist=ret->free_next;
+  101761:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  101764:	8b 12                	mov    (%edx),%edx
+  101766:	89 90 64 54 01 00    	mov    %edx,0x15464(%eax)
+		return ret;
+  10176c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  10176f:	c9                   	leave
+  101770:	c3                   	ret
+
+00101771 <mem_free>:
+{
+  101771:	55                   	push   %ebp
+  101772:	89 e5                	mov    %esp,%ebp
+  101774:	e8 97 ec ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  101779:	05 7b c8 00 00       	add    $0xc87b,%eax
+	if ((pi->refcount)==0) {
+  10177e:	8b 55 08             	mov    0x8(%ebp),%edx
+  101781:	8b 52 04             	mov    0x4(%edx),%edx
+  101784:	85 d2                	test   %edx,%edx
+  101786:	75 14                	jne    10179c <mem_free+0x2b>
+		pi->free_next=mem_freelist;
+  101788:	8b 88 64 54 01 00    	mov    0x15464(%eax),%ecx
+  10178e:	8b 55 08             	mov    0x8(%ebp),%edx
+  101791:	89 0a                	mov    %ecx,(%edx)
+		mem_freelist=pi;
+  101793:	8b 55 08             	mov    0x8(%ebp),%edx
+  101796:	89 90 64 54 01 00    	mov    %edx,0x15464(%eax)
+}
+  10179c:	90                   	nop
+  10179d:	5d                   	pop    %ebp
+  10179e:	c3                   	ret
+
+0010179f <mem_incref>:
+{
+  10179f:	55                   	push   %ebp
+  1017a0:	89 e5                	mov    %esp,%ebp
+  1017a2:	53                   	push   %ebx
+  1017a3:	83 ec 04             	sub    $0x4,%esp
+  1017a6:	e8 65 ec ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1017ab:	05 49 c8 00 00       	add    $0xc849,%eax
+	assert(pi > &mem_pageinfo[1] && pi < &mem_pageinfo[mem_npage]);
+  1017b0:	8b 90 60 54 01 00    	mov    0x15460(%eax),%edx
+  1017b6:	83 c2 08             	add    $0x8,%edx
+  1017b9:	3b 55 08             	cmp    0x8(%ebp),%edx
+  1017bc:	73 16                	jae    1017d4 <mem_incref+0x35>
+  1017be:	8b 90 60 54 01 00    	mov    0x15460(%eax),%edx
+  1017c4:	8b 88 5c 54 01 00    	mov    0x1545c(%eax),%ecx
+  1017ca:	c1 e1 03             	shl    $0x3,%ecx
+  1017cd:	01 ca                	add    %ecx,%edx
+  1017cf:	39 55 08             	cmp    %edx,0x8(%ebp)
+  1017d2:	72 21                	jb     1017f5 <mem_incref+0x56>
+  1017d4:	8d 90 b4 b4 ff ff    	lea    -0x4b4c(%eax),%edx
+  1017da:	52                   	push   %edx
+  1017db:	8d 90 6a b3 ff ff    	lea    -0x4c96(%eax),%edx
+  1017e1:	52                   	push   %edx
+  1017e2:	68 c9 00 00 00       	push   $0xc9
+  1017e7:	8d 90 eb b4 ff ff    	lea    -0x4b15(%eax),%edx
+  1017ed:	52                   	push   %edx
+  1017ee:	89 c3                	mov    %eax,%ebx
+  1017f0:	e8 dd f5 ff ff       	call   100dd2 <debug_panic>
+	assert(pi != mem_ptr2pi(pmap_zero));	// Don't alloc/free zero page!
+  1017f5:	8b 90 60 54 01 00    	mov    0x15460(%eax),%edx
+  1017fb:	c7 c1 00 80 13 00    	mov    $0x138000,%ecx
+  101801:	c1 e9 0c             	shr    $0xc,%ecx
+  101804:	c1 e1 03             	shl    $0x3,%ecx
+  101807:	01 ca                	add    %ecx,%edx
+  101809:	39 55 08             	cmp    %edx,0x8(%ebp)
+  10180c:	75 21                	jne    10182f <mem_incref+0x90>
+  10180e:	8d 90 f6 b4 ff ff    	lea    -0x4b0a(%eax),%edx
+  101814:	52                   	push   %edx
+  101815:	8d 90 6a b3 ff ff    	lea    -0x4c96(%eax),%edx
+  10181b:	52                   	push   %edx
+  10181c:	68 ca 00 00 00       	push   $0xca
+  101821:	8d 90 eb b4 ff ff    	lea    -0x4b15(%eax),%edx
+  101827:	52                   	push   %edx
+  101828:	89 c3                	mov    %eax,%ebx
+  10182a:	e8 a3 f5 ff ff       	call   100dd2 <debug_panic>
+	assert(pi < mem_ptr2pi(start) || pi > mem_ptr2pi(end-1));
+  10182f:	8b 90 60 54 01 00    	mov    0x15460(%eax),%edx
+  101835:	c7 c1 0c 00 10 00    	mov    $0x10000c,%ecx
+  10183b:	c1 e9 0c             	shr    $0xc,%ecx
+  10183e:	c1 e1 03             	shl    $0x3,%ecx
+  101841:	01 ca                	add    %ecx,%edx
+  101843:	39 55 08             	cmp    %edx,0x8(%ebp)
+  101846:	72 3d                	jb     101885 <mem_incref+0xe6>
+  101848:	8b 88 60 54 01 00    	mov    0x15460(%eax),%ecx
+  10184e:	c7 c2 a0 20 14 00    	mov    $0x1420a0,%edx
+  101854:	8d 52 ff             	lea    -0x1(%edx),%edx
+  101857:	c1 ea 0c             	shr    $0xc,%edx
+  10185a:	c1 e2 03             	shl    $0x3,%edx
+  10185d:	01 ca                	add    %ecx,%edx
+  10185f:	3b 55 08             	cmp    0x8(%ebp),%edx
+  101862:	72 21                	jb     101885 <mem_incref+0xe6>
+  101864:	8d 90 14 b5 ff ff    	lea    -0x4aec(%eax),%edx
+  10186a:	52                   	push   %edx
+  10186b:	8d 90 6a b3 ff ff    	lea    -0x4c96(%eax),%edx
+  101871:	52                   	push   %edx
+  101872:	68 cb 00 00 00       	push   $0xcb
+  101877:	8d 90 eb b4 ff ff    	lea    -0x4b15(%eax),%edx
+  10187d:	52                   	push   %edx
+  10187e:	89 c3                	mov    %eax,%ebx
+  101880:	e8 4d f5 ff ff       	call   100dd2 <debug_panic>
+	lockadd(&pi->refcount, 1);
+  101885:	8b 45 08             	mov    0x8(%ebp),%eax
+  101888:	83 c0 04             	add    $0x4,%eax
+  10188b:	83 ec 08             	sub    $0x8,%esp
+  10188e:	6a 01                	push   $0x1
+  101890:	50                   	push   %eax
+  101891:	e8 cd f9 ff ff       	call   101263 <lockadd>
+  101896:	83 c4 10             	add    $0x10,%esp
+}
+  101899:	90                   	nop
+  10189a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10189d:	c9                   	leave
+  10189e:	c3                   	ret
+
+0010189f <mem_decref>:
+{
+  10189f:	55                   	push   %ebp
+  1018a0:	89 e5                	mov    %esp,%ebp
+  1018a2:	53                   	push   %ebx
+  1018a3:	83 ec 04             	sub    $0x4,%esp
+  1018a6:	e8 69 eb ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1018ab:	81 c3 49 c7 00 00    	add    $0xc749,%ebx
+	assert(pi > &mem_pageinfo[1] && pi < &mem_pageinfo[mem_npage]);
+  1018b1:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1018b7:	83 c0 08             	add    $0x8,%eax
+  1018ba:	3b 45 08             	cmp    0x8(%ebp),%eax
+  1018bd:	73 16                	jae    1018d5 <mem_decref+0x36>
+  1018bf:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1018c5:	8b 93 5c 54 01 00    	mov    0x1545c(%ebx),%edx
+  1018cb:	c1 e2 03             	shl    $0x3,%edx
+  1018ce:	01 d0                	add    %edx,%eax
+  1018d0:	39 45 08             	cmp    %eax,0x8(%ebp)
+  1018d3:	72 1f                	jb     1018f4 <mem_decref+0x55>
+  1018d5:	8d 83 b4 b4 ff ff    	lea    -0x4b4c(%ebx),%eax
+  1018db:	50                   	push   %eax
+  1018dc:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  1018e2:	50                   	push   %eax
+  1018e3:	68 d5 00 00 00       	push   $0xd5
+  1018e8:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  1018ee:	50                   	push   %eax
+  1018ef:	e8 de f4 ff ff       	call   100dd2 <debug_panic>
+	assert(pi != mem_ptr2pi(pmap_zero));	// Don't alloc/free zero page!
+  1018f4:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1018fa:	c7 c2 00 80 13 00    	mov    $0x138000,%edx
+  101900:	c1 ea 0c             	shr    $0xc,%edx
+  101903:	c1 e2 03             	shl    $0x3,%edx
+  101906:	01 d0                	add    %edx,%eax
+  101908:	39 45 08             	cmp    %eax,0x8(%ebp)
+  10190b:	75 1f                	jne    10192c <mem_decref+0x8d>
+  10190d:	8d 83 f6 b4 ff ff    	lea    -0x4b0a(%ebx),%eax
+  101913:	50                   	push   %eax
+  101914:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  10191a:	50                   	push   %eax
+  10191b:	68 d6 00 00 00       	push   $0xd6
+  101920:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101926:	50                   	push   %eax
+  101927:	e8 a6 f4 ff ff       	call   100dd2 <debug_panic>
+	assert(pi < mem_ptr2pi(start) || pi > mem_ptr2pi(end-1));
+  10192c:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  101932:	c7 c2 0c 00 10 00    	mov    $0x10000c,%edx
+  101938:	c1 ea 0c             	shr    $0xc,%edx
+  10193b:	c1 e2 03             	shl    $0x3,%edx
+  10193e:	01 d0                	add    %edx,%eax
+  101940:	39 45 08             	cmp    %eax,0x8(%ebp)
+  101943:	72 3b                	jb     101980 <mem_decref+0xe1>
+  101945:	8b 93 60 54 01 00    	mov    0x15460(%ebx),%edx
+  10194b:	c7 c0 a0 20 14 00    	mov    $0x1420a0,%eax
+  101951:	8d 40 ff             	lea    -0x1(%eax),%eax
+  101954:	c1 e8 0c             	shr    $0xc,%eax
+  101957:	c1 e0 03             	shl    $0x3,%eax
+  10195a:	01 d0                	add    %edx,%eax
+  10195c:	3b 45 08             	cmp    0x8(%ebp),%eax
+  10195f:	72 1f                	jb     101980 <mem_decref+0xe1>
+  101961:	8d 83 14 b5 ff ff    	lea    -0x4aec(%ebx),%eax
+  101967:	50                   	push   %eax
+  101968:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  10196e:	50                   	push   %eax
+  10196f:	68 d7 00 00 00       	push   $0xd7
+  101974:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  10197a:	50                   	push   %eax
+  10197b:	e8 52 f4 ff ff       	call   100dd2 <debug_panic>
+	if (lockaddz(&pi->refcount, -1))
+  101980:	8b 45 08             	mov    0x8(%ebp),%eax
+  101983:	83 c0 04             	add    $0x4,%eax
+  101986:	83 ec 08             	sub    $0x8,%esp
+  101989:	6a ff                	push   $0xffffffff
+  10198b:	50                   	push   %eax
+  10198c:	e8 ee f8 ff ff       	call   10127f <lockaddz>
+  101991:	83 c4 10             	add    $0x10,%esp
+  101994:	84 c0                	test   %al,%al
+  101996:	74 0e                	je     1019a6 <mem_decref+0x107>
+			mem_free(pi);
+  101998:	83 ec 0c             	sub    $0xc,%esp
+  10199b:	ff 75 08             	push   0x8(%ebp)
+  10199e:	e8 ce fd ff ff       	call   101771 <mem_free>
+  1019a3:	83 c4 10             	add    $0x10,%esp
+	assert(pi->refcount >= 0);
+  1019a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  1019a9:	8b 40 04             	mov    0x4(%eax),%eax
+  1019ac:	85 c0                	test   %eax,%eax
+  1019ae:	79 1f                	jns    1019cf <mem_decref+0x130>
+  1019b0:	8d 83 45 b5 ff ff    	lea    -0x4abb(%ebx),%eax
+  1019b6:	50                   	push   %eax
+  1019b7:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  1019bd:	50                   	push   %eax
+  1019be:	68 db 00 00 00       	push   $0xdb
+  1019c3:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  1019c9:	50                   	push   %eax
+  1019ca:	e8 03 f4 ff ff       	call   100dd2 <debug_panic>
+}
+  1019cf:	90                   	nop
+  1019d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1019d3:	c9                   	leave
+  1019d4:	c3                   	ret
+
+001019d5 <mem_check>:
+{
+  1019d5:	55                   	push   %ebp
+  1019d6:	89 e5                	mov    %esp,%ebp
+  1019d8:	53                   	push   %ebx
+  1019d9:	83 ec 24             	sub    $0x24,%esp
+  1019dc:	e8 33 ea ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1019e1:	81 c3 13 c6 00 00    	add    $0xc613,%ebx
+	int freepages = 0;
+  1019e7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+	for (pp = mem_freelist; pp != 0; pp = pp->free_next) {
+  1019ee:	8b 83 64 54 01 00    	mov    0x15464(%ebx),%eax
+  1019f4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1019f7:	eb 32                	jmp    101a2b <mem_check+0x56>
+		memset(mem_pi2ptr(pp), 0x97, 128);
+  1019f9:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  1019ff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  101a02:	29 c2                	sub    %eax,%edx
+  101a04:	89 d0                	mov    %edx,%eax
+  101a06:	c1 e0 09             	shl    $0x9,%eax
+  101a09:	83 ec 04             	sub    $0x4,%esp
+  101a0c:	68 80 00 00 00       	push   $0x80
+  101a11:	68 97 00 00 00       	push   $0x97
+  101a16:	50                   	push   %eax
+  101a17:	e8 92 64 00 00       	call   107eae <memset>
+  101a1c:	83 c4 10             	add    $0x10,%esp
+		freepages++;
+  101a1f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+	for (pp = mem_freelist; pp != 0; pp = pp->free_next) {
+  101a23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101a26:	8b 00                	mov    (%eax),%eax
+  101a28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  101a2b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  101a2f:	75 c8                	jne    1019f9 <mem_check+0x24>
+	cprintf("mem_check: %d free pages\n", freepages);
+  101a31:	83 ec 08             	sub    $0x8,%esp
+  101a34:	ff 75 f0             	push   -0x10(%ebp)
+  101a37:	8d 83 57 b5 ff ff    	lea    -0x4aa9(%ebx),%eax
+  101a3d:	50                   	push   %eax
+  101a3e:	e8 d2 61 00 00       	call   107c15 <cprintf>
+  101a43:	83 c4 10             	add    $0x10,%esp
+	assert(freepages < mem_npage);	// can't have more free than total!
+  101a46:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  101a49:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  101a4f:	39 c2                	cmp    %eax,%edx
+  101a51:	72 1f                	jb     101a72 <mem_check+0x9d>
+  101a53:	8d 83 71 b5 ff ff    	lea    -0x4a8f(%ebx),%eax
+  101a59:	50                   	push   %eax
+  101a5a:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101a60:	50                   	push   %eax
+  101a61:	68 f4 00 00 00       	push   $0xf4
+  101a66:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101a6c:	50                   	push   %eax
+  101a6d:	e8 60 f3 ff ff       	call   100dd2 <debug_panic>
+	assert(freepages > 16000);	// make sure it's in the right ballpark
+  101a72:	81 7d f0 80 3e 00 00 	cmpl   $0x3e80,-0x10(%ebp)
+  101a79:	7f 1f                	jg     101a9a <mem_check+0xc5>
+  101a7b:	8d 83 87 b5 ff ff    	lea    -0x4a79(%ebx),%eax
+  101a81:	50                   	push   %eax
+  101a82:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101a88:	50                   	push   %eax
+  101a89:	68 f5 00 00 00       	push   $0xf5
+  101a8e:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101a94:	50                   	push   %eax
+  101a95:	e8 38 f3 ff ff       	call   100dd2 <debug_panic>
+	pp0 = pp1 = pp2 = 0;
+  101a9a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  101aa1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101aa4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  101aa7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  101aaa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pp0 = mem_alloc(); assert(pp0 != 0);
+  101aad:	e8 85 fc ff ff       	call   101737 <mem_alloc>
+  101ab2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  101ab5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  101ab9:	75 1f                	jne    101ada <mem_check+0x105>
+  101abb:	8d 83 99 b5 ff ff    	lea    -0x4a67(%ebx),%eax
+  101ac1:	50                   	push   %eax
+  101ac2:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101ac8:	50                   	push   %eax
+  101ac9:	68 f9 00 00 00       	push   $0xf9
+  101ace:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101ad4:	50                   	push   %eax
+  101ad5:	e8 f8 f2 ff ff       	call   100dd2 <debug_panic>
+	pp1 = mem_alloc(); assert(pp1 != 0);
+  101ada:	e8 58 fc ff ff       	call   101737 <mem_alloc>
+  101adf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  101ae2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  101ae6:	75 1f                	jne    101b07 <mem_check+0x132>
+  101ae8:	8d 83 a2 b5 ff ff    	lea    -0x4a5e(%ebx),%eax
+  101aee:	50                   	push   %eax
+  101aef:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101af5:	50                   	push   %eax
+  101af6:	68 fa 00 00 00       	push   $0xfa
+  101afb:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101b01:	50                   	push   %eax
+  101b02:	e8 cb f2 ff ff       	call   100dd2 <debug_panic>
+	pp2 = mem_alloc(); assert(pp2 != 0);
+  101b07:	e8 2b fc ff ff       	call   101737 <mem_alloc>
+  101b0c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  101b0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  101b13:	75 1f                	jne    101b34 <mem_check+0x15f>
+  101b15:	8d 83 ab b5 ff ff    	lea    -0x4a55(%ebx),%eax
+  101b1b:	50                   	push   %eax
+  101b1c:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101b22:	50                   	push   %eax
+  101b23:	68 fb 00 00 00       	push   $0xfb
+  101b28:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101b2e:	50                   	push   %eax
+  101b2f:	e8 9e f2 ff ff       	call   100dd2 <debug_panic>
+	assert(pp0);
+  101b34:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  101b38:	75 1f                	jne    101b59 <mem_check+0x184>
+  101b3a:	8d 83 b4 b5 ff ff    	lea    -0x4a4c(%ebx),%eax
+  101b40:	50                   	push   %eax
+  101b41:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101b47:	50                   	push   %eax
+  101b48:	68 fd 00 00 00       	push   $0xfd
+  101b4d:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101b53:	50                   	push   %eax
+  101b54:	e8 79 f2 ff ff       	call   100dd2 <debug_panic>
+	assert(pp1 && pp1 != pp0);
+  101b59:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  101b5d:	74 08                	je     101b67 <mem_check+0x192>
+  101b5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  101b62:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+  101b65:	75 1f                	jne    101b86 <mem_check+0x1b1>
+  101b67:	8d 83 b8 b5 ff ff    	lea    -0x4a48(%ebx),%eax
+  101b6d:	50                   	push   %eax
+  101b6e:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101b74:	50                   	push   %eax
+  101b75:	68 fe 00 00 00       	push   $0xfe
+  101b7a:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101b80:	50                   	push   %eax
+  101b81:	e8 4c f2 ff ff       	call   100dd2 <debug_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+  101b86:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  101b8a:	74 10                	je     101b9c <mem_check+0x1c7>
+  101b8c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101b8f:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+  101b92:	74 08                	je     101b9c <mem_check+0x1c7>
+  101b94:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101b97:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+  101b9a:	75 1f                	jne    101bbb <mem_check+0x1e6>
+  101b9c:	8d 83 cc b5 ff ff    	lea    -0x4a34(%ebx),%eax
+  101ba2:	50                   	push   %eax
+  101ba3:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101ba9:	50                   	push   %eax
+  101baa:	68 ff 00 00 00       	push   $0xff
+  101baf:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101bb5:	50                   	push   %eax
+  101bb6:	e8 17 f2 ff ff       	call   100dd2 <debug_panic>
+	assert(mem_pi2phys(pp0) < mem_npage*PAGESIZE);
+  101bbb:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  101bc1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  101bc4:	29 c2                	sub    %eax,%edx
+  101bc6:	89 d0                	mov    %edx,%eax
+  101bc8:	c1 e0 09             	shl    $0x9,%eax
+  101bcb:	89 c2                	mov    %eax,%edx
+  101bcd:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  101bd3:	c1 e0 0c             	shl    $0xc,%eax
+  101bd6:	39 c2                	cmp    %eax,%edx
+  101bd8:	72 1f                	jb     101bf9 <mem_check+0x224>
+  101bda:	8d 83 ec b5 ff ff    	lea    -0x4a14(%ebx),%eax
+  101be0:	50                   	push   %eax
+  101be1:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101be7:	50                   	push   %eax
+  101be8:	68 00 01 00 00       	push   $0x100
+  101bed:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101bf3:	50                   	push   %eax
+  101bf4:	e8 d9 f1 ff ff       	call   100dd2 <debug_panic>
+	assert(mem_pi2phys(pp1) < mem_npage*PAGESIZE);
+  101bf9:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  101bff:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  101c02:	29 c2                	sub    %eax,%edx
+  101c04:	89 d0                	mov    %edx,%eax
+  101c06:	c1 e0 09             	shl    $0x9,%eax
+  101c09:	89 c2                	mov    %eax,%edx
+  101c0b:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  101c11:	c1 e0 0c             	shl    $0xc,%eax
+  101c14:	39 c2                	cmp    %eax,%edx
+  101c16:	72 1f                	jb     101c37 <mem_check+0x262>
+  101c18:	8d 83 14 b6 ff ff    	lea    -0x49ec(%ebx),%eax
+  101c1e:	50                   	push   %eax
+  101c1f:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101c25:	50                   	push   %eax
+  101c26:	68 01 01 00 00       	push   $0x101
+  101c2b:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101c31:	50                   	push   %eax
+  101c32:	e8 9b f1 ff ff       	call   100dd2 <debug_panic>
+	assert(mem_pi2phys(pp2) < mem_npage*PAGESIZE);
+  101c37:	8b 83 60 54 01 00    	mov    0x15460(%ebx),%eax
+  101c3d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  101c40:	29 c2                	sub    %eax,%edx
+  101c42:	89 d0                	mov    %edx,%eax
+  101c44:	c1 e0 09             	shl    $0x9,%eax
+  101c47:	89 c2                	mov    %eax,%edx
+  101c49:	8b 83 5c 54 01 00    	mov    0x1545c(%ebx),%eax
+  101c4f:	c1 e0 0c             	shl    $0xc,%eax
+  101c52:	39 c2                	cmp    %eax,%edx
+  101c54:	72 1f                	jb     101c75 <mem_check+0x2a0>
+  101c56:	8d 83 3c b6 ff ff    	lea    -0x49c4(%ebx),%eax
+  101c5c:	50                   	push   %eax
+  101c5d:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101c63:	50                   	push   %eax
+  101c64:	68 02 01 00 00       	push   $0x102
+  101c69:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101c6f:	50                   	push   %eax
+  101c70:	e8 5d f1 ff ff       	call   100dd2 <debug_panic>
+	fl = mem_freelist;
+  101c75:	8b 83 64 54 01 00    	mov    0x15464(%ebx),%eax
+  101c7b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	mem_freelist = 0;
+  101c7e:	c7 83 64 54 01 00 00 	movl   $0x0,0x15464(%ebx)
+  101c85:	00 00 00 
+	assert(mem_alloc() == 0);
+  101c88:	e8 aa fa ff ff       	call   101737 <mem_alloc>
+  101c8d:	85 c0                	test   %eax,%eax
+  101c8f:	74 1f                	je     101cb0 <mem_check+0x2db>
+  101c91:	8d 83 62 b6 ff ff    	lea    -0x499e(%ebx),%eax
+  101c97:	50                   	push   %eax
+  101c98:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101c9e:	50                   	push   %eax
+  101c9f:	68 09 01 00 00       	push   $0x109
+  101ca4:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101caa:	50                   	push   %eax
+  101cab:	e8 22 f1 ff ff       	call   100dd2 <debug_panic>
+        mem_free(pp0);
+  101cb0:	83 ec 0c             	sub    $0xc,%esp
+  101cb3:	ff 75 e4             	push   -0x1c(%ebp)
+  101cb6:	e8 b6 fa ff ff       	call   101771 <mem_free>
+  101cbb:	83 c4 10             	add    $0x10,%esp
+        mem_free(pp1);
+  101cbe:	83 ec 0c             	sub    $0xc,%esp
+  101cc1:	ff 75 e8             	push   -0x18(%ebp)
+  101cc4:	e8 a8 fa ff ff       	call   101771 <mem_free>
+  101cc9:	83 c4 10             	add    $0x10,%esp
+        mem_free(pp2);
+  101ccc:	83 ec 0c             	sub    $0xc,%esp
+  101ccf:	ff 75 ec             	push   -0x14(%ebp)
+  101cd2:	e8 9a fa ff ff       	call   101771 <mem_free>
+  101cd7:	83 c4 10             	add    $0x10,%esp
+	pp0 = pp1 = pp2 = 0;
+  101cda:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  101ce1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101ce4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  101ce7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  101cea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pp0 = mem_alloc(); assert(pp0 != 0);
+  101ced:	e8 45 fa ff ff       	call   101737 <mem_alloc>
+  101cf2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  101cf5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  101cf9:	75 1f                	jne    101d1a <mem_check+0x345>
+  101cfb:	8d 83 99 b5 ff ff    	lea    -0x4a67(%ebx),%eax
+  101d01:	50                   	push   %eax
+  101d02:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101d08:	50                   	push   %eax
+  101d09:	68 10 01 00 00       	push   $0x110
+  101d0e:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101d14:	50                   	push   %eax
+  101d15:	e8 b8 f0 ff ff       	call   100dd2 <debug_panic>
+	pp1 = mem_alloc(); assert(pp1 != 0);
+  101d1a:	e8 18 fa ff ff       	call   101737 <mem_alloc>
+  101d1f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  101d22:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  101d26:	75 1f                	jne    101d47 <mem_check+0x372>
+  101d28:	8d 83 a2 b5 ff ff    	lea    -0x4a5e(%ebx),%eax
+  101d2e:	50                   	push   %eax
+  101d2f:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101d35:	50                   	push   %eax
+  101d36:	68 11 01 00 00       	push   $0x111
+  101d3b:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101d41:	50                   	push   %eax
+  101d42:	e8 8b f0 ff ff       	call   100dd2 <debug_panic>
+	pp2 = mem_alloc(); assert(pp2 != 0);
+  101d47:	e8 eb f9 ff ff       	call   101737 <mem_alloc>
+  101d4c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  101d4f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  101d53:	75 1f                	jne    101d74 <mem_check+0x39f>
+  101d55:	8d 83 ab b5 ff ff    	lea    -0x4a55(%ebx),%eax
+  101d5b:	50                   	push   %eax
+  101d5c:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101d62:	50                   	push   %eax
+  101d63:	68 12 01 00 00       	push   $0x112
+  101d68:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101d6e:	50                   	push   %eax
+  101d6f:	e8 5e f0 ff ff       	call   100dd2 <debug_panic>
+	assert(pp0);
+  101d74:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  101d78:	75 1f                	jne    101d99 <mem_check+0x3c4>
+  101d7a:	8d 83 b4 b5 ff ff    	lea    -0x4a4c(%ebx),%eax
+  101d80:	50                   	push   %eax
+  101d81:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101d87:	50                   	push   %eax
+  101d88:	68 13 01 00 00       	push   $0x113
+  101d8d:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101d93:	50                   	push   %eax
+  101d94:	e8 39 f0 ff ff       	call   100dd2 <debug_panic>
+	assert(pp1 && pp1 != pp0);
+  101d99:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  101d9d:	74 08                	je     101da7 <mem_check+0x3d2>
+  101d9f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  101da2:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+  101da5:	75 1f                	jne    101dc6 <mem_check+0x3f1>
+  101da7:	8d 83 b8 b5 ff ff    	lea    -0x4a48(%ebx),%eax
+  101dad:	50                   	push   %eax
+  101dae:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101db4:	50                   	push   %eax
+  101db5:	68 14 01 00 00       	push   $0x114
+  101dba:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101dc0:	50                   	push   %eax
+  101dc1:	e8 0c f0 ff ff       	call   100dd2 <debug_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+  101dc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  101dca:	74 10                	je     101ddc <mem_check+0x407>
+  101dcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101dcf:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+  101dd2:	74 08                	je     101ddc <mem_check+0x407>
+  101dd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  101dd7:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+  101dda:	75 1f                	jne    101dfb <mem_check+0x426>
+  101ddc:	8d 83 cc b5 ff ff    	lea    -0x4a34(%ebx),%eax
+  101de2:	50                   	push   %eax
+  101de3:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101de9:	50                   	push   %eax
+  101dea:	68 15 01 00 00       	push   $0x115
+  101def:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101df5:	50                   	push   %eax
+  101df6:	e8 d7 ef ff ff       	call   100dd2 <debug_panic>
+	assert(mem_alloc() == 0);
+  101dfb:	e8 37 f9 ff ff       	call   101737 <mem_alloc>
+  101e00:	85 c0                	test   %eax,%eax
+  101e02:	74 1f                	je     101e23 <mem_check+0x44e>
+  101e04:	8d 83 62 b6 ff ff    	lea    -0x499e(%ebx),%eax
+  101e0a:	50                   	push   %eax
+  101e0b:	8d 83 6a b3 ff ff    	lea    -0x4c96(%ebx),%eax
+  101e11:	50                   	push   %eax
+  101e12:	68 16 01 00 00       	push   $0x116
+  101e17:	8d 83 eb b4 ff ff    	lea    -0x4b15(%ebx),%eax
+  101e1d:	50                   	push   %eax
+  101e1e:	e8 af ef ff ff       	call   100dd2 <debug_panic>
+	mem_freelist = fl;
+  101e23:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  101e26:	89 83 64 54 01 00    	mov    %eax,0x15464(%ebx)
+	mem_free(pp0);
+  101e2c:	83 ec 0c             	sub    $0xc,%esp
+  101e2f:	ff 75 e4             	push   -0x1c(%ebp)
+  101e32:	e8 3a f9 ff ff       	call   101771 <mem_free>
+  101e37:	83 c4 10             	add    $0x10,%esp
+	mem_free(pp1);
+  101e3a:	83 ec 0c             	sub    $0xc,%esp
+  101e3d:	ff 75 e8             	push   -0x18(%ebp)
+  101e40:	e8 2c f9 ff ff       	call   101771 <mem_free>
+  101e45:	83 c4 10             	add    $0x10,%esp
+	mem_free(pp2);
+  101e48:	83 ec 0c             	sub    $0xc,%esp
+  101e4b:	ff 75 ec             	push   -0x14(%ebp)
+  101e4e:	e8 1e f9 ff ff       	call   101771 <mem_free>
+  101e53:	83 c4 10             	add    $0x10,%esp
+	cprintf("mem_check() succeeded!\n");
+  101e56:	83 ec 0c             	sub    $0xc,%esp
+  101e59:	8d 83 73 b6 ff ff    	lea    -0x498d(%ebx),%eax
+  101e5f:	50                   	push   %eax
+  101e60:	e8 b0 5d 00 00       	call   107c15 <cprintf>
+  101e65:	83 c4 10             	add    $0x10,%esp
+}
+  101e68:	90                   	nop
+  101e69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  101e6c:	c9                   	leave
+  101e6d:	c3                   	ret
+
+00101e6e <cpu_cur>:
+cpu_alloc(void)
+{
+	// Pointer to the cpu.next pointer of the last CPU on the list,
+	// for chaining on new CPUs in cpu_alloc().  Note: static.
+	static cpu **cpu_tail = &cpu_boot.next;
+	static uint8_t cpu_nextnum = 1;
+  101e6e:	55                   	push   %ebp
+  101e6f:	89 e5                	mov    %esp,%ebp
+  101e71:	53                   	push   %ebx
+  101e72:	83 ec 14             	sub    $0x14,%esp
+  101e75:	e8 96 e5 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  101e7a:	05 7a c1 00 00       	add    $0xc17a,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  101e7f:	89 e2                	mov    %esp,%edx
+  101e81:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  101e84:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  101e87:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  101e8a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  101e8d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  101e93:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  101e96:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  101e99:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  101e9f:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  101ea5:	74 1e                	je     101ec5 <cpu_cur+0x57>
+  101ea7:	8d 90 8c b6 ff ff    	lea    -0x4974(%eax),%edx
+  101ead:	52                   	push   %edx
+  101eae:	8d 90 a2 b6 ff ff    	lea    -0x495e(%eax),%edx
+  101eb4:	52                   	push   %edx
+  101eb5:	6a 65                	push   $0x65
+  101eb7:	8d 90 b7 b6 ff ff    	lea    -0x4949(%eax),%edx
+  101ebd:	52                   	push   %edx
+  101ebe:	89 c3                	mov    %eax,%ebx
+  101ec0:	e8 0d ef ff ff       	call   100dd2 <debug_panic>
+	return c;
+  101ec5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  101ec8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  101ecb:	c9                   	leave
+  101ecc:	c3                   	ret
+
+00101ecd <cpu_onboot>:
+cpu_onboot() {
+  101ecd:	55                   	push   %ebp
+  101ece:	89 e5                	mov    %esp,%ebp
+  101ed0:	53                   	push   %ebx
+  101ed1:	83 ec 04             	sub    $0x4,%esp
+  101ed4:	e8 3b e5 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  101ed9:	81 c3 1b c1 00 00    	add    $0xc11b,%ebx
+	return cpu_cur() == &cpu_boot;
+  101edf:	e8 8a ff ff ff       	call   101e6e <cpu_cur>
+  101ee4:	89 c2                	mov    %eax,%edx
+  101ee6:	8d 83 0c 10 00 00    	lea    0x100c(%ebx),%eax
+  101eec:	39 c2                	cmp    %eax,%edx
+  101eee:	0f 94 c0             	sete   %al
+  101ef1:	0f b6 c0             	movzbl %al,%eax
+}
+  101ef4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  101ef7:	c9                   	leave
+  101ef8:	c3                   	ret
+
+00101ef9 <cpu_init>:
+{
+  101ef9:	55                   	push   %ebp
+  101efa:	89 e5                	mov    %esp,%ebp
+  101efc:	53                   	push   %ebx
+  101efd:	83 ec 14             	sub    $0x14,%esp
+  101f00:	e8 0b e5 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  101f05:	05 ef c0 00 00       	add    $0xc0ef,%eax
+	cpu *c = cpu_cur();
+  101f0a:	e8 5f ff ff ff       	call   101e6e <cpu_cur>
+  101f0f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	(c->tss).ts_esp0=(uintptr_t)&c->kstackhi;
+  101f12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f15:	05 00 10 00 00       	add    $0x1000,%eax
+  101f1a:	89 c2                	mov    %eax,%edx
+  101f1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f1f:	89 50 34             	mov    %edx,0x34(%eax)
+	(c->tss).ts_ss0=CPU_GDT_KDATA;
+  101f22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f25:	66 c7 40 38 10 00    	movw   $0x10,0x38(%eax)
+	c->gdt[CPU_GDT_TSS >> 3]=SEGDESC16(STS_T32A, (uint32_t)&(c->tss),
+  101f2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f2e:	83 c0 30             	add    $0x30,%eax
+  101f31:	89 c3                	mov    %eax,%ebx
+  101f33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f36:	83 c0 30             	add    $0x30,%eax
+  101f39:	c1 e8 10             	shr    $0x10,%eax
+  101f3c:	89 c2                	mov    %eax,%edx
+  101f3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f41:	83 c0 30             	add    $0x30,%eax
+  101f44:	c1 e8 18             	shr    $0x18,%eax
+  101f47:	89 c1                	mov    %eax,%ecx
+  101f49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f4c:	66 c7 40 28 68 00    	movw   $0x68,0x28(%eax)
+  101f52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f55:	66 89 58 2a          	mov    %bx,0x2a(%eax)
+  101f59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f5c:	88 50 2c             	mov    %dl,0x2c(%eax)
+  101f5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f62:	0f b6 50 2d          	movzbl 0x2d(%eax),%edx
+  101f66:	83 e2 f0             	and    $0xfffffff0,%edx
+  101f69:	83 ca 09             	or     $0x9,%edx
+  101f6c:	88 50 2d             	mov    %dl,0x2d(%eax)
+  101f6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f72:	0f b6 50 2d          	movzbl 0x2d(%eax),%edx
+  101f76:	83 ca 10             	or     $0x10,%edx
+  101f79:	88 50 2d             	mov    %dl,0x2d(%eax)
+  101f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f7f:	0f b6 50 2d          	movzbl 0x2d(%eax),%edx
+  101f83:	83 e2 9f             	and    $0xffffff9f,%edx
+  101f86:	88 50 2d             	mov    %dl,0x2d(%eax)
+  101f89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f8c:	0f b6 50 2d          	movzbl 0x2d(%eax),%edx
+  101f90:	83 ca 80             	or     $0xffffff80,%edx
+  101f93:	88 50 2d             	mov    %dl,0x2d(%eax)
+  101f96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101f99:	0f b6 50 2e          	movzbl 0x2e(%eax),%edx
+  101f9d:	83 e2 f0             	and    $0xfffffff0,%edx
+  101fa0:	88 50 2e             	mov    %dl,0x2e(%eax)
+  101fa3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101fa6:	0f b6 50 2e          	movzbl 0x2e(%eax),%edx
+  101faa:	83 e2 ef             	and    $0xffffffef,%edx
+  101fad:	88 50 2e             	mov    %dl,0x2e(%eax)
+  101fb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101fb3:	0f b6 50 2e          	movzbl 0x2e(%eax),%edx
+  101fb7:	83 e2 df             	and    $0xffffffdf,%edx
+  101fba:	88 50 2e             	mov    %dl,0x2e(%eax)
+  101fbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101fc0:	0f b6 50 2e          	movzbl 0x2e(%eax),%edx
+  101fc4:	83 ca 40             	or     $0x40,%edx
+  101fc7:	88 50 2e             	mov    %dl,0x2e(%eax)
+  101fca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101fcd:	0f b6 50 2e          	movzbl 0x2e(%eax),%edx
+  101fd1:	83 e2 7f             	and    $0x7f,%edx
+  101fd4:	88 50 2e             	mov    %dl,0x2e(%eax)
+  101fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101fda:	88 48 2f             	mov    %cl,0x2f(%eax)
+	c->gdt[CPU_GDT_TSS >> 3].sd_s=0;
+  101fdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101fe0:	0f b6 50 2d          	movzbl 0x2d(%eax),%edx
+  101fe4:	83 e2 ef             	and    $0xffffffef,%edx
+  101fe7:	88 50 2d             	mov    %dl,0x2d(%eax)
+	struct pseudodesc gdt_pd = {
+  101fea:	66 c7 45 ec 2f 00    	movw   $0x2f,-0x14(%ebp)
+		sizeof(c->gdt) - 1, (uint32_t) c->gdt };
+  101ff0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+	struct pseudodesc gdt_pd = {
+  101ff3:	89 45 ee             	mov    %eax,-0x12(%ebp)
+	asm volatile("lgdt %0" : : "m" (gdt_pd));
+  101ff6:	0f 01 55 ec          	lgdtl  -0x14(%ebp)
+	asm volatile("movw %%ax,%%gs" :: "r" (CPU_GDT_UDATA|3));
+  101ffa:	b8 23 00 00 00       	mov    $0x23,%eax
+  101fff:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" :: "r" (CPU_GDT_UDATA|3));
+  102001:	b8 23 00 00 00       	mov    $0x23,%eax
+  102006:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" :: "r" (CPU_GDT_KDATA));
+  102008:	b8 10 00 00 00       	mov    $0x10,%eax
+  10200d:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" :: "r" (CPU_GDT_KDATA));
+  10200f:	b8 10 00 00 00       	mov    $0x10,%eax
+  102014:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" :: "r" (CPU_GDT_KDATA));
+  102016:	b8 10 00 00 00       	mov    $0x10,%eax
+  10201b:	8e d0                	mov    %eax,%ss
+	asm volatile("ljmp %0,$1f\n 1:\n" :: "i" (CPU_GDT_KCODE)); // reload CS
+  10201d:	ea 24 20 10 00 08 00 	ljmp   $0x8,$0x102024
+	asm volatile("lldt %%ax" :: "a" (0));
+  102024:	b8 00 00 00 00       	mov    $0x0,%eax
+  102029:	0f 00 d0             	lldt   %ax
+  10202c:	66 c7 45 f2 28 00    	movw   $0x28,-0xe(%ebp)
+	__asm __volatile("ltr %0" : : "r" (sel));
+  102032:	0f b7 45 f2          	movzwl -0xe(%ebp),%eax
+  102036:	0f 00 d8             	ltr    %ax
+}
+  102039:	90                   	nop
+}
+  10203a:	90                   	nop
+  10203b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10203e:	c9                   	leave
+  10203f:	c3                   	ret
+
+00102040 <cpu_alloc>:
+{
+  102040:	55                   	push   %ebp
+  102041:	89 e5                	mov    %esp,%ebp
+  102043:	53                   	push   %ebx
+  102044:	83 ec 14             	sub    $0x14,%esp
+  102047:	e8 c8 e3 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10204c:	81 c3 a8 bf 00 00    	add    $0xbfa8,%ebx
+
+	pageinfo *pi = mem_alloc();
+  102052:	e8 e0 f6 ff ff       	call   101737 <mem_alloc>
+  102057:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	assert(pi != 0);	// shouldn't be out of memory just yet!
+  10205a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  10205e:	75 1c                	jne    10207c <cpu_alloc+0x3c>
+  102060:	8d 83 c4 b6 ff ff    	lea    -0x493c(%ebx),%eax
+  102066:	50                   	push   %eax
+  102067:	8d 83 a2 b6 ff ff    	lea    -0x495e(%ebx),%eax
+  10206d:	50                   	push   %eax
+  10206e:	6a 64                	push   $0x64
+  102070:	8d 83 cc b6 ff ff    	lea    -0x4934(%ebx),%eax
+  102076:	50                   	push   %eax
+  102077:	e8 56 ed ff ff       	call   100dd2 <debug_panic>
+
+	cpu *c = (cpu*) mem_pi2ptr(pi);
+  10207c:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  102082:	8b 00                	mov    (%eax),%eax
+  102084:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  102087:	29 c2                	sub    %eax,%edx
+  102089:	89 d0                	mov    %edx,%eax
+  10208b:	c1 e0 09             	shl    $0x9,%eax
+  10208e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+	// Clear the whole page for good measure: cpu struct and kernel stack
+	memset(c, 0, PAGESIZE);
+  102091:	83 ec 04             	sub    $0x4,%esp
+  102094:	68 00 10 00 00       	push   $0x1000
+  102099:	6a 00                	push   $0x0
+  10209b:	ff 75 f0             	push   -0x10(%ebp)
+  10209e:	e8 0b 5e 00 00       	call   107eae <memset>
+  1020a3:	83 c4 10             	add    $0x10,%esp
+
+	// Now we need to initialize the new cpu struct
+	// just to the extent that's required for cpu_init() to work.
+	// The GDT can be the same as the boot CPU's, and cpu_init()
+	// fills in its own TSS descriptor.
+	memmove(c->gdt, cpu_boot.gdt, sizeof(c->gdt));
+  1020a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1020a9:	83 ec 04             	sub    $0x4,%esp
+  1020ac:	6a 30                	push   $0x30
+  1020ae:	8d 93 0c 10 00 00    	lea    0x100c(%ebx),%edx
+  1020b4:	52                   	push   %edx
+  1020b5:	50                   	push   %eax
+  1020b6:	e8 6d 5e 00 00       	call   107f28 <memmove>
+  1020bb:	83 c4 10             	add    $0x10,%esp
+	c->magic = CPU_MAGIC;
+  1020be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1020c1:	c7 80 b0 00 00 00 32 	movl   $0x98765432,0xb0(%eax)
+  1020c8:	54 76 98 
+	c->num = cpu_nextnum++;
+  1020cb:	0f b6 83 0c 20 00 00 	movzbl 0x200c(%ebx),%eax
+  1020d2:	8d 50 01             	lea    0x1(%eax),%edx
+  1020d5:	88 93 0c 20 00 00    	mov    %dl,0x200c(%ebx)
+  1020db:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1020de:	88 82 a0 00 00 00    	mov    %al,0xa0(%edx)
+
+	// Chain the new CPU onto the tail of the list.
+	*cpu_tail = c;
+  1020e4:	8b 83 10 20 00 00    	mov    0x2010(%ebx),%eax
+  1020ea:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1020ed:	89 10                	mov    %edx,(%eax)
+	cpu_tail = &c->next;
+  1020ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1020f2:	05 a8 00 00 00       	add    $0xa8,%eax
+  1020f7:	89 83 10 20 00 00    	mov    %eax,0x2010(%ebx)
+
+	return c;
+  1020fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  102100:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102103:	c9                   	leave
+  102104:	c3                   	ret
+
+00102105 <cpu_bootothers>:
+// of them has finished its own per-CPU setup.
+// Everything the APs share (IDT, memory allocator, console) must be
+// set up before this, since they start using it without asking.
+void
+cpu_bootothers(void)
+{
+  102105:	55                   	push   %ebp
+  102106:	89 e5                	mov    %esp,%ebp
+  102108:	53                   	push   %ebx
+  102109:	83 ec 24             	sub    $0x24,%esp
+  10210c:	e8 03 e3 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102111:	81 c3 e3 be 00 00    	add    $0xbee3,%ebx
+			_binary_obj_boot_bootother_size[];
+	static uint32_t stacks[MAX_CPUS];
+	cpu *c;
+	int i, n;
+
+	assert(cpu_onboot());
+  102117:	e8 b1 fd ff ff       	call   101ecd <cpu_onboot>
+  10211c:	85 c0                	test   %eax,%eax
+  10211e:	75 1f                	jne    10213f <cpu_bootothers+0x3a>
+  102120:	8d 83 d7 b6 ff ff    	lea    -0x4929(%ebx),%eax
+  102126:	50                   	push   %eax
+  102127:	8d 83 a2 b6 ff ff    	lea    -0x495e(%ebx),%eax
+  10212d:	50                   	push   %eax
+  10212e:	68 87 00 00 00       	push   $0x87
+  102133:	8d 83 cc b6 ff ff    	lea    -0x4934(%ebx),%eax
+  102139:	50                   	push   %eax
+  10213a:	e8 93 ec ff ff       	call   100dd2 <debug_panic>
+	cpu_boot.booted = 1;
+  10213f:	c7 83 b0 10 00 00 01 	movl   $0x1,0x10b0(%ebx)
+  102146:	00 00 00 
+	mp_init();
+  102149:	e8 89 13 00 00       	call   1034d7 <mp_init>
+	cpu_boot.id = lapic_id();	// now that mp_init() has found the LAPIC
+  10214e:	e8 e1 51 00 00       	call   107334 <lapic_id>
+  102153:	88 83 ad 10 00 00    	mov    %al,0x10ad(%ebx)
+	if (!ismp || ncpu == 1)
+  102159:	c7 c0 c0 64 12 00    	mov    $0x1264c0,%eax
+  10215f:	8b 00                	mov    (%eax),%eax
+  102161:	85 c0                	test   %eax,%eax
+  102163:	0f 84 84 01 00 00    	je     1022ed <cpu_bootothers+0x1e8>
+  102169:	c7 c0 a0 00 11 00    	mov    $0x1100a0,%eax
+  10216f:	8b 00                	mov    (%eax),%eax
+  102171:	83 f8 01             	cmp    $0x1,%eax
+  102174:	0f 84 73 01 00 00    	je     1022ed <cpu_bootothers+0x1e8>
+		return;
+
+	// Write bootstrap code to unused memory at 0x1000,
+	// with the parameters bootother.S expects just below it.
+	uint8_t *code = (uint8_t*)mem_ptr(0x1000);
+  10217a:	c7 45 e8 00 10 00 00 	movl   $0x1000,-0x18(%ebp)
+	memmove(code, _binary_obj_boot_bootother_start,
+  102181:	c7 c0 76 00 00 00    	mov    $0x76,%eax
+  102187:	83 ec 04             	sub    $0x4,%esp
+  10218a:	50                   	push   %eax
+  10218b:	c7 c0 52 06 11 00    	mov    $0x110652,%eax
+  102191:	50                   	push   %eax
+  102192:	ff 75 e8             	push   -0x18(%ebp)
+  102195:	e8 8e 5d 00 00       	call   107f28 <memmove>
+  10219a:	83 c4 10             	add    $0x10,%esp
+		(uint32_t) _binary_obj_boot_bootother_size);
+
+	for (n = 0; n < ncpu - 1; n++)
+  10219d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  1021a4:	eb 1a                	jmp    1021c0 <cpu_bootothers+0xbb>
+		stacks[n] = (uint32_t) cpu_alloc()->kstackhi;
+  1021a6:	e8 95 fe ff ff       	call   102040 <cpu_alloc>
+  1021ab:	05 00 10 00 00       	add    $0x1000,%eax
+  1021b0:	89 c2                	mov    %eax,%edx
+  1021b2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1021b5:	89 94 83 6c 54 01 00 	mov    %edx,0x1546c(%ebx,%eax,4)
+	for (n = 0; n < ncpu - 1; n++)
+  1021bc:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  1021c0:	c7 c0 a0 00 11 00    	mov    $0x1100a0,%eax
+  1021c6:	8b 00                	mov    (%eax),%eax
+  1021c8:	83 e8 01             	sub    $0x1,%eax
+  1021cb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+  1021ce:	7c d6                	jl     1021a6 <cpu_bootothers+0xa1>
+	((uint32_t*)code)[-1] = (uint32_t) init;
+  1021d0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  1021d3:	83 e8 04             	sub    $0x4,%eax
+  1021d6:	c7 c2 45 01 10 00    	mov    $0x100145,%edx
+  1021dc:	89 10                	mov    %edx,(%eax)
+	((uint32_t*)code)[-2] = (uint32_t) stacks;
+  1021de:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  1021e1:	8d 50 f8             	lea    -0x8(%eax),%edx
+  1021e4:	8d 83 6c 54 01 00    	lea    0x1546c(%ebx),%eax
+  1021ea:	89 02                	mov    %eax,(%edx)
+	((uint32_t*)code)[-3] = 0;
+  1021ec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  1021ef:	83 e8 0c             	sub    $0xc,%eax
+  1021f2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	((uint32_t*)code)[-4] = n;
+  1021f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  1021fb:	8d 50 f0             	lea    -0x10(%eax),%edx
+  1021fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  102201:	89 02                	mov    %eax,(%edx)
+
+	// One broadcast INIT/STARTUP sequence wakes every AP,
+	// instead of a full round trip per CPU.
+	lapic_startaps(0x1000);
+  102203:	83 ec 0c             	sub    $0xc,%esp
+  102206:	68 00 10 00 00       	push   $0x1000
+  10220b:	e8 52 51 00 00       	call   107362 <lapic_startaps>
+  102210:	83 c4 10             	add    $0x10,%esp
+
+	// Wait for them all, but give up on any that never show:
+	// the MP table may list processors that don't respond.
+	for (i = 0; i < 1000000; i++) {	// about one second
+  102213:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  10221a:	eb 45                	jmp    102261 <cpu_bootothers+0x15c>
+		for (c = cpu_boot.next; c != NULL && c->booted; c = c->next)
+  10221c:	8b 83 b4 10 00 00    	mov    0x10b4(%ebx),%eax
+  102222:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  102225:	eb 0c                	jmp    102233 <cpu_bootothers+0x12e>
+  102227:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10222a:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  102230:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  102233:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  102237:	74 0d                	je     102246 <cpu_bootothers+0x141>
+  102239:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10223c:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  102242:	85 c0                	test   %eax,%eax
+  102244:	75 e1                	jne    102227 <cpu_bootothers+0x122>
+			;
+		if (c == NULL)
+  102246:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  10224a:	74 20                	je     10226c <cpu_bootothers+0x167>
+  10224c:	c7 45 e4 84 00 00 00 	movl   $0x84,-0x1c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  102253:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102256:	89 c2                	mov    %eax,%edx
+  102258:	ec                   	in     (%dx),%al
+  102259:	88 45 e3             	mov    %al,-0x1d(%ebp)
+	return data;
+  10225c:	90                   	nop
+	for (i = 0; i < 1000000; i++) {	// about one second
+  10225d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  102261:	81 7d f0 3f 42 0f 00 	cmpl   $0xf423f,-0x10(%ebp)
+  102268:	7e b2                	jle    10221c <cpu_bootothers+0x117>
+  10226a:	eb 01                	jmp    10226d <cpu_bootothers+0x168>
+			break;
+  10226c:	90                   	nop
+		inb(0x84);
+	}
+
+	n = 0;
+  10226d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+	for (c = &cpu_boot; c != NULL; c = c->next)
+  102274:	8d 83 0c 10 00 00    	lea    0x100c(%ebx),%eax
+  10227a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  10227d:	eb 48                	jmp    1022c7 <cpu_bootothers+0x1c2>
+		if (c->booted)
+  10227f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102282:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  102288:	85 c0                	test   %eax,%eax
+  10228a:	74 06                	je     102292 <cpu_bootothers+0x18d>
+			n++;
+  10228c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  102290:	eb 29                	jmp    1022bb <cpu_bootothers+0x1b6>
+		else
+			warn("cpu_bootothers: CPU %d did not start\n", c->num);
+  102292:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102295:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  10229c:	0f b6 c0             	movzbl %al,%eax
+  10229f:	50                   	push   %eax
+  1022a0:	8d 83 e4 b6 ff ff    	lea    -0x491c(%ebx),%eax
+  1022a6:	50                   	push   %eax
+  1022a7:	68 ae 00 00 00       	push   $0xae
+  1022ac:	8d 83 cc b6 ff ff    	lea    -0x4934(%ebx),%eax
+  1022b2:	50                   	push   %eax
+  1022b3:	e8 18 ec ff ff       	call   100ed0 <debug_warn>
+  1022b8:	83 c4 10             	add    $0x10,%esp
+	for (c = &cpu_boot; c != NULL; c = c->next)
+  1022bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1022be:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  1022c4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1022c7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  1022cb:	75 b2                	jne    10227f <cpu_bootothers+0x17a>
+	cprintf("%d of %d CPUs running\n", n, ncpu);
+  1022cd:	c7 c0 a0 00 11 00    	mov    $0x1100a0,%eax
+  1022d3:	8b 00                	mov    (%eax),%eax
+  1022d5:	83 ec 04             	sub    $0x4,%esp
+  1022d8:	50                   	push   %eax
+  1022d9:	ff 75 ec             	push   -0x14(%ebp)
+  1022dc:	8d 83 0a b7 ff ff    	lea    -0x48f6(%ebx),%eax
+  1022e2:	50                   	push   %eax
+  1022e3:	e8 2d 59 00 00       	call   107c15 <cprintf>
+  1022e8:	83 c4 10             	add    $0x10,%esp
+  1022eb:	eb 01                	jmp    1022ee <cpu_bootothers+0x1e9>
+		return;
+  1022ed:	90                   	nop
+}
+  1022ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1022f1:	c9                   	leave
+  1022f2:	c3                   	ret
+
+001022f3 <cpu_cur>:
+		"Segment Not Present",
+		"Stack Fault",
+		"General Protection",
+		"Page Fault",
+		"(unknown trap)",
+		"x87 FPU Floating-Point Error",
+  1022f3:	55                   	push   %ebp
+  1022f4:	89 e5                	mov    %esp,%ebp
+  1022f6:	53                   	push   %ebx
+  1022f7:	83 ec 14             	sub    $0x14,%esp
+  1022fa:	e8 11 e1 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1022ff:	05 f5 bc 00 00       	add    $0xbcf5,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  102304:	89 e2                	mov    %esp,%edx
+  102306:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  102309:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  10230c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  10230f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  102312:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  102318:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  10231b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  10231e:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  102324:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  10232a:	74 1e                	je     10234a <cpu_cur+0x57>
+  10232c:	8d 90 24 b7 ff ff    	lea    -0x48dc(%eax),%edx
+  102332:	52                   	push   %edx
+  102333:	8d 90 3a b7 ff ff    	lea    -0x48c6(%eax),%edx
+  102339:	52                   	push   %edx
+  10233a:	6a 65                	push   $0x65
+  10233c:	8d 90 4f b7 ff ff    	lea    -0x48b1(%eax),%edx
+  102342:	52                   	push   %edx
+  102343:	89 c3                	mov    %eax,%ebx
+  102345:	e8 88 ea ff ff       	call   100dd2 <debug_panic>
+	return c;
+  10234a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  10234d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102350:	c9                   	leave
+  102351:	c3                   	ret
+
+00102352 <cpu_onboot>:
+cpu_onboot() {
+  102352:	55                   	push   %ebp
+  102353:	89 e5                	mov    %esp,%ebp
+  102355:	53                   	push   %ebx
+  102356:	83 ec 04             	sub    $0x4,%esp
+  102359:	e8 b6 e0 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10235e:	81 c3 96 bc 00 00    	add    $0xbc96,%ebx
+	return cpu_cur() == &cpu_boot;
+  102364:	e8 8a ff ff ff       	call   1022f3 <cpu_cur>
+  102369:	c7 c2 00 f0 10 00    	mov    $0x10f000,%edx
+  10236f:	39 d0                	cmp    %edx,%eax
+  102371:	0f 94 c0             	sete   %al
+  102374:	0f b6 c0             	movzbl %al,%eax
+}
+  102377:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10237a:	c9                   	leave
+  10237b:	c3                   	ret
+
+0010237c <trap_init_idt>:
+{
+  10237c:	55                   	push   %ebp
+  10237d:	89 e5                	mov    %esp,%ebp
+  10237f:	83 ec 10             	sub    $0x10,%esp
+  102382:	e8 89 e0 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  102387:	05 6d bc 00 00       	add    $0xbc6d,%eax
+	for (i=0;i<20;i=i+1) {
+  10238c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  102393:	e9 c7 00 00 00       	jmp    10245f <trap_init_idt+0xe3>
+		SETGATE(idt[i], 0, 1<<3, vectors[i], 0); //that 1<<3 corresponds to SEG_KCODE<<3 from xv6.
+  102398:	c7 c2 0e 00 11 00    	mov    $0x11000e,%edx
+  10239e:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+  1023a1:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+  1023a4:	89 d1                	mov    %edx,%ecx
+  1023a6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1023a9:	66 89 8c d0 cc 7c 01 	mov    %cx,0x17ccc(%eax,%edx,8)
+  1023b0:	00 
+  1023b1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1023b4:	66 c7 84 d0 ce 7c 01 	movw   $0x8,0x17cce(%eax,%edx,8)
+  1023bb:	00 08 00 
+  1023be:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1023c1:	0f b6 8c d0 d0 7c 01 	movzbl 0x17cd0(%eax,%edx,8),%ecx
+  1023c8:	00 
+  1023c9:	83 e1 e0             	and    $0xffffffe0,%ecx
+  1023cc:	88 8c d0 d0 7c 01 00 	mov    %cl,0x17cd0(%eax,%edx,8)
+  1023d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1023d6:	0f b6 8c d0 d0 7c 01 	movzbl 0x17cd0(%eax,%edx,8),%ecx
+  1023dd:	00 
+  1023de:	83 e1 1f             	and    $0x1f,%ecx
+  1023e1:	88 8c d0 d0 7c 01 00 	mov    %cl,0x17cd0(%eax,%edx,8)
+  1023e8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1023eb:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  1023f2:	00 
+  1023f3:	83 e1 f0             	and    $0xfffffff0,%ecx
+  1023f6:	83 c9 0e             	or     $0xe,%ecx
+  1023f9:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  102400:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  102403:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  10240a:	00 
+  10240b:	83 e1 ef             	and    $0xffffffef,%ecx
+  10240e:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  102415:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  102418:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  10241f:	00 
+  102420:	83 e1 9f             	and    $0xffffff9f,%ecx
+  102423:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  10242a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  10242d:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  102434:	00 
+  102435:	83 c9 80             	or     $0xffffff80,%ecx
+  102438:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  10243f:	c7 c2 0e 00 11 00    	mov    $0x11000e,%edx
+  102445:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+  102448:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+  10244b:	c1 ea 10             	shr    $0x10,%edx
+  10244e:	89 d1                	mov    %edx,%ecx
+  102450:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  102453:	66 89 8c d0 d2 7c 01 	mov    %cx,0x17cd2(%eax,%edx,8)
+  10245a:	00 
+	for (i=0;i<20;i=i+1) {
+  10245b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  10245f:	83 7d fc 13          	cmpl   $0x13,-0x4(%ebp)
+  102463:	0f 8e 2f ff ff ff    	jle    102398 <trap_init_idt+0x1c>
+	SETGATE(idt[3], 0, 1<<3, vectors[3], 3); //This is T_BRKPT, that 1<<3 corresponds to SEG_KCODE<<3 from xv6.
+  102469:	c7 c2 0e 00 11 00    	mov    $0x11000e,%edx
+  10246f:	8b 52 0c             	mov    0xc(%edx),%edx
+  102472:	66 89 90 e4 7c 01 00 	mov    %dx,0x17ce4(%eax)
+  102479:	66 c7 80 e6 7c 01 00 	movw   $0x8,0x17ce6(%eax)
+  102480:	08 00 
+  102482:	0f b6 90 e8 7c 01 00 	movzbl 0x17ce8(%eax),%edx
+  102489:	83 e2 e0             	and    $0xffffffe0,%edx
+  10248c:	88 90 e8 7c 01 00    	mov    %dl,0x17ce8(%eax)
+  102492:	0f b6 90 e8 7c 01 00 	movzbl 0x17ce8(%eax),%edx
+  102499:	83 e2 1f             	and    $0x1f,%edx
+  10249c:	88 90 e8 7c 01 00    	mov    %dl,0x17ce8(%eax)
+  1024a2:	0f b6 90 e9 7c 01 00 	movzbl 0x17ce9(%eax),%edx
+  1024a9:	83 e2 f0             	and    $0xfffffff0,%edx
+  1024ac:	83 ca 0e             	or     $0xe,%edx
+  1024af:	88 90 e9 7c 01 00    	mov    %dl,0x17ce9(%eax)
+  1024b5:	0f b6 90 e9 7c 01 00 	movzbl 0x17ce9(%eax),%edx
+  1024bc:	83 e2 ef             	and    $0xffffffef,%edx
+  1024bf:	88 90 e9 7c 01 00    	mov    %dl,0x17ce9(%eax)
+  1024c5:	0f b6 90 e9 7c 01 00 	movzbl 0x17ce9(%eax),%edx
+  1024cc:	83 ca 60             	or     $0x60,%edx
+  1024cf:	88 90 e9 7c 01 00    	mov    %dl,0x17ce9(%eax)
+  1024d5:	0f b6 90 e9 7c 01 00 	movzbl 0x17ce9(%eax),%edx
+  1024dc:	83 ca 80             	or     $0xffffff80,%edx
+  1024df:	88 90 e9 7c 01 00    	mov    %dl,0x17ce9(%eax)
+  1024e5:	c7 c2 0e 00 11 00    	mov    $0x11000e,%edx
+  1024eb:	8b 52 0c             	mov    0xc(%edx),%edx
+  1024ee:	c1 ea 10             	shr    $0x10,%edx
+  1024f1:	66 89 90 ea 7c 01 00 	mov    %dx,0x17cea(%eax)
+	SETGATE(idt[4], 0, 1<<3, vectors[4], 3); //This is T_OFLOW, that 1<<3 corresponds to SEG_KCODE<<3 from xv6.
+  1024f8:	c7 c2 0e 00 11 00    	mov    $0x11000e,%edx
+  1024fe:	8b 52 10             	mov    0x10(%edx),%edx
+  102501:	66 89 90 ec 7c 01 00 	mov    %dx,0x17cec(%eax)
+  102508:	66 c7 80 ee 7c 01 00 	movw   $0x8,0x17cee(%eax)
+  10250f:	08 00 
+  102511:	0f b6 90 f0 7c 01 00 	movzbl 0x17cf0(%eax),%edx
+  102518:	83 e2 e0             	and    $0xffffffe0,%edx
+  10251b:	88 90 f0 7c 01 00    	mov    %dl,0x17cf0(%eax)
+  102521:	0f b6 90 f0 7c 01 00 	movzbl 0x17cf0(%eax),%edx
+  102528:	83 e2 1f             	and    $0x1f,%edx
+  10252b:	88 90 f0 7c 01 00    	mov    %dl,0x17cf0(%eax)
+  102531:	0f b6 90 f1 7c 01 00 	movzbl 0x17cf1(%eax),%edx
+  102538:	83 e2 f0             	and    $0xfffffff0,%edx
+  10253b:	83 ca 0e             	or     $0xe,%edx
+  10253e:	88 90 f1 7c 01 00    	mov    %dl,0x17cf1(%eax)
+  102544:	0f b6 90 f1 7c 01 00 	movzbl 0x17cf1(%eax),%edx
+  10254b:	83 e2 ef             	and    $0xffffffef,%edx
+  10254e:	88 90 f1 7c 01 00    	mov    %dl,0x17cf1(%eax)
+  102554:	0f b6 90 f1 7c 01 00 	movzbl 0x17cf1(%eax),%edx
+  10255b:	83 ca 60             	or     $0x60,%edx
+  10255e:	88 90 f1 7c 01 00    	mov    %dl,0x17cf1(%eax)
+  102564:	0f b6 90 f1 7c 01 00 	movzbl 0x17cf1(%eax),%edx
+  10256b:	83 ca 80             	or     $0xffffff80,%edx
+  10256e:	88 90 f1 7c 01 00    	mov    %dl,0x17cf1(%eax)
+  102574:	c7 c2 0e 00 11 00    	mov    $0x11000e,%edx
+  10257a:	8b 52 10             	mov    0x10(%edx),%edx
+  10257d:	c1 ea 10             	shr    $0x10,%edx
+  102580:	66 89 90 f2 7c 01 00 	mov    %dx,0x17cf2(%eax)
+	for (i = 0; i < MAX_IRQS; i++)
+  102587:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  10258e:	e9 e0 00 00 00       	jmp    102673 <trap_init_idt+0x2f7>
+		SETGATE(idt[T_IRQ0 + i], 0, CPU_GDT_KCODE, irqvectors[i], 0);
+  102593:	c7 c2 5e 00 11 00    	mov    $0x11005e,%edx
+  102599:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+  10259c:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+  10259f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1025a2:	83 c2 20             	add    $0x20,%edx
+  1025a5:	66 89 8c d0 cc 7c 01 	mov    %cx,0x17ccc(%eax,%edx,8)
+  1025ac:	00 
+  1025ad:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1025b0:	83 c2 20             	add    $0x20,%edx
+  1025b3:	66 c7 84 d0 ce 7c 01 	movw   $0x8,0x17cce(%eax,%edx,8)
+  1025ba:	00 08 00 
+  1025bd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1025c0:	83 c2 20             	add    $0x20,%edx
+  1025c3:	0f b6 8c d0 d0 7c 01 	movzbl 0x17cd0(%eax,%edx,8),%ecx
+  1025ca:	00 
+  1025cb:	83 e1 e0             	and    $0xffffffe0,%ecx
+  1025ce:	88 8c d0 d0 7c 01 00 	mov    %cl,0x17cd0(%eax,%edx,8)
+  1025d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1025d8:	83 c2 20             	add    $0x20,%edx
+  1025db:	0f b6 8c d0 d0 7c 01 	movzbl 0x17cd0(%eax,%edx,8),%ecx
+  1025e2:	00 
+  1025e3:	83 e1 1f             	and    $0x1f,%ecx
+  1025e6:	88 8c d0 d0 7c 01 00 	mov    %cl,0x17cd0(%eax,%edx,8)
+  1025ed:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1025f0:	83 c2 20             	add    $0x20,%edx
+  1025f3:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  1025fa:	00 
+  1025fb:	83 e1 f0             	and    $0xfffffff0,%ecx
+  1025fe:	83 c9 0e             	or     $0xe,%ecx
+  102601:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  102608:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  10260b:	83 c2 20             	add    $0x20,%edx
+  10260e:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  102615:	00 
+  102616:	83 e1 ef             	and    $0xffffffef,%ecx
+  102619:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  102620:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  102623:	83 c2 20             	add    $0x20,%edx
+  102626:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  10262d:	00 
+  10262e:	83 e1 9f             	and    $0xffffff9f,%ecx
+  102631:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  102638:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  10263b:	83 c2 20             	add    $0x20,%edx
+  10263e:	0f b6 8c d0 d1 7c 01 	movzbl 0x17cd1(%eax,%edx,8),%ecx
+  102645:	00 
+  102646:	83 c9 80             	or     $0xffffff80,%ecx
+  102649:	88 8c d0 d1 7c 01 00 	mov    %cl,0x17cd1(%eax,%edx,8)
+  102650:	c7 c2 5e 00 11 00    	mov    $0x11005e,%edx
+  102656:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+  102659:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+  10265c:	89 d1                	mov    %edx,%ecx
+  10265e:	c1 e9 10             	shr    $0x10,%ecx
+  102661:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  102664:	83 c2 20             	add    $0x20,%edx
+  102667:	66 89 8c d0 d2 7c 01 	mov    %cx,0x17cd2(%eax,%edx,8)
+  10266e:	00 
+	for (i = 0; i < MAX_IRQS; i++)
+  10266f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  102673:	83 7d fc 0f          	cmpl   $0xf,-0x4(%ebp)
+  102677:	0f 8e 16 ff ff ff    	jle    102593 <trap_init_idt+0x217>
+	SETGATE(idt[T_SYSCALL], 0, CPU_GDT_KCODE, sysentry, 3);
+  10267d:	c7 c2 40 32 10 00    	mov    $0x103240,%edx
+  102683:	66 89 90 4c 7e 01 00 	mov    %dx,0x17e4c(%eax)
+  10268a:	66 c7 80 4e 7e 01 00 	movw   $0x8,0x17e4e(%eax)
+  102691:	08 00 
+  102693:	0f b6 90 50 7e 01 00 	movzbl 0x17e50(%eax),%edx
+  10269a:	83 e2 e0             	and    $0xffffffe0,%edx
+  10269d:	88 90 50 7e 01 00    	mov    %dl,0x17e50(%eax)
+  1026a3:	0f b6 90 50 7e 01 00 	movzbl 0x17e50(%eax),%edx
+  1026aa:	83 e2 1f             	and    $0x1f,%edx
+  1026ad:	88 90 50 7e 01 00    	mov    %dl,0x17e50(%eax)
+  1026b3:	0f b6 90 51 7e 01 00 	movzbl 0x17e51(%eax),%edx
+  1026ba:	83 e2 f0             	and    $0xfffffff0,%edx
+  1026bd:	83 ca 0e             	or     $0xe,%edx
+  1026c0:	88 90 51 7e 01 00    	mov    %dl,0x17e51(%eax)
+  1026c6:	0f b6 90 51 7e 01 00 	movzbl 0x17e51(%eax),%edx
+  1026cd:	83 e2 ef             	and    $0xffffffef,%edx
+  1026d0:	88 90 51 7e 01 00    	mov    %dl,0x17e51(%eax)
+  1026d6:	0f b6 90 51 7e 01 00 	movzbl 0x17e51(%eax),%edx
+  1026dd:	83 ca 60             	or     $0x60,%edx
+  1026e0:	88 90 51 7e 01 00    	mov    %dl,0x17e51(%eax)
+  1026e6:	0f b6 90 51 7e 01 00 	movzbl 0x17e51(%eax),%edx
+  1026ed:	83 ca 80             	or     $0xffffff80,%edx
+  1026f0:	88 90 51 7e 01 00    	mov    %dl,0x17e51(%eax)
+  1026f6:	c7 c2 40 32 10 00    	mov    $0x103240,%edx
+  1026fc:	c1 ea 10             	shr    $0x10,%edx
+  1026ff:	66 89 90 52 7e 01 00 	mov    %dx,0x17e52(%eax)
+}
+  102706:	90                   	nop
+  102707:	c9                   	leave
+  102708:	c3                   	ret
+
+00102709 <trap_init>:
+{
+  102709:	55                   	push   %ebp
+  10270a:	89 e5                	mov    %esp,%ebp
+  10270c:	53                   	push   %ebx
+  10270d:	83 ec 04             	sub    $0x4,%esp
+  102710:	e8 ff dc ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102715:	81 c3 df b8 00 00    	add    $0xb8df,%ebx
+	if (cpu_onboot()) {
+  10271b:	e8 32 fc ff ff       	call   102352 <cpu_onboot>
+  102720:	85 c0                	test   %eax,%eax
+  102722:	74 05                	je     102729 <trap_init+0x20>
+		trap_init_idt();
+  102724:	e8 53 fc ff ff       	call   10237c <trap_init_idt>
+	asm volatile("lidt %0" : : "m" (idt_pd));
+  102729:	0f 01 9b 14 20 00 00 	lidtl  0x2014(%ebx)
+}
+  102730:	90                   	nop
+  102731:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102734:	c9                   	leave
+  102735:	c3                   	ret
+
+00102736 <trap_name>:
+{
+  102736:	55                   	push   %ebp
+  102737:	89 e5                	mov    %esp,%ebp
+  102739:	e8 d2 dc ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10273e:	05 b6 b8 00 00       	add    $0xb8b6,%eax
+		"Alignment Check",
+		"Machine-Check",
+		"SIMD Floating-Point Exception"
+	};
+
+	if (trapno < sizeof(excnames)/sizeof(excnames[0]))
+  102743:	8b 55 08             	mov    0x8(%ebp),%edx
+  102746:	83 fa 13             	cmp    $0x13,%edx
+  102749:	77 0c                	ja     102757 <trap_name+0x21>
+		return excnames[trapno];
+  10274b:	8b 55 08             	mov    0x8(%ebp),%edx
+  10274e:	8b 84 90 ac ff ff ff 	mov    -0x54(%eax,%edx,4),%eax
+  102755:	eb 28                	jmp    10277f <trap_name+0x49>
+	if (trapno == T_SYSCALL)
+  102757:	83 7d 08 30          	cmpl   $0x30,0x8(%ebp)
+  10275b:	75 08                	jne    102765 <trap_name+0x2f>
+		return "System call";
+  10275d:	8d 80 5c b7 ff ff    	lea    -0x48a4(%eax),%eax
+  102763:	eb 1a                	jmp    10277f <trap_name+0x49>
+	if (trapno >= T_IRQ0 && trapno < T_IRQ0 + MAX_IRQS)
+  102765:	83 7d 08 1f          	cmpl   $0x1f,0x8(%ebp)
+  102769:	7e 0e                	jle    102779 <trap_name+0x43>
+  10276b:	83 7d 08 2f          	cmpl   $0x2f,0x8(%ebp)
+  10276f:	7f 08                	jg     102779 <trap_name+0x43>
+		return "Hardware Interrupt";
+  102771:	8d 80 68 b7 ff ff    	lea    -0x4898(%eax),%eax
+  102777:	eb 06                	jmp    10277f <trap_name+0x49>
+	return "(unknown trap)";
+  102779:	8d 80 7b b7 ff ff    	lea    -0x4885(%eax),%eax
+}
+  10277f:	5d                   	pop    %ebp
+  102780:	c3                   	ret
+
+00102781 <trap_print_regs>:
+
+void
+trap_print_regs(pushregs *regs)
+{
+  102781:	55                   	push   %ebp
+  102782:	89 e5                	mov    %esp,%ebp
+  102784:	53                   	push   %ebx
+  102785:	83 ec 04             	sub    $0x4,%esp
+  102788:	e8 87 dc ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10278d:	81 c3 67 b8 00 00    	add    $0xb867,%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+  102793:	8b 45 08             	mov    0x8(%ebp),%eax
+  102796:	8b 00                	mov    (%eax),%eax
+  102798:	83 ec 08             	sub    $0x8,%esp
+  10279b:	50                   	push   %eax
+  10279c:	8d 83 8a b7 ff ff    	lea    -0x4876(%ebx),%eax
+  1027a2:	50                   	push   %eax
+  1027a3:	e8 6d 54 00 00       	call   107c15 <cprintf>
+  1027a8:	83 c4 10             	add    $0x10,%esp
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+  1027ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  1027ae:	8b 40 04             	mov    0x4(%eax),%eax
+  1027b1:	83 ec 08             	sub    $0x8,%esp
+  1027b4:	50                   	push   %eax
+  1027b5:	8d 83 99 b7 ff ff    	lea    -0x4867(%ebx),%eax
+  1027bb:	50                   	push   %eax
+  1027bc:	e8 54 54 00 00       	call   107c15 <cprintf>
+  1027c1:	83 c4 10             	add    $0x10,%esp
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+  1027c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  1027c7:	8b 40 08             	mov    0x8(%eax),%eax
+  1027ca:	83 ec 08             	sub    $0x8,%esp
+  1027cd:	50                   	push   %eax
+  1027ce:	8d 83 a8 b7 ff ff    	lea    -0x4858(%ebx),%eax
+  1027d4:	50                   	push   %eax
+  1027d5:	e8 3b 54 00 00       	call   107c15 <cprintf>
+  1027da:	83 c4 10             	add    $0x10,%esp
+//	cprintf("  oesp 0x%08x\n", regs->reg_oesp);	don't print - useless
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+  1027dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  1027e0:	8b 40 10             	mov    0x10(%eax),%eax
+  1027e3:	83 ec 08             	sub    $0x8,%esp
+  1027e6:	50                   	push   %eax
+  1027e7:	8d 83 b7 b7 ff ff    	lea    -0x4849(%ebx),%eax
+  1027ed:	50                   	push   %eax
+  1027ee:	e8 22 54 00 00       	call   107c15 <cprintf>
+  1027f3:	83 c4 10             	add    $0x10,%esp
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+  1027f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  1027f9:	8b 40 14             	mov    0x14(%eax),%eax
+  1027fc:	83 ec 08             	sub    $0x8,%esp
+  1027ff:	50                   	push   %eax
+  102800:	8d 83 c6 b7 ff ff    	lea    -0x483a(%ebx),%eax
+  102806:	50                   	push   %eax
+  102807:	e8 09 54 00 00       	call   107c15 <cprintf>
+  10280c:	83 c4 10             	add    $0x10,%esp
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+  10280f:	8b 45 08             	mov    0x8(%ebp),%eax
+  102812:	8b 40 18             	mov    0x18(%eax),%eax
+  102815:	83 ec 08             	sub    $0x8,%esp
+  102818:	50                   	push   %eax
+  102819:	8d 83 d5 b7 ff ff    	lea    -0x482b(%ebx),%eax
+  10281f:	50                   	push   %eax
+  102820:	e8 f0 53 00 00       	call   107c15 <cprintf>
+  102825:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+  102828:	8b 45 08             	mov    0x8(%ebp),%eax
+  10282b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  10282e:	83 ec 08             	sub    $0x8,%esp
+  102831:	50                   	push   %eax
+  102832:	8d 83 e4 b7 ff ff    	lea    -0x481c(%ebx),%eax
+  102838:	50                   	push   %eax
+  102839:	e8 d7 53 00 00       	call   107c15 <cprintf>
+  10283e:	83 c4 10             	add    $0x10,%esp
+}
+  102841:	90                   	nop
+  102842:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102845:	c9                   	leave
+  102846:	c3                   	ret
+
+00102847 <trap_print>:
+
+void
+trap_print(trapframe *tf)
+{
+  102847:	55                   	push   %ebp
+  102848:	89 e5                	mov    %esp,%ebp
+  10284a:	53                   	push   %ebx
+  10284b:	83 ec 04             	sub    $0x4,%esp
+  10284e:	e8 c1 db ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102853:	81 c3 a1 b7 00 00    	add    $0xb7a1,%ebx
+	cprintf("TRAP frame at %p\n", tf);
+  102859:	83 ec 08             	sub    $0x8,%esp
+  10285c:	ff 75 08             	push   0x8(%ebp)
+  10285f:	8d 83 f3 b7 ff ff    	lea    -0x480d(%ebx),%eax
+  102865:	50                   	push   %eax
+  102866:	e8 aa 53 00 00       	call   107c15 <cprintf>
+  10286b:	83 c4 10             	add    $0x10,%esp
+	trap_print_regs(&tf->tf_regs);
+  10286e:	8b 45 08             	mov    0x8(%ebp),%eax
+  102871:	83 ec 0c             	sub    $0xc,%esp
+  102874:	50                   	push   %eax
+  102875:	e8 07 ff ff ff       	call   102781 <trap_print_regs>
+  10287a:	83 c4 10             	add    $0x10,%esp
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+  10287d:	8b 45 08             	mov    0x8(%ebp),%eax
+  102880:	0f b7 40 20          	movzwl 0x20(%eax),%eax
+  102884:	0f b7 c0             	movzwl %ax,%eax
+  102887:	83 ec 08             	sub    $0x8,%esp
+  10288a:	50                   	push   %eax
+  10288b:	8d 83 05 b8 ff ff    	lea    -0x47fb(%ebx),%eax
+  102891:	50                   	push   %eax
+  102892:	e8 7e 53 00 00       	call   107c15 <cprintf>
+  102897:	83 c4 10             	add    $0x10,%esp
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+  10289a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10289d:	0f b7 40 24          	movzwl 0x24(%eax),%eax
+  1028a1:	0f b7 c0             	movzwl %ax,%eax
+  1028a4:	83 ec 08             	sub    $0x8,%esp
+  1028a7:	50                   	push   %eax
+  1028a8:	8d 83 18 b8 ff ff    	lea    -0x47e8(%ebx),%eax
+  1028ae:	50                   	push   %eax
+  1028af:	e8 61 53 00 00       	call   107c15 <cprintf>
+  1028b4:	83 c4 10             	add    $0x10,%esp
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trap_name(tf->tf_trapno));
+  1028b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1028ba:	8b 40 28             	mov    0x28(%eax),%eax
+  1028bd:	83 ec 0c             	sub    $0xc,%esp
+  1028c0:	50                   	push   %eax
+  1028c1:	e8 70 fe ff ff       	call   102736 <trap_name>
+  1028c6:	83 c4 10             	add    $0x10,%esp
+  1028c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  1028cc:	8b 52 28             	mov    0x28(%edx),%edx
+  1028cf:	83 ec 04             	sub    $0x4,%esp
+  1028d2:	50                   	push   %eax
+  1028d3:	52                   	push   %edx
+  1028d4:	8d 83 2b b8 ff ff    	lea    -0x47d5(%ebx),%eax
+  1028da:	50                   	push   %eax
+  1028db:	e8 35 53 00 00       	call   107c15 <cprintf>
+  1028e0:	83 c4 10             	add    $0x10,%esp
+	cprintf("  err  0x%08x\n", tf->tf_err);
+  1028e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  1028e6:	8b 40 2c             	mov    0x2c(%eax),%eax
+  1028e9:	83 ec 08             	sub    $0x8,%esp
+  1028ec:	50                   	push   %eax
+  1028ed:	8d 83 3d b8 ff ff    	lea    -0x47c3(%ebx),%eax
+  1028f3:	50                   	push   %eax
+  1028f4:	e8 1c 53 00 00       	call   107c15 <cprintf>
+  1028f9:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+  1028fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  1028ff:	8b 40 30             	mov    0x30(%eax),%eax
+  102902:	83 ec 08             	sub    $0x8,%esp
+  102905:	50                   	push   %eax
+  102906:	8d 83 4c b8 ff ff    	lea    -0x47b4(%ebx),%eax
+  10290c:	50                   	push   %eax
+  10290d:	e8 03 53 00 00       	call   107c15 <cprintf>
+  102912:	83 c4 10             	add    $0x10,%esp
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+  102915:	8b 45 08             	mov    0x8(%ebp),%eax
+  102918:	0f b7 40 34          	movzwl 0x34(%eax),%eax
+  10291c:	0f b7 c0             	movzwl %ax,%eax
+  10291f:	83 ec 08             	sub    $0x8,%esp
+  102922:	50                   	push   %eax
+  102923:	8d 83 5b b8 ff ff    	lea    -0x47a5(%ebx),%eax
+  102929:	50                   	push   %eax
+  10292a:	e8 e6 52 00 00       	call   107c15 <cprintf>
+  10292f:	83 c4 10             	add    $0x10,%esp
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+  102932:	8b 45 08             	mov    0x8(%ebp),%eax
+  102935:	8b 40 38             	mov    0x38(%eax),%eax
+  102938:	83 ec 08             	sub    $0x8,%esp
+  10293b:	50                   	push   %eax
+  10293c:	8d 83 6e b8 ff ff    	lea    -0x4792(%ebx),%eax
+  102942:	50                   	push   %eax
+  102943:	e8 cd 52 00 00       	call   107c15 <cprintf>
+  102948:	83 c4 10             	add    $0x10,%esp
+	cprintf("  esp  0x%08x\n", tf->tf_esp);
+  10294b:	8b 45 08             	mov    0x8(%ebp),%eax
+  10294e:	8b 40 3c             	mov    0x3c(%eax),%eax
+  102951:	83 ec 08             	sub    $0x8,%esp
+  102954:	50                   	push   %eax
+  102955:	8d 83 7d b8 ff ff    	lea    -0x4783(%ebx),%eax
+  10295b:	50                   	push   %eax
+  10295c:	e8 b4 52 00 00       	call   107c15 <cprintf>
+  102961:	83 c4 10             	add    $0x10,%esp
+	cprintf("  ss   0x----%04x\n", tf->tf_ss);
+  102964:	8b 45 08             	mov    0x8(%ebp),%eax
+  102967:	0f b7 40 40          	movzwl 0x40(%eax),%eax
+  10296b:	0f b7 c0             	movzwl %ax,%eax
+  10296e:	83 ec 08             	sub    $0x8,%esp
+  102971:	50                   	push   %eax
+  102972:	8d 83 8c b8 ff ff    	lea    -0x4774(%ebx),%eax
+  102978:	50                   	push   %eax
+  102979:	e8 97 52 00 00       	call   107c15 <cprintf>
+  10297e:	83 c4 10             	add    $0x10,%esp
+}
+  102981:	90                   	nop
+  102982:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102985:	c9                   	leave
+  102986:	c3                   	ret
+
+00102987 <trap>:
+
+void gcc_noreturn
+trap(trapframe *tf)
+{
+  102987:	55                   	push   %ebp
+  102988:	89 e5                	mov    %esp,%ebp
+  10298a:	56                   	push   %esi
+  10298b:	53                   	push   %ebx
+  10298c:	83 ec 10             	sub    $0x10,%esp
+  10298f:	e8 80 da ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102994:	81 c3 60 b6 00 00    	add    $0xb660,%ebx
+	// The user-level environment may have set the DF flag,
+	// and some versions of GCC rely on DF being clear.
+	asm volatile("cld" ::: "cc");
+  10299a:	fc                   	cld
+
+	// Count the trap and start charging cycles to its vector.
+	// A nested trap restarts the clock; the outer trap's
+	// remaining cycles then go uncounted, which is rare enough.
+	cpu *c = cpu_cur();
+  10299b:	e8 53 f9 ff ff       	call   1022f3 <cpu_cur>
+  1029a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	trapstats *ts = &trap_stats[c->num];
+  1029a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1029a6:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  1029ad:	0f b6 d0             	movzbl %al,%edx
+  1029b0:	89 d0                	mov    %edx,%eax
+  1029b2:	c1 e0 02             	shl    $0x2,%eax
+  1029b5:	01 d0                	add    %edx,%eax
+  1029b7:	c1 e0 07             	shl    $0x7,%eax
+  1029ba:	8d 93 cc 54 01 00    	lea    0x154cc(%ebx),%edx
+  1029c0:	01 d0                	add    %edx,%eax
+  1029c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	if (tf->tf_trapno < TRAP_NSTATS) {
+  1029c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1029c8:	8b 40 28             	mov    0x28(%eax),%eax
+  1029cb:	83 f8 30             	cmp    $0x30,%eax
+  1029ce:	77 41                	ja     102a11 <trap+0x8a>
+		ts->count[tf->tf_trapno]++;
+  1029d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  1029d3:	8b 40 28             	mov    0x28(%eax),%eax
+  1029d6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1029d9:	8b 14 82             	mov    (%edx,%eax,4),%edx
+  1029dc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  1029df:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1029e2:	89 0c 82             	mov    %ecx,(%edx,%eax,4)
+		ts->vec = tf->tf_trapno;
+  1029e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1029e8:	8b 50 28             	mov    0x28(%eax),%edx
+  1029eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1029ee:	89 90 54 02 00 00    	mov    %edx,0x254(%eax)
+        asm volatile("rdtsc" : "=A" (tsc));
+  1029f4:	0f 31                	rdtsc
+  1029f6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  1029f9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return tsc;
+  1029fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  1029ff:	8b 55 ec             	mov    -0x14(%ebp),%edx
+		ts->start = rdtsc();
+  102a02:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  102a05:	89 81 4c 02 00 00    	mov    %eax,0x24c(%ecx)
+  102a0b:	89 91 50 02 00 00    	mov    %edx,0x250(%ecx)
+	}
+	trace("trap %d (%s) at eip %x", tf->tf_trapno,
+  102a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a14:	8b 70 30             	mov    0x30(%eax),%esi
+  102a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a1a:	8b 40 28             	mov    0x28(%eax),%eax
+  102a1d:	83 ec 0c             	sub    $0xc,%esp
+  102a20:	50                   	push   %eax
+  102a21:	e8 10 fd ff ff       	call   102736 <trap_name>
+  102a26:	83 c4 10             	add    $0x10,%esp
+  102a29:	8b 55 08             	mov    0x8(%ebp),%edx
+  102a2c:	8b 52 28             	mov    0x28(%edx),%edx
+  102a2f:	83 ec 0c             	sub    $0xc,%esp
+  102a32:	6a 00                	push   $0x0
+  102a34:	6a 00                	push   $0x0
+  102a36:	6a 00                	push   $0x0
+  102a38:	6a 00                	push   $0x0
+  102a3a:	6a 00                	push   $0x0
+  102a3c:	56                   	push   %esi
+  102a3d:	50                   	push   %eax
+  102a3e:	52                   	push   %edx
+  102a3f:	8d 83 9f b8 ff ff    	lea    -0x4761(%ebx),%eax
+  102a45:	50                   	push   %eax
+  102a46:	e8 7e 10 00 00       	call   103ac9 <trace_log>
+  102a4b:	83 c4 30             	add    $0x30,%esp
+		trap_name(tf->tf_trapno), tf->tf_eip);
+
+	// Device interrupts are never the trap a recovery handler expects,
+	// so service them first.  The PIC runs in automatic-EOI mode.
+	if (tf->tf_trapno >= T_IRQ0 && tf->tf_trapno < T_IRQ0 + MAX_IRQS) {
+  102a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a51:	8b 40 28             	mov    0x28(%eax),%eax
+  102a54:	83 f8 1f             	cmp    $0x1f,%eax
+  102a57:	76 4f                	jbe    102aa8 <trap+0x121>
+  102a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a5c:	8b 40 28             	mov    0x28(%eax),%eax
+  102a5f:	83 f8 2f             	cmp    $0x2f,%eax
+  102a62:	77 44                	ja     102aa8 <trap+0x121>
+		if (tf->tf_trapno == T_IRQ0 + IRQ_KBD)
+  102a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a67:	8b 40 28             	mov    0x28(%eax),%eax
+  102a6a:	83 f8 21             	cmp    $0x21,%eax
+  102a6d:	75 07                	jne    102a76 <trap+0xef>
+			kbd_intr();
+  102a6f:	e8 d0 3d 00 00       	call   106844 <kbd_intr>
+  102a74:	eb 10                	jmp    102a86 <trap+0xff>
+		else if (tf->tf_trapno == T_IRQ0 + IRQ_SERIAL)
+  102a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a79:	8b 40 28             	mov    0x28(%eax),%eax
+  102a7c:	83 f8 24             	cmp    $0x24,%eax
+  102a7f:	75 05                	jne    102a86 <trap+0xff>
+			serial_intr();
+  102a81:	e8 29 41 00 00       	call   106baf <serial_intr>
+
+		// A device interrupt from user mode is also a chance to run
+		// requests a polling process has queued since we last looked.
+		if ((tf->tf_cs & 3) == 3)
+  102a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  102a89:	0f b7 40 34          	movzwl 0x34(%eax),%eax
+  102a8d:	0f b7 c0             	movzwl %ax,%eax
+  102a90:	83 e0 03             	and    $0x3,%eax
+  102a93:	83 f8 03             	cmp    $0x3,%eax
+  102a96:	75 05                	jne    102a9d <trap+0x116>
+			syscall_poll();
+  102a98:	e8 90 0f 00 00       	call   103a2d <syscall_poll>
+		trap_return(tf);	// ignore spurious and unexpected IRQs
+  102a9d:	83 ec 0c             	sub    $0xc,%esp
+  102aa0:	ff 75 08             	push   0x8(%ebp)
+  102aa3:	e8 f8 07 00 00       	call   1032a0 <trap_return>
+	}
+
+	// Copy-on-write faults are part of normal operation:
+	// pmap_pagefault() returns only if this isn't one.
+	if (tf->tf_trapno == T_PGFLT)
+  102aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  102aab:	8b 40 28             	mov    0x28(%eax),%eax
+  102aae:	83 f8 0e             	cmp    $0xe,%eax
+  102ab1:	75 0e                	jne    102ac1 <trap+0x13a>
+		pmap_pagefault(tf);
+  102ab3:	83 ec 0c             	sub    $0xc,%esp
+  102ab6:	ff 75 08             	push   0x8(%ebp)
+  102ab9:	e8 ca 29 00 00       	call   105488 <pmap_pagefault>
+  102abe:	83 c4 10             	add    $0x10,%esp
+
+	// If this trap was anticipated, just use the designated handler.
+	if (c->recover)
+  102ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102ac4:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  102aca:	85 c0                	test   %eax,%eax
+  102acc:	74 1b                	je     102ae9 <trap+0x162>
+		c->recover(tf, c->recoverdata);
+  102ace:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102ad1:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  102ad7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  102ada:	8b 92 9c 00 00 00    	mov    0x9c(%edx),%edx
+  102ae0:	83 ec 08             	sub    $0x8,%esp
+  102ae3:	52                   	push   %edx
+  102ae4:	ff 75 08             	push   0x8(%ebp)
+  102ae7:	ff d0                	call   *%eax
+
+	if (tf->tf_trapno == T_SYSCALL)
+  102ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  102aec:	8b 40 28             	mov    0x28(%eax),%eax
+  102aef:	83 f8 30             	cmp    $0x30,%eax
+  102af2:	75 0e                	jne    102b02 <trap+0x17b>
+		syscall(tf);	// returns only if it couldn't handle the call
+  102af4:	83 ec 0c             	sub    $0xc,%esp
+  102af7:	ff 75 08             	push   0x8(%ebp)
+  102afa:	e8 e0 0d 00 00       	call   1038df <syscall>
+  102aff:	83 c4 10             	add    $0x10,%esp
+
+	trap_print(tf);
+  102b02:	83 ec 0c             	sub    $0xc,%esp
+  102b05:	ff 75 08             	push   0x8(%ebp)
+  102b08:	e8 3a fd ff ff       	call   102847 <trap_print>
+  102b0d:	83 c4 10             	add    $0x10,%esp
+	panic("unhandled trap");
+  102b10:	83 ec 04             	sub    $0x4,%esp
+  102b13:	8d 83 b6 b8 ff ff    	lea    -0x474a(%ebx),%eax
+  102b19:	50                   	push   %eax
+  102b1a:	68 bd 00 00 00       	push   $0xbd
+  102b1f:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102b25:	50                   	push   %eax
+  102b26:	e8 a7 e2 ff ff       	call   100dd2 <debug_panic>
+
+00102b2b <trap_account>:
+
+// Charge the cycles spent since trap() was entered to the trap's vector.
+// Called by trap_return() on every way back out of the kernel.
+void
+trap_account(void)
+{
+  102b2b:	55                   	push   %ebp
+  102b2c:	89 e5                	mov    %esp,%ebp
+  102b2e:	57                   	push   %edi
+  102b2f:	56                   	push   %esi
+  102b30:	53                   	push   %ebx
+  102b31:	83 ec 1c             	sub    $0x1c,%esp
+  102b34:	e8 db d8 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102b39:	81 c3 bb b4 00 00    	add    $0xb4bb,%ebx
+	trapstats *ts = &trap_stats[cpu_cur()->num];
+  102b3f:	e8 af f7 ff ff       	call   1022f3 <cpu_cur>
+  102b44:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  102b4b:	0f b6 d0             	movzbl %al,%edx
+  102b4e:	89 d0                	mov    %edx,%eax
+  102b50:	c1 e0 02             	shl    $0x2,%eax
+  102b53:	01 d0                	add    %edx,%eax
+  102b55:	c1 e0 07             	shl    $0x7,%eax
+  102b58:	8d 93 cc 54 01 00    	lea    0x154cc(%ebx),%edx
+  102b5e:	01 d0                	add    %edx,%eax
+  102b60:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (ts->start == 0)
+  102b63:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102b66:	8b 90 50 02 00 00    	mov    0x250(%eax),%edx
+  102b6c:	8b 80 4c 02 00 00    	mov    0x24c(%eax),%eax
+  102b72:	09 d0                	or     %edx,%eax
+  102b74:	85 c0                	test   %eax,%eax
+  102b76:	74 71                	je     102be9 <trap_account+0xbe>
+        asm volatile("rdtsc" : "=A" (tsc));
+  102b78:	0f 31                	rdtsc
+  102b7a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  102b7d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+        return tsc;
+  102b80:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  102b83:	8b 55 dc             	mov    -0x24(%ebp),%edx
+		return;		// not returning from a counted trap
+	ts->cycles[ts->vec] += rdtsc() - ts->start;
+  102b86:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  102b89:	8b 99 50 02 00 00    	mov    0x250(%ecx),%ebx
+  102b8f:	8b 89 4c 02 00 00    	mov    0x24c(%ecx),%ecx
+  102b95:	29 c8                	sub    %ecx,%eax
+  102b97:	19 da                	sbb    %ebx,%edx
+  102b99:	89 c6                	mov    %eax,%esi
+  102b9b:	89 d7                	mov    %edx,%edi
+  102b9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102ba0:	8b 90 54 02 00 00    	mov    0x254(%eax),%edx
+  102ba6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102ba9:	83 c2 18             	add    $0x18,%edx
+  102bac:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+  102bb0:	8b 02                	mov    (%edx),%eax
+  102bb2:	8b 52 04             	mov    0x4(%edx),%edx
+  102bb5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  102bb8:	8b 99 54 02 00 00    	mov    0x254(%ecx),%ebx
+  102bbe:	01 f0                	add    %esi,%eax
+  102bc0:	11 fa                	adc    %edi,%edx
+  102bc2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  102bc5:	83 c3 18             	add    $0x18,%ebx
+  102bc8:	89 44 d9 04          	mov    %eax,0x4(%ecx,%ebx,8)
+  102bcc:	89 54 d9 08          	mov    %edx,0x8(%ecx,%ebx,8)
+	ts->start = 0;
+  102bd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102bd3:	c7 80 4c 02 00 00 00 	movl   $0x0,0x24c(%eax)
+  102bda:	00 00 00 
+  102bdd:	c7 80 50 02 00 00 00 	movl   $0x0,0x250(%eax)
+  102be4:	00 00 00 
+  102be7:	eb 01                	jmp    102bea <trap_account+0xbf>
+		return;		// not returning from a counted trap
+  102be9:	90                   	nop
+}
+  102bea:	83 c4 1c             	add    $0x1c,%esp
+  102bed:	5b                   	pop    %ebx
+  102bee:	5e                   	pop    %esi
+  102bef:	5f                   	pop    %edi
+  102bf0:	5d                   	pop    %ebp
+  102bf1:	c3                   	ret
+
+00102bf2 <trap_print_stats>:
+
+// Print the current CPU's per-vector trap statistics as a table.
+void
+trap_print_stats(void)
+{
+  102bf2:	55                   	push   %ebp
+  102bf3:	89 e5                	mov    %esp,%ebp
+  102bf5:	56                   	push   %esi
+  102bf6:	53                   	push   %ebx
+  102bf7:	83 ec 30             	sub    $0x30,%esp
+  102bfa:	e8 cf e1 ff ff       	call   100dce <__x86.get_pc_thunk.si>
+  102bff:	81 c6 f5 b3 00 00    	add    $0xb3f5,%esi
+	trapstats *ts = &trap_stats[cpu_cur()->num];
+  102c05:	e8 e9 f6 ff ff       	call   1022f3 <cpu_cur>
+  102c0a:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  102c11:	0f b6 d0             	movzbl %al,%edx
+  102c14:	89 d0                	mov    %edx,%eax
+  102c16:	c1 e0 02             	shl    $0x2,%eax
+  102c19:	01 d0                	add    %edx,%eax
+  102c1b:	c1 e0 07             	shl    $0x7,%eax
+  102c1e:	8d 96 cc 54 01 00    	lea    0x154cc(%esi),%edx
+  102c24:	01 d0                	add    %edx,%eax
+  102c26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint64_t totcycles = 0;
+  102c29:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  102c30:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+	uint32_t totcount = 0;
+  102c37:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+	int v;
+
+	cprintf("vec name                              count"
+  102c3e:	83 ec 0c             	sub    $0xc,%esp
+  102c41:	8d 86 d4 b8 ff ff    	lea    -0x472c(%esi),%eax
+  102c47:	50                   	push   %eax
+  102c48:	89 f3                	mov    %esi,%ebx
+  102c4a:	e8 c6 4f 00 00       	call   107c15 <cprintf>
+  102c4f:	83 c4 10             	add    $0x10,%esp
+		"           cycles      avg\n");
+	for (v = 0; v < TRAP_NSTATS; v++) {
+  102c52:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  102c59:	e9 c0 00 00 00       	jmp    102d1e <trap_print_stats+0x12c>
+		if (ts->count[v] == 0)
+  102c5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102c61:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  102c64:	8b 04 90             	mov    (%eax,%edx,4),%eax
+  102c67:	85 c0                	test   %eax,%eax
+  102c69:	0f 84 aa 00 00 00    	je     102d19 <trap_print_stats+0x127>
+			continue;
+		cprintf("%3d %-30s %10u %16llu %8llu\n", v, trap_name(v),
+			ts->count[v], ts->cycles[v],
+			ts->cycles[v] / ts->count[v]);
+  102c6f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102c72:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  102c75:	83 c2 18             	add    $0x18,%edx
+  102c78:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+  102c7c:	8b 02                	mov    (%edx),%eax
+  102c7e:	8b 52 04             	mov    0x4(%edx),%edx
+  102c81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  102c84:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  102c87:	8b 0c 99             	mov    (%ecx,%ebx,4),%ecx
+  102c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		cprintf("%3d %-30s %10u %16llu %8llu\n", v, trap_name(v),
+  102c8f:	53                   	push   %ebx
+  102c90:	51                   	push   %ecx
+  102c91:	52                   	push   %edx
+  102c92:	50                   	push   %eax
+  102c93:	89 f3                	mov    %esi,%ebx
+  102c95:	e8 66 56 00 00       	call   108300 <__udivdi3>
+  102c9a:	83 c4 10             	add    $0x10,%esp
+  102c9d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  102ca0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  102ca3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102ca6:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  102ca9:	83 c2 18             	add    $0x18,%edx
+  102cac:	8b 4c d0 04          	mov    0x4(%eax,%edx,8),%ecx
+  102cb0:	8b 5c d0 08          	mov    0x8(%eax,%edx,8),%ebx
+  102cb4:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  102cb7:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  102cba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102cbd:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  102cc0:	8b 1c 90             	mov    (%eax,%edx,4),%ebx
+  102cc3:	83 ec 0c             	sub    $0xc,%esp
+  102cc6:	ff 75 e8             	push   -0x18(%ebp)
+  102cc9:	e8 68 fa ff ff       	call   102736 <trap_name>
+  102cce:	83 c4 10             	add    $0x10,%esp
+  102cd1:	ff 75 d4             	push   -0x2c(%ebp)
+  102cd4:	ff 75 d0             	push   -0x30(%ebp)
+  102cd7:	ff 75 cc             	push   -0x34(%ebp)
+  102cda:	ff 75 c8             	push   -0x38(%ebp)
+  102cdd:	53                   	push   %ebx
+  102cde:	50                   	push   %eax
+  102cdf:	ff 75 e8             	push   -0x18(%ebp)
+  102ce2:	8d 86 1b b9 ff ff    	lea    -0x46e5(%esi),%eax
+  102ce8:	50                   	push   %eax
+  102ce9:	89 f3                	mov    %esi,%ebx
+  102ceb:	e8 25 4f 00 00       	call   107c15 <cprintf>
+  102cf0:	83 c4 20             	add    $0x20,%esp
+		totcount += ts->count[v];
+  102cf3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102cf6:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  102cf9:	8b 04 90             	mov    (%eax,%edx,4),%eax
+  102cfc:	01 45 ec             	add    %eax,-0x14(%ebp)
+		totcycles += ts->cycles[v];
+  102cff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102d02:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  102d05:	83 c2 18             	add    $0x18,%edx
+  102d08:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+  102d0c:	8b 02                	mov    (%edx),%eax
+  102d0e:	8b 52 04             	mov    0x4(%edx),%edx
+  102d11:	01 45 f0             	add    %eax,-0x10(%ebp)
+  102d14:	11 55 f4             	adc    %edx,-0xc(%ebp)
+  102d17:	eb 01                	jmp    102d1a <trap_print_stats+0x128>
+			continue;
+  102d19:	90                   	nop
+	for (v = 0; v < TRAP_NSTATS; v++) {
+  102d1a:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+  102d1e:	83 7d e8 30          	cmpl   $0x30,-0x18(%ebp)
+  102d22:	0f 8e 36 ff ff ff    	jle    102c5e <trap_print_stats+0x6c>
+	}
+	cprintf("    %-30s %10u %16llu\n", "total", totcount, totcycles);
+  102d28:	83 ec 0c             	sub    $0xc,%esp
+  102d2b:	ff 75 f4             	push   -0xc(%ebp)
+  102d2e:	ff 75 f0             	push   -0x10(%ebp)
+  102d31:	ff 75 ec             	push   -0x14(%ebp)
+  102d34:	8d 86 38 b9 ff ff    	lea    -0x46c8(%esi),%eax
+  102d3a:	50                   	push   %eax
+  102d3b:	8d 86 3e b9 ff ff    	lea    -0x46c2(%esi),%eax
+  102d41:	50                   	push   %eax
+  102d42:	89 f3                	mov    %esi,%ebx
+  102d44:	e8 cc 4e 00 00       	call   107c15 <cprintf>
+  102d49:	83 c4 20             	add    $0x20,%esp
+}
+  102d4c:	90                   	nop
+  102d4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  102d50:	5b                   	pop    %ebx
+  102d51:	5e                   	pop    %esi
+  102d52:	5d                   	pop    %ebp
+  102d53:	c3                   	ret
+
+00102d54 <trap_check_recover>:
+
+// Helper function for trap_check_recover(), below:
+// handles "anticipated" traps by simply resuming at a new EIP.
+static void gcc_noreturn
+trap_check_recover(trapframe *tf, void *recoverdata)
+{
+  102d54:	55                   	push   %ebp
+  102d55:	89 e5                	mov    %esp,%ebp
+  102d57:	53                   	push   %ebx
+  102d58:	83 ec 14             	sub    $0x14,%esp
+  102d5b:	e8 b0 d6 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  102d60:	05 94 b2 00 00       	add    $0xb294,%eax
+	trap_check_args *args = recoverdata;
+  102d65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  102d68:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	tf->tf_eip = (uint32_t) args->reip;	// Use recovery EIP on return
+  102d6b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  102d6e:	8b 12                	mov    (%edx),%edx
+  102d70:	89 d1                	mov    %edx,%ecx
+  102d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  102d75:	89 4a 30             	mov    %ecx,0x30(%edx)
+	args->trapno = tf->tf_trapno;		// Return trap number
+  102d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  102d7b:	8b 52 28             	mov    0x28(%edx),%edx
+  102d7e:	89 d1                	mov    %edx,%ecx
+  102d80:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  102d83:	89 4a 04             	mov    %ecx,0x4(%edx)
+	trap_return(tf);
+  102d86:	83 ec 0c             	sub    $0xc,%esp
+  102d89:	ff 75 08             	push   0x8(%ebp)
+  102d8c:	89 c3                	mov    %eax,%ebx
+  102d8e:	e8 0d 05 00 00       	call   1032a0 <trap_return>
+
+00102d93 <trap_check_kernel>:
+
+// Check for correct handling of traps from kernel mode.
+// Called on the boot CPU after trap_init() and trap_setup().
+void
+trap_check_kernel(void)
+{
+  102d93:	55                   	push   %ebp
+  102d94:	89 e5                	mov    %esp,%ebp
+  102d96:	53                   	push   %ebx
+  102d97:	83 ec 14             	sub    $0x14,%esp
+  102d9a:	e8 75 d6 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102d9f:	81 c3 55 b2 00 00    	add    $0xb255,%ebx
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  102da5:	66 8c c8             	mov    %cs,%ax
+  102da8:	66 89 45 f2          	mov    %ax,-0xe(%ebp)
+        return cs;
+  102dac:	0f b7 45 f2          	movzwl -0xe(%ebp),%eax
+	assert((read_cs() & 3) == 0);	// better be in kernel mode!
+  102db0:	0f b7 c0             	movzwl %ax,%eax
+  102db3:	83 e0 03             	and    $0x3,%eax
+  102db6:	85 c0                	test   %eax,%eax
+  102db8:	74 1f                	je     102dd9 <trap_check_kernel+0x46>
+  102dba:	8d 83 55 b9 ff ff    	lea    -0x46ab(%ebx),%eax
+  102dc0:	50                   	push   %eax
+  102dc1:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102dc7:	50                   	push   %eax
+  102dc8:	68 f4 00 00 00       	push   $0xf4
+  102dcd:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102dd3:	50                   	push   %eax
+  102dd4:	e8 f9 df ff ff       	call   100dd2 <debug_panic>
+
+	cpu *c = cpu_cur();
+  102dd9:	e8 15 f5 ff ff       	call   1022f3 <cpu_cur>
+  102dde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	c->recover = trap_check_recover;
+  102de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102de4:	8d 93 60 4d ff ff    	lea    -0xb2a0(%ebx),%edx
+  102dea:	89 90 98 00 00 00    	mov    %edx,0x98(%eax)
+	trap_check(&c->recoverdata);
+  102df0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102df3:	05 9c 00 00 00       	add    $0x9c,%eax
+  102df8:	83 ec 0c             	sub    $0xc,%esp
+  102dfb:	50                   	push   %eax
+  102dfc:	e8 c0 00 00 00       	call   102ec1 <trap_check>
+  102e01:	83 c4 10             	add    $0x10,%esp
+	c->recover = NULL;	// No more mr. nice-guy; traps are real again
+  102e04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102e07:	c7 80 98 00 00 00 00 	movl   $0x0,0x98(%eax)
+  102e0e:	00 00 00 
+
+	cprintf("trap_check_kernel() succeeded!\n");
+  102e11:	83 ec 0c             	sub    $0xc,%esp
+  102e14:	8d 83 6c b9 ff ff    	lea    -0x4694(%ebx),%eax
+  102e1a:	50                   	push   %eax
+  102e1b:	e8 f5 4d 00 00       	call   107c15 <cprintf>
+  102e20:	83 c4 10             	add    $0x10,%esp
+}
+  102e23:	90                   	nop
+  102e24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102e27:	c9                   	leave
+  102e28:	c3                   	ret
+
+00102e29 <trap_check_user>:
+// Called from user() in kern/init.c, only in lab 1.
+// We assume the "current cpu" is always the boot cpu;
+// this true only because lab 1 doesn't start any other CPUs.
+void
+trap_check_user(void)
+{
+  102e29:	55                   	push   %ebp
+  102e2a:	89 e5                	mov    %esp,%ebp
+  102e2c:	53                   	push   %ebx
+  102e2d:	83 ec 14             	sub    $0x14,%esp
+  102e30:	e8 df d5 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  102e35:	81 c3 bf b1 00 00    	add    $0xb1bf,%ebx
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  102e3b:	66 8c c8             	mov    %cs,%ax
+  102e3e:	66 89 45 f2          	mov    %ax,-0xe(%ebp)
+        return cs;
+  102e42:	0f b7 45 f2          	movzwl -0xe(%ebp),%eax
+	assert((read_cs() & 3) == 3);	// better be in user mode!
+  102e46:	0f b7 c0             	movzwl %ax,%eax
+  102e49:	83 e0 03             	and    $0x3,%eax
+  102e4c:	83 f8 03             	cmp    $0x3,%eax
+  102e4f:	74 1f                	je     102e70 <trap_check_user+0x47>
+  102e51:	8d 83 8c b9 ff ff    	lea    -0x4674(%ebx),%eax
+  102e57:	50                   	push   %eax
+  102e58:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102e5e:	50                   	push   %eax
+  102e5f:	68 05 01 00 00       	push   $0x105
+  102e64:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102e6a:	50                   	push   %eax
+  102e6b:	e8 62 df ff ff       	call   100dd2 <debug_panic>
+
+	cpu *c = &cpu_boot;	// cpu_cur doesn't work from user mode!
+  102e70:	c7 c0 00 f0 10 00    	mov    $0x10f000,%eax
+  102e76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	c->recover = trap_check_recover;
+  102e79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102e7c:	8d 93 60 4d ff ff    	lea    -0xb2a0(%ebx),%edx
+  102e82:	89 90 98 00 00 00    	mov    %edx,0x98(%eax)
+	trap_check(&c->recoverdata);
+  102e88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102e8b:	05 9c 00 00 00       	add    $0x9c,%eax
+  102e90:	83 ec 0c             	sub    $0xc,%esp
+  102e93:	50                   	push   %eax
+  102e94:	e8 28 00 00 00       	call   102ec1 <trap_check>
+  102e99:	83 c4 10             	add    $0x10,%esp
+	c->recover = NULL;	// No more mr. nice-guy; traps are real again
+  102e9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  102e9f:	c7 80 98 00 00 00 00 	movl   $0x0,0x98(%eax)
+  102ea6:	00 00 00 
+
+	cprintf("trap_check_user() succeeded!\n");
+  102ea9:	83 ec 0c             	sub    $0xc,%esp
+  102eac:	8d 83 a1 b9 ff ff    	lea    -0x465f(%ebx),%eax
+  102eb2:	50                   	push   %eax
+  102eb3:	e8 5d 4d 00 00       	call   107c15 <cprintf>
+  102eb8:	83 c4 10             	add    $0x10,%esp
+}
+  102ebb:	90                   	nop
+  102ebc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  102ebf:	c9                   	leave
+  102ec0:	c3                   	ret
+
+00102ec1 <trap_check>:
+void after_priv();
+
+// Multi-purpose trap checking function.
+void
+trap_check(void **argsp)
+{
+  102ec1:	55                   	push   %ebp
+  102ec2:	89 e5                	mov    %esp,%ebp
+  102ec4:	57                   	push   %edi
+  102ec5:	56                   	push   %esi
+  102ec6:	53                   	push   %ebx
+  102ec7:	83 ec 3c             	sub    $0x3c,%esp
+  102eca:	e8 40 02 00 00       	call   10310f <__x86.get_pc_thunk.cx>
+  102ecf:	81 c1 25 b1 00 00    	add    $0xb125,%ecx
+  102ed5:	89 cb                	mov    %ecx,%ebx
+  102ed7:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+	volatile int cookie = 0xfeedface;
+  102eda:	c7 45 e0 ce fa ed fe 	movl   $0xfeedface,-0x20(%ebp)
+	volatile trap_check_args args;
+	*argsp = (void*)&args;	// provide args needed for trap recovery
+  102ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+  102ee4:	8d 55 d8             	lea    -0x28(%ebp),%edx
+  102ee7:	89 10                	mov    %edx,(%eax)
+
+	// Try a divide by zero trap.
+	// Be careful when using && to take the address of a label:
+	// some versions of GCC (4.4.2 at least) will incorrectly try to
+	// eliminate code it thinks is _only_ reachable via such a pointer.
+	args.reip = after_div0;
+  102ee9:	89 d9                	mov    %ebx,%ecx
+  102eeb:	c7 c0 fb 2e 10 00    	mov    $0x102efb,%eax
+  102ef1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	asm volatile("div %0,%0; after_div0:" : : "r" (0));
+  102ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  102ef9:	f7 f0                	div    %eax
+
+00102efb <after_div0>:
+	assert(args.trapno == T_DIVIDE);
+  102efb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  102efe:	85 c0                	test   %eax,%eax
+  102f00:	74 1f                	je     102f21 <after_div0+0x26>
+  102f02:	8d 83 bf b9 ff ff    	lea    -0x4641(%ebx),%eax
+  102f08:	50                   	push   %eax
+  102f09:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102f0f:	50                   	push   %eax
+  102f10:	68 25 01 00 00       	push   $0x125
+  102f15:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102f1b:	50                   	push   %eax
+  102f1c:	e8 b1 de ff ff       	call   100dd2 <debug_panic>
+
+	// Make sure we got our correct stack back with us.
+	// The asm ensures gcc uses ebp/esp to get the cookie.
+	asm volatile("" : : : "eax","ebx","ecx","edx","esi","edi");
+	assert(cookie == 0xfeedface);
+  102f21:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  102f24:	3d ce fa ed fe       	cmp    $0xfeedface,%eax
+  102f29:	74 22                	je     102f4d <after_div0+0x52>
+  102f2b:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  102f2e:	8d 83 d7 b9 ff ff    	lea    -0x4629(%ebx),%eax
+  102f34:	50                   	push   %eax
+  102f35:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102f3b:	50                   	push   %eax
+  102f3c:	68 2a 01 00 00       	push   $0x12a
+  102f41:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102f47:	50                   	push   %eax
+  102f48:	e8 85 de ff ff       	call   100dd2 <debug_panic>
+
+	// Breakpoint trap
+	args.reip = after_breakpoint;
+  102f4d:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  102f50:	89 df                	mov    %ebx,%edi
+  102f52:	c7 c0 5c 2f 10 00    	mov    $0x102f5c,%eax
+  102f58:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	asm volatile("int3; after_breakpoint:");
+  102f5b:	cc                   	int3
+
+00102f5c <after_breakpoint>:
+	assert(args.trapno == T_BRKPT);
+  102f5c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  102f5f:	83 f8 03             	cmp    $0x3,%eax
+  102f62:	74 1f                	je     102f83 <after_breakpoint+0x27>
+  102f64:	8d 83 ec b9 ff ff    	lea    -0x4614(%ebx),%eax
+  102f6a:	50                   	push   %eax
+  102f6b:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102f71:	50                   	push   %eax
+  102f72:	68 2f 01 00 00       	push   $0x12f
+  102f77:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102f7d:	50                   	push   %eax
+  102f7e:	e8 4f de ff ff       	call   100dd2 <debug_panic>
+
+	// Overflow trap
+	args.reip = after_overflow;
+  102f83:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  102f86:	89 da                	mov    %ebx,%edx
+  102f88:	c7 c0 99 2f 10 00    	mov    $0x102f99,%eax
+  102f8e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	asm volatile("addl %0,%0; into; after_overflow:" : : "r" (0x70000000));
+  102f91:	b8 00 00 00 70       	mov    $0x70000000,%eax
+  102f96:	01 c0                	add    %eax,%eax
+  102f98:	ce                   	into
+
+00102f99 <after_overflow>:
+	assert(args.trapno == T_OFLOW);
+  102f99:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  102f9c:	83 f8 04             	cmp    $0x4,%eax
+  102f9f:	74 1f                	je     102fc0 <after_overflow+0x27>
+  102fa1:	8d 83 03 ba ff ff    	lea    -0x45fd(%ebx),%eax
+  102fa7:	50                   	push   %eax
+  102fa8:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102fae:	50                   	push   %eax
+  102faf:	68 34 01 00 00       	push   $0x134
+  102fb4:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  102fba:	50                   	push   %eax
+  102fbb:	e8 12 de ff ff       	call   100dd2 <debug_panic>
+
+	// Bounds trap
+	args.reip = after_bound;
+  102fc0:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  102fc3:	89 df                	mov    %ebx,%edi
+  102fc5:	c7 c0 e4 2f 10 00    	mov    $0x102fe4,%eax
+  102fcb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	int bounds[2] = { 1, 3 };
+  102fce:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  102fd5:	c7 45 d4 03 00 00 00 	movl   $0x3,-0x2c(%ebp)
+	asm volatile("boundl %0,%1; after_bound:" : : "r" (0), "m" (bounds[0]));
+  102fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  102fe1:	62 45 d0             	bound  %eax,-0x30(%ebp)
+
+00102fe4 <after_bound>:
+	assert(args.trapno == T_BOUND);
+  102fe4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  102fe7:	83 f8 05             	cmp    $0x5,%eax
+  102fea:	74 1f                	je     10300b <after_bound+0x27>
+  102fec:	8d 83 1a ba ff ff    	lea    -0x45e6(%ebx),%eax
+  102ff2:	50                   	push   %eax
+  102ff3:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  102ff9:	50                   	push   %eax
+  102ffa:	68 3a 01 00 00       	push   $0x13a
+  102fff:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  103005:	50                   	push   %eax
+  103006:	e8 c7 dd ff ff       	call   100dd2 <debug_panic>
+
+	// Illegal instruction trap
+	args.reip = after_illegal;
+  10300b:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  10300e:	89 da                	mov    %ebx,%edx
+  103010:	c7 c0 1b 30 10 00    	mov    $0x10301b,%eax
+  103016:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	asm volatile("ud2; after_illegal:");	// guaranteed to be undefined
+  103019:	0f 0b                	ud2
+
+0010301b <after_illegal>:
+	assert(args.trapno == T_ILLOP);
+  10301b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  10301e:	83 f8 06             	cmp    $0x6,%eax
+  103021:	74 1f                	je     103042 <after_illegal+0x27>
+  103023:	8d 83 31 ba ff ff    	lea    -0x45cf(%ebx),%eax
+  103029:	50                   	push   %eax
+  10302a:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  103030:	50                   	push   %eax
+  103031:	68 3f 01 00 00       	push   $0x13f
+  103036:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  10303c:	50                   	push   %eax
+  10303d:	e8 90 dd ff ff       	call   100dd2 <debug_panic>
+
+	// General protection fault due to invalid segment load
+	args.reip = after_gpfault;
+  103042:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  103045:	89 d9                	mov    %ebx,%ecx
+  103047:	c7 c0 57 30 10 00    	mov    $0x103057,%eax
+  10304d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	asm volatile("movl %0,%%fs; after_gpfault:" : : "r" (-1));
+  103050:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  103055:	8e e0                	mov    %eax,%fs
+
+00103057 <after_gpfault>:
+	assert(args.trapno == T_GPFLT);
+  103057:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  10305a:	83 f8 0d             	cmp    $0xd,%eax
+  10305d:	74 1f                	je     10307e <after_gpfault+0x27>
+  10305f:	8d 83 48 ba ff ff    	lea    -0x45b8(%ebx),%eax
+  103065:	50                   	push   %eax
+  103066:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  10306c:	50                   	push   %eax
+  10306d:	68 44 01 00 00       	push   $0x144
+  103072:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  103078:	50                   	push   %eax
+  103079:	e8 54 dd ff ff       	call   100dd2 <debug_panic>
+        __asm __volatile("movw %%cs,%0" : "=rm" (cs));
+  10307e:	66 8c c8             	mov    %cs,%ax
+  103081:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+        return cs;
+  103085:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+
+	// General protection fault due to privilege violation
+	if (read_cs() & 3) {
+  103089:	0f b7 c0             	movzwl %ax,%eax
+  10308c:	83 e0 03             	and    $0x3,%eax
+  10308f:	85 c0                	test   %eax,%eax
+  103091:	74 3e                	je     1030d1 <after_priv+0x27>
+		args.reip = after_priv;
+  103093:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  103096:	89 de                	mov    %ebx,%esi
+  103098:	c7 c0 aa 30 10 00    	mov    $0x1030aa,%eax
+  10309e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		asm volatile("lidt %0; after_priv:" : : "m" (idt_pd));
+  1030a1:	89 de                	mov    %ebx,%esi
+  1030a3:	0f 01 9e 14 20 00 00 	lidtl  0x2014(%esi)
+
+001030aa <after_priv>:
+		assert(args.trapno == T_GPFLT);
+  1030aa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  1030ad:	83 f8 0d             	cmp    $0xd,%eax
+  1030b0:	74 1f                	je     1030d1 <after_priv+0x27>
+  1030b2:	8d 83 48 ba ff ff    	lea    -0x45b8(%ebx),%eax
+  1030b8:	50                   	push   %eax
+  1030b9:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  1030bf:	50                   	push   %eax
+  1030c0:	68 4a 01 00 00       	push   $0x14a
+  1030c5:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  1030cb:	50                   	push   %eax
+  1030cc:	e8 01 dd ff ff       	call   100dd2 <debug_panic>
+	}
+
+	// Make sure our stack cookie is still with us
+	assert(cookie == 0xfeedface);
+  1030d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1030d4:	3d ce fa ed fe       	cmp    $0xfeedface,%eax
+  1030d9:	74 22                	je     1030fd <after_priv+0x53>
+  1030db:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  1030de:	8d 83 d7 b9 ff ff    	lea    -0x4629(%ebx),%eax
+  1030e4:	50                   	push   %eax
+  1030e5:	8d 83 3a b7 ff ff    	lea    -0x48c6(%ebx),%eax
+  1030eb:	50                   	push   %eax
+  1030ec:	68 4e 01 00 00       	push   $0x14e
+  1030f1:	8d 83 c5 b8 ff ff    	lea    -0x473b(%ebx),%eax
+  1030f7:	50                   	push   %eax
+  1030f8:	e8 d5 dc ff ff       	call   100dd2 <debug_panic>
+
+	*argsp = NULL;	// recovery mechanism not needed anymore
+  1030fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  103100:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  103106:	90                   	nop
+  103107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10310a:	5b                   	pop    %ebx
+  10310b:	5e                   	pop    %esi
+  10310c:	5f                   	pop    %edi
+  10310d:	5d                   	pop    %ebp
+  10310e:	c3                   	ret
+
+0010310f <__x86.get_pc_thunk.cx>:
+  10310f:	8b 0c 24             	mov    (%esp),%ecx
+  103112:	c3                   	ret
+  103113:	66 90                	xchg   %ax,%ax
+  103115:	66 90                	xchg   %ax,%ax
+  103117:	66 90                	xchg   %ax,%ax
+  103119:	66 90                	xchg   %ax,%ax
+  10311b:	66 90                	xchg   %ax,%ax
+  10311d:	66 90                	xchg   %ax,%ax
+  10311f:	90                   	nop
+
+00103120 <vector0>:
+.text
+
+/*
+ * Lab 1: Your code here for generating entry points for the different traps.
+ */
+TRAPHANDLER_NOEC(vector0,0)		// divide error
+  103120:	6a 00                	push   $0x0
+  103122:	6a 00                	push   $0x0
+  103124:	e9 f9 00 00 00       	jmp    103222 <_alltraps>
+  103129:	90                   	nop
+
+0010312a <vector1>:
+TRAPHANDLER_NOEC(vector1,1)		// debug exception
+  10312a:	6a 00                	push   $0x0
+  10312c:	6a 01                	push   $0x1
+  10312e:	e9 ef 00 00 00       	jmp    103222 <_alltraps>
+  103133:	90                   	nop
+
+00103134 <vector2>:
+TRAPHANDLER_NOEC(vector2,2)		// non-maskable interrupt
+  103134:	6a 00                	push   $0x0
+  103136:	6a 02                	push   $0x2
+  103138:	e9 e5 00 00 00       	jmp    103222 <_alltraps>
+  10313d:	90                   	nop
+
+0010313e <vector3>:
+TRAPHANDLER_NOEC(vector3,3)		// breakpoint
+  10313e:	6a 00                	push   $0x0
+  103140:	6a 03                	push   $0x3
+  103142:	e9 db 00 00 00       	jmp    103222 <_alltraps>
+  103147:	90                   	nop
+
+00103148 <vector4>:
+TRAPHANDLER_NOEC(vector4,4)		// overflow
+  103148:	6a 00                	push   $0x0
+  10314a:	6a 04                	push   $0x4
+  10314c:	e9 d1 00 00 00       	jmp    103222 <_alltraps>
+  103151:	90                   	nop
+
+00103152 <vector5>:
+TRAPHANDLER_NOEC(vector5,5)		// bounds check
+  103152:	6a 00                	push   $0x0
+  103154:	6a 05                	push   $0x5
+  103156:	e9 c7 00 00 00       	jmp    103222 <_alltraps>
+  10315b:	90                   	nop
+
+0010315c <vector6>:
+TRAPHANDLER_NOEC(vector6,6)		// illegal opcode
+  10315c:	6a 00                	push   $0x0
+  10315e:	6a 06                	push   $0x6
+  103160:	e9 bd 00 00 00       	jmp    103222 <_alltraps>
+  103165:	90                   	nop
+
+00103166 <vector7>:
+TRAPHANDLER_NOEC(vector7,7)		// device not available 
+  103166:	6a 00                	push   $0x0
+  103168:	6a 07                	push   $0x7
+  10316a:	e9 b3 00 00 00       	jmp    103222 <_alltraps>
+  10316f:	90                   	nop
+
+00103170 <vector8>:
+TRAPHANDLER(vector8,8)			// double fault
+  103170:	6a 08                	push   $0x8
+  103172:	e9 ab 00 00 00       	jmp    103222 <_alltraps>
+  103177:	90                   	nop
+
+00103178 <vector9>:
+TRAPHANDLER_NOEC(vector9,9)		// reserved (not generated by recent processors)
+  103178:	6a 00                	push   $0x0
+  10317a:	6a 09                	push   $0x9
+  10317c:	e9 a1 00 00 00       	jmp    103222 <_alltraps>
+  103181:	90                   	nop
+
+00103182 <vector10>:
+TRAPHANDLER(vector10,10)		// invalid task switch segment
+  103182:	6a 0a                	push   $0xa
+  103184:	e9 99 00 00 00       	jmp    103222 <_alltraps>
+  103189:	90                   	nop
+
+0010318a <vector11>:
+TRAPHANDLER(vector11,11)		// segment not present
+  10318a:	6a 0b                	push   $0xb
+  10318c:	e9 91 00 00 00       	jmp    103222 <_alltraps>
+  103191:	90                   	nop
+
+00103192 <vector12>:
+TRAPHANDLER(vector12,12)		// stack exception
+  103192:	6a 0c                	push   $0xc
+  103194:	e9 89 00 00 00       	jmp    103222 <_alltraps>
+  103199:	90                   	nop
+
+0010319a <vector13>:
+TRAPHANDLER(vector13,13)		// general protection fault
+  10319a:	6a 0d                	push   $0xd
+  10319c:	e9 81 00 00 00       	jmp    103222 <_alltraps>
+  1031a1:	90                   	nop
+
+001031a2 <vector14>:
+TRAPHANDLER(vector14,14)		// page fault
+  1031a2:	6a 0e                	push   $0xe
+  1031a4:	eb 7c                	jmp    103222 <_alltraps>
+
+001031a6 <vector15>:
+TRAPHANDLER_NOEC(vector15,15)		// reserved
+  1031a6:	6a 00                	push   $0x0
+  1031a8:	6a 0f                	push   $0xf
+  1031aa:	eb 76                	jmp    103222 <_alltraps>
+
+001031ac <vector16>:
+TRAPHANDLER_NOEC(vector16,16)		// floating point error
+  1031ac:	6a 00                	push   $0x0
+  1031ae:	6a 10                	push   $0x10
+  1031b0:	eb 70                	jmp    103222 <_alltraps>
+
+001031b2 <vector17>:
+TRAPHANDLER(vector17,17)		// alignment check
+  1031b2:	6a 11                	push   $0x11
+  1031b4:	eb 6c                	jmp    103222 <_alltraps>
+
+001031b6 <vector18>:
+TRAPHANDLER_NOEC(vector18,18)		// machine check
+  1031b6:	6a 00                	push   $0x0
+  1031b8:	6a 12                	push   $0x12
+  1031ba:	eb 66                	jmp    103222 <_alltraps>
+
+001031bc <vector19>:
+TRAPHANDLER_NOEC(vector19,19)		// SIMD floating point error
+  1031bc:	6a 00                	push   $0x0
+  1031be:	6a 13                	push   $0x13
+  1031c0:	eb 60                	jmp    103222 <_alltraps>
+
+001031c2 <vector32>:
+
+TRAPHANDLER_NOEC(vector32,T_IRQ0+0)	// hardware interrupts
+  1031c2:	6a 00                	push   $0x0
+  1031c4:	6a 20                	push   $0x20
+  1031c6:	eb 5a                	jmp    103222 <_alltraps>
+
+001031c8 <vector33>:
+TRAPHANDLER_NOEC(vector33,T_IRQ0+1)
+  1031c8:	6a 00                	push   $0x0
+  1031ca:	6a 21                	push   $0x21
+  1031cc:	eb 54                	jmp    103222 <_alltraps>
+
+001031ce <vector34>:
+TRAPHANDLER_NOEC(vector34,T_IRQ0+2)
+  1031ce:	6a 00                	push   $0x0
+  1031d0:	6a 22                	push   $0x22
+  1031d2:	eb 4e                	jmp    103222 <_alltraps>
+
+001031d4 <vector35>:
+TRAPHANDLER_NOEC(vector35,T_IRQ0+3)
+  1031d4:	6a 00                	push   $0x0
+  1031d6:	6a 23                	push   $0x23
+  1031d8:	eb 48                	jmp    103222 <_alltraps>
+
+001031da <vector36>:
+TRAPHANDLER_NOEC(vector36,T_IRQ0+4)
+  1031da:	6a 00                	push   $0x0
+  1031dc:	6a 24                	push   $0x24
+  1031de:	eb 42                	jmp    103222 <_alltraps>
+
+001031e0 <vector37>:
+TRAPHANDLER_NOEC(vector37,T_IRQ0+5)
+  1031e0:	6a 00                	push   $0x0
+  1031e2:	6a 25                	push   $0x25
+  1031e4:	eb 3c                	jmp    103222 <_alltraps>
+
+001031e6 <vector38>:
+TRAPHANDLER_NOEC(vector38,T_IRQ0+6)
+  1031e6:	6a 00                	push   $0x0
+  1031e8:	6a 26                	push   $0x26
+  1031ea:	eb 36                	jmp    103222 <_alltraps>
+
+001031ec <vector39>:
+TRAPHANDLER_NOEC(vector39,T_IRQ0+7)
+  1031ec:	6a 00                	push   $0x0
+  1031ee:	6a 27                	push   $0x27
+  1031f0:	eb 30                	jmp    103222 <_alltraps>
+
+001031f2 <vector40>:
+TRAPHANDLER_NOEC(vector40,T_IRQ0+8)
+  1031f2:	6a 00                	push   $0x0
+  1031f4:	6a 28                	push   $0x28
+  1031f6:	eb 2a                	jmp    103222 <_alltraps>
+
+001031f8 <vector41>:
+TRAPHANDLER_NOEC(vector41,T_IRQ0+9)
+  1031f8:	6a 00                	push   $0x0
+  1031fa:	6a 29                	push   $0x29
+  1031fc:	eb 24                	jmp    103222 <_alltraps>
+
+001031fe <vector42>:
+TRAPHANDLER_NOEC(vector42,T_IRQ0+10)
+  1031fe:	6a 00                	push   $0x0
+  103200:	6a 2a                	push   $0x2a
+  103202:	eb 1e                	jmp    103222 <_alltraps>
+
+00103204 <vector43>:
+TRAPHANDLER_NOEC(vector43,T_IRQ0+11)
+  103204:	6a 00                	push   $0x0
+  103206:	6a 2b                	push   $0x2b
+  103208:	eb 18                	jmp    103222 <_alltraps>
+
+0010320a <vector44>:
+TRAPHANDLER_NOEC(vector44,T_IRQ0+12)
+  10320a:	6a 00                	push   $0x0
+  10320c:	6a 2c                	push   $0x2c
+  10320e:	eb 12                	jmp    103222 <_alltraps>
+
+00103210 <vector45>:
+TRAPHANDLER_NOEC(vector45,T_IRQ0+13)
+  103210:	6a 00                	push   $0x0
+  103212:	6a 2d                	push   $0x2d
+  103214:	eb 0c                	jmp    103222 <_alltraps>
+
+00103216 <vector46>:
+TRAPHANDLER_NOEC(vector46,T_IRQ0+14)
+  103216:	6a 00                	push   $0x0
+  103218:	6a 2e                	push   $0x2e
+  10321a:	eb 06                	jmp    103222 <_alltraps>
+
+0010321c <vector47>:
+TRAPHANDLER_NOEC(vector47,T_IRQ0+15)
+  10321c:	6a 00                	push   $0x0
+  10321e:	6a 2f                	push   $0x2f
+  103220:	eb 00                	jmp    103222 <_alltraps>
+
+00103222 <_alltraps>:
+ * Lab 1: Your code here for _alltraps
+ */
+
+
+_alltraps:
+	pushl %ds
+  103222:	1e                   	push   %ds
+	pushl %es
+  103223:	06                   	push   %es
+	pushal
+  103224:	60                   	pusha
+	movw $CPU_GDT_KDATA,%ax 
+  103225:	66 b8 10 00          	mov    $0x10,%ax
+	movw %ax,%es //CPU_GDT_KDATA
+  103229:	8e c0                	mov    %eax,%es
+	movw %ax,%ds //CPU_GDT_KDATA
+  10322b:	8e d8                	mov    %eax,%ds
+	pushl %esp
+  10322d:	54                   	push   %esp
+	call trap
+  10322e:	e8 54 f7 ff ff       	call   102987 <trap>
+	addl $4, %esp
+  103233:	83 c4 04             	add    $0x4,%esp
+  103236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  10323d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00103240 <sysentry>:
+ */
+.globl	sysentry
+.type	sysentry,@function
+.p2align 4, 0x90
+sysentry:
+	testl $(SYS_TYPE | SYS_REGS | SYS_FPU), %eax
+  103240:	a9 03 30 00 00       	test   $0x3003,%eax
+	jz 1f
+  103245:	74 06                	je     10324d <sysentry+0xd>
+	pushl $0
+  103247:	6a 00                	push   $0x0
+	pushl $T_SYSCALL
+  103249:	6a 30                	push   $0x30
+	jmp _alltraps
+  10324b:	eb d5                	jmp    103222 <_alltraps>
+
+1:	pushl %ds
+  10324d:	1e                   	push   %ds
+	pushl %es
+  10324e:	06                   	push   %es
+	pushl %edi
+  10324f:	57                   	push   %edi
+	pushl %esi
+  103250:	56                   	push   %esi
+	pushl %edx
+  103251:	52                   	push   %edx
+	pushl %ecx
+  103252:	51                   	push   %ecx
+	pushl %ebx
+  103253:	53                   	push   %ebx
+	pushl %eax
+  103254:	50                   	push   %eax
+	cld
+  103255:	fc                   	cld
+	movw %ds,%ax
+  103256:	66 8c d8             	mov    %ds,%ax
+	cmpw $CPU_GDT_KDATA,%ax
+  103259:	66 83 f8 10          	cmp    $0x10,%ax
+	jne 2f
+  10325d:	75 09                	jne    103268 <sysentry+0x28>
+	movw %es,%ax
+  10325f:	66 8c c0             	mov    %es,%ax
+	cmpw $CPU_GDT_KDATA,%ax
+  103262:	66 83 f8 10          	cmp    $0x10,%ax
+	je 3f
+  103266:	74 08                	je     103270 <sysentry+0x30>
+2:	movw $CPU_GDT_KDATA,%ax
+  103268:	66 b8 10 00          	mov    $0x10,%ax
+	movw %ax,%ds
+  10326c:	8e d8                	mov    %eax,%ds
+	movw %ax,%es
+  10326e:	8e c0                	mov    %eax,%es
+3:	pushl %esp
+  103270:	54                   	push   %esp
+	call syscall_fast
+  103271:	e8 df 06 00 00       	call   103955 <syscall_fast>
+	addl $4,%esp
+  103276:	83 c4 04             	add    $0x4,%esp
+
+	// EBX, ESI and EDI were preserved by the C code: just skip them.
+	cmpw $CPU_GDT_KDATA,24(%esp)
+  103279:	66 83 7c 24 18 10    	cmpw   $0x10,0x18(%esp)
+	jne 4f
+  10327f:	75 12                	jne    103293 <sysentry+0x53>
+	cmpw $CPU_GDT_KDATA,28(%esp)
+  103281:	66 83 7c 24 1c 10    	cmpw   $0x10,0x1c(%esp)
+	jne 4f
+  103287:	75 0a                	jne    103293 <sysentry+0x53>
+	popl %eax
+  103289:	58                   	pop    %eax
+	addl $4,%esp
+  10328a:	83 c4 04             	add    $0x4,%esp
+	popl %ecx
+  10328d:	59                   	pop    %ecx
+	popl %edx
+  10328e:	5a                   	pop    %edx
+	addl $16,%esp		// DS and ES never changed
+  10328f:	83 c4 10             	add    $0x10,%esp
+	iret
+  103292:	cf                   	iret
+4:	popl %eax
+  103293:	58                   	pop    %eax
+	addl $4,%esp
+  103294:	83 c4 04             	add    $0x4,%esp
+	popl %ecx
+  103297:	59                   	pop    %ecx
+	popl %edx
+  103298:	5a                   	pop    %edx
+	addl $8,%esp
+  103299:	83 c4 08             	add    $0x8,%esp
+	popl %es
+  10329c:	07                   	pop    %es
+	popl %ds
+  10329d:	1f                   	pop    %ds
+	iret
+  10329e:	cf                   	iret
+  10329f:	90                   	nop
+
+001032a0 <trap_return>:
+.p2align 4, 0x90		/* 16-byte alignment, nop filled */
+trap_return:
+/*
+ * Lab 1: Your code here for trap_return
+ */
+	call trap_account	// charge time to the trap we're leaving
+  1032a0:	e8 86 f8 ff ff       	call   102b2b <trap_account>
+	addl $4, %esp
+  1032a5:	83 c4 04             	add    $0x4,%esp
+	popl %esp
+  1032a8:	5c                   	pop    %esp
+	popal
+  1032a9:	61                   	popa
+	popl %es
+  1032aa:	07                   	pop    %es
+	popl %ds
+  1032ab:	1f                   	pop    %ds
+	addl $8, %esp
+  1032ac:	83 c4 08             	add    $0x8,%esp
+	iret
+  1032af:	cf                   	iret
+1:	jmp	1b		// just spin
+  1032b0:	eb fe                	jmp    1032b0 <trap_return+0x10>
+
+001032b2 <sum>:
+int ncpu = 1;
+
+
+static uint8_t
+sum(uint8_t * addr, int len)
+{
+  1032b2:	55                   	push   %ebp
+  1032b3:	89 e5                	mov    %esp,%ebp
+  1032b5:	83 ec 10             	sub    $0x10,%esp
+  1032b8:	e8 53 d1 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1032bd:	05 37 ad 00 00       	add    $0xad37,%eax
+	int i, sum;
+
+	sum = 0;
+  1032c2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+	for (i = 0; i < len; i++)
+  1032c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  1032d0:	eb 15                	jmp    1032e7 <sum+0x35>
+		sum += addr[i];
+  1032d2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1032d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1032d8:	01 d0                	add    %edx,%eax
+  1032da:	0f b6 00             	movzbl (%eax),%eax
+  1032dd:	0f b6 c0             	movzbl %al,%eax
+  1032e0:	01 45 f8             	add    %eax,-0x8(%ebp)
+	for (i = 0; i < len; i++)
+  1032e3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  1032e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  1032ea:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  1032ed:	7c e3                	jl     1032d2 <sum+0x20>
+	return sum;
+  1032ef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+}
+  1032f2:	c9                   	leave
+  1032f3:	c3                   	ret
+
+001032f4 <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static mp *
+mpsearch1(uint8_t * addr, int len)
+{
+  1032f4:	55                   	push   %ebp
+  1032f5:	89 e5                	mov    %esp,%ebp
+  1032f7:	53                   	push   %ebx
+  1032f8:	83 ec 14             	sub    $0x14,%esp
+  1032fb:	e8 14 d1 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  103300:	81 c3 f4 ac 00 00    	add    $0xacf4,%ebx
+	uint8_t *e, *p;
+
+	e = addr + len;
+  103306:	8b 55 0c             	mov    0xc(%ebp),%edx
+  103309:	8b 45 08             	mov    0x8(%ebp),%eax
+  10330c:	01 d0                	add    %edx,%eax
+  10330e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	for (p = addr; p < e; p += sizeof(mp))
+  103311:	8b 45 08             	mov    0x8(%ebp),%eax
+  103314:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  103317:	eb 38                	jmp    103351 <mpsearch1+0x5d>
+		if (memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(mp)) == 0)
+  103319:	83 ec 04             	sub    $0x4,%esp
+  10331c:	6a 04                	push   $0x4
+  10331e:	8d 83 a4 bb ff ff    	lea    -0x445c(%ebx),%eax
+  103324:	50                   	push   %eax
+  103325:	ff 75 f4             	push   -0xc(%ebp)
+  103328:	e8 ff 4c 00 00       	call   10802c <memcmp>
+  10332d:	83 c4 10             	add    $0x10,%esp
+  103330:	85 c0                	test   %eax,%eax
+  103332:	75 19                	jne    10334d <mpsearch1+0x59>
+  103334:	83 ec 08             	sub    $0x8,%esp
+  103337:	6a 10                	push   $0x10
+  103339:	ff 75 f4             	push   -0xc(%ebp)
+  10333c:	e8 71 ff ff ff       	call   1032b2 <sum>
+  103341:	83 c4 10             	add    $0x10,%esp
+  103344:	84 c0                	test   %al,%al
+  103346:	75 05                	jne    10334d <mpsearch1+0x59>
+			return (mp *) p;
+  103348:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10334b:	eb 11                	jmp    10335e <mpsearch1+0x6a>
+	for (p = addr; p < e; p += sizeof(mp))
+  10334d:	83 45 f4 10          	addl   $0x10,-0xc(%ebp)
+  103351:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103354:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  103357:	72 c0                	jb     103319 <mpsearch1+0x25>
+	return 0;
+  103359:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  10335e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103361:	c9                   	leave
+  103362:	c3                   	ret
+
+00103363 <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static mp *
+mpsearch(void)
+{
+  103363:	55                   	push   %ebp
+  103364:	89 e5                	mov    %esp,%ebp
+  103366:	83 ec 18             	sub    $0x18,%esp
+  103369:	e8 a2 d0 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10336e:	05 86 ac 00 00       	add    $0xac86,%eax
+	uint8_t *bda;
+	uint32_t p;
+	mp *mp;
+
+	bda = (uint8_t *) mem_ptr(0x400);
+  103373:	c7 45 f4 00 04 00 00 	movl   $0x400,-0xc(%ebp)
+	if ((p = ((bda[0x0F] << 8) | bda[0x0E]) << 4)) {
+  10337a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10337d:	83 c0 0f             	add    $0xf,%eax
+  103380:	0f b6 00             	movzbl (%eax),%eax
+  103383:	0f b6 c0             	movzbl %al,%eax
+  103386:	c1 e0 08             	shl    $0x8,%eax
+  103389:	89 c2                	mov    %eax,%edx
+  10338b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10338e:	83 c0 0e             	add    $0xe,%eax
+  103391:	0f b6 00             	movzbl (%eax),%eax
+  103394:	0f b6 c0             	movzbl %al,%eax
+  103397:	09 d0                	or     %edx,%eax
+  103399:	c1 e0 04             	shl    $0x4,%eax
+  10339c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  10339f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  1033a3:	74 22                	je     1033c7 <mpsearch+0x64>
+		if ((mp = mpsearch1((uint8_t *) mem_ptr(p), 1024)))
+  1033a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1033a8:	83 ec 08             	sub    $0x8,%esp
+  1033ab:	68 00 04 00 00       	push   $0x400
+  1033b0:	50                   	push   %eax
+  1033b1:	e8 3e ff ff ff       	call   1032f4 <mpsearch1>
+  1033b6:	83 c4 10             	add    $0x10,%esp
+  1033b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  1033bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  1033c0:	74 51                	je     103413 <mpsearch+0xb0>
+			return mp;
+  1033c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1033c5:	eb 61                	jmp    103428 <mpsearch+0xc5>
+	} else {
+		p = ((bda[0x14] << 8) | bda[0x13]) * 1024;
+  1033c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1033ca:	83 c0 14             	add    $0x14,%eax
+  1033cd:	0f b6 00             	movzbl (%eax),%eax
+  1033d0:	0f b6 c0             	movzbl %al,%eax
+  1033d3:	c1 e0 08             	shl    $0x8,%eax
+  1033d6:	89 c2                	mov    %eax,%edx
+  1033d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1033db:	83 c0 13             	add    $0x13,%eax
+  1033de:	0f b6 00             	movzbl (%eax),%eax
+  1033e1:	0f b6 c0             	movzbl %al,%eax
+  1033e4:	09 d0                	or     %edx,%eax
+  1033e6:	c1 e0 0a             	shl    $0xa,%eax
+  1033e9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		if ((mp = mpsearch1((uint8_t *) mem_ptr(p - 1024), 1024)))
+  1033ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1033ef:	2d 00 04 00 00       	sub    $0x400,%eax
+  1033f4:	83 ec 08             	sub    $0x8,%esp
+  1033f7:	68 00 04 00 00       	push   $0x400
+  1033fc:	50                   	push   %eax
+  1033fd:	e8 f2 fe ff ff       	call   1032f4 <mpsearch1>
+  103402:	83 c4 10             	add    $0x10,%esp
+  103405:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  103408:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  10340c:	74 05                	je     103413 <mpsearch+0xb0>
+			return mp;
+  10340e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103411:	eb 15                	jmp    103428 <mpsearch+0xc5>
+	}
+	return mpsearch1((uint8_t *) mem_ptr(0xF0000), 0x10000);
+  103413:	83 ec 08             	sub    $0x8,%esp
+  103416:	68 00 00 01 00       	push   $0x10000
+  10341b:	68 00 00 0f 00       	push   $0xf0000
+  103420:	e8 cf fe ff ff       	call   1032f4 <mpsearch1>
+  103425:	83 c4 10             	add    $0x10,%esp
+}
+  103428:	c9                   	leave
+  103429:	c3                   	ret
+
+0010342a <mpconfig>:
+// Search for an MP configuration table.  For now,
+// don't accept the default configurations (physaddr == 0).
+// Check for correct signature, checksum, and version.
+static mpconf *
+mpconfig(mp **pmp)
+{
+  10342a:	55                   	push   %ebp
+  10342b:	89 e5                	mov    %esp,%ebp
+  10342d:	53                   	push   %ebx
+  10342e:	83 ec 14             	sub    $0x14,%esp
+  103431:	e8 de cf ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  103436:	81 c3 be ab 00 00    	add    $0xabbe,%ebx
+	mpconf *conf;
+	mp *mp;
+
+	if ((mp = mpsearch()) == 0 || mp->physaddr == 0)
+  10343c:	e8 22 ff ff ff       	call   103363 <mpsearch>
+  103441:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  103444:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  103448:	74 0a                	je     103454 <mpconfig+0x2a>
+  10344a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10344d:	8b 40 04             	mov    0x4(%eax),%eax
+  103450:	85 c0                	test   %eax,%eax
+  103452:	75 07                	jne    10345b <mpconfig+0x31>
+		return 0;
+  103454:	b8 00 00 00 00       	mov    $0x0,%eax
+  103459:	eb 77                	jmp    1034d2 <mpconfig+0xa8>
+	conf = (mpconf *) mem_ptr(mp->physaddr);
+  10345b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10345e:	8b 40 04             	mov    0x4(%eax),%eax
+  103461:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	if (memcmp(conf, "PCMP", 4) != 0)
+  103464:	83 ec 04             	sub    $0x4,%esp
+  103467:	6a 04                	push   $0x4
+  103469:	8d 83 a9 bb ff ff    	lea    -0x4457(%ebx),%eax
+  10346f:	50                   	push   %eax
+  103470:	ff 75 f0             	push   -0x10(%ebp)
+  103473:	e8 b4 4b 00 00       	call   10802c <memcmp>
+  103478:	83 c4 10             	add    $0x10,%esp
+  10347b:	85 c0                	test   %eax,%eax
+  10347d:	74 07                	je     103486 <mpconfig+0x5c>
+		return 0;
+  10347f:	b8 00 00 00 00       	mov    $0x0,%eax
+  103484:	eb 4c                	jmp    1034d2 <mpconfig+0xa8>
+	if (conf->version != 1 && conf->version != 4)
+  103486:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  103489:	0f b6 40 06          	movzbl 0x6(%eax),%eax
+  10348d:	3c 01                	cmp    $0x1,%al
+  10348f:	74 12                	je     1034a3 <mpconfig+0x79>
+  103491:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  103494:	0f b6 40 06          	movzbl 0x6(%eax),%eax
+  103498:	3c 04                	cmp    $0x4,%al
+  10349a:	74 07                	je     1034a3 <mpconfig+0x79>
+		return 0;
+  10349c:	b8 00 00 00 00       	mov    $0x0,%eax
+  1034a1:	eb 2f                	jmp    1034d2 <mpconfig+0xa8>
+	if (sum((uint8_t *) conf, conf->length) != 0)
+  1034a3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1034a6:	0f b7 40 04          	movzwl 0x4(%eax),%eax
+  1034aa:	0f b7 c0             	movzwl %ax,%eax
+  1034ad:	83 ec 08             	sub    $0x8,%esp
+  1034b0:	50                   	push   %eax
+  1034b1:	ff 75 f0             	push   -0x10(%ebp)
+  1034b4:	e8 f9 fd ff ff       	call   1032b2 <sum>
+  1034b9:	83 c4 10             	add    $0x10,%esp
+  1034bc:	84 c0                	test   %al,%al
+  1034be:	74 07                	je     1034c7 <mpconfig+0x9d>
+		return 0;
+  1034c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  1034c5:	eb 0b                	jmp    1034d2 <mpconfig+0xa8>
+	*pmp = mp;
+  1034c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1034ca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1034cd:	89 10                	mov    %edx,(%eax)
+	return conf;
+  1034cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  1034d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1034d5:	c9                   	leave
+  1034d6:	c3                   	ret
+
+001034d7 <mp_init>:
+
+void
+mp_init(void)
+{
+  1034d7:	55                   	push   %ebp
+  1034d8:	89 e5                	mov    %esp,%ebp
+  1034da:	53                   	push   %ebx
+  1034db:	83 ec 24             	sub    $0x24,%esp
+  1034de:	e8 31 cf ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1034e3:	81 c3 11 ab 00 00    	add    $0xab11,%ebx
+	uint8_t *p, *e;
+	mp *mp;
+	mpconf *conf;
+	mpproc *proc;
+	int n = 0;
+  1034e9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+	if ((conf = mpconfig(&mp)) == 0)
+  1034f0:	83 ec 0c             	sub    $0xc,%esp
+  1034f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1034f6:	50                   	push   %eax
+  1034f7:	e8 2e ff ff ff       	call   10342a <mpconfig>
+  1034fc:	83 c4 10             	add    $0x10,%esp
+  1034ff:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  103502:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  103506:	0f 84 01 01 00 00    	je     10360d <mp_init+0x136>
+		return; // Not a multiprocessor machine - just use boot CPU.
+
+	ismp = 1;
+  10350c:	c7 83 cc 84 01 00 01 	movl   $0x1,0x184cc(%ebx)
+  103513:	00 00 00 
+	lapic = (volatile uint32_t *) mem_ptr(conf->lapicaddr);
+  103516:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103519:	8b 40 24             	mov    0x24(%eax),%eax
+  10351c:	89 c2                	mov    %eax,%edx
+  10351e:	c7 c0 9c 20 14 00    	mov    $0x14209c,%eax
+  103524:	89 10                	mov    %edx,(%eax)
+	for (p = conf->entries, e = (uint8_t *) conf + conf->length; p < e; ) {
+  103526:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103529:	83 c0 2c             	add    $0x2c,%eax
+  10352c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  10352f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103532:	0f b7 40 04          	movzwl 0x4(%eax),%eax
+  103536:	0f b7 d0             	movzwl %ax,%edx
+  103539:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10353c:	01 d0                	add    %edx,%eax
+  10353e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  103541:	eb 7d                	jmp    1035c0 <mp_init+0xe9>
+		switch (*p) {
+  103543:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103546:	0f b6 00             	movzbl (%eax),%eax
+  103549:	0f b6 c0             	movzbl %al,%eax
+  10354c:	85 c0                	test   %eax,%eax
+  10354e:	74 0e                	je     10355e <mp_init+0x87>
+  103550:	85 c0                	test   %eax,%eax
+  103552:	78 31                	js     103585 <mp_init+0xae>
+  103554:	83 e8 01             	sub    $0x1,%eax
+  103557:	83 f8 03             	cmp    $0x3,%eax
+  10355a:	77 29                	ja     103585 <mp_init+0xae>
+  10355c:	eb 21                	jmp    10357f <mp_init+0xa8>
+		case MPPROC:
+			proc = (mpproc *) p;
+  10355e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103561:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			p += sizeof(mpproc);
+  103564:	83 45 f4 14          	addl   $0x14,-0xc(%ebp)
+			if (proc->flags & MPENAB)
+  103568:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10356b:	0f b6 40 03          	movzbl 0x3(%eax),%eax
+  10356f:	0f b6 c0             	movzbl %al,%eax
+  103572:	83 e0 01             	and    $0x1,%eax
+  103575:	85 c0                	test   %eax,%eax
+  103577:	74 46                	je     1035bf <mp_init+0xe8>
+				n++;
+  103579:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+			continue;
+  10357d:	eb 40                	jmp    1035bf <mp_init+0xe8>
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+  10357f:	83 45 f4 08          	addl   $0x8,-0xc(%ebp)
+			continue;
+  103583:	eb 3b                	jmp    1035c0 <mp_init+0xe9>
+		default:
+			warn("mp_init: unknown config type %x\n", *p);
+  103585:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103588:	0f b6 00             	movzbl (%eax),%eax
+  10358b:	0f b6 c0             	movzbl %al,%eax
+  10358e:	50                   	push   %eax
+  10358f:	8d 83 b0 bb ff ff    	lea    -0x4450(%ebx),%eax
+  103595:	50                   	push   %eax
+  103596:	6a 7e                	push   $0x7e
+  103598:	8d 83 d1 bb ff ff    	lea    -0x442f(%ebx),%eax
+  10359e:	50                   	push   %eax
+  10359f:	e8 2c d9 ff ff       	call   100ed0 <debug_warn>
+  1035a4:	83 c4 10             	add    $0x10,%esp
+			ismp = 0;
+  1035a7:	c7 83 cc 84 01 00 00 	movl   $0x0,0x184cc(%ebx)
+  1035ae:	00 00 00 
+			lapic = NULL;
+  1035b1:	c7 c0 9c 20 14 00    	mov    $0x14209c,%eax
+  1035b7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+			return;
+  1035bd:	eb 4f                	jmp    10360e <mp_init+0x137>
+			continue;
+  1035bf:	90                   	nop
+	for (p = conf->entries, e = (uint8_t *) conf + conf->length; p < e; ) {
+  1035c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1035c3:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+  1035c6:	0f 82 77 ff ff ff    	jb     103543 <mp_init+0x6c>
+		}
+	}
+
+	if (n > MAX_CPUS) {
+  1035cc:	83 7d f0 10          	cmpl   $0x10,-0x10(%ebp)
+  1035d0:	7e 2a                	jle    1035fc <mp_init+0x125>
+		warn("mp_init: %d CPUs, only using %d\n", n, MAX_CPUS);
+  1035d2:	83 ec 0c             	sub    $0xc,%esp
+  1035d5:	6a 10                	push   $0x10
+  1035d7:	ff 75 f0             	push   -0x10(%ebp)
+  1035da:	8d 83 dc bb ff ff    	lea    -0x4424(%ebx),%eax
+  1035e0:	50                   	push   %eax
+  1035e1:	68 86 00 00 00       	push   $0x86
+  1035e6:	8d 83 d1 bb ff ff    	lea    -0x442f(%ebx),%eax
+  1035ec:	50                   	push   %eax
+  1035ed:	e8 de d8 ff ff       	call   100ed0 <debug_warn>
+  1035f2:	83 c4 20             	add    $0x20,%esp
+		n = MAX_CPUS;
+  1035f5:	c7 45 f0 10 00 00 00 	movl   $0x10,-0x10(%ebp)
+	}
+	if (n > 0)
+  1035fc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  103600:	7e 0c                	jle    10360e <mp_init+0x137>
+		ncpu = n;
+  103602:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  103605:	89 83 ac 20 00 00    	mov    %eax,0x20ac(%ebx)
+  10360b:	eb 01                	jmp    10360e <mp_init+0x137>
+		return; // Not a multiprocessor machine - just use boot CPU.
+  10360d:	90                   	nop
+
+	// We keep the 8259A PIC in charge of device interrupts and
+	// leave the IMCR alone, so they still go only to the boot CPU.
+}
+  10360e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103611:	c9                   	leave
+  103612:	c3                   	ret
+
+00103613 <cpu_cur>:
+
+static void
+do_ring(uint32_t ebx)
+{
+	cpu *c = cpu_cur();
+	sysring *r = (sysring *) ebx;
+  103613:	55                   	push   %ebp
+  103614:	89 e5                	mov    %esp,%ebp
+  103616:	53                   	push   %ebx
+  103617:	83 ec 14             	sub    $0x14,%esp
+  10361a:	e8 f1 cd ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10361f:	05 d5 a9 00 00       	add    $0xa9d5,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  103624:	89 e2                	mov    %esp,%edx
+  103626:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  103629:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  10362c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  10362f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  103632:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  103638:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  10363b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  10363e:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  103644:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  10364a:	74 1e                	je     10366a <cpu_cur+0x57>
+  10364c:	8d 90 fd bb ff ff    	lea    -0x4403(%eax),%edx
+  103652:	52                   	push   %edx
+  103653:	8d 90 13 bc ff ff    	lea    -0x43ed(%eax),%edx
+  103659:	52                   	push   %edx
+  10365a:	6a 65                	push   $0x65
+  10365c:	8d 90 28 bc ff ff    	lea    -0x43d8(%eax),%edx
+  103662:	52                   	push   %edx
+  103663:	89 c3                	mov    %eax,%ebx
+  103665:	e8 68 d7 ff ff       	call   100dd2 <debug_panic>
+	return c;
+  10366a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  10366d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103670:	c9                   	leave
+  103671:	c3                   	ret
+
+00103672 <checkva>:
+{
+  103672:	55                   	push   %ebp
+  103673:	89 e5                	mov    %esp,%ebp
+  103675:	53                   	push   %ebx
+  103676:	83 ec 14             	sub    $0x14,%esp
+  103679:	e8 92 cd ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10367e:	05 76 a9 00 00       	add    $0xa976,%eax
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+  103683:	0f 20 da             	mov    %cr3,%edx
+  103686:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	return val;
+  103689:	8b 55 f0             	mov    -0x10(%ebp),%edx
+	pde_t *pdir = mem_ptr(PGADDR(rcr3()));
+  10368c:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  103692:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	return pmap_checkuser(pdir, va, size, writing);
+  103695:	ff 75 10             	push   0x10(%ebp)
+  103698:	ff 75 0c             	push   0xc(%ebp)
+  10369b:	ff 75 08             	push   0x8(%ebp)
+  10369e:	ff 75 f4             	push   -0xc(%ebp)
+  1036a1:	89 c3                	mov    %eax,%ebx
+  1036a3:	e8 a3 1c 00 00       	call   10534b <pmap_checkuser>
+  1036a8:	83 c4 10             	add    $0x10,%esp
+}
+  1036ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1036ae:	c9                   	leave
+  1036af:	c3                   	ret
+
+001036b0 <do_cputs>:
+{
+  1036b0:	55                   	push   %ebp
+  1036b1:	89 e5                	mov    %esp,%ebp
+  1036b3:	53                   	push   %ebx
+  1036b4:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  1036ba:	e8 55 cd ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1036bf:	81 c3 35 a9 00 00    	add    $0xa935,%ebx
+	for (len = 0; len < SYS_CPUTS_MAX - 1; len++) {
+  1036c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  1036cc:	eb 63                	jmp    103731 <do_cputs+0x81>
+		uint32_t va = ebx + len;
+  1036ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  1036d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1036d4:	01 d0                	add    %edx,%eax
+  1036d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		if ((len == 0 || PGOFF(va) == 0) && !checkva(va, 1, 0))
+  1036d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  1036dd:	74 0c                	je     1036eb <do_cputs+0x3b>
+  1036df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1036e2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  1036e7:	85 c0                	test   %eax,%eax
+  1036e9:	75 1d                	jne    103708 <do_cputs+0x58>
+  1036eb:	83 ec 04             	sub    $0x4,%esp
+  1036ee:	6a 00                	push   $0x0
+  1036f0:	6a 01                	push   $0x1
+  1036f2:	ff 75 f0             	push   -0x10(%ebp)
+  1036f5:	e8 78 ff ff ff       	call   103672 <checkva>
+  1036fa:	83 c4 10             	add    $0x10,%esp
+  1036fd:	85 c0                	test   %eax,%eax
+  1036ff:	75 07                	jne    103708 <do_cputs+0x58>
+			return -1;
+  103701:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  103706:	eb 5a                	jmp    103762 <do_cputs+0xb2>
+		if ((buf[len] = *(const char *) va) == 0)
+  103708:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  10370b:	0f b6 00             	movzbl (%eax),%eax
+  10370e:	8d 8d f0 fe ff ff    	lea    -0x110(%ebp),%ecx
+  103714:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  103717:	01 ca                	add    %ecx,%edx
+  103719:	88 02                	mov    %al,(%edx)
+  10371b:	8d 95 f0 fe ff ff    	lea    -0x110(%ebp),%edx
+  103721:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103724:	01 d0                	add    %edx,%eax
+  103726:	0f b6 00             	movzbl (%eax),%eax
+  103729:	84 c0                	test   %al,%al
+  10372b:	74 0f                	je     10373c <do_cputs+0x8c>
+	for (len = 0; len < SYS_CPUTS_MAX - 1; len++) {
+  10372d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  103731:	81 7d f4 fe 00 00 00 	cmpl   $0xfe,-0xc(%ebp)
+  103738:	76 94                	jbe    1036ce <do_cputs+0x1e>
+  10373a:	eb 01                	jmp    10373d <do_cputs+0x8d>
+			break;
+  10373c:	90                   	nop
+	buf[len] = 0;
+  10373d:	8d 95 f0 fe ff ff    	lea    -0x110(%ebp),%edx
+  103743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103746:	01 d0                	add    %edx,%eax
+  103748:	c6 00 00             	movb   $0x0,(%eax)
+	cputs(buf);
+  10374b:	83 ec 0c             	sub    $0xc,%esp
+  10374e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  103754:	50                   	push   %eax
+  103755:	e8 d4 d5 ff ff       	call   100d2e <cputs>
+  10375a:	83 c4 10             	add    $0x10,%esp
+	return 0;
+  10375d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  103762:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103765:	c9                   	leave
+  103766:	c3                   	ret
+
+00103767 <do_op>:
+{
+  103767:	55                   	push   %ebp
+  103768:	89 e5                	mov    %esp,%ebp
+  10376a:	83 ec 08             	sub    $0x8,%esp
+  10376d:	e8 9e cc ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  103772:	05 82 a8 00 00       	add    $0xa882,%eax
+	switch (eax & SYS_TYPE) {
+  103777:	8b 45 08             	mov    0x8(%ebp),%eax
+  10377a:	83 e0 03             	and    $0x3,%eax
+  10377d:	85 c0                	test   %eax,%eax
+  10377f:	75 10                	jne    103791 <do_op+0x2a>
+		return do_cputs(ebx);
+  103781:	83 ec 0c             	sub    $0xc,%esp
+  103784:	ff 75 0c             	push   0xc(%ebp)
+  103787:	e8 24 ff ff ff       	call   1036b0 <do_cputs>
+  10378c:	83 c4 10             	add    $0x10,%esp
+  10378f:	eb 05                	jmp    103796 <do_op+0x2f>
+		return -1;
+  103791:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  103796:	c9                   	leave
+  103797:	c3                   	ret
+
+00103798 <do_ring_drain>:
+{
+  103798:	55                   	push   %ebp
+  103799:	89 e5                	mov    %esp,%ebp
+  10379b:	83 ec 18             	sub    $0x18,%esp
+  10379e:	e8 6d cc ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1037a3:	05 51 a8 00 00       	add    $0xa851,%eax
+	while (r->sq_head != r->sq_tail
+  1037a8:	e9 93 00 00 00       	jmp    103840 <do_ring_drain+0xa8>
+		sysreq *rq = &r->sq[r->sq_head & (SYS_RING_SIZE-1)];
+  1037ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  1037b0:	8b 00                	mov    (%eax),%eax
+  1037b2:	83 e0 3f             	and    $0x3f,%eax
+  1037b5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  1037b8:	8d 50 10             	lea    0x10(%eax),%edx
+  1037bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  1037be:	01 d0                	add    %edx,%eax
+  1037c0:	83 c0 04             	add    $0x4,%eax
+  1037c3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		syscomp *cp = &r->cq[r->cq_tail & (SYS_RING_SIZE-1)];
+  1037c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  1037c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  1037cc:	83 e0 3f             	and    $0x3f,%eax
+  1037cf:	05 e2 00 00 00       	add    $0xe2,%eax
+  1037d4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  1037db:	8b 45 08             	mov    0x8(%ebp),%eax
+  1037de:	01 d0                	add    %edx,%eax
+  1037e0:	83 c0 04             	add    $0x4,%eax
+  1037e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		cp->tag = rq->tag;
+  1037e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1037e9:	8b 50 18             	mov    0x18(%eax),%edx
+  1037ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1037ef:	89 10                	mov    %edx,(%eax)
+		cp->status = (rq->eax & SYS_RING) ? -1	// no nested rings
+  1037f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1037f4:	8b 00                	mov    (%eax),%eax
+  1037f6:	25 00 01 00 00       	and    $0x100,%eax
+				: do_op(rq->eax, rq->ebx);
+  1037fb:	85 c0                	test   %eax,%eax
+  1037fd:	75 1a                	jne    103819 <do_ring_drain+0x81>
+  1037ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103802:	8b 50 04             	mov    0x4(%eax),%edx
+  103805:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103808:	8b 00                	mov    (%eax),%eax
+  10380a:	83 ec 08             	sub    $0x8,%esp
+  10380d:	52                   	push   %edx
+  10380e:	50                   	push   %eax
+  10380f:	e8 53 ff ff ff       	call   103767 <do_op>
+  103814:	83 c4 10             	add    $0x10,%esp
+  103817:	eb 05                	jmp    10381e <do_ring_drain+0x86>
+  103819:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+		cp->status = (rq->eax & SYS_RING) ? -1	// no nested rings
+  10381e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  103821:	89 42 04             	mov    %eax,0x4(%edx)
+		r->cq_tail++;
+  103824:	8b 45 08             	mov    0x8(%ebp),%eax
+  103827:	8b 40 0c             	mov    0xc(%eax),%eax
+  10382a:	8d 50 01             	lea    0x1(%eax),%edx
+  10382d:	8b 45 08             	mov    0x8(%ebp),%eax
+  103830:	89 50 0c             	mov    %edx,0xc(%eax)
+		r->sq_head++;
+  103833:	8b 45 08             	mov    0x8(%ebp),%eax
+  103836:	8b 00                	mov    (%eax),%eax
+  103838:	8d 50 01             	lea    0x1(%eax),%edx
+  10383b:	8b 45 08             	mov    0x8(%ebp),%eax
+  10383e:	89 10                	mov    %edx,(%eax)
+	while (r->sq_head != r->sq_tail
+  103840:	8b 45 08             	mov    0x8(%ebp),%eax
+  103843:	8b 10                	mov    (%eax),%edx
+  103845:	8b 45 08             	mov    0x8(%ebp),%eax
+  103848:	8b 40 04             	mov    0x4(%eax),%eax
+			&& r->cq_tail - r->cq_head < SYS_RING_SIZE) {
+  10384b:	39 c2                	cmp    %eax,%edx
+  10384d:	74 17                	je     103866 <do_ring_drain+0xce>
+  10384f:	8b 45 08             	mov    0x8(%ebp),%eax
+  103852:	8b 50 0c             	mov    0xc(%eax),%edx
+  103855:	8b 45 08             	mov    0x8(%ebp),%eax
+  103858:	8b 40 08             	mov    0x8(%eax),%eax
+  10385b:	29 c2                	sub    %eax,%edx
+  10385d:	83 fa 3f             	cmp    $0x3f,%edx
+  103860:	0f 86 47 ff ff ff    	jbe    1037ad <do_ring_drain+0x15>
+}
+  103866:	90                   	nop
+  103867:	c9                   	leave
+  103868:	c3                   	ret
+
+00103869 <do_ring>:
+{
+  103869:	55                   	push   %ebp
+  10386a:	89 e5                	mov    %esp,%ebp
+  10386c:	83 ec 18             	sub    $0x18,%esp
+  10386f:	e8 9c cb ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  103874:	05 80 a7 00 00       	add    $0xa780,%eax
+	cpu *c = cpu_cur();
+  103879:	e8 95 fd ff ff       	call   103613 <cpu_cur>
+  10387e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	sysring *r = (sysring *) ebx;
+  103881:	8b 45 08             	mov    0x8(%ebp),%eax
+  103884:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+	c->sysring = NULL;
+  103887:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10388a:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+  103891:	00 00 00 
+	if (r == NULL || !checkva(ebx, sizeof(sysring), 1))
+  103894:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  103898:	74 42                	je     1038dc <do_ring+0x73>
+  10389a:	83 ec 04             	sub    $0x4,%esp
+  10389d:	6a 01                	push   $0x1
+  10389f:	68 14 09 00 00       	push   $0x914
+  1038a4:	ff 75 08             	push   0x8(%ebp)
+  1038a7:	e8 c6 fd ff ff       	call   103672 <checkva>
+  1038ac:	83 c4 10             	add    $0x10,%esp
+  1038af:	85 c0                	test   %eax,%eax
+  1038b1:	74 29                	je     1038dc <do_ring+0x73>
+		return;
+	do_ring_drain(r);
+  1038b3:	83 ec 0c             	sub    $0xc,%esp
+  1038b6:	ff 75 f0             	push   -0x10(%ebp)
+  1038b9:	e8 da fe ff ff       	call   103798 <do_ring_drain>
+  1038be:	83 c4 10             	add    $0x10,%esp
+	if (r->flags & SYS_RING_POLL)
+  1038c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1038c4:	8b 40 10             	mov    0x10(%eax),%eax
+  1038c7:	83 e0 01             	and    $0x1,%eax
+  1038ca:	85 c0                	test   %eax,%eax
+  1038cc:	74 0f                	je     1038dd <do_ring+0x74>
+		c->sysring = r;
+  1038ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1038d1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1038d4:	89 90 ac 00 00 00    	mov    %edx,0xac(%eax)
+  1038da:	eb 01                	jmp    1038dd <do_ring+0x74>
+		return;
+  1038dc:	90                   	nop
+}
+  1038dd:	c9                   	leave
+  1038de:	c3                   	ret
+
+001038df <syscall>:
+
+void
+syscall(trapframe *tf)
+{
+  1038df:	55                   	push   %ebp
+  1038e0:	89 e5                	mov    %esp,%ebp
+  1038e2:	53                   	push   %ebx
+  1038e3:	83 ec 14             	sub    $0x14,%esp
+  1038e6:	e8 29 cb ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1038eb:	81 c3 09 a7 00 00    	add    $0xa709,%ebx
+	uint32_t cmd = tf->tf_regs.reg_eax;
+  1038f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  1038f4:	8b 40 1c             	mov    0x1c(%eax),%eax
+  1038f7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+	// Run any requests a polling process has queued since we last looked.
+	syscall_poll();
+  1038fa:	e8 2e 01 00 00       	call   103a2d <syscall_poll>
+
+	if (cmd & SYS_RING) {
+  1038ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103902:	25 00 01 00 00       	and    $0x100,%eax
+  103907:	85 c0                	test   %eax,%eax
+  103909:	74 1d                	je     103928 <syscall+0x49>
+		do_ring(tf->tf_regs.reg_ebx);
+  10390b:	8b 45 08             	mov    0x8(%ebp),%eax
+  10390e:	8b 40 10             	mov    0x10(%eax),%eax
+  103911:	83 ec 0c             	sub    $0xc,%esp
+  103914:	50                   	push   %eax
+  103915:	e8 4f ff ff ff       	call   103869 <do_ring>
+  10391a:	83 c4 10             	add    $0x10,%esp
+		trap_return(tf);
+  10391d:	83 ec 0c             	sub    $0xc,%esp
+  103920:	ff 75 08             	push   0x8(%ebp)
+  103923:	e8 78 f9 ff ff       	call   1032a0 <trap_return>
+	}
+	switch (cmd & SYS_TYPE) {
+  103928:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10392b:	83 e0 03             	and    $0x3,%eax
+  10392e:	85 c0                	test   %eax,%eax
+  103930:	75 1d                	jne    10394f <syscall+0x70>
+	case SYS_CPUTS:
+		do_cputs(tf->tf_regs.reg_ebx);
+  103932:	8b 45 08             	mov    0x8(%ebp),%eax
+  103935:	8b 40 10             	mov    0x10(%eax),%eax
+  103938:	83 ec 0c             	sub    $0xc,%esp
+  10393b:	50                   	push   %eax
+  10393c:	e8 6f fd ff ff       	call   1036b0 <do_cputs>
+  103941:	83 c4 10             	add    $0x10,%esp
+		trap_return(tf);
+  103944:	83 ec 0c             	sub    $0xc,%esp
+  103947:	ff 75 08             	push   0x8(%ebp)
+  10394a:	e8 51 f9 ff ff       	call   1032a0 <trap_return>
+	default:
+		return;		// handle as a regular trap
+  10394f:	90                   	nop
+	}
+}
+  103950:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103953:	c9                   	leave
+  103954:	c3                   	ret
+
+00103955 <syscall_fast>:
+
+void
+syscall_fast(sysframe *sf)
+{
+  103955:	55                   	push   %ebp
+  103956:	89 e5                	mov    %esp,%ebp
+  103958:	53                   	push   %ebx
+  103959:	83 ec 24             	sub    $0x24,%esp
+  10395c:	e8 b3 ca ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  103961:	81 c3 93 a6 00 00    	add    $0xa693,%ebx
+	trapstats *ts = &trap_stats[cpu_cur()->num];
+  103967:	e8 a7 fc ff ff       	call   103613 <cpu_cur>
+  10396c:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  103973:	0f b6 d0             	movzbl %al,%edx
+  103976:	89 d0                	mov    %edx,%eax
+  103978:	c1 e0 02             	shl    $0x2,%eax
+  10397b:	01 d0                	add    %edx,%eax
+  10397d:	c1 e0 07             	shl    $0x7,%eax
+  103980:	c7 c2 c0 34 12 00    	mov    $0x1234c0,%edx
+  103986:	01 d0                	add    %edx,%eax
+  103988:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        asm volatile("rdtsc" : "=A" (tsc));
+  10398b:	0f 31                	rdtsc
+  10398d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  103990:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+        return tsc;
+  103993:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  103996:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+	uint64_t start = rdtsc();
+  103999:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  10399c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+
+	// There's no trap() or trap_return() on this path,
+	// so keep the per-vector trap statistics here.
+	ts->count[T_SYSCALL]++;
+  10399f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1039a2:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+  1039a8:	8d 50 01             	lea    0x1(%eax),%edx
+  1039ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1039ae:	89 90 c0 00 00 00    	mov    %edx,0xc0(%eax)
+
+	syscall_poll();
+  1039b4:	e8 74 00 00 00       	call   103a2d <syscall_poll>
+	if (sf->sf_eax & SYS_RING)
+  1039b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  1039bc:	8b 00                	mov    (%eax),%eax
+  1039be:	25 00 01 00 00       	and    $0x100,%eax
+  1039c3:	85 c0                	test   %eax,%eax
+  1039c5:	74 14                	je     1039db <syscall_fast+0x86>
+		do_ring(sf->sf_ebx);
+  1039c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1039ca:	8b 40 04             	mov    0x4(%eax),%eax
+  1039cd:	83 ec 0c             	sub    $0xc,%esp
+  1039d0:	50                   	push   %eax
+  1039d1:	e8 93 fe ff ff       	call   103869 <do_ring>
+  1039d6:	83 c4 10             	add    $0x10,%esp
+  1039d9:	eb 12                	jmp    1039ed <syscall_fast+0x98>
+	else
+		do_cputs(sf->sf_ebx);
+  1039db:	8b 45 08             	mov    0x8(%ebp),%eax
+  1039de:	8b 40 04             	mov    0x4(%eax),%eax
+  1039e1:	83 ec 0c             	sub    $0xc,%esp
+  1039e4:	50                   	push   %eax
+  1039e5:	e8 c6 fc ff ff       	call   1036b0 <do_cputs>
+  1039ea:	83 c4 10             	add    $0x10,%esp
+        asm volatile("rdtsc" : "=A" (tsc));
+  1039ed:	0f 31                	rdtsc
+  1039ef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  1039f2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+        return tsc;
+  1039f5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1039f8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+
+	ts->cycles[T_SYSCALL] += rdtsc() - start;
+  1039fb:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  1039fe:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+  103a01:	89 c1                	mov    %eax,%ecx
+  103a03:	89 d3                	mov    %edx,%ebx
+  103a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103a08:	8b 90 48 02 00 00    	mov    0x248(%eax),%edx
+  103a0e:	8b 80 44 02 00 00    	mov    0x244(%eax),%eax
+  103a14:	01 c8                	add    %ecx,%eax
+  103a16:	11 da                	adc    %ebx,%edx
+  103a18:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  103a1b:	89 81 44 02 00 00    	mov    %eax,0x244(%ecx)
+  103a21:	89 91 48 02 00 00    	mov    %edx,0x248(%ecx)
+}
+  103a27:	90                   	nop
+  103a28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103a2b:	c9                   	leave
+  103a2c:	c3                   	ret
+
+00103a2d <syscall_poll>:
+
+void
+syscall_poll(void)
+{
+  103a2d:	55                   	push   %ebp
+  103a2e:	89 e5                	mov    %esp,%ebp
+  103a30:	83 ec 18             	sub    $0x18,%esp
+  103a33:	e8 d8 c9 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  103a38:	05 bc a5 00 00       	add    $0xa5bc,%eax
+	cpu *c = cpu_cur();
+  103a3d:	e8 d1 fb ff ff       	call   103613 <cpu_cur>
+  103a42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+	if (c->sysring != NULL)
+  103a45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103a48:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+  103a4e:	85 c0                	test   %eax,%eax
+  103a50:	74 15                	je     103a67 <syscall_poll+0x3a>
+		do_ring_drain(c->sysring);
+  103a52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103a55:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+  103a5b:	83 ec 0c             	sub    $0xc,%esp
+  103a5e:	50                   	push   %eax
+  103a5f:	e8 34 fd ff ff       	call   103798 <do_ring_drain>
+  103a64:	83 c4 10             	add    $0x10,%esp
+}
+  103a67:	90                   	nop
+  103a68:	c9                   	leave
+  103a69:	c3                   	ret
+
+00103a6a <cpu_cur>:
+
+  103a6a:	55                   	push   %ebp
+  103a6b:	89 e5                	mov    %esp,%ebp
+  103a6d:	53                   	push   %ebx
+  103a6e:	83 ec 14             	sub    $0x14,%esp
+  103a71:	e8 9a c9 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  103a76:	05 7e a5 00 00       	add    $0xa57e,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  103a7b:	89 e2                	mov    %esp,%edx
+  103a7d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  103a80:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  103a83:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  103a86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  103a89:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  103a8f:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  103a92:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  103a95:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  103a9b:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  103aa1:	74 1e                	je     103ac1 <cpu_cur+0x57>
+  103aa3:	8d 90 35 bc ff ff    	lea    -0x43cb(%eax),%edx
+  103aa9:	52                   	push   %edx
+  103aaa:	8d 90 4b bc ff ff    	lea    -0x43b5(%eax),%edx
+  103ab0:	52                   	push   %edx
+  103ab1:	6a 65                	push   $0x65
+  103ab3:	8d 90 60 bc ff ff    	lea    -0x43a0(%eax),%edx
+  103ab9:	52                   	push   %edx
+  103aba:	89 c3                	mov    %eax,%ebx
+  103abc:	e8 11 d3 ff ff       	call   100dd2 <debug_panic>
+	return c;
+  103ac1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  103ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103ac7:	c9                   	leave
+  103ac8:	c3                   	ret
+
+00103ac9 <trace_log>:
+{
+  103ac9:	55                   	push   %ebp
+  103aca:	89 e5                	mov    %esp,%ebp
+  103acc:	53                   	push   %ebx
+  103acd:	83 ec 34             	sub    $0x34,%esp
+  103ad0:	e8 3f c9 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  103ad5:	81 c3 1f a5 00 00    	add    $0xa51f,%ebx
+	tracebuf *t = &tracebufs[cpu_cur()->num];
+  103adb:	e8 8a ff ff ff       	call   103a6a <cpu_cur>
+  103ae0:	0f b6 80 a0 00 00 00 	movzbl 0xa0(%eax),%eax
+  103ae7:	0f b6 c0             	movzbl %al,%eax
+  103aea:	69 d0 40 10 00 00    	imul   $0x1040,%eax,%edx
+  103af0:	8d 83 0c 85 01 00    	lea    0x1850c(%ebx),%eax
+  103af6:	01 d0                	add    %edx,%eax
+  103af8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  103afb:	9c                   	pushf
+  103afc:	58                   	pop    %eax
+  103afd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        return eflags;
+  103b00:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	uint32_t eflags = read_eflags();
+  103b03:	89 45 e8             	mov    %eax,-0x18(%ebp)
+	asm volatile("cli");
+  103b06:	fa                   	cli
+}
+  103b07:	90                   	nop
+	r = &t->recs[t->head & (TRACE_NRECS-1)];
+  103b08:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103b0b:	8b 80 00 10 00 00    	mov    0x1000(%eax),%eax
+  103b11:	83 e0 7f             	and    $0x7f,%eax
+  103b14:	c1 e0 05             	shl    $0x5,%eax
+  103b17:	89 c2                	mov    %eax,%edx
+  103b19:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103b1c:	01 d0                	add    %edx,%eax
+  103b1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	r->fmt = (uint32_t) fmt;
+  103b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  103b24:	89 c2                	mov    %eax,%edx
+  103b26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  103b29:	89 50 08             	mov    %edx,0x8(%eax)
+        asm volatile("rdtsc" : "=A" (tsc));
+  103b2c:	0f 31                	rdtsc
+  103b2e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  103b31:	89 55 dc             	mov    %edx,-0x24(%ebp)
+        return tsc;
+  103b34:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103b37:	8b 55 dc             	mov    -0x24(%ebp),%edx
+	r->tsc = rdtsc();
+  103b3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  103b3d:	89 01                	mov    %eax,(%ecx)
+  103b3f:	89 51 04             	mov    %edx,0x4(%ecx)
+	va_start(ap, fmt);
+  103b42:	8d 45 0c             	lea    0xc(%ebp),%eax
+  103b45:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	for (i = 0; i < TRACE_MAXARGS; i++)
+  103b48:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  103b4f:	eb 1a                	jmp    103b6b <trace_log+0xa2>
+		r->args[i] = va_arg(ap, uint32_t);
+  103b51:	83 45 f4 04          	addl   $0x4,-0xc(%ebp)
+  103b55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103b58:	83 e8 04             	sub    $0x4,%eax
+  103b5b:	8b 08                	mov    (%eax),%ecx
+  103b5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  103b60:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  103b63:	89 4c 90 0c          	mov    %ecx,0xc(%eax,%edx,4)
+	for (i = 0; i < TRACE_MAXARGS; i++)
+  103b67:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  103b6b:	83 7d f0 04          	cmpl   $0x4,-0x10(%ebp)
+  103b6f:	7e e0                	jle    103b51 <trace_log+0x88>
+	t->head++;
+  103b71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103b74:	8b 80 00 10 00 00    	mov    0x1000(%eax),%eax
+  103b7a:	8d 50 01             	lea    0x1(%eax),%edx
+  103b7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  103b80:	89 90 00 10 00 00    	mov    %edx,0x1000(%eax)
+  103b86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  103b89:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  103b8c:	ff 75 d0             	push   -0x30(%ebp)
+  103b8f:	9d                   	popf
+}
+  103b90:	90                   	nop
+}
+  103b91:	90                   	nop
+  103b92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  103b95:	c9                   	leave
+  103b96:	c3                   	ret
+
+00103b97 <trace_dump>:
+{
+  103b97:	55                   	push   %ebp
+  103b98:	89 e5                	mov    %esp,%ebp
+  103b9a:	57                   	push   %edi
+  103b9b:	56                   	push   %esi
+  103b9c:	53                   	push   %ebx
+  103b9d:	83 ec 7c             	sub    $0x7c,%esp
+  103ba0:	e8 29 d2 ff ff       	call   100dce <__x86.get_pc_thunk.si>
+  103ba5:	81 c6 4f a4 00 00    	add    $0xa44f,%esi
+	uint64_t t0 = 0;
+  103bab:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  103bb2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	for (i = 0; i < MAX_CPUS; i++) {
+  103bb9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  103bc0:	eb 36                	jmp    103bf8 <trace_dump+0x61>
+		uint32_t head = tracebufs[i].head;
+  103bc2:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  103bc5:	8d 86 0c 85 01 00    	lea    0x1850c(%esi),%eax
+  103bcb:	69 d2 40 10 00 00    	imul   $0x1040,%edx,%edx
+  103bd1:	01 d0                	add    %edx,%eax
+  103bd3:	05 00 10 00 00       	add    $0x1000,%eax
+  103bd8:	8b 00                	mov    (%eax),%eax
+  103bda:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		next[i] = head > TRACE_NRECS ? head - TRACE_NRECS : 0;
+  103bdd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  103be0:	ba 80 00 00 00       	mov    $0x80,%edx
+  103be5:	39 d0                	cmp    %edx,%eax
+  103be7:	0f 42 c2             	cmovb  %edx,%eax
+  103bea:	8d 50 80             	lea    -0x80(%eax),%edx
+  103bed:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  103bf0:	89 54 85 8c          	mov    %edx,-0x74(%ebp,%eax,4)
+	for (i = 0; i < MAX_CPUS; i++) {
+  103bf4:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+  103bf8:	83 7d dc 0f          	cmpl   $0xf,-0x24(%ebp)
+  103bfc:	7e c4                	jle    103bc2 <trace_dump+0x2b>
+		tracerec *r, *oldest = NULL;
+  103bfe:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		int oldestcpu = 0;
+  103c05:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+		for (i = 0; i < MAX_CPUS; i++) {
+  103c0c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  103c13:	eb 7b                	jmp    103c90 <trace_dump+0xf9>
+			if (next[i] == tracebufs[i].head)
+  103c15:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  103c18:	8b 54 85 8c          	mov    -0x74(%ebp,%eax,4),%edx
+  103c1c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  103c1f:	8d 86 0c 85 01 00    	lea    0x1850c(%esi),%eax
+  103c25:	69 c9 40 10 00 00    	imul   $0x1040,%ecx,%ecx
+  103c2b:	01 c8                	add    %ecx,%eax
+  103c2d:	05 00 10 00 00       	add    $0x1000,%eax
+  103c32:	8b 00                	mov    (%eax),%eax
+  103c34:	39 c2                	cmp    %eax,%edx
+  103c36:	74 53                	je     103c8b <trace_dump+0xf4>
+			r = &tracebufs[i].recs[next[i] & (TRACE_NRECS-1)];
+  103c38:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  103c3b:	8b 44 85 8c          	mov    -0x74(%ebp,%eax,4),%eax
+  103c3f:	83 e0 7f             	and    $0x7f,%eax
+  103c42:	89 c2                	mov    %eax,%edx
+  103c44:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  103c47:	69 c0 82 00 00 00    	imul   $0x82,%eax,%eax
+  103c4d:	01 d0                	add    %edx,%eax
+  103c4f:	c1 e0 05             	shl    $0x5,%eax
+  103c52:	89 c2                	mov    %eax,%edx
+  103c54:	8d 86 0c 85 01 00    	lea    0x1850c(%esi),%eax
+  103c5a:	01 d0                	add    %edx,%eax
+  103c5c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+			if (oldest == NULL || r->tsc < oldest->tsc)
+  103c5f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  103c63:	74 18                	je     103c7d <trace_dump+0xe6>
+  103c65:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  103c68:	8b 08                	mov    (%eax),%ecx
+  103c6a:	8b 58 04             	mov    0x4(%eax),%ebx
+  103c6d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103c70:	8b 50 04             	mov    0x4(%eax),%edx
+  103c73:	8b 00                	mov    (%eax),%eax
+  103c75:	39 c1                	cmp    %eax,%ecx
+  103c77:	89 df                	mov    %ebx,%edi
+  103c79:	19 d7                	sbb    %edx,%edi
+  103c7b:	73 0f                	jae    103c8c <trace_dump+0xf5>
+				oldest = r, oldestcpu = i;
+  103c7d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  103c80:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  103c83:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  103c86:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  103c89:	eb 01                	jmp    103c8c <trace_dump+0xf5>
+				continue;
+  103c8b:	90                   	nop
+		for (i = 0; i < MAX_CPUS; i++) {
+  103c8c:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+  103c90:	83 7d dc 0f          	cmpl   $0xf,-0x24(%ebp)
+  103c94:	0f 8e 7b ff ff ff    	jle    103c15 <trace_dump+0x7e>
+		if (oldest == NULL)
+  103c9a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  103c9e:	0f 84 a4 00 00 00    	je     103d48 <trace_dump+0x1b1>
+		next[oldestcpu]++;
+  103ca4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  103ca7:	8b 44 85 8c          	mov    -0x74(%ebp,%eax,4),%eax
+  103cab:	8d 50 01             	lea    0x1(%eax),%edx
+  103cae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  103cb1:	89 54 85 8c          	mov    %edx,-0x74(%ebp,%eax,4)
+		if (t0 == 0)
+  103cb5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  103cb8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103cbb:	09 d0                	or     %edx,%eax
+  103cbd:	85 c0                	test   %eax,%eax
+  103cbf:	75 0e                	jne    103ccf <trace_dump+0x138>
+			t0 = oldest->tsc;
+  103cc1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103cc4:	8b 50 04             	mov    0x4(%eax),%edx
+  103cc7:	8b 00                	mov    (%eax),%eax
+  103cc9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  103ccc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		cprintf("[%d %10llu] ", oldestcpu, oldest->tsc - t0);
+  103ccf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103cd2:	8b 50 04             	mov    0x4(%eax),%edx
+  103cd5:	8b 00                	mov    (%eax),%eax
+  103cd7:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  103cda:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  103cdd:	52                   	push   %edx
+  103cde:	50                   	push   %eax
+  103cdf:	ff 75 d4             	push   -0x2c(%ebp)
+  103ce2:	8d 86 6d bc ff ff    	lea    -0x4393(%esi),%eax
+  103ce8:	50                   	push   %eax
+  103ce9:	89 f3                	mov    %esi,%ebx
+  103ceb:	e8 25 3f 00 00       	call   107c15 <cprintf>
+  103cf0:	83 c4 10             	add    $0x10,%esp
+		cprintf((const char *) oldest->fmt, oldest->args[0], oldest->args[1],
+  103cf3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103cf6:	8b 40 1c             	mov    0x1c(%eax),%eax
+  103cf9:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  103cfc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103cff:	8b 78 18             	mov    0x18(%eax),%edi
+  103d02:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103d05:	8b 58 14             	mov    0x14(%eax),%ebx
+  103d08:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103d0b:	8b 48 10             	mov    0x10(%eax),%ecx
+  103d0e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103d11:	8b 50 0c             	mov    0xc(%eax),%edx
+  103d14:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103d17:	8b 40 08             	mov    0x8(%eax),%eax
+  103d1a:	83 ec 08             	sub    $0x8,%esp
+  103d1d:	ff 75 84             	push   -0x7c(%ebp)
+  103d20:	57                   	push   %edi
+  103d21:	53                   	push   %ebx
+  103d22:	51                   	push   %ecx
+  103d23:	52                   	push   %edx
+  103d24:	50                   	push   %eax
+  103d25:	89 f3                	mov    %esi,%ebx
+  103d27:	e8 e9 3e 00 00       	call   107c15 <cprintf>
+  103d2c:	83 c4 20             	add    $0x20,%esp
+		cprintf("\n");
+  103d2f:	83 ec 0c             	sub    $0xc,%esp
+  103d32:	8d 86 7a bc ff ff    	lea    -0x4386(%esi),%eax
+  103d38:	50                   	push   %eax
+  103d39:	89 f3                	mov    %esi,%ebx
+  103d3b:	e8 d5 3e 00 00       	call   107c15 <cprintf>
+  103d40:	83 c4 10             	add    $0x10,%esp
+	while (1) {
+  103d43:	e9 b6 fe ff ff       	jmp    103bfe <trace_dump+0x67>
+			break;
+  103d48:	90                   	nop
+}
+  103d49:	90                   	nop
+  103d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103d4d:	5b                   	pop    %ebx
+  103d4e:	5e                   	pop    %esi
+  103d4f:	5f                   	pop    %edi
+  103d50:	5d                   	pop    %ebp
+  103d51:	c3                   	ret
+
+00103d52 <boottime_init>:
+static int nboottimes;
+
+
+void
+boottime_init(void)
+{
+  103d52:	55                   	push   %ebp
+  103d53:	89 e5                	mov    %esp,%ebp
+  103d55:	57                   	push   %edi
+  103d56:	56                   	push   %esi
+  103d57:	53                   	push   %ebx
+  103d58:	83 ec 1c             	sub    $0x1c,%esp
+  103d5b:	e8 b0 c6 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  103d60:	05 94 a2 00 00       	add    $0xa294,%eax
+	static const char *lowphases[BOOTTIME_NLOWMEM] = {
+		[BOOTTIME_LOADER] = "bootmain",
+		[BOOTTIME_LOADED] = "load kernel",
+		[BOOTTIME_ENTRY] = "enter kernel",
+	};
+	volatile uint64_t *low = (uint64_t *) BOOTTIME_LOWMEM;
+  103d65:	c7 45 e0 00 80 00 00 	movl   $0x8000,-0x20(%ebp)
+	int i;
+
+	// Anything but our own boot loader (e.g., GRUB) leaves
+	// whatever it likes in the loader's slots: believe them only
+	// if they're nonzero and in order.
+	for (i = 0; i < BOOTTIME_NLOWMEM; i++) {
+  103d6c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  103d73:	e9 ed 00 00 00       	jmp    103e65 <boottime_init+0x113>
+		if (i < BOOTTIME_ENTRY && (low[i] == 0
+  103d78:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+  103d7c:	7f 7d                	jg     103dfb <boottime_init+0xa9>
+  103d7e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103d81:	8d 0c d5 00 00 00 00 	lea    0x0(,%edx,8),%ecx
+  103d88:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  103d8b:	01 ca                	add    %ecx,%edx
+  103d8d:	8b 0a                	mov    (%edx),%ecx
+  103d8f:	8b 5a 04             	mov    0x4(%edx),%ebx
+  103d92:	89 da                	mov    %ebx,%edx
+  103d94:	09 ca                	or     %ecx,%edx
+  103d96:	85 d2                	test   %edx,%edx
+  103d98:	0f 84 c2 00 00 00    	je     103e60 <boottime_init+0x10e>
+				|| low[i] > low[i+1]
+  103d9e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103da1:	8d 0c d5 00 00 00 00 	lea    0x0(,%edx,8),%ecx
+  103da8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  103dab:	01 ca                	add    %ecx,%edx
+  103dad:	8b 0a                	mov    (%edx),%ecx
+  103daf:	8b 5a 04             	mov    0x4(%edx),%ebx
+  103db2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103db5:	83 c2 01             	add    $0x1,%edx
+  103db8:	8d 34 d5 00 00 00 00 	lea    0x0(,%edx,8),%esi
+  103dbf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  103dc2:	01 f2                	add    %esi,%edx
+  103dc4:	8b 32                	mov    (%edx),%esi
+  103dc6:	8b 7a 04             	mov    0x4(%edx),%edi
+  103dc9:	39 ce                	cmp    %ecx,%esi
+  103dcb:	19 df                	sbb    %ebx,%edi
+  103dcd:	0f 82 8d 00 00 00    	jb     103e60 <boottime_init+0x10e>
+				|| low[i+1] > low[BOOTTIME_ENTRY]))
+  103dd3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103dd6:	83 c2 01             	add    $0x1,%edx
+  103dd9:	8d 0c d5 00 00 00 00 	lea    0x0(,%edx,8),%ecx
+  103de0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  103de3:	01 ca                	add    %ecx,%edx
+  103de5:	8b 0a                	mov    (%edx),%ecx
+  103de7:	8b 5a 04             	mov    0x4(%edx),%ebx
+  103dea:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  103ded:	83 c2 10             	add    $0x10,%edx
+  103df0:	8b 32                	mov    (%edx),%esi
+  103df2:	8b 7a 04             	mov    0x4(%edx),%edi
+  103df5:	39 ce                	cmp    %ecx,%esi
+  103df7:	19 df                	sbb    %ebx,%edi
+  103df9:	72 65                	jb     103e60 <boottime_init+0x10e>
+			continue;
+		boottimes[nboottimes].phase = lowphases[i];
+  103dfb:	8b 88 cc 89 02 00    	mov    0x289cc(%eax),%ecx
+  103e01:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103e04:	8b 9c 90 b0 20 00 00 	mov    0x20b0(%eax,%edx,4),%ebx
+  103e0b:	8d b0 0c 89 02 00    	lea    0x2890c(%eax),%esi
+  103e11:	89 ca                	mov    %ecx,%edx
+  103e13:	01 d2                	add    %edx,%edx
+  103e15:	01 ca                	add    %ecx,%edx
+  103e17:	c1 e2 02             	shl    $0x2,%edx
+  103e1a:	01 f2                	add    %esi,%edx
+  103e1c:	89 1a                	mov    %ebx,(%edx)
+		boottimes[nboottimes].tsc = low[i];
+  103e1e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103e21:	8d 0c d5 00 00 00 00 	lea    0x0(,%edx,8),%ecx
+  103e28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  103e2b:	01 ca                	add    %ecx,%edx
+  103e2d:	8b b0 cc 89 02 00    	mov    0x289cc(%eax),%esi
+  103e33:	8b 0a                	mov    (%edx),%ecx
+  103e35:	8b 5a 04             	mov    0x4(%edx),%ebx
+  103e38:	8d b8 0c 89 02 00    	lea    0x2890c(%eax),%edi
+  103e3e:	89 f2                	mov    %esi,%edx
+  103e40:	01 d2                	add    %edx,%edx
+  103e42:	01 f2                	add    %esi,%edx
+  103e44:	c1 e2 02             	shl    $0x2,%edx
+  103e47:	01 fa                	add    %edi,%edx
+  103e49:	89 4a 04             	mov    %ecx,0x4(%edx)
+  103e4c:	89 5a 08             	mov    %ebx,0x8(%edx)
+		nboottimes++;
+  103e4f:	8b 90 cc 89 02 00    	mov    0x289cc(%eax),%edx
+  103e55:	83 c2 01             	add    $0x1,%edx
+  103e58:	89 90 cc 89 02 00    	mov    %edx,0x289cc(%eax)
+  103e5e:	eb 01                	jmp    103e61 <boottime_init+0x10f>
+			continue;
+  103e60:	90                   	nop
+	for (i = 0; i < BOOTTIME_NLOWMEM; i++) {
+  103e61:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  103e65:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+  103e69:	0f 8e 09 ff ff ff    	jle    103d78 <boottime_init+0x26>
+	}
+	boottime_mark("BSS clear");
+  103e6f:	83 ec 0c             	sub    $0xc,%esp
+  103e72:	8d 80 7c bc ff ff    	lea    -0x4384(%eax),%eax
+  103e78:	50                   	push   %eax
+  103e79:	e8 0c 00 00 00       	call   103e8a <boottime_mark>
+  103e7e:	83 c4 10             	add    $0x10,%esp
+}
+  103e81:	90                   	nop
+  103e82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103e85:	5b                   	pop    %ebx
+  103e86:	5e                   	pop    %esi
+  103e87:	5f                   	pop    %edi
+  103e88:	5d                   	pop    %ebp
+  103e89:	c3                   	ret
+
+00103e8a <boottime_mark>:
+
+void
+boottime_mark(const char *phase)
+{
+  103e8a:	55                   	push   %ebp
+  103e8b:	89 e5                	mov    %esp,%ebp
+  103e8d:	57                   	push   %edi
+  103e8e:	56                   	push   %esi
+  103e8f:	53                   	push   %ebx
+  103e90:	83 ec 14             	sub    $0x14,%esp
+  103e93:	e8 77 f2 ff ff       	call   10310f <__x86.get_pc_thunk.cx>
+  103e98:	81 c1 5c a1 00 00    	add    $0xa15c,%ecx
+	if (nboottimes == BOOTTIME_MAX)
+  103e9e:	8b 81 cc 89 02 00    	mov    0x289cc(%ecx),%eax
+  103ea4:	83 f8 10             	cmp    $0x10,%eax
+  103ea7:	74 59                	je     103f02 <boottime_mark+0x78>
+		return;
+	boottimes[nboottimes].phase = phase;
+  103ea9:	8b 91 cc 89 02 00    	mov    0x289cc(%ecx),%edx
+  103eaf:	8d 99 0c 89 02 00    	lea    0x2890c(%ecx),%ebx
+  103eb5:	89 d0                	mov    %edx,%eax
+  103eb7:	01 c0                	add    %eax,%eax
+  103eb9:	01 d0                	add    %edx,%eax
+  103ebb:	c1 e0 02             	shl    $0x2,%eax
+  103ebe:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  103ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+  103ec4:	89 02                	mov    %eax,(%edx)
+	boottimes[nboottimes].tsc = rdtsc();
+  103ec6:	8b 99 cc 89 02 00    	mov    0x289cc(%ecx),%ebx
+        asm volatile("rdtsc" : "=A" (tsc));
+  103ecc:	0f 31                	rdtsc
+  103ece:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  103ed1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return tsc;
+  103ed4:	8b 75 e8             	mov    -0x18(%ebp),%esi
+  103ed7:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  103eda:	8d 91 0c 89 02 00    	lea    0x2890c(%ecx),%edx
+  103ee0:	89 d8                	mov    %ebx,%eax
+  103ee2:	01 c0                	add    %eax,%eax
+  103ee4:	01 d8                	add    %ebx,%eax
+  103ee6:	c1 e0 02             	shl    $0x2,%eax
+  103ee9:	01 d0                	add    %edx,%eax
+  103eeb:	89 70 04             	mov    %esi,0x4(%eax)
+  103eee:	89 78 08             	mov    %edi,0x8(%eax)
+	nboottimes++;
+  103ef1:	8b 81 cc 89 02 00    	mov    0x289cc(%ecx),%eax
+  103ef7:	83 c0 01             	add    $0x1,%eax
+  103efa:	89 81 cc 89 02 00    	mov    %eax,0x289cc(%ecx)
+  103f00:	eb 01                	jmp    103f03 <boottime_mark+0x79>
+		return;
+  103f02:	90                   	nop
+}
+  103f03:	83 c4 14             	add    $0x14,%esp
+  103f06:	5b                   	pop    %ebx
+  103f07:	5e                   	pop    %esi
+  103f08:	5f                   	pop    %edi
+  103f09:	5d                   	pop    %ebp
+  103f0a:	c3                   	ret
+
+00103f0b <boottime_calibrate>:
+
+// Count TSC ticks over 10ms timed by PIT channel 2,
+// and return the TSC rate in ticks per microsecond.
+static uint64_t
+boottime_calibrate(void)
+{
+  103f0b:	55                   	push   %ebp
+  103f0c:	89 e5                	mov    %esp,%ebp
+  103f0e:	56                   	push   %esi
+  103f0f:	53                   	push   %ebx
+  103f10:	83 ec 60             	sub    $0x60,%esp
+  103f13:	e8 f7 f1 ff ff       	call   10310f <__x86.get_pc_thunk.cx>
+  103f18:	81 c1 dc a0 00 00    	add    $0xa0dc,%ecx
+	uint32_t latch = PIT_FREQ / 100;
+  103f1e:	c7 45 f4 9b 2e 00 00 	movl   $0x2e9b,-0xc(%ebp)
+  103f25:	c7 45 b4 61 00 00 00 	movl   $0x61,-0x4c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  103f2c:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  103f2f:	89 c2                	mov    %eax,%edx
+  103f31:	ec                   	in     (%dx),%al
+  103f32:	88 45 b3             	mov    %al,-0x4d(%ebp)
+	return data;
+  103f35:	0f b6 45 b3          	movzbl -0x4d(%ebp),%eax
+	uint64_t t0, t1;
+
+	// Gate channel 2 on with the speaker off, and count down once.
+	outb(PIT_PORTB, (inb(PIT_PORTB) & ~PORTB_SPKR) | PORTB_GATE2);
+  103f39:	83 e0 fc             	and    $0xfffffffc,%eax
+  103f3c:	83 c8 01             	or     $0x1,%eax
+  103f3f:	0f b6 c0             	movzbl %al,%eax
+  103f42:	c7 45 bc 61 00 00 00 	movl   $0x61,-0x44(%ebp)
+  103f49:	88 45 bb             	mov    %al,-0x45(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  103f4c:	0f b6 45 bb          	movzbl -0x45(%ebp),%eax
+  103f50:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  103f53:	ee                   	out    %al,(%dx)
+}
+  103f54:	90                   	nop
+  103f55:	c7 45 c4 43 00 00 00 	movl   $0x43,-0x3c(%ebp)
+  103f5c:	c6 45 c3 b0          	movb   $0xb0,-0x3d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  103f60:	0f b6 45 c3          	movzbl -0x3d(%ebp),%eax
+  103f64:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  103f67:	ee                   	out    %al,(%dx)
+}
+  103f68:	90                   	nop
+	outb(PIT_MODE, PIT_SEL2 | PIT_16BIT);	// mode 0: one shot
+	outb(PIT_CNTR2, latch & 0xff);
+  103f69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103f6c:	0f b6 c0             	movzbl %al,%eax
+  103f6f:	c7 45 cc 42 00 00 00 	movl   $0x42,-0x34(%ebp)
+  103f76:	88 45 cb             	mov    %al,-0x35(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  103f79:	0f b6 45 cb          	movzbl -0x35(%ebp),%eax
+  103f7d:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  103f80:	ee                   	out    %al,(%dx)
+}
+  103f81:	90                   	nop
+	outb(PIT_CNTR2, latch >> 8);
+  103f82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  103f85:	c1 e8 08             	shr    $0x8,%eax
+  103f88:	0f b6 c0             	movzbl %al,%eax
+  103f8b:	c7 45 d4 42 00 00 00 	movl   $0x42,-0x2c(%ebp)
+  103f92:	88 45 d3             	mov    %al,-0x2d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  103f95:	0f b6 45 d3          	movzbl -0x2d(%ebp),%eax
+  103f99:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  103f9c:	ee                   	out    %al,(%dx)
+}
+  103f9d:	90                   	nop
+        asm volatile("rdtsc" : "=A" (tsc));
+  103f9e:	0f 31                	rdtsc
+  103fa0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  103fa3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+        return tsc;
+  103fa6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103fa9:	8b 55 dc             	mov    -0x24(%ebp),%edx
+
+	t0 = rdtsc();
+  103fac:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  103faf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+	while (!(inb(PIT_PORTB) & PORTB_OUT2))
+  103fb2:	90                   	nop
+  103fb3:	c7 45 ac 61 00 00 00 	movl   $0x61,-0x54(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  103fba:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  103fbd:	89 c2                	mov    %eax,%edx
+  103fbf:	ec                   	in     (%dx),%al
+  103fc0:	88 45 ab             	mov    %al,-0x55(%ebp)
+	return data;
+  103fc3:	0f b6 45 ab          	movzbl -0x55(%ebp),%eax
+  103fc7:	0f b6 c0             	movzbl %al,%eax
+  103fca:	83 e0 20             	and    $0x20,%eax
+  103fcd:	85 c0                	test   %eax,%eax
+  103fcf:	74 e2                	je     103fb3 <boottime_calibrate+0xa8>
+        asm volatile("rdtsc" : "=A" (tsc));
+  103fd1:	0f 31                	rdtsc
+  103fd3:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  103fd6:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+        return tsc;
+  103fd9:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  103fdc:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+		/* do nothing */;
+	t1 = rdtsc();
+  103fdf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  103fe2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+	if (t1 - t0 < 10000)
+  103fe5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  103fe8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  103feb:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  103fee:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+  103ff1:	be 0f 27 00 00       	mov    $0x270f,%esi
+  103ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  103ffb:	39 c6                	cmp    %eax,%esi
+  103ffd:	19 d3                	sbb    %edx,%ebx
+  103fff:	72 0c                	jb     10400d <boottime_calibrate+0x102>
+		return 1;	// unreasonably slow: avoid dividing by zero
+  104001:	b8 01 00 00 00       	mov    $0x1,%eax
+  104006:	ba 00 00 00 00       	mov    $0x0,%edx
+  10400b:	eb 1f                	jmp    10402c <boottime_calibrate+0x121>
+	return (t1 - t0) / 10000;
+  10400d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  104010:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  104013:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  104016:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+  104019:	6a 00                	push   $0x0
+  10401b:	68 10 27 00 00       	push   $0x2710
+  104020:	52                   	push   %edx
+  104021:	50                   	push   %eax
+  104022:	89 cb                	mov    %ecx,%ebx
+  104024:	e8 d7 42 00 00       	call   108300 <__udivdi3>
+  104029:	83 c4 10             	add    $0x10,%esp
+}
+  10402c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  10402f:	5b                   	pop    %ebx
+  104030:	5e                   	pop    %esi
+  104031:	5d                   	pop    %ebp
+  104032:	c3                   	ret
+
+00104033 <boottime_print>:
+
+void
+boottime_print(void)
+{
+  104033:	55                   	push   %ebp
+  104034:	89 e5                	mov    %esp,%ebp
+  104036:	57                   	push   %edi
+  104037:	56                   	push   %esi
+  104038:	53                   	push   %ebx
+  104039:	83 ec 4c             	sub    $0x4c,%esp
+  10403c:	e8 d3 c3 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104041:	81 c3 b3 9f 00 00    	add    $0x9fb3,%ebx
+	uint64_t perus = boottime_calibrate();
+  104047:	e8 bf fe ff ff       	call   103f0b <boottime_calibrate>
+  10404c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  10404f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint64_t t0 = boottimes[0].tsc;
+  104052:	8b 83 10 89 02 00    	mov    0x28910(%ebx),%eax
+  104058:	8b 93 14 89 02 00    	mov    0x28914(%ebx),%edx
+  10405e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  104061:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	int i;
+
+	cprintf("Boot timeline (TSC at %llu MHz):\n", perus);
+  104064:	83 ec 04             	sub    $0x4,%esp
+  104067:	ff 75 dc             	push   -0x24(%ebp)
+  10406a:	ff 75 d8             	push   -0x28(%ebp)
+  10406d:	8d 83 88 bc ff ff    	lea    -0x4378(%ebx),%eax
+  104073:	50                   	push   %eax
+  104074:	e8 9c 3b 00 00       	call   107c15 <cprintf>
+  104079:	83 c4 10             	add    $0x10,%esp
+	cprintf("   time (us)  phase (us)\n");
+  10407c:	83 ec 0c             	sub    $0xc,%esp
+  10407f:	8d 83 aa bc ff ff    	lea    -0x4356(%ebx),%eax
+  104085:	50                   	push   %eax
+  104086:	e8 8a 3b 00 00       	call   107c15 <cprintf>
+  10408b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < nboottimes; i++) {
+  10408e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  104095:	e9 c3 00 00 00       	jmp    10415d <boottime_print+0x12a>
+		uint64_t t = boottimes[i].tsc;
+  10409a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  10409d:	8d 8b 0c 89 02 00    	lea    0x2890c(%ebx),%ecx
+  1040a3:	89 d0                	mov    %edx,%eax
+  1040a5:	01 c0                	add    %eax,%eax
+  1040a7:	01 d0                	add    %edx,%eax
+  1040a9:	c1 e0 02             	shl    $0x2,%eax
+  1040ac:	01 c8                	add    %ecx,%eax
+  1040ae:	8b 50 08             	mov    0x8(%eax),%edx
+  1040b1:	8b 40 04             	mov    0x4(%eax),%eax
+  1040b4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  1040b7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+		uint64_t prev = i > 0 ? boottimes[i-1].tsc : t;
+  1040ba:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  1040be:	7e 1f                	jle    1040df <boottime_print+0xac>
+  1040c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  1040c3:	8d 50 ff             	lea    -0x1(%eax),%edx
+  1040c6:	8d 8b 0c 89 02 00    	lea    0x2890c(%ebx),%ecx
+  1040cc:	89 d0                	mov    %edx,%eax
+  1040ce:	01 c0                	add    %eax,%eax
+  1040d0:	01 d0                	add    %edx,%eax
+  1040d2:	c1 e0 02             	shl    $0x2,%eax
+  1040d5:	01 c8                	add    %ecx,%eax
+  1040d7:	8b 50 08             	mov    0x8(%eax),%edx
+  1040da:	8b 40 04             	mov    0x4(%eax),%eax
+  1040dd:	eb 06                	jmp    1040e5 <boottime_print+0xb2>
+  1040df:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  1040e2:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  1040e5:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  1040e8:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		cprintf("%12llu  %10llu  %s\n", (t - t0) / perus,
+  1040eb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  1040ee:	8d 8b 0c 89 02 00    	lea    0x2890c(%ebx),%ecx
+  1040f4:	89 d0                	mov    %edx,%eax
+  1040f6:	01 c0                	add    %eax,%eax
+  1040f8:	01 d0                	add    %edx,%eax
+  1040fa:	c1 e0 02             	shl    $0x2,%eax
+  1040fd:	01 c8                	add    %ecx,%eax
+  1040ff:	8b 00                	mov    (%eax),%eax
+  104101:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+			(t - prev) / perus, boottimes[i].phase);
+  104104:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  104107:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  10410a:	2b 45 c0             	sub    -0x40(%ebp),%eax
+  10410d:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+		cprintf("%12llu  %10llu  %s\n", (t - t0) / perus,
+  104110:	ff 75 dc             	push   -0x24(%ebp)
+  104113:	ff 75 d8             	push   -0x28(%ebp)
+  104116:	52                   	push   %edx
+  104117:	50                   	push   %eax
+  104118:	e8 e3 41 00 00       	call   108300 <__udivdi3>
+  10411d:	83 c4 10             	add    $0x10,%esp
+  104120:	89 c6                	mov    %eax,%esi
+  104122:	89 d7                	mov    %edx,%edi
+  104124:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  104127:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  10412a:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  10412d:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+  104130:	ff 75 dc             	push   -0x24(%ebp)
+  104133:	ff 75 d8             	push   -0x28(%ebp)
+  104136:	52                   	push   %edx
+  104137:	50                   	push   %eax
+  104138:	e8 c3 41 00 00       	call   108300 <__udivdi3>
+  10413d:	83 c4 10             	add    $0x10,%esp
+  104140:	83 ec 08             	sub    $0x8,%esp
+  104143:	ff 75 b4             	push   -0x4c(%ebp)
+  104146:	57                   	push   %edi
+  104147:	56                   	push   %esi
+  104148:	52                   	push   %edx
+  104149:	50                   	push   %eax
+  10414a:	8d 83 c4 bc ff ff    	lea    -0x433c(%ebx),%eax
+  104150:	50                   	push   %eax
+  104151:	e8 bf 3a 00 00       	call   107c15 <cprintf>
+  104156:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < nboottimes; i++) {
+  104159:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  10415d:	8b 83 cc 89 02 00    	mov    0x289cc(%ebx),%eax
+  104163:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  104166:	0f 8c 2e ff ff ff    	jl     10409a <boottime_print+0x67>
+	}
+}
+  10416c:	90                   	nop
+  10416d:	90                   	nop
+  10416e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104171:	5b                   	pop    %ebx
+  104172:	5e                   	pop    %esi
+  104173:	5f                   	pop    %edi
+  104174:	5d                   	pop    %ebp
+  104175:	c3                   	ret
+
+00104176 <selftest_select>:
+#define NSELFTESTS	(sizeof(selftests) / sizeof(selftests[0]))
+
+
+void
+selftest_select(const char *spec)
+{
+  104176:	55                   	push   %ebp
+  104177:	89 e5                	mov    %esp,%ebp
+  104179:	53                   	push   %ebx
+  10417a:	83 ec 34             	sub    $0x34,%esp
+  10417d:	e8 92 c2 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104182:	81 c3 72 9e 00 00    	add    $0x9e72,%ebx
+	char word[16];
+	int i;
+
+	while (*spec) {
+  104188:	e9 ac 01 00 00       	jmp    104339 <selftest_select+0x1c3>
+		// Pick out the next word.
+		int len = 0;
+  10418d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+		while (*spec && *spec != ',' && *spec != ' ') {
+  104194:	eb 1f                	jmp    1041b5 <selftest_select+0x3f>
+			if (len < sizeof(word) - 1)
+  104196:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  104199:	83 f8 0e             	cmp    $0xe,%eax
+  10419c:	77 13                	ja     1041b1 <selftest_select+0x3b>
+				word[len++] = *spec;
+  10419e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1041a1:	8d 50 01             	lea    0x1(%eax),%edx
+  1041a4:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  1041a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  1041aa:	0f b6 12             	movzbl (%edx),%edx
+  1041ad:	88 54 05 d0          	mov    %dl,-0x30(%ebp,%eax,1)
+			spec++;
+  1041b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+		while (*spec && *spec != ',' && *spec != ' ') {
+  1041b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1041b8:	0f b6 00             	movzbl (%eax),%eax
+  1041bb:	84 c0                	test   %al,%al
+  1041bd:	74 14                	je     1041d3 <selftest_select+0x5d>
+  1041bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  1041c2:	0f b6 00             	movzbl (%eax),%eax
+  1041c5:	3c 2c                	cmp    $0x2c,%al
+  1041c7:	74 0a                	je     1041d3 <selftest_select+0x5d>
+  1041c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  1041cc:	0f b6 00             	movzbl (%eax),%eax
+  1041cf:	3c 20                	cmp    $0x20,%al
+  1041d1:	75 c3                	jne    104196 <selftest_select+0x20>
+		}
+		word[len] = 0;
+  1041d3:	8d 55 d0             	lea    -0x30(%ebp),%edx
+  1041d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1041d9:	01 d0                	add    %edx,%eax
+  1041db:	c6 00 00             	movb   $0x0,(%eax)
+		if (*spec)
+  1041de:	8b 45 08             	mov    0x8(%ebp),%eax
+  1041e1:	0f b6 00             	movzbl (%eax),%eax
+  1041e4:	84 c0                	test   %al,%al
+  1041e6:	74 04                	je     1041ec <selftest_select+0x76>
+			spec++;
+  1041e8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+		if (len == 0)
+  1041ec:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  1041f0:	0f 84 42 01 00 00    	je     104338 <selftest_select+0x1c2>
+			continue;
+
+		bool on = word[0] != '-';
+  1041f6:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+  1041fa:	3c 2d                	cmp    $0x2d,%al
+  1041fc:	0f 95 c0             	setne  %al
+  1041ff:	0f b6 c0             	movzbl %al,%eax
+  104202:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		const char *name = on ? word : word + 1;
+  104205:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  104209:	74 05                	je     104210 <selftest_select+0x9a>
+  10420b:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  10420e:	eb 06                	jmp    104216 <selftest_select+0xa0>
+  104210:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  104213:	83 c0 01             	add    $0x1,%eax
+  104216:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		bool found = 0;
+  104219:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+		for (i = 0; i < NSELFTESTS; i++) {
+  104220:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  104227:	e9 dd 00 00 00       	jmp    104309 <selftest_select+0x193>
+			struct selftest *t = &selftests[i];
+  10422c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  10422f:	89 d0                	mov    %edx,%eax
+  104231:	c1 e0 02             	shl    $0x2,%eax
+  104234:	01 d0                	add    %edx,%eax
+  104236:	c1 e0 02             	shl    $0x2,%eax
+  104239:	8d 93 cc 20 00 00    	lea    0x20cc(%ebx),%edx
+  10423f:	01 d0                	add    %edx,%eax
+  104241:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			if (strcmp(name, "all") == 0)
+  104244:	83 ec 08             	sub    $0x8,%esp
+  104247:	8d 83 15 bd ff ff    	lea    -0x42eb(%ebx),%eax
+  10424d:	50                   	push   %eax
+  10424e:	ff 75 e4             	push   -0x1c(%ebp)
+  104251:	e8 39 3b 00 00       	call   107d8f <strcmp>
+  104256:	83 c4 10             	add    $0x10,%esp
+  104259:	85 c0                	test   %eax,%eax
+  10425b:	75 0e                	jne    10426b <selftest_select+0xf5>
+				t->selected = on;
+  10425d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  104260:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  104263:	89 50 10             	mov    %edx,0x10(%eax)
+  104266:	e9 90 00 00 00       	jmp    1042fb <selftest_select+0x185>
+			else if (strcmp(name, "none") == 0)
+  10426b:	83 ec 08             	sub    $0x8,%esp
+  10426e:	8d 83 19 bd ff ff    	lea    -0x42e7(%ebx),%eax
+  104274:	50                   	push   %eax
+  104275:	ff 75 e4             	push   -0x1c(%ebp)
+  104278:	e8 12 3b 00 00       	call   107d8f <strcmp>
+  10427d:	83 c4 10             	add    $0x10,%esp
+  104280:	85 c0                	test   %eax,%eax
+  104282:	75 12                	jne    104296 <selftest_select+0x120>
+				t->selected = !on;
+  104284:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  104288:	0f 94 c0             	sete   %al
+  10428b:	0f b6 d0             	movzbl %al,%edx
+  10428e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  104291:	89 50 10             	mov    %edx,0x10(%eax)
+  104294:	eb 65                	jmp    1042fb <selftest_select+0x185>
+			else if (strcmp(name, "fast") == 0) {
+  104296:	83 ec 08             	sub    $0x8,%esp
+  104299:	8d 83 1e bd ff ff    	lea    -0x42e2(%ebx),%eax
+  10429f:	50                   	push   %eax
+  1042a0:	ff 75 e4             	push   -0x1c(%ebp)
+  1042a3:	e8 e7 3a 00 00       	call   107d8f <strcmp>
+  1042a8:	83 c4 10             	add    $0x10,%esp
+  1042ab:	85 c0                	test   %eax,%eax
+  1042ad:	75 2b                	jne    1042da <selftest_select+0x164>
+				// "fast" picks exactly the quick tests;
+				// "-fast" just drops the slow ones.
+				if (t->flags & SELFTEST_SLOW)
+  1042af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1042b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  1042b5:	83 e0 01             	and    $0x1,%eax
+  1042b8:	85 c0                	test   %eax,%eax
+  1042ba:	74 0c                	je     1042c8 <selftest_select+0x152>
+					t->selected = 0;
+  1042bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1042bf:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  1042c6:	eb 33                	jmp    1042fb <selftest_select+0x185>
+				else if (on)
+  1042c8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  1042cc:	74 2d                	je     1042fb <selftest_select+0x185>
+					t->selected = 1;
+  1042ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1042d1:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%eax)
+  1042d8:	eb 21                	jmp    1042fb <selftest_select+0x185>
+			}
+			else if (strcmp(name, t->name) == 0)
+  1042da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1042dd:	8b 00                	mov    (%eax),%eax
+  1042df:	83 ec 08             	sub    $0x8,%esp
+  1042e2:	50                   	push   %eax
+  1042e3:	ff 75 e4             	push   -0x1c(%ebp)
+  1042e6:	e8 a4 3a 00 00       	call   107d8f <strcmp>
+  1042eb:	83 c4 10             	add    $0x10,%esp
+  1042ee:	85 c0                	test   %eax,%eax
+  1042f0:	75 12                	jne    104304 <selftest_select+0x18e>
+				t->selected = on;
+  1042f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1042f5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  1042f8:	89 50 10             	mov    %edx,0x10(%eax)
+			else
+				continue;
+			found = 1;
+  1042fb:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+  104302:	eb 01                	jmp    104305 <selftest_select+0x18f>
+				continue;
+  104304:	90                   	nop
+		for (i = 0; i < NSELFTESTS; i++) {
+  104305:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  104309:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10430c:	83 f8 04             	cmp    $0x4,%eax
+  10430f:	0f 86 17 ff ff ff    	jbe    10422c <selftest_select+0xb6>
+		}
+		if (!found)
+  104315:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  104319:	75 1e                	jne    104339 <selftest_select+0x1c3>
+			warn("selftest_select: no self-test named '%s'", name);
+  10431b:	ff 75 e4             	push   -0x1c(%ebp)
+  10431e:	8d 83 24 bd ff ff    	lea    -0x42dc(%ebx),%eax
+  104324:	50                   	push   %eax
+  104325:	6a 56                	push   $0x56
+  104327:	8d 83 4d bd ff ff    	lea    -0x42b3(%ebx),%eax
+  10432d:	50                   	push   %eax
+  10432e:	e8 9d cb ff ff       	call   100ed0 <debug_warn>
+  104333:	83 c4 10             	add    $0x10,%esp
+  104336:	eb 01                	jmp    104339 <selftest_select+0x1c3>
+			continue;
+  104338:	90                   	nop
+	while (*spec) {
+  104339:	8b 45 08             	mov    0x8(%ebp),%eax
+  10433c:	0f b6 00             	movzbl (%eax),%eax
+  10433f:	84 c0                	test   %al,%al
+  104341:	0f 85 46 fe ff ff    	jne    10418d <selftest_select+0x17>
+	}
+}
+  104347:	90                   	nop
+  104348:	90                   	nop
+  104349:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10434c:	c9                   	leave
+  10434d:	c3                   	ret
+
+0010434e <selftest_run>:
+
+void
+selftest_run(int when)
+{
+  10434e:	55                   	push   %ebp
+  10434f:	89 e5                	mov    %esp,%ebp
+  104351:	53                   	push   %ebx
+  104352:	83 ec 14             	sub    $0x14,%esp
+  104355:	e8 ba c0 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10435a:	81 c3 9a 9c 00 00    	add    $0x9c9a,%ebx
+	int i;
+
+	for (i = 0; i < NSELFTESTS; i++)
+  104360:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  104367:	eb 57                	jmp    1043c0 <selftest_run+0x72>
+		if (selftests[i].when == when && selftests[i].selected)
+  104369:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  10436c:	8d 8b d4 20 00 00    	lea    0x20d4(%ebx),%ecx
+  104372:	89 d0                	mov    %edx,%eax
+  104374:	c1 e0 02             	shl    $0x2,%eax
+  104377:	01 d0                	add    %edx,%eax
+  104379:	c1 e0 02             	shl    $0x2,%eax
+  10437c:	01 c8                	add    %ecx,%eax
+  10437e:	8b 00                	mov    (%eax),%eax
+  104380:	39 45 08             	cmp    %eax,0x8(%ebp)
+  104383:	75 37                	jne    1043bc <selftest_run+0x6e>
+  104385:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  104388:	8d 8b cc 20 00 00    	lea    0x20cc(%ebx),%ecx
+  10438e:	89 d0                	mov    %edx,%eax
+  104390:	c1 e0 02             	shl    $0x2,%eax
+  104393:	01 d0                	add    %edx,%eax
+  104395:	c1 e0 02             	shl    $0x2,%eax
+  104398:	01 c8                	add    %ecx,%eax
+  10439a:	83 c0 10             	add    $0x10,%eax
+  10439d:	8b 00                	mov    (%eax),%eax
+  10439f:	85 c0                	test   %eax,%eax
+  1043a1:	74 19                	je     1043bc <selftest_run+0x6e>
+			selftests[i].func();
+  1043a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1043a6:	8d 8b d0 20 00 00    	lea    0x20d0(%ebx),%ecx
+  1043ac:	89 d0                	mov    %edx,%eax
+  1043ae:	c1 e0 02             	shl    $0x2,%eax
+  1043b1:	01 d0                	add    %edx,%eax
+  1043b3:	c1 e0 02             	shl    $0x2,%eax
+  1043b6:	01 c8                	add    %ecx,%eax
+  1043b8:	8b 00                	mov    (%eax),%eax
+  1043ba:	ff d0                	call   *%eax
+	for (i = 0; i < NSELFTESTS; i++)
+  1043bc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  1043c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1043c3:	83 f8 04             	cmp    $0x4,%eax
+  1043c6:	76 a1                	jbe    104369 <selftest_run+0x1b>
+}
+  1043c8:	90                   	nop
+  1043c9:	90                   	nop
+  1043ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1043cd:	c9                   	leave
+  1043ce:	c3                   	ret
+
+001043cf <multiboot_options>:
+
+// Apply the options we recognize on the kernel command line:
+//	selftest=<spec>		choose self-tests, as for selftest_select()
+static void
+multiboot_options(char *cmd)
+{
+  1043cf:	55                   	push   %ebp
+  1043d0:	89 e5                	mov    %esp,%ebp
+  1043d2:	53                   	push   %ebx
+  1043d3:	83 ec 14             	sub    $0x14,%esp
+  1043d6:	e8 39 c0 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1043db:	81 c3 19 9c 00 00    	add    $0x9c19,%ebx
+	while (*cmd) {
+  1043e1:	eb 73                	jmp    104456 <multiboot_options+0x87>
+		while (*cmd == ' ')
+			cmd++;
+  1043e3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+		while (*cmd == ' ')
+  1043e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1043ea:	0f b6 00             	movzbl (%eax),%eax
+  1043ed:	3c 20                	cmp    $0x20,%al
+  1043ef:	74 f2                	je     1043e3 <multiboot_options+0x14>
+		char *word = cmd;
+  1043f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  1043f4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		while (*cmd && *cmd != ' ')
+  1043f7:	eb 04                	jmp    1043fd <multiboot_options+0x2e>
+			cmd++;
+  1043f9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+		while (*cmd && *cmd != ' ')
+  1043fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  104400:	0f b6 00             	movzbl (%eax),%eax
+  104403:	84 c0                	test   %al,%al
+  104405:	74 0a                	je     104411 <multiboot_options+0x42>
+  104407:	8b 45 08             	mov    0x8(%ebp),%eax
+  10440a:	0f b6 00             	movzbl (%eax),%eax
+  10440d:	3c 20                	cmp    $0x20,%al
+  10440f:	75 e8                	jne    1043f9 <multiboot_options+0x2a>
+
+		char save = *cmd;
+  104411:	8b 45 08             	mov    0x8(%ebp),%eax
+  104414:	0f b6 00             	movzbl (%eax),%eax
+  104417:	88 45 f3             	mov    %al,-0xd(%ebp)
+		*cmd = 0;
+  10441a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10441d:	c6 00 00             	movb   $0x0,(%eax)
+		if (strncmp(word, "selftest=", 9) == 0)
+  104420:	83 ec 04             	sub    $0x4,%esp
+  104423:	6a 09                	push   $0x9
+  104425:	8d 83 60 bd ff ff    	lea    -0x42a0(%ebx),%eax
+  10442b:	50                   	push   %eax
+  10442c:	ff 75 f4             	push   -0xc(%ebp)
+  10442f:	e8 a4 39 00 00       	call   107dd8 <strncmp>
+  104434:	83 c4 10             	add    $0x10,%esp
+  104437:	85 c0                	test   %eax,%eax
+  104439:	75 12                	jne    10444d <multiboot_options+0x7e>
+			selftest_select(word + 9);
+  10443b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10443e:	83 c0 09             	add    $0x9,%eax
+  104441:	83 ec 0c             	sub    $0xc,%esp
+  104444:	50                   	push   %eax
+  104445:	e8 2c fd ff ff       	call   104176 <selftest_select>
+  10444a:	83 c4 10             	add    $0x10,%esp
+		*cmd = save;
+  10444d:	8b 45 08             	mov    0x8(%ebp),%eax
+  104450:	0f b6 55 f3          	movzbl -0xd(%ebp),%edx
+  104454:	88 10                	mov    %dl,(%eax)
+	while (*cmd) {
+  104456:	8b 45 08             	mov    0x8(%ebp),%eax
+  104459:	0f b6 00             	movzbl (%eax),%eax
+  10445c:	84 c0                	test   %al,%al
+  10445e:	75 87                	jne    1043e7 <multiboot_options+0x18>
+	}
+}
+  104460:	90                   	nop
+  104461:	90                   	nop
+  104462:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  104465:	c9                   	leave
+  104466:	c3                   	ret
+
+00104467 <multiboot_init>:
+
+void
+multiboot_init(void)
+{
+  104467:	55                   	push   %ebp
+  104468:	89 e5                	mov    %esp,%ebp
+  10446a:	57                   	push   %edi
+  10446b:	56                   	push   %esi
+  10446c:	53                   	push   %ebx
+  10446d:	83 ec 7c             	sub    $0x7c,%esp
+  104470:	e8 59 c9 ff ff       	call   100dce <__x86.get_pc_thunk.si>
+  104475:	81 c6 7f 9b 00 00    	add    $0x9b7f,%esi
+	if (multiboot_magic != MULTIBOOT_BOOTLOADER_MAGIC)
+  10447b:	c7 c0 00 e0 10 00    	mov    $0x10e000,%eax
+  104481:	8b 00                	mov    (%eax),%eax
+  104483:	3d 02 b0 ad 2b       	cmp    $0x2badb002,%eax
+  104488:	0f 85 fc 02 00 00    	jne    10478a <multiboot_init+0x323>
+		return;		// loaded by boot/main.c
+	multiboot = 1;
+  10448e:	c7 86 ec 89 02 00 01 	movl   $0x1,0x289ec(%esi)
+  104495:	00 00 00 
+
+	const multiboot_info *mbi = mem_ptr(multiboot_infopa);
+  104498:	c7 c0 04 e0 10 00    	mov    $0x10e004,%eax
+  10449e:	8b 00                	mov    (%eax),%eax
+  1044a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+	if (mbi->flags & MULTIBOOT_INFO_CMDLINE)
+  1044a3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1044a6:	8b 00                	mov    (%eax),%eax
+  1044a8:	83 e0 04             	and    $0x4,%eax
+  1044ab:	85 c0                	test   %eax,%eax
+  1044ad:	74 20                	je     1044cf <multiboot_init+0x68>
+		strlcpy(multiboot_cmdline, mem_ptr(mbi->cmdline),
+  1044af:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1044b2:	8b 40 10             	mov    0x10(%eax),%eax
+  1044b5:	83 ec 04             	sub    $0x4,%esp
+  1044b8:	68 00 01 00 00       	push   $0x100
+  1044bd:	50                   	push   %eax
+  1044be:	8d 86 0c 8a 02 00    	lea    0x28a0c(%esi),%eax
+  1044c4:	50                   	push   %eax
+  1044c5:	89 f3                	mov    %esi,%ebx
+  1044c7:	e8 6c 38 00 00       	call   107d38 <strlcpy>
+  1044cc:	83 c4 10             	add    $0x10,%esp
+			sizeof(multiboot_cmdline));
+
+	if (mbi->flags & MULTIBOOT_INFO_MODS) {
+  1044cf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1044d2:	8b 00                	mov    (%eax),%eax
+  1044d4:	83 e0 08             	and    $0x8,%eax
+  1044d7:	85 c0                	test   %eax,%eax
+  1044d9:	0f 84 ba 00 00 00    	je     104599 <multiboot_init+0x132>
+		const multiboot_mod *mod = mem_ptr(mbi->mods_addr);
+  1044df:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1044e2:	8b 40 18             	mov    0x18(%eax),%eax
+  1044e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		int i;
+		for (i = 0; i < mbi->mods_count; i++, mod++) {
+  1044e8:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  1044ef:	e9 94 00 00 00       	jmp    104588 <multiboot_init+0x121>
+			if (multiboot_nmods == MULTIBOOT_MAXMODS) {
+  1044f4:	8b 86 0c 8b 02 00    	mov    0x28b0c(%esi),%eax
+  1044fa:	83 f8 08             	cmp    $0x8,%eax
+  1044fd:	75 1e                	jne    10451d <multiboot_init+0xb6>
+				warn("multiboot: ignoring modules past %d",
+  1044ff:	6a 08                	push   $0x8
+  104501:	8d 86 6c bd ff ff    	lea    -0x4294(%esi),%eax
+  104507:	50                   	push   %eax
+  104508:	6a 49                	push   $0x49
+  10450a:	8d 86 90 bd ff ff    	lea    -0x4270(%esi),%eax
+  104510:	50                   	push   %eax
+  104511:	89 f3                	mov    %esi,%ebx
+  104513:	e8 b8 c9 ff ff       	call   100ed0 <debug_warn>
+  104518:	83 c4 10             	add    $0x10,%esp
+					MULTIBOOT_MAXMODS);
+				break;
+  10451b:	eb 7c                	jmp    104599 <multiboot_init+0x132>
+			}
+			multiboot_module *m = &multiboot_mods[multiboot_nmods++];
+  10451d:	8b 96 0c 8b 02 00    	mov    0x28b0c(%esi),%edx
+  104523:	8d 42 01             	lea    0x1(%edx),%eax
+  104526:	89 86 0c 8b 02 00    	mov    %eax,0x28b0c(%esi)
+  10452c:	89 d0                	mov    %edx,%eax
+  10452e:	c1 e0 03             	shl    $0x3,%eax
+  104531:	01 d0                	add    %edx,%eax
+  104533:	c1 e0 03             	shl    $0x3,%eax
+  104536:	8d 96 2c 8b 02 00    	lea    0x28b2c(%esi),%edx
+  10453c:	01 d0                	add    %edx,%eax
+  10453e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+			m->start = mod->mod_start;
+  104541:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104544:	8b 10                	mov    (%eax),%edx
+  104546:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  104549:	89 10                	mov    %edx,(%eax)
+			m->end = mod->mod_end;
+  10454b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10454e:	8b 50 04             	mov    0x4(%eax),%edx
+  104551:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  104554:	89 50 04             	mov    %edx,0x4(%eax)
+			if (mod->string)
+  104557:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10455a:	8b 40 08             	mov    0x8(%eax),%eax
+  10455d:	85 c0                	test   %eax,%eax
+  10455f:	74 1f                	je     104580 <multiboot_init+0x119>
+				strlcpy(m->name, mem_ptr(mod->string),
+  104561:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104564:	8b 40 08             	mov    0x8(%eax),%eax
+  104567:	89 c2                	mov    %eax,%edx
+  104569:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  10456c:	83 c0 08             	add    $0x8,%eax
+  10456f:	83 ec 04             	sub    $0x4,%esp
+  104572:	6a 40                	push   $0x40
+  104574:	52                   	push   %edx
+  104575:	50                   	push   %eax
+  104576:	89 f3                	mov    %esi,%ebx
+  104578:	e8 bb 37 00 00       	call   107d38 <strlcpy>
+  10457d:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < mbi->mods_count; i++, mod++) {
+  104580:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  104584:	83 45 e4 10          	addl   $0x10,-0x1c(%ebp)
+  104588:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  10458b:	8b 40 14             	mov    0x14(%eax),%eax
+  10458e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  104591:	39 c2                	cmp    %eax,%edx
+  104593:	0f 82 5b ff ff ff    	jb     1044f4 <multiboot_init+0x8d>
+		}
+	}
+
+	// Keep the available regions in the low 4GB, shrunk to whole pages,
+	// less the top page so that their ends fit in 32 bits.
+	if (mbi->flags & MULTIBOOT_INFO_MEM_MAP) {
+  104599:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  10459c:	8b 00                	mov    (%eax),%eax
+  10459e:	83 e0 40             	and    $0x40,%eax
+  1045a1:	85 c0                	test   %eax,%eax
+  1045a3:	0f 84 a7 01 00 00    	je     104750 <multiboot_init+0x2e9>
+		const uint64_t top = 0x100000000ULL - PAGESIZE;
+  1045a9:	c7 45 c8 00 f0 ff ff 	movl   $0xfffff000,-0x38(%ebp)
+  1045b0:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+		uint32_t pa = mbi->mmap_addr;
+  1045b7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1045ba:	8b 40 30             	mov    0x30(%eax),%eax
+  1045bd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		while (pa < mbi->mmap_addr + mbi->mmap_length) {
+  1045c0:	e9 74 01 00 00       	jmp    104739 <multiboot_init+0x2d2>
+			const multiboot_mmap *mm = mem_ptr(pa);
+  1045c5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  1045c8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+			pa += mm->size + sizeof(mm->size);
+  1045cb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  1045ce:	8b 10                	mov    (%eax),%edx
+  1045d0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  1045d3:	01 d0                	add    %edx,%eax
+  1045d5:	83 c0 04             	add    $0x4,%eax
+  1045d8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+
+			if (mm->type != MULTIBOOT_MEMORY_AVAILABLE
+  1045db:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  1045de:	8b 40 14             	mov    0x14(%eax),%eax
+  1045e1:	83 f8 01             	cmp    $0x1,%eax
+  1045e4:	0f 85 4b 01 00 00    	jne    104735 <multiboot_init+0x2ce>
+					|| mm->addr >= top)
+  1045ea:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  1045ed:	8b 50 08             	mov    0x8(%eax),%edx
+  1045f0:	8b 40 04             	mov    0x4(%eax),%eax
+  1045f3:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+  1045f6:	89 d0                	mov    %edx,%eax
+  1045f8:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+  1045fb:	0f 83 34 01 00 00    	jae    104735 <multiboot_init+0x2ce>
+				continue;
+			uint64_t end = MIN(mm->addr + mm->len, top);
+  104601:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  104604:	8b 48 04             	mov    0x4(%eax),%ecx
+  104607:	8b 58 08             	mov    0x8(%eax),%ebx
+  10460a:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  10460d:	8b 50 10             	mov    0x10(%eax),%edx
+  104610:	8b 40 0c             	mov    0xc(%eax),%eax
+  104613:	01 c8                	add    %ecx,%eax
+  104615:	11 da                	adc    %ebx,%edx
+  104617:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  10461a:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  10461d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  104620:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  104623:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  104626:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  104629:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+  10462c:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+  10462f:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  104632:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  104635:	39 c8                	cmp    %ecx,%eax
+  104637:	89 d7                	mov    %edx,%edi
+  104639:	19 df                	sbb    %ebx,%edi
+  10463b:	89 c7                	mov    %eax,%edi
+  10463d:	0f 43 f9             	cmovae %ecx,%edi
+  104640:	89 7d 80             	mov    %edi,-0x80(%ebp)
+  104643:	89 d0                	mov    %edx,%eax
+  104645:	0f 43 c3             	cmovae %ebx,%eax
+  104648:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  10464b:	8b 45 80             	mov    -0x80(%ebp),%eax
+  10464e:	8b 55 84             	mov    -0x7c(%ebp),%edx
+  104651:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  104654:	89 55 ac             	mov    %edx,-0x54(%ebp)
+			uint64_t lo = ROUNDUP(mm->addr, PAGESIZE);
+  104657:	c7 45 a4 00 10 00 00 	movl   $0x1000,-0x5c(%ebp)
+  10465e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  104661:	8b 50 08             	mov    0x8(%eax),%edx
+  104664:	8b 40 04             	mov    0x4(%eax),%eax
+  104667:	89 c2                	mov    %eax,%edx
+  104669:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  10466c:	01 d0                	add    %edx,%eax
+  10466e:	83 e8 01             	sub    $0x1,%eax
+  104671:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  104674:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  104677:	ba 00 00 00 00       	mov    $0x0,%edx
+  10467c:	f7 75 a4             	divl   -0x5c(%ebp)
+  10467f:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  104682:	29 d0                	sub    %edx,%eax
+  104684:	ba 00 00 00 00       	mov    $0x0,%edx
+  104689:	89 45 98             	mov    %eax,-0x68(%ebp)
+  10468c:	89 55 9c             	mov    %edx,-0x64(%ebp)
+			uint64_t hi = ROUNDDOWN(end, PAGESIZE);
+  10468f:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  104692:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  104695:	8b 45 94             	mov    -0x6c(%ebp),%eax
+  104698:	ba 00 00 00 00       	mov    $0x0,%edx
+  10469d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  1046a2:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+  1046a8:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  1046af:	00 00 00 
+  1046b2:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+  1046b8:	8b 95 7c ff ff ff    	mov    -0x84(%ebp),%edx
+  1046be:	89 45 88             	mov    %eax,-0x78(%ebp)
+  1046c1:	89 55 8c             	mov    %edx,-0x74(%ebp)
+			if (lo >= hi)
+  1046c4:	8b 45 98             	mov    -0x68(%ebp),%eax
+  1046c7:	8b 55 9c             	mov    -0x64(%ebp),%edx
+  1046ca:	3b 45 88             	cmp    -0x78(%ebp),%eax
+  1046cd:	89 d0                	mov    %edx,%eax
+  1046cf:	1b 45 8c             	sbb    -0x74(%ebp),%eax
+  1046d2:	73 64                	jae    104738 <multiboot_init+0x2d1>
+				continue;
+			if (multiboot_nregions == MULTIBOOT_MAXREGIONS) {
+  1046d4:	8b 86 6c 8d 02 00    	mov    0x28d6c(%esi),%eax
+  1046da:	83 f8 10             	cmp    $0x10,%eax
+  1046dd:	75 25                	jne    104704 <multiboot_init+0x29d>
+				warn("multiboot: ignoring memory past %llx", lo);
+  1046df:	83 ec 0c             	sub    $0xc,%esp
+  1046e2:	ff 75 9c             	push   -0x64(%ebp)
+  1046e5:	ff 75 98             	push   -0x68(%ebp)
+  1046e8:	8d 86 a4 bd ff ff    	lea    -0x425c(%esi),%eax
+  1046ee:	50                   	push   %eax
+  1046ef:	6a 68                	push   $0x68
+  1046f1:	8d 86 90 bd ff ff    	lea    -0x4270(%esi),%eax
+  1046f7:	50                   	push   %eax
+  1046f8:	89 f3                	mov    %esi,%ebx
+  1046fa:	e8 d1 c7 ff ff       	call   100ed0 <debug_warn>
+  1046ff:	83 c4 20             	add    $0x20,%esp
+				break;
+  104702:	eb 4c                	jmp    104750 <multiboot_init+0x2e9>
+			}
+			multiboot_regions[multiboot_nregions].start = lo;
+  104704:	8b 86 6c 8d 02 00    	mov    0x28d6c(%esi),%eax
+  10470a:	8b 55 98             	mov    -0x68(%ebp),%edx
+  10470d:	89 94 c6 8c 8d 02 00 	mov    %edx,0x28d8c(%esi,%eax,8)
+			multiboot_regions[multiboot_nregions].end = hi;
+  104714:	8b 86 6c 8d 02 00    	mov    0x28d6c(%esi),%eax
+  10471a:	8b 55 88             	mov    -0x78(%ebp),%edx
+  10471d:	89 94 c6 90 8d 02 00 	mov    %edx,0x28d90(%esi,%eax,8)
+			multiboot_nregions++;
+  104724:	8b 86 6c 8d 02 00    	mov    0x28d6c(%esi),%eax
+  10472a:	83 c0 01             	add    $0x1,%eax
+  10472d:	89 86 6c 8d 02 00    	mov    %eax,0x28d6c(%esi)
+  104733:	eb 04                	jmp    104739 <multiboot_init+0x2d2>
+				continue;
+  104735:	90                   	nop
+  104736:	eb 01                	jmp    104739 <multiboot_init+0x2d2>
+				continue;
+  104738:	90                   	nop
+		while (pa < mbi->mmap_addr + mbi->mmap_length) {
+  104739:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  10473c:	8b 50 30             	mov    0x30(%eax),%edx
+  10473f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  104742:	8b 40 2c             	mov    0x2c(%eax),%eax
+  104745:	01 d0                	add    %edx,%eax
+  104747:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  10474a:	0f 82 75 fe ff ff    	jb     1045c5 <multiboot_init+0x15e>
+		}
+	}
+
+	cprintf("multiboot: command line '%s', %d module(s), "
+  104750:	8b 96 6c 8d 02 00    	mov    0x28d6c(%esi),%edx
+  104756:	8b 86 0c 8b 02 00    	mov    0x28b0c(%esi),%eax
+  10475c:	52                   	push   %edx
+  10475d:	50                   	push   %eax
+  10475e:	8d 86 0c 8a 02 00    	lea    0x28a0c(%esi),%eax
+  104764:	50                   	push   %eax
+  104765:	8d 86 cc bd ff ff    	lea    -0x4234(%esi),%eax
+  10476b:	50                   	push   %eax
+  10476c:	89 f3                	mov    %esi,%ebx
+  10476e:	e8 a2 34 00 00       	call   107c15 <cprintf>
+  104773:	83 c4 10             	add    $0x10,%esp
+		"%d memory region(s)\n", multiboot_cmdline,
+		multiboot_nmods, multiboot_nregions);
+	multiboot_options(multiboot_cmdline);
+  104776:	83 ec 0c             	sub    $0xc,%esp
+  104779:	8d 86 0c 8a 02 00    	lea    0x28a0c(%esi),%eax
+  10477f:	50                   	push   %eax
+  104780:	e8 4a fc ff ff       	call   1043cf <multiboot_options>
+  104785:	83 c4 10             	add    $0x10,%esp
+  104788:	eb 01                	jmp    10478b <multiboot_init+0x324>
+		return;		// loaded by boot/main.c
+  10478a:	90                   	nop
+}
+  10478b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10478e:	5b                   	pop    %ebx
+  10478f:	5e                   	pop    %esi
+  104790:	5f                   	pop    %edi
+  104791:	5d                   	pop    %ebp
+  104792:	c3                   	ret
+
+00104793 <multiboot_avail>:
+
+bool
+multiboot_avail(uint32_t pa, uint32_t size)
+{
+  104793:	55                   	push   %ebp
+  104794:	89 e5                	mov    %esp,%ebp
+  104796:	83 ec 10             	sub    $0x10,%esp
+  104799:	e8 72 bc ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10479e:	05 56 98 00 00       	add    $0x9856,%eax
+	int i;
+
+	if (multiboot_nregions == 0)
+  1047a3:	8b 90 6c 8d 02 00    	mov    0x28d6c(%eax),%edx
+  1047a9:	85 d2                	test   %edx,%edx
+  1047ab:	75 07                	jne    1047b4 <multiboot_avail+0x21>
+		return 1;
+  1047ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  1047b2:	eb 49                	jmp    1047fd <multiboot_avail+0x6a>
+	for (i = 0; i < multiboot_nregions; i++)
+  1047b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  1047bb:	eb 30                	jmp    1047ed <multiboot_avail+0x5a>
+		if (pa >= multiboot_regions[i].start
+  1047bd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1047c0:	8b 94 d0 8c 8d 02 00 	mov    0x28d8c(%eax,%edx,8),%edx
+  1047c7:	39 55 08             	cmp    %edx,0x8(%ebp)
+  1047ca:	72 1d                	jb     1047e9 <multiboot_avail+0x56>
+				&& pa + size <= multiboot_regions[i].end)
+  1047cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  1047cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1047d2:	01 d1                	add    %edx,%ecx
+  1047d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1047d7:	8b 94 d0 90 8d 02 00 	mov    0x28d90(%eax,%edx,8),%edx
+  1047de:	39 ca                	cmp    %ecx,%edx
+  1047e0:	72 07                	jb     1047e9 <multiboot_avail+0x56>
+			return 1;
+  1047e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  1047e7:	eb 14                	jmp    1047fd <multiboot_avail+0x6a>
+	for (i = 0; i < multiboot_nregions; i++)
+  1047e9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  1047ed:	8b 90 6c 8d 02 00    	mov    0x28d6c(%eax),%edx
+  1047f3:	39 55 fc             	cmp    %edx,-0x4(%ebp)
+  1047f6:	7c c5                	jl     1047bd <multiboot_avail+0x2a>
+	return 0;
+  1047f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  1047fd:	c9                   	leave
+  1047fe:	c3                   	ret
+
+001047ff <multiboot_end>:
+
+uint32_t
+multiboot_end(void)
+{
+  1047ff:	55                   	push   %ebp
+  104800:	89 e5                	mov    %esp,%ebp
+  104802:	53                   	push   %ebx
+  104803:	83 ec 10             	sub    $0x10,%esp
+  104806:	e8 63 00 00 00       	call   10486e <__x86.get_pc_thunk.dx>
+  10480b:	81 c2 e9 97 00 00    	add    $0x97e9,%edx
+	uint32_t end = 0;
+  104811:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+	int i;
+
+	for (i = 0; i < multiboot_nmods; i++)
+  104818:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  10481f:	eb 3a                	jmp    10485b <multiboot_end+0x5c>
+		if (multiboot_mods[i].end > end)
+  104821:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  104824:	8d 9a 30 8b 02 00    	lea    0x28b30(%edx),%ebx
+  10482a:	89 c8                	mov    %ecx,%eax
+  10482c:	c1 e0 03             	shl    $0x3,%eax
+  10482f:	01 c8                	add    %ecx,%eax
+  104831:	c1 e0 03             	shl    $0x3,%eax
+  104834:	01 d8                	add    %ebx,%eax
+  104836:	8b 00                	mov    (%eax),%eax
+  104838:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+  10483b:	73 1a                	jae    104857 <multiboot_end+0x58>
+			end = multiboot_mods[i].end;
+  10483d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  104840:	8d 9a 30 8b 02 00    	lea    0x28b30(%edx),%ebx
+  104846:	89 c8                	mov    %ecx,%eax
+  104848:	c1 e0 03             	shl    $0x3,%eax
+  10484b:	01 c8                	add    %ecx,%eax
+  10484d:	c1 e0 03             	shl    $0x3,%eax
+  104850:	01 d8                	add    %ebx,%eax
+  104852:	8b 00                	mov    (%eax),%eax
+  104854:	89 45 f8             	mov    %eax,-0x8(%ebp)
+	for (i = 0; i < multiboot_nmods; i++)
+  104857:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  10485b:	8b 82 0c 8b 02 00    	mov    0x28b0c(%edx),%eax
+  104861:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  104864:	7c bb                	jl     104821 <multiboot_end+0x22>
+	return end;
+  104866:	8b 45 f8             	mov    -0x8(%ebp),%eax
+}
+  104869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10486c:	c9                   	leave
+  10486d:	c3                   	ret
+
+0010486e <__x86.get_pc_thunk.dx>:
+  10486e:	8b 14 24             	mov    (%esp),%edx
+  104871:	c3                   	ret
+
+00104872 <cpu_cur>:
+	int i;
+	for (i = 0; i < NPDENTRIES; i++)
+		pdir[i] = pmap_bootpdir[i] & ~PTE_U;
+	memset(&pdir[PDX(VM_USERLO)], 0,
+		(PDX(VM_USERHI) - PDX(VM_USERLO)) * sizeof(pde_t));
+
+  104872:	55                   	push   %ebp
+  104873:	89 e5                	mov    %esp,%ebp
+  104875:	53                   	push   %ebx
+  104876:	83 ec 14             	sub    $0x14,%esp
+  104879:	e8 92 bb ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10487e:	05 76 97 00 00       	add    $0x9776,%eax
+        __asm __volatile("movl %%esp,%0" : "=rm" (esp));
+  104883:	89 e2                	mov    %esp,%edx
+  104885:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return esp;
+  104888:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	cpu *c = (cpu*)ROUNDDOWN(read_esp(), PAGESIZE);
+  10488b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  10488e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  104891:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  104897:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	assert(c->magic == CPU_MAGIC);
+  10489a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  10489d:	8b 92 b0 00 00 00    	mov    0xb0(%edx),%edx
+  1048a3:	81 fa 32 54 76 98    	cmp    $0x98765432,%edx
+  1048a9:	74 1e                	je     1048c9 <cpu_cur+0x57>
+  1048ab:	8d 90 10 be ff ff    	lea    -0x41f0(%eax),%edx
+  1048b1:	52                   	push   %edx
+  1048b2:	8d 90 26 be ff ff    	lea    -0x41da(%eax),%edx
+  1048b8:	52                   	push   %edx
+  1048b9:	6a 65                	push   $0x65
+  1048bb:	8d 90 3b be ff ff    	lea    -0x41c5(%eax),%edx
+  1048c1:	52                   	push   %edx
+  1048c2:	89 c3                	mov    %eax,%ebx
+  1048c4:	e8 09 c5 ff ff       	call   100dd2 <debug_panic>
+	return c;
+  1048c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  1048cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1048cf:	c9                   	leave
+  1048d0:	c3                   	ret
+
+001048d1 <cpu_onboot>:
+cpu_onboot() {
+  1048d1:	55                   	push   %ebp
+  1048d2:	89 e5                	mov    %esp,%ebp
+  1048d4:	53                   	push   %ebx
+  1048d5:	83 ec 04             	sub    $0x4,%esp
+  1048d8:	e8 37 bb ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1048dd:	81 c3 17 97 00 00    	add    $0x9717,%ebx
+	return cpu_cur() == &cpu_boot;
+  1048e3:	e8 8a ff ff ff       	call   104872 <cpu_cur>
+  1048e8:	c7 c2 00 f0 10 00    	mov    $0x10f000,%edx
+  1048ee:	39 d0                	cmp    %edx,%eax
+  1048f0:	0f 94 c0             	sete   %al
+  1048f3:	0f b6 c0             	movzbl %al,%eax
+}
+  1048f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1048f9:	c9                   	leave
+  1048fa:	c3                   	ret
+
+001048fb <pmap_init>:
+{
+  1048fb:	55                   	push   %ebp
+  1048fc:	89 e5                	mov    %esp,%ebp
+  1048fe:	53                   	push   %ebx
+  1048ff:	83 ec 34             	sub    $0x34,%esp
+  104902:	e8 0d bb ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104907:	81 c3 ed 96 00 00    	add    $0x96ed,%ebx
+	if (cpu_onboot()) {
+  10490d:	e8 bf ff ff ff       	call   1048d1 <cpu_onboot>
+  104912:	85 c0                	test   %eax,%eax
+  104914:	0f 84 9b 00 00 00    	je     1049b5 <pmap_init+0xba>
+		uint32_t userend = ROUNDUP(mem_phys(end), PTSIZE);
+  10491a:	c7 45 f0 00 00 40 00 	movl   $0x400000,-0x10(%ebp)
+  104921:	c7 c0 a0 20 14 00    	mov    $0x1420a0,%eax
+  104927:	8d 50 ff             	lea    -0x1(%eax),%edx
+  10492a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  10492d:	01 d0                	add    %edx,%eax
+  10492f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  104932:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104935:	ba 00 00 00 00       	mov    $0x0,%edx
+  10493a:	f7 75 f0             	divl   -0x10(%ebp)
+  10493d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104940:	29 d0                	sub    %edx,%eax
+  104942:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		for (i = 0; i < NPDENTRIES; i++) {
+  104945:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  10494c:	eb 5e                	jmp    1049ac <pmap_init+0xb1>
+			uint32_t va = (uint32_t) i << PDXSHIFT;
+  10494e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104951:	c1 e0 16             	shl    $0x16,%eax
+  104954:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			if (va >= VM_USERLO && va < VM_USERHI)
+  104957:	81 7d e4 ff ff ff 3f 	cmpl   $0x3fffffff,-0x1c(%ebp)
+  10495e:	76 19                	jbe    104979 <pmap_init+0x7e>
+  104960:	81 7d e4 ff ff ff ef 	cmpl   $0xefffffff,-0x1c(%ebp)
+  104967:	77 10                	ja     104979 <pmap_init+0x7e>
+				pmap_bootpdir[i] = 0;
+  104969:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10496c:	c7 84 83 0c 90 02 00 	movl   $0x0,0x2900c(%ebx,%eax,4)
+  104973:	00 00 00 00 
+  104977:	eb 2f                	jmp    1049a8 <pmap_init+0xad>
+			else if (va < userend)
+  104979:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10497c:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+  10497f:	73 13                	jae    104994 <pmap_init+0x99>
+						| PTE_PS;
+  104981:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104984:	0c 87                	or     $0x87,%al
+  104986:	89 c2                	mov    %eax,%edx
+				pmap_bootpdir[i] = va | PTE_P | PTE_W | PTE_U
+  104988:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10498b:	89 94 83 0c 90 02 00 	mov    %edx,0x2900c(%ebx,%eax,4)
+  104992:	eb 14                	jmp    1049a8 <pmap_init+0xad>
+						| PTE_G;
+  104994:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104997:	0d 83 01 00 00       	or     $0x183,%eax
+  10499c:	89 c2                	mov    %eax,%edx
+				pmap_bootpdir[i] = va | PTE_P | PTE_W | PTE_PS
+  10499e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1049a1:	89 94 83 0c 90 02 00 	mov    %edx,0x2900c(%ebx,%eax,4)
+		for (i = 0; i < NPDENTRIES; i++) {
+  1049a8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  1049ac:	81 7d f4 ff 03 00 00 	cmpl   $0x3ff,-0xc(%ebp)
+  1049b3:	7e 99                	jle    10494e <pmap_init+0x53>
+	__asm __volatile("movl %%cr4,%0" : "=r" (cr4));
+  1049b5:	0f 20 e0             	mov    %cr4,%eax
+  1049b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	return cr4;
+  1049bb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+	lcr4(rcr4() | CR4_PSE | CR4_PGE);
+  1049be:	0c 90                	or     $0x90,%al
+  1049c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	__asm __volatile("movl %0,%%cr4" : : "r" (val));
+  1049c3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1049c6:	0f 22 e0             	mov    %eax,%cr4
+}
+  1049c9:	90                   	nop
+	lcr3(mem_phys(pmap_bootpdir));
+  1049ca:	8d 83 0c 90 02 00    	lea    0x2900c(%ebx),%eax
+  1049d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+  1049d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1049d6:	0f 22 d8             	mov    %eax,%cr3
+}
+  1049d9:	90                   	nop
+	__asm __volatile("movl %%cr0,%0" : "=r" (val));
+  1049da:	0f 20 c0             	mov    %cr0,%eax
+  1049dd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	return val;
+  1049e0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+	lcr0(rcr0() | CR0_PE | CR0_PG | CR0_WP);
+  1049e3:	0d 01 00 01 80       	or     $0x80010001,%eax
+  1049e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	__asm __volatile("movl %0,%%cr0" : : "r" (val));
+  1049eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1049ee:	0f 22 c0             	mov    %eax,%cr0
+}
+  1049f1:	90                   	nop
+}
+  1049f2:	90                   	nop
+  1049f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1049f6:	c9                   	leave
+  1049f7:	c3                   	ret
+
+001049f8 <pmap_newpdir>:
+{
+  1049f8:	55                   	push   %ebp
+  1049f9:	89 e5                	mov    %esp,%ebp
+  1049fb:	53                   	push   %ebx
+  1049fc:	83 ec 14             	sub    $0x14,%esp
+  1049ff:	e8 10 ba ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104a04:	81 c3 f0 95 00 00    	add    $0x95f0,%ebx
+	pageinfo *pi = mem_alloc();
+  104a0a:	e8 28 cd ff ff       	call   101737 <mem_alloc>
+  104a0f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	if (pi == NULL)
+  104a12:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  104a16:	75 07                	jne    104a1f <pmap_newpdir+0x27>
+		return NULL;
+  104a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  104a1d:	eb 75                	jmp    104a94 <pmap_newpdir+0x9c>
+	mem_incref(pi);
+  104a1f:	83 ec 0c             	sub    $0xc,%esp
+  104a22:	ff 75 f0             	push   -0x10(%ebp)
+  104a25:	e8 75 cd ff ff       	call   10179f <mem_incref>
+  104a2a:	83 c4 10             	add    $0x10,%esp
+	pde_t *pdir = mem_pi2ptr(pi);
+  104a2d:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104a33:	8b 00                	mov    (%eax),%eax
+  104a35:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  104a38:	29 c2                	sub    %eax,%edx
+  104a3a:	89 d0                	mov    %edx,%eax
+  104a3c:	c1 e0 09             	shl    $0x9,%eax
+  104a3f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	for (i = 0; i < NPDENTRIES; i++)
+  104a42:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  104a49:	eb 22                	jmp    104a6d <pmap_newpdir+0x75>
+		pdir[i] = pmap_bootpdir[i] & ~PTE_U;
+  104a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104a4e:	8b 94 83 0c 90 02 00 	mov    0x2900c(%ebx,%eax,4),%edx
+  104a55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104a58:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+  104a5f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104a62:	01 c8                	add    %ecx,%eax
+  104a64:	83 e2 fb             	and    $0xfffffffb,%edx
+  104a67:	89 10                	mov    %edx,(%eax)
+	for (i = 0; i < NPDENTRIES; i++)
+  104a69:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  104a6d:	81 7d f4 ff 03 00 00 	cmpl   $0x3ff,-0xc(%ebp)
+  104a74:	7e d5                	jle    104a4b <pmap_newpdir+0x53>
+	memset(&pdir[PDX(VM_USERLO)], 0,
+  104a76:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104a79:	05 00 04 00 00       	add    $0x400,%eax
+  104a7e:	83 ec 04             	sub    $0x4,%esp
+  104a81:	68 00 0b 00 00       	push   $0xb00
+  104a86:	6a 00                	push   $0x0
+  104a88:	50                   	push   %eax
+  104a89:	e8 20 34 00 00       	call   107eae <memset>
+  104a8e:	83 c4 10             	add    $0x10,%esp
+	return pdir;
+  104a91:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+  104a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  104a97:	c9                   	leave
+  104a98:	c3                   	ret
+
+00104a99 <pmap_freepdir>:
+
+void
+pmap_freepdir(pde_t *pdir)
+{
+  104a99:	55                   	push   %ebp
+  104a9a:	89 e5                	mov    %esp,%ebp
+  104a9c:	53                   	push   %ebx
+  104a9d:	83 ec 04             	sub    $0x4,%esp
+  104aa0:	e8 6f b9 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104aa5:	81 c3 4f 95 00 00    	add    $0x954f,%ebx
+	pmap_remove(pdir, VM_USERLO, VM_USERHI - VM_USERLO);
+  104aab:	83 ec 04             	sub    $0x4,%esp
+  104aae:	68 00 00 00 b0       	push   $0xb0000000
+  104ab3:	68 00 00 00 40       	push   $0x40000000
+  104ab8:	ff 75 08             	push   0x8(%ebp)
+  104abb:	e8 0f 03 00 00       	call   104dcf <pmap_remove>
+  104ac0:	83 c4 10             	add    $0x10,%esp
+	mem_decref(mem_ptr2pi(pdir));
+  104ac3:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104ac9:	8b 00                	mov    (%eax),%eax
+  104acb:	8b 55 08             	mov    0x8(%ebp),%edx
+  104ace:	c1 ea 0c             	shr    $0xc,%edx
+  104ad1:	c1 e2 03             	shl    $0x3,%edx
+  104ad4:	01 d0                	add    %edx,%eax
+  104ad6:	83 ec 0c             	sub    $0xc,%esp
+  104ad9:	50                   	push   %eax
+  104ada:	e8 c0 cd ff ff       	call   10189f <mem_decref>
+  104adf:	83 c4 10             	add    $0x10,%esp
+}
+  104ae2:	90                   	nop
+  104ae3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  104ae6:	c9                   	leave
+  104ae7:	c3                   	ret
+
+00104ae8 <pmap_walk>:
+
+pte_t *
+pmap_walk(pde_t *pdir, uint32_t va, bool writing)
+{
+  104ae8:	55                   	push   %ebp
+  104ae9:	89 e5                	mov    %esp,%ebp
+  104aeb:	53                   	push   %ebx
+  104aec:	83 ec 14             	sub    $0x14,%esp
+  104aef:	e8 20 b9 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104af4:	81 c3 00 95 00 00    	add    $0x9500,%ebx
+	assert(va >= VM_USERLO && va < VM_USERHI);
+  104afa:	81 7d 0c ff ff ff 3f 	cmpl   $0x3fffffff,0xc(%ebp)
+  104b01:	76 09                	jbe    104b0c <pmap_walk+0x24>
+  104b03:	81 7d 0c ff ff ff ef 	cmpl   $0xefffffff,0xc(%ebp)
+  104b0a:	76 1c                	jbe    104b28 <pmap_walk+0x40>
+  104b0c:	8d 83 48 be ff ff    	lea    -0x41b8(%ebx),%eax
+  104b12:	50                   	push   %eax
+  104b13:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104b19:	50                   	push   %eax
+  104b1a:	6a 6f                	push   $0x6f
+  104b1c:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104b22:	50                   	push   %eax
+  104b23:	e8 aa c2 ff ff       	call   100dd2 <debug_panic>
+
+	pde_t *pde = &pdir[PDX(va)];
+  104b28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104b2b:	c1 e8 16             	shr    $0x16,%eax
+  104b2e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  104b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  104b38:	01 d0                	add    %edx,%eax
+  104b3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if (!(*pde & PTE_P)) {
+  104b3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104b40:	8b 00                	mov    (%eax),%eax
+  104b42:	83 e0 01             	and    $0x1,%eax
+  104b45:	85 c0                	test   %eax,%eax
+  104b47:	0f 85 9b 00 00 00    	jne    104be8 <pmap_walk+0x100>
+		if (!writing)
+  104b4d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  104b51:	75 0a                	jne    104b5d <pmap_walk+0x75>
+			return NULL;
+  104b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  104b58:	e9 af 00 00 00       	jmp    104c0c <pmap_walk+0x124>
+		assert(pdir != pmap_bootpdir);	// live on every CPU
+  104b5d:	8d 83 0c 90 02 00    	lea    0x2900c(%ebx),%eax
+  104b63:	39 45 08             	cmp    %eax,0x8(%ebp)
+  104b66:	75 1c                	jne    104b84 <pmap_walk+0x9c>
+  104b68:	8d 83 76 be ff ff    	lea    -0x418a(%ebx),%eax
+  104b6e:	50                   	push   %eax
+  104b6f:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104b75:	50                   	push   %eax
+  104b76:	6a 75                	push   $0x75
+  104b78:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104b7e:	50                   	push   %eax
+  104b7f:	e8 4e c2 ff ff       	call   100dd2 <debug_panic>
+		pageinfo *pi = mem_alloc();
+  104b84:	e8 ae cb ff ff       	call   101737 <mem_alloc>
+  104b89:	89 45 f0             	mov    %eax,-0x10(%ebp)
+		if (pi == NULL)
+  104b8c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  104b90:	75 07                	jne    104b99 <pmap_walk+0xb1>
+			return NULL;
+  104b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  104b97:	eb 73                	jmp    104c0c <pmap_walk+0x124>
+		mem_incref(pi);
+  104b99:	83 ec 0c             	sub    $0xc,%esp
+  104b9c:	ff 75 f0             	push   -0x10(%ebp)
+  104b9f:	e8 fb cb ff ff       	call   10179f <mem_incref>
+  104ba4:	83 c4 10             	add    $0x10,%esp
+		memset(mem_pi2ptr(pi), 0, PAGESIZE);
+  104ba7:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104bad:	8b 00                	mov    (%eax),%eax
+  104baf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  104bb2:	29 c2                	sub    %eax,%edx
+  104bb4:	89 d0                	mov    %edx,%eax
+  104bb6:	c1 e0 09             	shl    $0x9,%eax
+  104bb9:	83 ec 04             	sub    $0x4,%esp
+  104bbc:	68 00 10 00 00       	push   $0x1000
+  104bc1:	6a 00                	push   $0x0
+  104bc3:	50                   	push   %eax
+  104bc4:	e8 e5 32 00 00       	call   107eae <memset>
+  104bc9:	83 c4 10             	add    $0x10,%esp
+
+		// Permissions are up to the PTEs: allow everything here.
+		*pde = mem_pi2phys(pi) | PTE_P | PTE_W | PTE_U;
+  104bcc:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104bd2:	8b 00                	mov    (%eax),%eax
+  104bd4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  104bd7:	29 c2                	sub    %eax,%edx
+  104bd9:	89 d0                	mov    %edx,%eax
+  104bdb:	c1 e0 09             	shl    $0x9,%eax
+  104bde:	83 c8 07             	or     $0x7,%eax
+  104be1:	89 c2                	mov    %eax,%edx
+  104be3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104be6:	89 10                	mov    %edx,(%eax)
+	}
+
+	pte_t *pt = mem_ptr(PGADDR(*pde));
+  104be8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104beb:	8b 00                	mov    (%eax),%eax
+  104bed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  104bf2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	return &pt[PTX(va)];
+  104bf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104bf8:	c1 e8 0c             	shr    $0xc,%eax
+  104bfb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  104c00:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  104c07:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104c0a:	01 d0                	add    %edx,%eax
+}
+  104c0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  104c0f:	c9                   	leave
+  104c10:	c3                   	ret
+
+00104c11 <pmap_insert>:
+
+pte_t *
+pmap_insert(pde_t *pdir, pageinfo *pi, uint32_t va, int perm)
+{
+  104c11:	55                   	push   %ebp
+  104c12:	89 e5                	mov    %esp,%ebp
+  104c14:	53                   	push   %ebx
+  104c15:	83 ec 14             	sub    $0x14,%esp
+  104c18:	e8 f7 b7 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104c1d:	81 c3 d7 93 00 00    	add    $0x93d7,%ebx
+	pte_t *pte = pmap_walk(pdir, va, 1);
+  104c23:	83 ec 04             	sub    $0x4,%esp
+  104c26:	6a 01                	push   $0x1
+  104c28:	ff 75 10             	push   0x10(%ebp)
+  104c2b:	ff 75 08             	push   0x8(%ebp)
+  104c2e:	e8 b5 fe ff ff       	call   104ae8 <pmap_walk>
+  104c33:	83 c4 10             	add    $0x10,%esp
+  104c36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if (pte == NULL)
+  104c39:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  104c3d:	75 07                	jne    104c46 <pmap_insert+0x35>
+		return NULL;
+  104c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  104c44:	eb 52                	jmp    104c98 <pmap_insert+0x87>
+
+	// Take the new reference first, in case pi is already mapped here.
+	mem_incref(pi);
+  104c46:	83 ec 0c             	sub    $0xc,%esp
+  104c49:	ff 75 0c             	push   0xc(%ebp)
+  104c4c:	e8 4e cb ff ff       	call   10179f <mem_incref>
+  104c51:	83 c4 10             	add    $0x10,%esp
+	if (*pte & PTE_P)
+  104c54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104c57:	8b 00                	mov    (%eax),%eax
+  104c59:	83 e0 01             	and    $0x1,%eax
+  104c5c:	85 c0                	test   %eax,%eax
+  104c5e:	74 16                	je     104c76 <pmap_insert+0x65>
+		pmap_remove(pdir, va, PAGESIZE);
+  104c60:	83 ec 04             	sub    $0x4,%esp
+  104c63:	68 00 10 00 00       	push   $0x1000
+  104c68:	ff 75 10             	push   0x10(%ebp)
+  104c6b:	ff 75 08             	push   0x8(%ebp)
+  104c6e:	e8 5c 01 00 00       	call   104dcf <pmap_remove>
+  104c73:	83 c4 10             	add    $0x10,%esp
+
+	*pte = mem_pi2phys(pi) | perm | PTE_P;
+  104c76:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104c7c:	8b 00                	mov    (%eax),%eax
+  104c7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  104c81:	29 c2                	sub    %eax,%edx
+  104c83:	89 d0                	mov    %edx,%eax
+  104c85:	c1 e0 09             	shl    $0x9,%eax
+  104c88:	0b 45 14             	or     0x14(%ebp),%eax
+  104c8b:	83 c8 01             	or     $0x1,%eax
+  104c8e:	89 c2                	mov    %eax,%edx
+  104c90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104c93:	89 10                	mov    %edx,(%eax)
+	return pte;
+  104c95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  104c98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  104c9b:	c9                   	leave
+  104c9c:	c3                   	ret
+
+00104c9d <pmap_zerofill>:
+
+int
+pmap_zerofill(pde_t *pdir, uint32_t va, size_t size, int perm)
+{
+  104c9d:	55                   	push   %ebp
+  104c9e:	89 e5                	mov    %esp,%ebp
+  104ca0:	53                   	push   %ebx
+  104ca1:	83 ec 14             	sub    $0x14,%esp
+  104ca4:	e8 6b b7 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104ca9:	81 c3 4b 93 00 00    	add    $0x934b,%ebx
+	assert(PGOFF(va) == 0 && PGOFF(size) == 0);
+  104caf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104cb2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  104cb7:	85 c0                	test   %eax,%eax
+  104cb9:	75 0c                	jne    104cc7 <pmap_zerofill+0x2a>
+  104cbb:	8b 45 10             	mov    0x10(%ebp),%eax
+  104cbe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  104cc3:	85 c0                	test   %eax,%eax
+  104cc5:	74 1f                	je     104ce6 <pmap_zerofill+0x49>
+  104cc7:	8d 83 8c be ff ff    	lea    -0x4174(%ebx),%eax
+  104ccd:	50                   	push   %eax
+  104cce:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104cd4:	50                   	push   %eax
+  104cd5:	68 97 00 00 00       	push   $0x97
+  104cda:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104ce0:	50                   	push   %eax
+  104ce1:	e8 ec c0 ff ff       	call   100dd2 <debug_panic>
+	assert(va >= VM_USERLO && va < VM_USERHI);
+  104ce6:	81 7d 0c ff ff ff 3f 	cmpl   $0x3fffffff,0xc(%ebp)
+  104ced:	76 09                	jbe    104cf8 <pmap_zerofill+0x5b>
+  104cef:	81 7d 0c ff ff ff ef 	cmpl   $0xefffffff,0xc(%ebp)
+  104cf6:	76 1f                	jbe    104d17 <pmap_zerofill+0x7a>
+  104cf8:	8d 83 48 be ff ff    	lea    -0x41b8(%ebx),%eax
+  104cfe:	50                   	push   %eax
+  104cff:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104d05:	50                   	push   %eax
+  104d06:	68 98 00 00 00       	push   $0x98
+  104d0b:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104d11:	50                   	push   %eax
+  104d12:	e8 bb c0 ff ff       	call   100dd2 <debug_panic>
+	assert(size <= VM_USERHI - va);
+  104d17:	b8 00 00 00 f0       	mov    $0xf0000000,%eax
+  104d1c:	2b 45 0c             	sub    0xc(%ebp),%eax
+  104d1f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  104d22:	73 1f                	jae    104d43 <pmap_zerofill+0xa6>
+  104d24:	8d 83 af be ff ff    	lea    -0x4151(%ebx),%eax
+  104d2a:	50                   	push   %eax
+  104d2b:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104d31:	50                   	push   %eax
+  104d32:	68 99 00 00 00       	push   $0x99
+  104d37:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104d3d:	50                   	push   %eax
+  104d3e:	e8 8f c0 ff ff       	call   100dd2 <debug_panic>
+
+	pmap_remove(pdir, va, size);
+  104d43:	83 ec 04             	sub    $0x4,%esp
+  104d46:	ff 75 10             	push   0x10(%ebp)
+  104d49:	ff 75 0c             	push   0xc(%ebp)
+  104d4c:	ff 75 08             	push   0x8(%ebp)
+  104d4f:	e8 7b 00 00 00       	call   104dcf <pmap_remove>
+  104d54:	83 c4 10             	add    $0x10,%esp
+
+	// Writable zero-fill pages are copy-on-write copies of pmap_zero.
+	pte_t zpte = mem_phys(pmap_zero) | PTE_P | (perm & ~PTE_W);
+  104d57:	8b 45 14             	mov    0x14(%ebp),%eax
+  104d5a:	83 e0 fd             	and    $0xfffffffd,%eax
+  104d5d:	89 c2                	mov    %eax,%edx
+  104d5f:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  104d65:	83 c8 01             	or     $0x1,%eax
+  104d68:	09 d0                	or     %edx,%eax
+  104d6a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if (perm & PTE_W)
+  104d6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  104d70:	83 e0 02             	and    $0x2,%eax
+  104d73:	85 c0                	test   %eax,%eax
+  104d75:	74 07                	je     104d7e <pmap_zerofill+0xe1>
+		zpte |= PTE_COW;
+  104d77:	81 4d f4 00 02 00 00 	orl    $0x200,-0xc(%ebp)
+
+	uint32_t eva = va + size;
+  104d7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  104d81:	8b 45 10             	mov    0x10(%ebp),%eax
+  104d84:	01 d0                	add    %edx,%eax
+  104d86:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	for (; va < eva; va += PAGESIZE) {
+  104d89:	eb 32                	jmp    104dbd <pmap_zerofill+0x120>
+		pte_t *pte = pmap_walk(pdir, va, 1);
+  104d8b:	83 ec 04             	sub    $0x4,%esp
+  104d8e:	6a 01                	push   $0x1
+  104d90:	ff 75 0c             	push   0xc(%ebp)
+  104d93:	ff 75 08             	push   0x8(%ebp)
+  104d96:	e8 4d fd ff ff       	call   104ae8 <pmap_walk>
+  104d9b:	83 c4 10             	add    $0x10,%esp
+  104d9e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+		if (pte == NULL)
+  104da1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  104da5:	75 07                	jne    104dae <pmap_zerofill+0x111>
+			return 0;
+  104da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  104dac:	eb 1c                	jmp    104dca <pmap_zerofill+0x12d>
+		*pte = zpte;
+  104dae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104db1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  104db4:	89 10                	mov    %edx,(%eax)
+	for (; va < eva; va += PAGESIZE) {
+  104db6:	81 45 0c 00 10 00 00 	addl   $0x1000,0xc(%ebp)
+  104dbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104dc0:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  104dc3:	72 c6                	jb     104d8b <pmap_zerofill+0xee>
+	}
+	return 1;
+  104dc5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  104dca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  104dcd:	c9                   	leave
+  104dce:	c3                   	ret
+
+00104dcf <pmap_remove>:
+
+void
+pmap_remove(pde_t *pdir, uint32_t va, size_t size)
+{
+  104dcf:	55                   	push   %ebp
+  104dd0:	89 e5                	mov    %esp,%ebp
+  104dd2:	53                   	push   %ebx
+  104dd3:	83 ec 24             	sub    $0x24,%esp
+  104dd6:	e8 39 b6 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  104ddb:	81 c3 19 92 00 00    	add    $0x9219,%ebx
+	assert(PGOFF(size) == 0);	// must be page-aligned
+  104de1:	8b 45 10             	mov    0x10(%ebp),%eax
+  104de4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  104de9:	85 c0                	test   %eax,%eax
+  104deb:	74 1f                	je     104e0c <pmap_remove+0x3d>
+  104ded:	8d 83 c6 be ff ff    	lea    -0x413a(%ebx),%eax
+  104df3:	50                   	push   %eax
+  104df4:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104dfa:	50                   	push   %eax
+  104dfb:	68 af 00 00 00       	push   $0xaf
+  104e00:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104e06:	50                   	push   %eax
+  104e07:	e8 c6 bf ff ff       	call   100dd2 <debug_panic>
+	assert(va >= VM_USERLO && va < VM_USERHI);
+  104e0c:	81 7d 0c ff ff ff 3f 	cmpl   $0x3fffffff,0xc(%ebp)
+  104e13:	76 09                	jbe    104e1e <pmap_remove+0x4f>
+  104e15:	81 7d 0c ff ff ff ef 	cmpl   $0xefffffff,0xc(%ebp)
+  104e1c:	76 1f                	jbe    104e3d <pmap_remove+0x6e>
+  104e1e:	8d 83 48 be ff ff    	lea    -0x41b8(%ebx),%eax
+  104e24:	50                   	push   %eax
+  104e25:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104e2b:	50                   	push   %eax
+  104e2c:	68 b0 00 00 00       	push   $0xb0
+  104e31:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104e37:	50                   	push   %eax
+  104e38:	e8 95 bf ff ff       	call   100dd2 <debug_panic>
+	assert(size <= VM_USERHI - va);
+  104e3d:	b8 00 00 00 f0       	mov    $0xf0000000,%eax
+  104e42:	2b 45 0c             	sub    0xc(%ebp),%eax
+  104e45:	3b 45 10             	cmp    0x10(%ebp),%eax
+  104e48:	73 1f                	jae    104e69 <pmap_remove+0x9a>
+  104e4a:	8d 83 af be ff ff    	lea    -0x4151(%ebx),%eax
+  104e50:	50                   	push   %eax
+  104e51:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  104e57:	50                   	push   %eax
+  104e58:	68 b1 00 00 00       	push   $0xb1
+  104e5d:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  104e63:	50                   	push   %eax
+  104e64:	e8 69 bf ff ff       	call   100dd2 <debug_panic>
+
+	uint32_t eva = va + size;
+  104e69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  104e6c:	8b 45 10             	mov    0x10(%ebp),%eax
+  104e6f:	01 d0                	add    %edx,%eax
+  104e71:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	while (va < eva) {
+  104e74:	e9 7d 01 00 00       	jmp    104ff6 <pmap_remove+0x227>
+		pde_t *pde = &pdir[PDX(va)];
+  104e79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104e7c:	c1 e8 16             	shr    $0x16,%eax
+  104e7f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  104e86:	8b 45 08             	mov    0x8(%ebp),%eax
+  104e89:	01 d0                	add    %edx,%eax
+  104e8b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+		if (!(*pde & PTE_P)) {		// no page table: skip it
+  104e8e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104e91:	8b 00                	mov    (%eax),%eax
+  104e93:	83 e0 01             	and    $0x1,%eax
+  104e96:	85 c0                	test   %eax,%eax
+  104e98:	75 15                	jne    104eaf <pmap_remove+0xe0>
+			va = PTADDR(va + PTSIZE);
+  104e9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104e9d:	05 00 00 40 00       	add    $0x400000,%eax
+  104ea2:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  104ea7:	89 45 0c             	mov    %eax,0xc(%ebp)
+			continue;
+  104eaa:	e9 47 01 00 00       	jmp    104ff6 <pmap_remove+0x227>
+		}
+
+		// Drop a whole page table at once if we're removing all of it.
+		if (PTOFF(va) == 0 && eva - va >= PTSIZE) {
+  104eaf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104eb2:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+  104eb7:	85 c0                	test   %eax,%eax
+  104eb9:	0f 85 ce 00 00 00    	jne    104f8d <pmap_remove+0x1be>
+  104ebf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  104ec2:	2b 45 0c             	sub    0xc(%ebp),%eax
+  104ec5:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  104eca:	0f 86 bd 00 00 00    	jbe    104f8d <pmap_remove+0x1be>
+			pte_t *pt = mem_ptr(PGADDR(*pde));
+  104ed0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104ed3:	8b 00                	mov    (%eax),%eax
+  104ed5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  104eda:	89 45 e8             	mov    %eax,-0x18(%ebp)
+			int i;
+			for (i = 0; i < NPTENTRIES; i++)
+  104edd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  104ee4:	eb 6b                	jmp    104f51 <pmap_remove+0x182>
+				if ((pt[i] & PTE_P) && !PTE_ISZERO(pt[i]))
+  104ee6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104ee9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  104ef0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  104ef3:	01 d0                	add    %edx,%eax
+  104ef5:	8b 00                	mov    (%eax),%eax
+  104ef7:	83 e0 01             	and    $0x1,%eax
+  104efa:	85 c0                	test   %eax,%eax
+  104efc:	74 4f                	je     104f4d <pmap_remove+0x17e>
+  104efe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  104f01:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  104f08:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  104f0b:	01 d0                	add    %edx,%eax
+  104f0d:	8b 00                	mov    (%eax),%eax
+  104f0f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  104f14:	89 c2                	mov    %eax,%edx
+  104f16:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  104f1c:	39 c2                	cmp    %eax,%edx
+  104f1e:	74 2d                	je     104f4d <pmap_remove+0x17e>
+					mem_decref(mem_phys2pi(PGADDR(pt[i])));
+  104f20:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104f26:	8b 00                	mov    (%eax),%eax
+  104f28:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  104f2b:	8d 0c 95 00 00 00 00 	lea    0x0(,%edx,4),%ecx
+  104f32:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  104f35:	01 ca                	add    %ecx,%edx
+  104f37:	8b 12                	mov    (%edx),%edx
+  104f39:	c1 ea 0c             	shr    $0xc,%edx
+  104f3c:	c1 e2 03             	shl    $0x3,%edx
+  104f3f:	01 d0                	add    %edx,%eax
+  104f41:	83 ec 0c             	sub    $0xc,%esp
+  104f44:	50                   	push   %eax
+  104f45:	e8 55 c9 ff ff       	call   10189f <mem_decref>
+  104f4a:	83 c4 10             	add    $0x10,%esp
+			for (i = 0; i < NPTENTRIES; i++)
+  104f4d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  104f51:	81 7d f4 ff 03 00 00 	cmpl   $0x3ff,-0xc(%ebp)
+  104f58:	7e 8c                	jle    104ee6 <pmap_remove+0x117>
+			mem_decref(mem_phys2pi(PGADDR(*pde)));
+  104f5a:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104f60:	8b 10                	mov    (%eax),%edx
+  104f62:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104f65:	8b 00                	mov    (%eax),%eax
+  104f67:	c1 e8 0c             	shr    $0xc,%eax
+  104f6a:	c1 e0 03             	shl    $0x3,%eax
+  104f6d:	01 d0                	add    %edx,%eax
+  104f6f:	83 ec 0c             	sub    $0xc,%esp
+  104f72:	50                   	push   %eax
+  104f73:	e8 27 c9 ff ff       	call   10189f <mem_decref>
+  104f78:	83 c4 10             	add    $0x10,%esp
+			*pde = 0;
+  104f7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  104f7e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+			va += PTSIZE;
+  104f84:	81 45 0c 00 00 40 00 	addl   $0x400000,0xc(%ebp)
+			continue;
+  104f8b:	eb 69                	jmp    104ff6 <pmap_remove+0x227>
+		}
+
+		pte_t *pte = pmap_walk(pdir, va, 0);
+  104f8d:	83 ec 04             	sub    $0x4,%esp
+  104f90:	6a 00                	push   $0x0
+  104f92:	ff 75 0c             	push   0xc(%ebp)
+  104f95:	ff 75 08             	push   0x8(%ebp)
+  104f98:	e8 4b fb ff ff       	call   104ae8 <pmap_walk>
+  104f9d:	83 c4 10             	add    $0x10,%esp
+  104fa0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if ((*pte & PTE_P) && !PTE_ISZERO(*pte))
+  104fa3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104fa6:	8b 00                	mov    (%eax),%eax
+  104fa8:	83 e0 01             	and    $0x1,%eax
+  104fab:	85 c0                	test   %eax,%eax
+  104fad:	74 37                	je     104fe6 <pmap_remove+0x217>
+  104faf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104fb2:	8b 00                	mov    (%eax),%eax
+  104fb4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  104fb9:	89 c2                	mov    %eax,%edx
+  104fbb:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  104fc1:	39 c2                	cmp    %eax,%edx
+  104fc3:	74 21                	je     104fe6 <pmap_remove+0x217>
+			mem_decref(mem_phys2pi(PGADDR(*pte)));
+  104fc5:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  104fcb:	8b 10                	mov    (%eax),%edx
+  104fcd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104fd0:	8b 00                	mov    (%eax),%eax
+  104fd2:	c1 e8 0c             	shr    $0xc,%eax
+  104fd5:	c1 e0 03             	shl    $0x3,%eax
+  104fd8:	01 d0                	add    %edx,%eax
+  104fda:	83 ec 0c             	sub    $0xc,%esp
+  104fdd:	50                   	push   %eax
+  104fde:	e8 bc c8 ff ff       	call   10189f <mem_decref>
+  104fe3:	83 c4 10             	add    $0x10,%esp
+		*pte = 0;
+  104fe6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  104fe9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		va += PAGESIZE;
+  104fef:	81 45 0c 00 10 00 00 	addl   $0x1000,0xc(%ebp)
+	while (va < eva) {
+  104ff6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  104ff9:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  104ffc:	0f 82 77 fe ff ff    	jb     104e79 <pmap_remove+0xaa>
+	}
+
+	pmap_inval(pdir, eva - size, size);
+  105002:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  105005:	2b 45 10             	sub    0x10(%ebp),%eax
+  105008:	83 ec 04             	sub    $0x4,%esp
+  10500b:	ff 75 10             	push   0x10(%ebp)
+  10500e:	50                   	push   %eax
+  10500f:	ff 75 08             	push   0x8(%ebp)
+  105012:	e8 09 00 00 00       	call   105020 <pmap_inval>
+  105017:	83 c4 10             	add    $0x10,%esp
+}
+  10501a:	90                   	nop
+  10501b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10501e:	c9                   	leave
+  10501f:	c3                   	ret
+
+00105020 <pmap_inval>:
+// There are no TLB shootdowns yet, so this covers only the current CPU:
+// callers changing a page directory must make sure no other CPU has it
+// loaded (see kern/pmap.h).
+void
+pmap_inval(pde_t *pdir, uint32_t va, size_t size)
+{
+  105020:	55                   	push   %ebp
+  105021:	89 e5                	mov    %esp,%ebp
+  105023:	83 ec 10             	sub    $0x10,%esp
+  105026:	e8 e5 b3 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10502b:	05 c9 8f 00 00       	add    $0x8fc9,%eax
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+  105030:	0f 20 d8             	mov    %cr3,%eax
+  105033:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	return val;
+  105036:	8b 45 fc             	mov    -0x4(%ebp),%eax
+	if (PGADDR(rcr3()) != mem_phys(pdir))
+  105039:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  10503e:	89 c2                	mov    %eax,%edx
+  105040:	8b 45 08             	mov    0x8(%ebp),%eax
+  105043:	39 c2                	cmp    %eax,%edx
+  105045:	75 25                	jne    10506c <pmap_inval+0x4c>
+		return;		// not this CPU's current address space
+
+	// A single page is cheap to flush on its own.  Otherwise reload CR3,
+	// which keeps the global mappings above the kernel image in the TLB
+	// but flushes the image itself (see pmap_init()).
+	if (size == PAGESIZE)
+  105047:	81 7d 10 00 10 00 00 	cmpl   $0x1000,0x10(%ebp)
+  10504e:	75 0e                	jne    10505e <pmap_inval+0x3e>
+		invlpg(mem_ptr(va));
+  105050:	8b 45 0c             	mov    0xc(%ebp),%eax
+  105053:	89 45 f8             	mov    %eax,-0x8(%ebp)
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+  105056:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  105059:	0f 01 38             	invlpg (%eax)
+}  
+  10505c:	eb 0f                	jmp    10506d <pmap_inval+0x4d>
+	else
+		lcr3(mem_phys(pdir));
+  10505e:	8b 45 08             	mov    0x8(%ebp),%eax
+  105061:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+  105064:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105067:	0f 22 d8             	mov    %eax,%cr3
+}
+  10506a:	eb 01                	jmp    10506d <pmap_inval+0x4d>
+		return;		// not this CPU's current address space
+  10506c:	90                   	nop
+}
+  10506d:	c9                   	leave
+  10506e:	c3                   	ret
+
+0010506f <pmap_copy>:
+
+int
+pmap_copy(pde_t *spdir, uint32_t sva, pde_t *dpdir, uint32_t dva,
+		size_t size)
+{
+  10506f:	55                   	push   %ebp
+  105070:	89 e5                	mov    %esp,%ebp
+  105072:	53                   	push   %ebx
+  105073:	83 ec 24             	sub    $0x24,%esp
+  105076:	e8 99 b3 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10507b:	81 c3 79 8f 00 00    	add    $0x8f79,%ebx
+	assert(PTOFF(sva) == 0);	// must be 4MB-aligned
+  105081:	8b 45 0c             	mov    0xc(%ebp),%eax
+  105084:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+  105089:	85 c0                	test   %eax,%eax
+  10508b:	74 1f                	je     1050ac <pmap_copy+0x3d>
+  10508d:	8d 83 d7 be ff ff    	lea    -0x4129(%ebx),%eax
+  105093:	50                   	push   %eax
+  105094:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  10509a:	50                   	push   %eax
+  10509b:	68 e8 00 00 00       	push   $0xe8
+  1050a0:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1050a6:	50                   	push   %eax
+  1050a7:	e8 26 bd ff ff       	call   100dd2 <debug_panic>
+	assert(PTOFF(dva) == 0);
+  1050ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  1050af:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+  1050b4:	85 c0                	test   %eax,%eax
+  1050b6:	74 1f                	je     1050d7 <pmap_copy+0x68>
+  1050b8:	8d 83 e7 be ff ff    	lea    -0x4119(%ebx),%eax
+  1050be:	50                   	push   %eax
+  1050bf:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1050c5:	50                   	push   %eax
+  1050c6:	68 e9 00 00 00       	push   $0xe9
+  1050cb:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1050d1:	50                   	push   %eax
+  1050d2:	e8 fb bc ff ff       	call   100dd2 <debug_panic>
+	assert(PTOFF(size) == 0);
+  1050d7:	8b 45 18             	mov    0x18(%ebp),%eax
+  1050da:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+  1050df:	85 c0                	test   %eax,%eax
+  1050e1:	74 1f                	je     105102 <pmap_copy+0x93>
+  1050e3:	8d 83 f7 be ff ff    	lea    -0x4109(%ebx),%eax
+  1050e9:	50                   	push   %eax
+  1050ea:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1050f0:	50                   	push   %eax
+  1050f1:	68 ea 00 00 00       	push   $0xea
+  1050f6:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1050fc:	50                   	push   %eax
+  1050fd:	e8 d0 bc ff ff       	call   100dd2 <debug_panic>
+	assert(sva >= VM_USERLO && sva < VM_USERHI);
+  105102:	81 7d 0c ff ff ff 3f 	cmpl   $0x3fffffff,0xc(%ebp)
+  105109:	76 09                	jbe    105114 <pmap_copy+0xa5>
+  10510b:	81 7d 0c ff ff ff ef 	cmpl   $0xefffffff,0xc(%ebp)
+  105112:	76 1f                	jbe    105133 <pmap_copy+0xc4>
+  105114:	8d 83 08 bf ff ff    	lea    -0x40f8(%ebx),%eax
+  10511a:	50                   	push   %eax
+  10511b:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105121:	50                   	push   %eax
+  105122:	68 eb 00 00 00       	push   $0xeb
+  105127:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  10512d:	50                   	push   %eax
+  10512e:	e8 9f bc ff ff       	call   100dd2 <debug_panic>
+	assert(dva >= VM_USERLO && dva < VM_USERHI);
+  105133:	81 7d 14 ff ff ff 3f 	cmpl   $0x3fffffff,0x14(%ebp)
+  10513a:	76 09                	jbe    105145 <pmap_copy+0xd6>
+  10513c:	81 7d 14 ff ff ff ef 	cmpl   $0xefffffff,0x14(%ebp)
+  105143:	76 1f                	jbe    105164 <pmap_copy+0xf5>
+  105145:	8d 83 2c bf ff ff    	lea    -0x40d4(%ebx),%eax
+  10514b:	50                   	push   %eax
+  10514c:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105152:	50                   	push   %eax
+  105153:	68 ec 00 00 00       	push   $0xec
+  105158:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  10515e:	50                   	push   %eax
+  10515f:	e8 6e bc ff ff       	call   100dd2 <debug_panic>
+	assert(size <= VM_USERHI - sva);
+  105164:	b8 00 00 00 f0       	mov    $0xf0000000,%eax
+  105169:	2b 45 0c             	sub    0xc(%ebp),%eax
+  10516c:	3b 45 18             	cmp    0x18(%ebp),%eax
+  10516f:	73 1f                	jae    105190 <pmap_copy+0x121>
+  105171:	8d 83 50 bf ff ff    	lea    -0x40b0(%ebx),%eax
+  105177:	50                   	push   %eax
+  105178:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  10517e:	50                   	push   %eax
+  10517f:	68 ed 00 00 00       	push   $0xed
+  105184:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  10518a:	50                   	push   %eax
+  10518b:	e8 42 bc ff ff       	call   100dd2 <debug_panic>
+	assert(size <= VM_USERHI - dva);
+  105190:	b8 00 00 00 f0       	mov    $0xf0000000,%eax
+  105195:	2b 45 14             	sub    0x14(%ebp),%eax
+  105198:	3b 45 18             	cmp    0x18(%ebp),%eax
+  10519b:	73 1f                	jae    1051bc <pmap_copy+0x14d>
+  10519d:	8d 83 68 bf ff ff    	lea    -0x4098(%ebx),%eax
+  1051a3:	50                   	push   %eax
+  1051a4:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1051aa:	50                   	push   %eax
+  1051ab:	68 ee 00 00 00       	push   $0xee
+  1051b0:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1051b6:	50                   	push   %eax
+  1051b7:	e8 16 bc ff ff       	call   100dd2 <debug_panic>
+	assert(spdir != pmap_bootpdir);	// can't flush it on other CPUs
+  1051bc:	8d 83 0c 90 02 00    	lea    0x2900c(%ebx),%eax
+  1051c2:	39 45 08             	cmp    %eax,0x8(%ebp)
+  1051c5:	75 1f                	jne    1051e6 <pmap_copy+0x177>
+  1051c7:	8d 83 80 bf ff ff    	lea    -0x4080(%ebx),%eax
+  1051cd:	50                   	push   %eax
+  1051ce:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1051d4:	50                   	push   %eax
+  1051d5:	68 ef 00 00 00       	push   $0xef
+  1051da:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1051e0:	50                   	push   %eax
+  1051e1:	e8 ec bb ff ff       	call   100dd2 <debug_panic>
+
+	pmap_remove(dpdir, dva, size);
+  1051e6:	83 ec 04             	sub    $0x4,%esp
+  1051e9:	ff 75 18             	push   0x18(%ebp)
+  1051ec:	ff 75 14             	push   0x14(%ebp)
+  1051ef:	ff 75 10             	push   0x10(%ebp)
+  1051f2:	e8 d8 fb ff ff       	call   104dcf <pmap_remove>
+  1051f7:	83 c4 10             	add    $0x10,%esp
+
+	// Copy page tables only: the pages themselves become shared,
+	// and writable ones copy-on-write on both sides.
+	uint32_t off;
+	for (off = 0; off < size; off += PTSIZE) {
+  1051fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  105201:	e9 1b 01 00 00       	jmp    105321 <pmap_copy+0x2b2>
+		pde_t spde = spdir[PDX(sva + off)];
+  105206:	8b 55 0c             	mov    0xc(%ebp),%edx
+  105209:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10520c:	01 d0                	add    %edx,%eax
+  10520e:	c1 e8 16             	shr    $0x16,%eax
+  105211:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  105218:	8b 45 08             	mov    0x8(%ebp),%eax
+  10521b:	01 d0                	add    %edx,%eax
+  10521d:	8b 00                	mov    (%eax),%eax
+  10521f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (!(spde & PTE_P))
+  105222:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  105225:	83 e0 01             	and    $0x1,%eax
+  105228:	85 c0                	test   %eax,%eax
+  10522a:	0f 84 e9 00 00 00    	je     105319 <pmap_copy+0x2aa>
+			continue;
+
+		pte_t *spt = mem_ptr(PGADDR(spde));
+  105230:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  105233:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105238:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		pte_t *dpt = pmap_walk(dpdir, dva + off, 1);
+  10523b:	8b 55 14             	mov    0x14(%ebp),%edx
+  10523e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105241:	01 d0                	add    %edx,%eax
+  105243:	83 ec 04             	sub    $0x4,%esp
+  105246:	6a 01                	push   $0x1
+  105248:	50                   	push   %eax
+  105249:	ff 75 10             	push   0x10(%ebp)
+  10524c:	e8 97 f8 ff ff       	call   104ae8 <pmap_walk>
+  105251:	83 c4 10             	add    $0x10,%esp
+  105254:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		if (dpt == NULL)
+  105257:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  10525b:	75 0a                	jne    105267 <pmap_copy+0x1f8>
+			return 0;
+  10525d:	b8 00 00 00 00       	mov    $0x0,%eax
+  105262:	e9 df 00 00 00       	jmp    105346 <pmap_copy+0x2d7>
+
+		int i;
+		for (i = 0; i < NPTENTRIES; i++) {
+  105267:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  10526e:	e9 97 00 00 00       	jmp    10530a <pmap_copy+0x29b>
+			pte_t pte = spt[i];
+  105273:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  105276:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  10527d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105280:	01 d0                	add    %edx,%eax
+  105282:	8b 00                	mov    (%eax),%eax
+  105284:	89 45 ec             	mov    %eax,-0x14(%ebp)
+			if (!(pte & PTE_P))
+  105287:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10528a:	83 e0 01             	and    $0x1,%eax
+  10528d:	85 c0                	test   %eax,%eax
+  10528f:	74 74                	je     105305 <pmap_copy+0x296>
+				continue;
+			if (pte & PTE_W)
+  105291:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  105294:	83 e0 02             	and    $0x2,%eax
+  105297:	85 c0                	test   %eax,%eax
+  105299:	74 0e                	je     1052a9 <pmap_copy+0x23a>
+				pte = (pte & ~PTE_W) | PTE_COW;
+  10529b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10529e:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+  1052a3:	80 cc 02             	or     $0x2,%ah
+  1052a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+			if (!PTE_ISZERO(pte))
+  1052a9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1052ac:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  1052b1:	89 c2                	mov    %eax,%edx
+  1052b3:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  1052b9:	39 c2                	cmp    %eax,%edx
+  1052bb:	74 1f                	je     1052dc <pmap_copy+0x26d>
+				mem_incref(mem_phys2pi(PGADDR(pte)));
+  1052bd:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  1052c3:	8b 00                	mov    (%eax),%eax
+  1052c5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  1052c8:	c1 ea 0c             	shr    $0xc,%edx
+  1052cb:	c1 e2 03             	shl    $0x3,%edx
+  1052ce:	01 d0                	add    %edx,%eax
+  1052d0:	83 ec 0c             	sub    $0xc,%esp
+  1052d3:	50                   	push   %eax
+  1052d4:	e8 c6 c4 ff ff       	call   10179f <mem_incref>
+  1052d9:	83 c4 10             	add    $0x10,%esp
+			spt[i] = dpt[i] = pte;
+  1052dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1052df:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  1052e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1052e9:	01 d0                	add    %edx,%eax
+  1052eb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  1052ee:	89 10                	mov    %edx,(%eax)
+  1052f0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  1052f3:	8d 0c 95 00 00 00 00 	lea    0x0(,%edx,4),%ecx
+  1052fa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  1052fd:	01 ca                	add    %ecx,%edx
+  1052ff:	8b 00                	mov    (%eax),%eax
+  105301:	89 02                	mov    %eax,(%edx)
+  105303:	eb 01                	jmp    105306 <pmap_copy+0x297>
+				continue;
+  105305:	90                   	nop
+		for (i = 0; i < NPTENTRIES; i++) {
+  105306:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  10530a:	81 7d f0 ff 03 00 00 	cmpl   $0x3ff,-0x10(%ebp)
+  105311:	0f 8e 5c ff ff ff    	jle    105273 <pmap_copy+0x204>
+  105317:	eb 01                	jmp    10531a <pmap_copy+0x2ab>
+			continue;
+  105319:	90                   	nop
+	for (off = 0; off < size; off += PTSIZE) {
+  10531a:	81 45 f4 00 00 40 00 	addl   $0x400000,-0xc(%ebp)
+  105321:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105324:	3b 45 18             	cmp    0x18(%ebp),%eax
+  105327:	0f 82 d9 fe ff ff    	jb     105206 <pmap_copy+0x197>
+		}
+	}
+
+	// Source pages we just made read-only may still be writable in the TLB.
+	pmap_inval(spdir, sva, size);
+  10532d:	83 ec 04             	sub    $0x4,%esp
+  105330:	ff 75 18             	push   0x18(%ebp)
+  105333:	ff 75 0c             	push   0xc(%ebp)
+  105336:	ff 75 08             	push   0x8(%ebp)
+  105339:	e8 e2 fc ff ff       	call   105020 <pmap_inval>
+  10533e:	83 c4 10             	add    $0x10,%esp
+	return 1;
+  105341:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  105346:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  105349:	c9                   	leave
+  10534a:	c3                   	ret
+
+0010534b <pmap_checkuser>:
+
+bool
+pmap_checkuser(pde_t *pdir, uint32_t va, size_t size, bool writing)
+{
+  10534b:	55                   	push   %ebp
+  10534c:	89 e5                	mov    %esp,%ebp
+  10534e:	83 ec 10             	sub    $0x10,%esp
+  105351:	e8 ba b0 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  105356:	05 9e 8c 00 00       	add    $0x8c9e,%eax
+	if (size == 0)
+  10535b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10535f:	75 0a                	jne    10536b <pmap_checkuser+0x20>
+		return 1;
+  105361:	b8 01 00 00 00       	mov    $0x1,%eax
+  105366:	e9 1b 01 00 00       	jmp    105486 <pmap_checkuser+0x13b>
+	if (va + size - 1 < va)
+  10536b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  10536e:	8b 45 10             	mov    0x10(%ebp),%eax
+  105371:	01 d0                	add    %edx,%eax
+  105373:	83 e8 01             	sub    $0x1,%eax
+  105376:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  105379:	73 0a                	jae    105385 <pmap_checkuser+0x3a>
+		return 0;		// wraps around the top of memory
+  10537b:	b8 00 00 00 00       	mov    $0x0,%eax
+  105380:	e9 01 01 00 00       	jmp    105486 <pmap_checkuser+0x13b>
+
+	uint32_t eva = va + size - 1;	// last byte, to avoid overflow
+  105385:	8b 55 0c             	mov    0xc(%ebp),%edx
+  105388:	8b 45 10             	mov    0x10(%ebp),%eax
+  10538b:	01 d0                	add    %edx,%eax
+  10538d:	83 e8 01             	sub    $0x1,%eax
+  105390:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	va = PGADDR(va);
+  105393:	81 65 0c 00 f0 ff ff 	andl   $0xfffff000,0xc(%ebp)
+	while (1) {
+		pde_t pde = pdir[PDX(va)];
+  10539a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10539d:	c1 e8 16             	shr    $0x16,%eax
+  1053a0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  1053a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1053aa:	01 d0                	add    %edx,%eax
+  1053ac:	8b 00                	mov    (%eax),%eax
+  1053ae:	89 45 f8             	mov    %eax,-0x8(%ebp)
+		if ((pde & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+  1053b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  1053b4:	83 e0 05             	and    $0x5,%eax
+  1053b7:	83 f8 05             	cmp    $0x5,%eax
+  1053ba:	74 0a                	je     1053c6 <pmap_checkuser+0x7b>
+			return 0;
+  1053bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  1053c1:	e9 c0 00 00 00       	jmp    105486 <pmap_checkuser+0x13b>
+
+		if (pde & PTE_PS) {	// 4MB page, as in pmap_bootpdir
+  1053c6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  1053c9:	25 80 00 00 00       	and    $0x80,%eax
+  1053ce:	85 c0                	test   %eax,%eax
+  1053d0:	74 48                	je     10541a <pmap_checkuser+0xcf>
+			if (writing && !(pde & PTE_W))
+  1053d2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  1053d6:	74 14                	je     1053ec <pmap_checkuser+0xa1>
+  1053d8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  1053db:	83 e0 02             	and    $0x2,%eax
+  1053de:	85 c0                	test   %eax,%eax
+  1053e0:	75 0a                	jne    1053ec <pmap_checkuser+0xa1>
+				return 0;
+  1053e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  1053e7:	e9 9a 00 00 00       	jmp    105486 <pmap_checkuser+0x13b>
+			if (eva - PTADDR(va) < PTSIZE)
+  1053ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1053ef:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  1053f4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1053f7:	29 c2                	sub    %eax,%edx
+  1053f9:	81 fa ff ff 3f 00    	cmp    $0x3fffff,%edx
+  1053ff:	77 07                	ja     105408 <pmap_checkuser+0xbd>
+				return 1;
+  105401:	b8 01 00 00 00       	mov    $0x1,%eax
+  105406:	eb 7e                	jmp    105486 <pmap_checkuser+0x13b>
+			va = PTADDR(va) + PTSIZE;
+  105408:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10540b:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  105410:	05 00 00 40 00       	add    $0x400000,%eax
+  105415:	89 45 0c             	mov    %eax,0xc(%ebp)
+			continue;
+  105418:	eb 67                	jmp    105481 <pmap_checkuser+0x136>
+		}
+
+		// The kernel may write to copy-on-write pages too:
+		// with CR0_WP it faults, and pmap_pagefault() copies them.
+		pte_t pte = ((pte_t *) mem_ptr(PGADDR(pde)))[PTX(va)];
+  10541a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10541d:	c1 e8 0c             	shr    $0xc,%eax
+  105420:	25 ff 03 00 00       	and    $0x3ff,%eax
+  105425:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  10542c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  10542f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105434:	01 d0                	add    %edx,%eax
+  105436:	8b 00                	mov    (%eax),%eax
+  105438:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+  10543b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10543e:	83 e0 05             	and    $0x5,%eax
+  105441:	83 f8 05             	cmp    $0x5,%eax
+  105444:	74 07                	je     10544d <pmap_checkuser+0x102>
+			return 0;
+  105446:	b8 00 00 00 00       	mov    $0x0,%eax
+  10544b:	eb 39                	jmp    105486 <pmap_checkuser+0x13b>
+		if (writing && !(pte & (PTE_W | PTE_COW)))
+  10544d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  105451:	74 13                	je     105466 <pmap_checkuser+0x11b>
+  105453:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105456:	25 02 02 00 00       	and    $0x202,%eax
+  10545b:	85 c0                	test   %eax,%eax
+  10545d:	75 07                	jne    105466 <pmap_checkuser+0x11b>
+			return 0;
+  10545f:	b8 00 00 00 00       	mov    $0x0,%eax
+  105464:	eb 20                	jmp    105486 <pmap_checkuser+0x13b>
+		if (eva - va < PAGESIZE)
+  105466:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  105469:	2b 45 0c             	sub    0xc(%ebp),%eax
+  10546c:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  105471:	77 07                	ja     10547a <pmap_checkuser+0x12f>
+			return 1;
+  105473:	b8 01 00 00 00       	mov    $0x1,%eax
+  105478:	eb 0c                	jmp    105486 <pmap_checkuser+0x13b>
+		va += PAGESIZE;
+  10547a:	81 45 0c 00 10 00 00 	addl   $0x1000,0xc(%ebp)
+	while (1) {
+  105481:	e9 14 ff ff ff       	jmp    10539a <pmap_checkuser+0x4f>
+	}
+}
+  105486:	c9                   	leave
+  105487:	c3                   	ret
+
+00105488 <pmap_pagefault>:
+
+void
+pmap_pagefault(trapframe *tf)
+{
+  105488:	55                   	push   %ebp
+  105489:	89 e5                	mov    %esp,%ebp
+  10548b:	53                   	push   %ebx
+  10548c:	83 ec 34             	sub    $0x34,%esp
+  10548f:	e8 80 af ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  105494:	81 c3 60 8b 00 00    	add    $0x8b60,%ebx
+	__asm __volatile("movl %%cr2,%0" : "=r" (val));
+  10549a:	0f 20 d0             	mov    %cr2,%eax
+  10549d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	return val;
+  1054a0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+	uint32_t fva = rcr2();
+  1054a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+	if (fva < VM_USERLO || fva >= VM_USERHI || !(tf->tf_err & PFE_WR))
+  1054a6:	81 7d f4 ff ff ff 3f 	cmpl   $0x3fffffff,-0xc(%ebp)
+  1054ad:	0f 86 65 02 00 00    	jbe    105718 <pmap_pagefault+0x290>
+  1054b3:	81 7d f4 ff ff ff ef 	cmpl   $0xefffffff,-0xc(%ebp)
+  1054ba:	0f 87 58 02 00 00    	ja     105718 <pmap_pagefault+0x290>
+  1054c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  1054c3:	8b 40 2c             	mov    0x2c(%eax),%eax
+  1054c6:	83 e0 02             	and    $0x2,%eax
+  1054c9:	85 c0                	test   %eax,%eax
+  1054cb:	0f 84 47 02 00 00    	je     105718 <pmap_pagefault+0x290>
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+  1054d1:	0f 20 d8             	mov    %cr3,%eax
+  1054d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	return val;
+  1054d7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+		return;		// not a write to the user area
+
+	pde_t *pdir = mem_ptr(PGADDR(rcr3()));
+  1054da:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  1054df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	pte_t *pte = pmap_walk(pdir, fva, 0);
+  1054e2:	83 ec 04             	sub    $0x4,%esp
+  1054e5:	6a 00                	push   $0x0
+  1054e7:	ff 75 f4             	push   -0xc(%ebp)
+  1054ea:	ff 75 f0             	push   -0x10(%ebp)
+  1054ed:	e8 f6 f5 ff ff       	call   104ae8 <pmap_walk>
+  1054f2:	83 c4 10             	add    $0x10,%esp
+  1054f5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	if (pte == NULL || (*pte & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW))
+  1054f8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  1054fc:	0f 84 19 02 00 00    	je     10571b <pmap_pagefault+0x293>
+  105502:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  105505:	8b 00                	mov    (%eax),%eax
+  105507:	25 01 02 00 00       	and    $0x201,%eax
+  10550c:	3d 01 02 00 00       	cmp    $0x201,%eax
+  105511:	0f 85 04 02 00 00    	jne    10571b <pmap_pagefault+0x293>
+		return;		// not a copy-on-write page
+
+	if (PTE_ISZERO(*pte)) {
+  105517:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10551a:	8b 00                	mov    (%eax),%eax
+  10551c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105521:	89 c2                	mov    %eax,%edx
+  105523:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  105529:	39 c2                	cmp    %eax,%edx
+  10552b:	0f 85 c5 00 00 00    	jne    1055f6 <pmap_pagefault+0x16e>
+		// First write to zero-fill memory: give it a page of its own.
+		pageinfo *npi = mem_alloc();
+  105531:	e8 01 c2 ff ff       	call   101737 <mem_alloc>
+  105536:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		if (npi == NULL) {
+  105539:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  10553d:	75 23                	jne    105562 <pmap_pagefault+0xda>
+			warn("pmap_pagefault: out of memory for zero-fill");
+  10553f:	83 ec 04             	sub    $0x4,%esp
+  105542:	8d 83 98 bf ff ff    	lea    -0x4068(%ebx),%eax
+  105548:	50                   	push   %eax
+  105549:	68 48 01 00 00       	push   $0x148
+  10554e:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105554:	50                   	push   %eax
+  105555:	e8 76 b9 ff ff       	call   100ed0 <debug_warn>
+  10555a:	83 c4 10             	add    $0x10,%esp
+			return;
+  10555d:	e9 ba 01 00 00       	jmp    10571c <pmap_pagefault+0x294>
+		}
+		mem_incref(npi);
+  105562:	83 ec 0c             	sub    $0xc,%esp
+  105565:	ff 75 e0             	push   -0x20(%ebp)
+  105568:	e8 32 c2 ff ff       	call   10179f <mem_incref>
+  10556d:	83 c4 10             	add    $0x10,%esp
+		memset(mem_pi2ptr(npi), 0, PAGESIZE);
+  105570:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105576:	8b 00                	mov    (%eax),%eax
+  105578:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  10557b:	29 c2                	sub    %eax,%edx
+  10557d:	89 d0                	mov    %edx,%eax
+  10557f:	c1 e0 09             	shl    $0x9,%eax
+  105582:	83 ec 04             	sub    $0x4,%esp
+  105585:	68 00 10 00 00       	push   $0x1000
+  10558a:	6a 00                	push   $0x0
+  10558c:	50                   	push   %eax
+  10558d:	e8 1c 29 00 00       	call   107eae <memset>
+  105592:	83 c4 10             	add    $0x10,%esp
+		trace("pmap_pagefault: zero-fill at %x", fva);
+  105595:	83 ec 04             	sub    $0x4,%esp
+  105598:	6a 00                	push   $0x0
+  10559a:	6a 00                	push   $0x0
+  10559c:	6a 00                	push   $0x0
+  10559e:	6a 00                	push   $0x0
+  1055a0:	6a 00                	push   $0x0
+  1055a2:	ff 75 f4             	push   -0xc(%ebp)
+  1055a5:	8d 83 c4 bf ff ff    	lea    -0x403c(%ebx),%eax
+  1055ab:	50                   	push   %eax
+  1055ac:	e8 18 e5 ff ff       	call   103ac9 <trace_log>
+  1055b1:	83 c4 20             	add    $0x20,%esp
+		*pte = mem_pi2phys(npi) | (PGOFF(*pte) & ~PTE_COW) | PTE_W;
+  1055b4:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  1055ba:	8b 00                	mov    (%eax),%eax
+  1055bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  1055bf:	29 c2                	sub    %eax,%edx
+  1055c1:	89 d0                	mov    %edx,%eax
+  1055c3:	c1 e0 09             	shl    $0x9,%eax
+  1055c6:	89 c2                	mov    %eax,%edx
+  1055c8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1055cb:	8b 00                	mov    (%eax),%eax
+  1055cd:	25 ff 0d 00 00       	and    $0xdff,%eax
+  1055d2:	09 d0                	or     %edx,%eax
+  1055d4:	83 c8 02             	or     $0x2,%eax
+  1055d7:	89 c2                	mov    %eax,%edx
+  1055d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1055dc:	89 10                	mov    %edx,(%eax)
+		invlpg(mem_ptr(fva));
+  1055de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1055e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+  1055e4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1055e7:	0f 01 38             	invlpg (%eax)
+}  
+  1055ea:	90                   	nop
+		trap_return(tf);
+  1055eb:	83 ec 0c             	sub    $0xc,%esp
+  1055ee:	ff 75 08             	push   0x8(%ebp)
+  1055f1:	e8 aa dc ff ff       	call   1032a0 <trap_return>
+	}
+
+	pageinfo *pi = mem_phys2pi(PGADDR(*pte));
+  1055f6:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  1055fc:	8b 10                	mov    (%eax),%edx
+  1055fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  105601:	8b 00                	mov    (%eax),%eax
+  105603:	c1 e8 0c             	shr    $0xc,%eax
+  105606:	c1 e0 03             	shl    $0x3,%eax
+  105609:	01 d0                	add    %edx,%eax
+  10560b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+	if (pi->refcount == 1) {
+  10560e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  105611:	8b 40 04             	mov    0x4(%eax),%eax
+  105614:	83 f8 01             	cmp    $0x1,%eax
+  105617:	75 19                	jne    105632 <pmap_pagefault+0x1aa>
+		// Everyone else has let go of the page already:
+		// it's ours, so no need to copy it.
+		*pte = (*pte & ~PTE_COW) | PTE_W;
+  105619:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10561c:	8b 00                	mov    (%eax),%eax
+  10561e:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+  105623:	83 c8 02             	or     $0x2,%eax
+  105626:	89 c2                	mov    %eax,%edx
+  105628:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  10562b:	89 10                	mov    %edx,(%eax)
+  10562d:	e9 ce 00 00 00       	jmp    105700 <pmap_pagefault+0x278>
+	} else {
+		pageinfo *npi = mem_alloc();
+  105632:	e8 00 c1 ff ff       	call   101737 <mem_alloc>
+  105637:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if (npi == NULL) {
+  10563a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  10563e:	75 23                	jne    105663 <pmap_pagefault+0x1db>
+			warn("pmap_pagefault: out of memory for copy-on-write");
+  105640:	83 ec 04             	sub    $0x4,%esp
+  105643:	8d 83 e4 bf ff ff    	lea    -0x401c(%ebx),%eax
+  105649:	50                   	push   %eax
+  10564a:	68 5b 01 00 00       	push   $0x15b
+  10564f:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105655:	50                   	push   %eax
+  105656:	e8 75 b8 ff ff       	call   100ed0 <debug_warn>
+  10565b:	83 c4 10             	add    $0x10,%esp
+			return;
+  10565e:	e9 b9 00 00 00       	jmp    10571c <pmap_pagefault+0x294>
+		}
+		mem_incref(npi);
+  105663:	83 ec 0c             	sub    $0xc,%esp
+  105666:	ff 75 e4             	push   -0x1c(%ebp)
+  105669:	e8 31 c1 ff ff       	call   10179f <mem_incref>
+  10566e:	83 c4 10             	add    $0x10,%esp
+		memmove(mem_pi2ptr(npi), mem_pi2ptr(pi), PAGESIZE);
+  105671:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105677:	8b 00                	mov    (%eax),%eax
+  105679:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  10567c:	29 c2                	sub    %eax,%edx
+  10567e:	89 d0                	mov    %edx,%eax
+  105680:	c1 e0 09             	shl    $0x9,%eax
+  105683:	89 c1                	mov    %eax,%ecx
+  105685:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  10568b:	8b 00                	mov    (%eax),%eax
+  10568d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105690:	29 c2                	sub    %eax,%edx
+  105692:	89 d0                	mov    %edx,%eax
+  105694:	c1 e0 09             	shl    $0x9,%eax
+  105697:	83 ec 04             	sub    $0x4,%esp
+  10569a:	68 00 10 00 00       	push   $0x1000
+  10569f:	51                   	push   %ecx
+  1056a0:	50                   	push   %eax
+  1056a1:	e8 82 28 00 00       	call   107f28 <memmove>
+  1056a6:	83 c4 10             	add    $0x10,%esp
+		trace("pmap_pagefault: copy-on-write at %x", fva);
+  1056a9:	83 ec 04             	sub    $0x4,%esp
+  1056ac:	6a 00                	push   $0x0
+  1056ae:	6a 00                	push   $0x0
+  1056b0:	6a 00                	push   $0x0
+  1056b2:	6a 00                	push   $0x0
+  1056b4:	6a 00                	push   $0x0
+  1056b6:	ff 75 f4             	push   -0xc(%ebp)
+  1056b9:	8d 83 14 c0 ff ff    	lea    -0x3fec(%ebx),%eax
+  1056bf:	50                   	push   %eax
+  1056c0:	e8 04 e4 ff ff       	call   103ac9 <trace_log>
+  1056c5:	83 c4 20             	add    $0x20,%esp
+		*pte = mem_pi2phys(npi) | (PGOFF(*pte) & ~PTE_COW) | PTE_W;
+  1056c8:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  1056ce:	8b 00                	mov    (%eax),%eax
+  1056d0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  1056d3:	29 c2                	sub    %eax,%edx
+  1056d5:	89 d0                	mov    %edx,%eax
+  1056d7:	c1 e0 09             	shl    $0x9,%eax
+  1056da:	89 c2                	mov    %eax,%edx
+  1056dc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1056df:	8b 00                	mov    (%eax),%eax
+  1056e1:	25 ff 0d 00 00       	and    $0xdff,%eax
+  1056e6:	09 d0                	or     %edx,%eax
+  1056e8:	83 c8 02             	or     $0x2,%eax
+  1056eb:	89 c2                	mov    %eax,%edx
+  1056ed:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1056f0:	89 10                	mov    %edx,(%eax)
+		mem_decref(pi);
+  1056f2:	83 ec 0c             	sub    $0xc,%esp
+  1056f5:	ff 75 e8             	push   -0x18(%ebp)
+  1056f8:	e8 a2 c1 ff ff       	call   10189f <mem_decref>
+  1056fd:	83 c4 10             	add    $0x10,%esp
+	}
+	invlpg(mem_ptr(fva));
+  105700:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105703:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+  105706:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105709:	0f 01 38             	invlpg (%eax)
+}  
+  10570c:	90                   	nop
+
+	trap_return(tf);
+  10570d:	83 ec 0c             	sub    $0xc,%esp
+  105710:	ff 75 08             	push   0x8(%ebp)
+  105713:	e8 88 db ff ff       	call   1032a0 <trap_return>
+		return;		// not a write to the user area
+  105718:	90                   	nop
+  105719:	eb 01                	jmp    10571c <pmap_pagefault+0x294>
+		return;		// not a copy-on-write page
+  10571b:	90                   	nop
+}
+  10571c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10571f:	c9                   	leave
+  105720:	c3                   	ret
+
+00105721 <pmap_check>:
+
+// Check copy-on-write between two address spaces,
+// writing to the shared page from the kernel, which CR0_WP makes fault too.
+void
+pmap_check(void)
+{
+  105721:	55                   	push   %ebp
+  105722:	89 e5                	mov    %esp,%ebp
+  105724:	53                   	push   %ebx
+  105725:	83 ec 44             	sub    $0x44,%esp
+  105728:	e8 e7 ac ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10572d:	81 c3 c7 88 00 00    	add    $0x88c7,%ebx
+	uint32_t va = VM_USERLO;
+  105733:	c7 45 f4 00 00 00 40 	movl   $0x40000000,-0xc(%ebp)
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+  10573a:	0f 20 d8             	mov    %cr3,%eax
+  10573d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	return val;
+  105740:	8b 45 c8             	mov    -0x38(%ebp),%eax
+	uint32_t cr3 = rcr3();
+  105743:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+	pde_t *parent = pmap_newpdir();
+  105746:	e8 ad f2 ff ff       	call   1049f8 <pmap_newpdir>
+  10574b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	pde_t *child = pmap_newpdir();
+  10574e:	e8 a5 f2 ff ff       	call   1049f8 <pmap_newpdir>
+  105753:	89 45 e8             	mov    %eax,-0x18(%ebp)
+	pageinfo *pi = mem_alloc();
+  105756:	e8 dc bf ff ff       	call   101737 <mem_alloc>
+  10575b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pageinfo *ro = mem_alloc();
+  10575e:	e8 d4 bf ff ff       	call   101737 <mem_alloc>
+  105763:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	assert(parent && child && pi && ro);
+  105766:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  10576a:	74 12                	je     10577e <pmap_check+0x5d>
+  10576c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  105770:	74 0c                	je     10577e <pmap_check+0x5d>
+  105772:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  105776:	74 06                	je     10577e <pmap_check+0x5d>
+  105778:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  10577c:	75 1f                	jne    10579d <pmap_check+0x7c>
+  10577e:	8d 83 38 c0 ff ff    	lea    -0x3fc8(%ebx),%eax
+  105784:	50                   	push   %eax
+  105785:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  10578b:	50                   	push   %eax
+  10578c:	68 75 01 00 00       	push   $0x175
+  105791:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105797:	50                   	push   %eax
+  105798:	e8 35 b6 ff ff       	call   100dd2 <debug_panic>
+
+	// A writable page and a read-only one in the parent
+	memset(mem_pi2ptr(pi), 'p', PAGESIZE);
+  10579d:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  1057a3:	8b 00                	mov    (%eax),%eax
+  1057a5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  1057a8:	29 c2                	sub    %eax,%edx
+  1057aa:	89 d0                	mov    %edx,%eax
+  1057ac:	c1 e0 09             	shl    $0x9,%eax
+  1057af:	83 ec 04             	sub    $0x4,%esp
+  1057b2:	68 00 10 00 00       	push   $0x1000
+  1057b7:	6a 70                	push   $0x70
+  1057b9:	50                   	push   %eax
+  1057ba:	e8 ef 26 00 00       	call   107eae <memset>
+  1057bf:	83 c4 10             	add    $0x10,%esp
+	assert(pmap_insert(parent, pi, va, PTE_W | PTE_U));
+  1057c2:	6a 06                	push   $0x6
+  1057c4:	ff 75 f4             	push   -0xc(%ebp)
+  1057c7:	ff 75 e4             	push   -0x1c(%ebp)
+  1057ca:	ff 75 ec             	push   -0x14(%ebp)
+  1057cd:	e8 3f f4 ff ff       	call   104c11 <pmap_insert>
+  1057d2:	83 c4 10             	add    $0x10,%esp
+  1057d5:	85 c0                	test   %eax,%eax
+  1057d7:	75 1f                	jne    1057f8 <pmap_check+0xd7>
+  1057d9:	8d 83 54 c0 ff ff    	lea    -0x3fac(%ebx),%eax
+  1057df:	50                   	push   %eax
+  1057e0:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1057e6:	50                   	push   %eax
+  1057e7:	68 79 01 00 00       	push   $0x179
+  1057ec:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1057f2:	50                   	push   %eax
+  1057f3:	e8 da b5 ff ff       	call   100dd2 <debug_panic>
+	assert(pmap_insert(parent, ro, va + PAGESIZE, PTE_U));
+  1057f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1057fb:	05 00 10 00 00       	add    $0x1000,%eax
+  105800:	6a 04                	push   $0x4
+  105802:	50                   	push   %eax
+  105803:	ff 75 e0             	push   -0x20(%ebp)
+  105806:	ff 75 ec             	push   -0x14(%ebp)
+  105809:	e8 03 f4 ff ff       	call   104c11 <pmap_insert>
+  10580e:	83 c4 10             	add    $0x10,%esp
+  105811:	85 c0                	test   %eax,%eax
+  105813:	75 1f                	jne    105834 <pmap_check+0x113>
+  105815:	8d 83 80 c0 ff ff    	lea    -0x3f80(%ebx),%eax
+  10581b:	50                   	push   %eax
+  10581c:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105822:	50                   	push   %eax
+  105823:	68 7a 01 00 00       	push   $0x17a
+  105828:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  10582e:	50                   	push   %eax
+  10582f:	e8 9e b5 ff ff       	call   100dd2 <debug_panic>
+	assert(pi->refcount == 1 && ro->refcount == 1);
+  105834:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105837:	8b 40 04             	mov    0x4(%eax),%eax
+  10583a:	83 f8 01             	cmp    $0x1,%eax
+  10583d:	75 0b                	jne    10584a <pmap_check+0x129>
+  10583f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  105842:	8b 40 04             	mov    0x4(%eax),%eax
+  105845:	83 f8 01             	cmp    $0x1,%eax
+  105848:	74 1f                	je     105869 <pmap_check+0x148>
+  10584a:	8d 83 b0 c0 ff ff    	lea    -0x3f50(%ebx),%eax
+  105850:	50                   	push   %eax
+  105851:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105857:	50                   	push   %eax
+  105858:	68 7b 01 00 00       	push   $0x17b
+  10585d:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105863:	50                   	push   %eax
+  105864:	e8 69 b5 ff ff       	call   100dd2 <debug_panic>
+
+	// Cloning shares both pages, and only the writable one becomes COW.
+	assert(pmap_copy(parent, VM_USERLO, child, VM_USERLO, PTSIZE));
+  105869:	83 ec 0c             	sub    $0xc,%esp
+  10586c:	68 00 00 40 00       	push   $0x400000
+  105871:	68 00 00 00 40       	push   $0x40000000
+  105876:	ff 75 e8             	push   -0x18(%ebp)
+  105879:	68 00 00 00 40       	push   $0x40000000
+  10587e:	ff 75 ec             	push   -0x14(%ebp)
+  105881:	e8 e9 f7 ff ff       	call   10506f <pmap_copy>
+  105886:	83 c4 20             	add    $0x20,%esp
+  105889:	85 c0                	test   %eax,%eax
+  10588b:	75 1f                	jne    1058ac <pmap_check+0x18b>
+  10588d:	8d 83 d8 c0 ff ff    	lea    -0x3f28(%ebx),%eax
+  105893:	50                   	push   %eax
+  105894:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  10589a:	50                   	push   %eax
+  10589b:	68 7e 01 00 00       	push   $0x17e
+  1058a0:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1058a6:	50                   	push   %eax
+  1058a7:	e8 26 b5 ff ff       	call   100dd2 <debug_panic>
+	assert(pi->refcount == 2 && ro->refcount == 2);
+  1058ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  1058af:	8b 40 04             	mov    0x4(%eax),%eax
+  1058b2:	83 f8 02             	cmp    $0x2,%eax
+  1058b5:	75 0b                	jne    1058c2 <pmap_check+0x1a1>
+  1058b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1058ba:	8b 40 04             	mov    0x4(%eax),%eax
+  1058bd:	83 f8 02             	cmp    $0x2,%eax
+  1058c0:	74 1f                	je     1058e1 <pmap_check+0x1c0>
+  1058c2:	8d 83 10 c1 ff ff    	lea    -0x3ef0(%ebx),%eax
+  1058c8:	50                   	push   %eax
+  1058c9:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1058cf:	50                   	push   %eax
+  1058d0:	68 7f 01 00 00       	push   $0x17f
+  1058d5:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1058db:	50                   	push   %eax
+  1058dc:	e8 f1 b4 ff ff       	call   100dd2 <debug_panic>
+	pte_t *ppte = pmap_walk(parent, va, 0);
+  1058e1:	83 ec 04             	sub    $0x4,%esp
+  1058e4:	6a 00                	push   $0x0
+  1058e6:	ff 75 f4             	push   -0xc(%ebp)
+  1058e9:	ff 75 ec             	push   -0x14(%ebp)
+  1058ec:	e8 f7 f1 ff ff       	call   104ae8 <pmap_walk>
+  1058f1:	83 c4 10             	add    $0x10,%esp
+  1058f4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	pte_t *cpte = pmap_walk(child, va, 0);
+  1058f7:	83 ec 04             	sub    $0x4,%esp
+  1058fa:	6a 00                	push   $0x0
+  1058fc:	ff 75 f4             	push   -0xc(%ebp)
+  1058ff:	ff 75 e8             	push   -0x18(%ebp)
+  105902:	e8 e1 f1 ff ff       	call   104ae8 <pmap_walk>
+  105907:	83 c4 10             	add    $0x10,%esp
+  10590a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	assert(PGADDR(*ppte) == mem_pi2phys(pi));
+  10590d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  105910:	8b 00                	mov    (%eax),%eax
+  105912:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105917:	89 c1                	mov    %eax,%ecx
+  105919:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  10591f:	8b 00                	mov    (%eax),%eax
+  105921:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105924:	29 c2                	sub    %eax,%edx
+  105926:	89 d0                	mov    %edx,%eax
+  105928:	c1 e0 09             	shl    $0x9,%eax
+  10592b:	39 c1                	cmp    %eax,%ecx
+  10592d:	74 1f                	je     10594e <pmap_check+0x22d>
+  10592f:	8d 83 38 c1 ff ff    	lea    -0x3ec8(%ebx),%eax
+  105935:	50                   	push   %eax
+  105936:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  10593c:	50                   	push   %eax
+  10593d:	68 82 01 00 00       	push   $0x182
+  105942:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105948:	50                   	push   %eax
+  105949:	e8 84 b4 ff ff       	call   100dd2 <debug_panic>
+	assert(PGADDR(*cpte) == mem_pi2phys(pi));
+  10594e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  105951:	8b 00                	mov    (%eax),%eax
+  105953:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105958:	89 c1                	mov    %eax,%ecx
+  10595a:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105960:	8b 00                	mov    (%eax),%eax
+  105962:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105965:	29 c2                	sub    %eax,%edx
+  105967:	89 d0                	mov    %edx,%eax
+  105969:	c1 e0 09             	shl    $0x9,%eax
+  10596c:	39 c1                	cmp    %eax,%ecx
+  10596e:	74 1f                	je     10598f <pmap_check+0x26e>
+  105970:	8d 83 5c c1 ff ff    	lea    -0x3ea4(%ebx),%eax
+  105976:	50                   	push   %eax
+  105977:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  10597d:	50                   	push   %eax
+  10597e:	68 83 01 00 00       	push   $0x183
+  105983:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105989:	50                   	push   %eax
+  10598a:	e8 43 b4 ff ff       	call   100dd2 <debug_panic>
+	assert((*ppte & (PTE_W | PTE_COW)) == PTE_COW);
+  10598f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  105992:	8b 00                	mov    (%eax),%eax
+  105994:	25 02 02 00 00       	and    $0x202,%eax
+  105999:	3d 00 02 00 00       	cmp    $0x200,%eax
+  10599e:	74 1f                	je     1059bf <pmap_check+0x29e>
+  1059a0:	8d 83 80 c1 ff ff    	lea    -0x3e80(%ebx),%eax
+  1059a6:	50                   	push   %eax
+  1059a7:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1059ad:	50                   	push   %eax
+  1059ae:	68 84 01 00 00       	push   $0x184
+  1059b3:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1059b9:	50                   	push   %eax
+  1059ba:	e8 13 b4 ff ff       	call   100dd2 <debug_panic>
+	assert((*cpte & (PTE_W | PTE_COW)) == PTE_COW);
+  1059bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1059c2:	8b 00                	mov    (%eax),%eax
+  1059c4:	25 02 02 00 00       	and    $0x202,%eax
+  1059c9:	3d 00 02 00 00       	cmp    $0x200,%eax
+  1059ce:	74 1f                	je     1059ef <pmap_check+0x2ce>
+  1059d0:	8d 83 a8 c1 ff ff    	lea    -0x3e58(%ebx),%eax
+  1059d6:	50                   	push   %eax
+  1059d7:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  1059dd:	50                   	push   %eax
+  1059de:	68 85 01 00 00       	push   $0x185
+  1059e3:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  1059e9:	50                   	push   %eax
+  1059ea:	e8 e3 b3 ff ff       	call   100dd2 <debug_panic>
+	assert(!(*pmap_walk(child, va + PAGESIZE, 0) & (PTE_W | PTE_COW)));
+  1059ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1059f2:	05 00 10 00 00       	add    $0x1000,%eax
+  1059f7:	83 ec 04             	sub    $0x4,%esp
+  1059fa:	6a 00                	push   $0x0
+  1059fc:	50                   	push   %eax
+  1059fd:	ff 75 e8             	push   -0x18(%ebp)
+  105a00:	e8 e3 f0 ff ff       	call   104ae8 <pmap_walk>
+  105a05:	83 c4 10             	add    $0x10,%esp
+  105a08:	8b 00                	mov    (%eax),%eax
+  105a0a:	25 02 02 00 00       	and    $0x202,%eax
+  105a0f:	85 c0                	test   %eax,%eax
+  105a11:	74 1f                	je     105a32 <pmap_check+0x311>
+  105a13:	8d 83 d0 c1 ff ff    	lea    -0x3e30(%ebx),%eax
+  105a19:	50                   	push   %eax
+  105a1a:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105a20:	50                   	push   %eax
+  105a21:	68 86 01 00 00       	push   $0x186
+  105a26:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105a2c:	50                   	push   %eax
+  105a2d:	e8 a0 b3 ff ff       	call   100dd2 <debug_panic>
+
+	// The child's first write gets it a copy of its own.
+	lcr3(mem_phys(child));
+  105a32:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  105a35:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+  105a38:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  105a3b:	0f 22 d8             	mov    %eax,%cr3
+}
+  105a3e:	90                   	nop
+	*(volatile char *) va = 'c';
+  105a3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105a42:	c6 00 63             	movb   $0x63,(%eax)
+	asm volatile("" ::: "memory");	// the fault changed memory under us
+	assert(pi->refcount == 1);
+  105a45:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105a48:	8b 40 04             	mov    0x4(%eax),%eax
+  105a4b:	83 f8 01             	cmp    $0x1,%eax
+  105a4e:	74 1f                	je     105a6f <pmap_check+0x34e>
+  105a50:	8d 83 0b c2 ff ff    	lea    -0x3df5(%ebx),%eax
+  105a56:	50                   	push   %eax
+  105a57:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105a5d:	50                   	push   %eax
+  105a5e:	68 8c 01 00 00       	push   $0x18c
+  105a63:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105a69:	50                   	push   %eax
+  105a6a:	e8 63 b3 ff ff       	call   100dd2 <debug_panic>
+	assert(PGADDR(*cpte) != mem_pi2phys(pi));
+  105a6f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  105a72:	8b 00                	mov    (%eax),%eax
+  105a74:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105a79:	89 c1                	mov    %eax,%ecx
+  105a7b:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105a81:	8b 00                	mov    (%eax),%eax
+  105a83:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105a86:	29 c2                	sub    %eax,%edx
+  105a88:	89 d0                	mov    %edx,%eax
+  105a8a:	c1 e0 09             	shl    $0x9,%eax
+  105a8d:	39 c1                	cmp    %eax,%ecx
+  105a8f:	75 1f                	jne    105ab0 <pmap_check+0x38f>
+  105a91:	8d 83 20 c2 ff ff    	lea    -0x3de0(%ebx),%eax
+  105a97:	50                   	push   %eax
+  105a98:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105a9e:	50                   	push   %eax
+  105a9f:	68 8d 01 00 00       	push   $0x18d
+  105aa4:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105aaa:	50                   	push   %eax
+  105aab:	e8 22 b3 ff ff       	call   100dd2 <debug_panic>
+	assert((*cpte & (PTE_W | PTE_COW)) == PTE_W);
+  105ab0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  105ab3:	8b 00                	mov    (%eax),%eax
+  105ab5:	25 02 02 00 00       	and    $0x202,%eax
+  105aba:	83 f8 02             	cmp    $0x2,%eax
+  105abd:	74 1f                	je     105ade <pmap_check+0x3bd>
+  105abf:	8d 83 44 c2 ff ff    	lea    -0x3dbc(%ebx),%eax
+  105ac5:	50                   	push   %eax
+  105ac6:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105acc:	50                   	push   %eax
+  105acd:	68 8e 01 00 00       	push   $0x18e
+  105ad2:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105ad8:	50                   	push   %eax
+  105ad9:	e8 f4 b2 ff ff       	call   100dd2 <debug_panic>
+	assert(((char *) mem_ptr(PGADDR(*cpte)))[0] == 'c');
+  105ade:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  105ae1:	8b 00                	mov    (%eax),%eax
+  105ae3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105ae8:	0f b6 00             	movzbl (%eax),%eax
+  105aeb:	3c 63                	cmp    $0x63,%al
+  105aed:	74 1f                	je     105b0e <pmap_check+0x3ed>
+  105aef:	8d 83 6c c2 ff ff    	lea    -0x3d94(%ebx),%eax
+  105af5:	50                   	push   %eax
+  105af6:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105afc:	50                   	push   %eax
+  105afd:	68 8f 01 00 00       	push   $0x18f
+  105b02:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105b08:	50                   	push   %eax
+  105b09:	e8 c4 b2 ff ff       	call   100dd2 <debug_panic>
+	assert(((char *) mem_ptr(PGADDR(*cpte)))[1] == 'p');
+  105b0e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  105b11:	8b 00                	mov    (%eax),%eax
+  105b13:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105b18:	83 c0 01             	add    $0x1,%eax
+  105b1b:	0f b6 00             	movzbl (%eax),%eax
+  105b1e:	3c 70                	cmp    $0x70,%al
+  105b20:	74 1f                	je     105b41 <pmap_check+0x420>
+  105b22:	8d 83 98 c2 ff ff    	lea    -0x3d68(%ebx),%eax
+  105b28:	50                   	push   %eax
+  105b29:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105b2f:	50                   	push   %eax
+  105b30:	68 90 01 00 00       	push   $0x190
+  105b35:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105b3b:	50                   	push   %eax
+  105b3c:	e8 91 b2 ff ff       	call   100dd2 <debug_panic>
+	assert(((char *) mem_pi2ptr(pi))[0] == 'p');
+  105b41:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105b47:	8b 00                	mov    (%eax),%eax
+  105b49:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105b4c:	29 c2                	sub    %eax,%edx
+  105b4e:	89 d0                	mov    %edx,%eax
+  105b50:	c1 e0 09             	shl    $0x9,%eax
+  105b53:	0f b6 00             	movzbl (%eax),%eax
+  105b56:	3c 70                	cmp    $0x70,%al
+  105b58:	74 1f                	je     105b79 <pmap_check+0x458>
+  105b5a:	8d 83 c4 c2 ff ff    	lea    -0x3d3c(%ebx),%eax
+  105b60:	50                   	push   %eax
+  105b61:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105b67:	50                   	push   %eax
+  105b68:	68 91 01 00 00       	push   $0x191
+  105b6d:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105b73:	50                   	push   %eax
+  105b74:	e8 59 b2 ff ff       	call   100dd2 <debug_panic>
+
+	// The parent now holds the only reference, so it keeps the page.
+	lcr3(mem_phys(parent));
+  105b79:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  105b7c:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+  105b7f:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  105b82:	0f 22 d8             	mov    %eax,%cr3
+}
+  105b85:	90                   	nop
+	*(volatile char *) va = 'q';
+  105b86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105b89:	c6 00 71             	movb   $0x71,(%eax)
+	asm volatile("" ::: "memory");
+	assert(PGADDR(*ppte) == mem_pi2phys(pi));
+  105b8c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  105b8f:	8b 00                	mov    (%eax),%eax
+  105b91:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105b96:	89 c1                	mov    %eax,%ecx
+  105b98:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105b9e:	8b 00                	mov    (%eax),%eax
+  105ba0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105ba3:	29 c2                	sub    %eax,%edx
+  105ba5:	89 d0                	mov    %edx,%eax
+  105ba7:	c1 e0 09             	shl    $0x9,%eax
+  105baa:	39 c1                	cmp    %eax,%ecx
+  105bac:	74 1f                	je     105bcd <pmap_check+0x4ac>
+  105bae:	8d 83 38 c1 ff ff    	lea    -0x3ec8(%ebx),%eax
+  105bb4:	50                   	push   %eax
+  105bb5:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105bbb:	50                   	push   %eax
+  105bbc:	68 97 01 00 00       	push   $0x197
+  105bc1:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105bc7:	50                   	push   %eax
+  105bc8:	e8 05 b2 ff ff       	call   100dd2 <debug_panic>
+	assert((*ppte & (PTE_W | PTE_COW)) == PTE_W);
+  105bcd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  105bd0:	8b 00                	mov    (%eax),%eax
+  105bd2:	25 02 02 00 00       	and    $0x202,%eax
+  105bd7:	83 f8 02             	cmp    $0x2,%eax
+  105bda:	74 1f                	je     105bfb <pmap_check+0x4da>
+  105bdc:	8d 83 e8 c2 ff ff    	lea    -0x3d18(%ebx),%eax
+  105be2:	50                   	push   %eax
+  105be3:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105be9:	50                   	push   %eax
+  105bea:	68 98 01 00 00       	push   $0x198
+  105bef:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105bf5:	50                   	push   %eax
+  105bf6:	e8 d7 b1 ff ff       	call   100dd2 <debug_panic>
+	assert(((char *) mem_pi2ptr(pi))[0] == 'q');
+  105bfb:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105c01:	8b 00                	mov    (%eax),%eax
+  105c03:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105c06:	29 c2                	sub    %eax,%edx
+  105c08:	89 d0                	mov    %edx,%eax
+  105c0a:	c1 e0 09             	shl    $0x9,%eax
+  105c0d:	0f b6 00             	movzbl (%eax),%eax
+  105c10:	3c 71                	cmp    $0x71,%al
+  105c12:	74 1f                	je     105c33 <pmap_check+0x512>
+  105c14:	8d 83 10 c3 ff ff    	lea    -0x3cf0(%ebx),%eax
+  105c1a:	50                   	push   %eax
+  105c1b:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105c21:	50                   	push   %eax
+  105c22:	68 99 01 00 00       	push   $0x199
+  105c27:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105c2d:	50                   	push   %eax
+  105c2e:	e8 9f b1 ff ff       	call   100dd2 <debug_panic>
+
+	// Zero-fill memory reads as zeros from the shared page,
+	// and gets a page of its own only where written.
+	uint32_t zva = va + 2*PAGESIZE;
+  105c33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105c36:	05 00 20 00 00       	add    $0x2000,%eax
+  105c3b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	assert(pmap_zerofill(parent, zva, 2*PAGESIZE, PTE_W | PTE_U));
+  105c3e:	6a 06                	push   $0x6
+  105c40:	68 00 20 00 00       	push   $0x2000
+  105c45:	ff 75 d4             	push   -0x2c(%ebp)
+  105c48:	ff 75 ec             	push   -0x14(%ebp)
+  105c4b:	e8 4d f0 ff ff       	call   104c9d <pmap_zerofill>
+  105c50:	83 c4 10             	add    $0x10,%esp
+  105c53:	85 c0                	test   %eax,%eax
+  105c55:	75 1f                	jne    105c76 <pmap_check+0x555>
+  105c57:	8d 83 34 c3 ff ff    	lea    -0x3ccc(%ebx),%eax
+  105c5d:	50                   	push   %eax
+  105c5e:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105c64:	50                   	push   %eax
+  105c65:	68 9e 01 00 00       	push   $0x19e
+  105c6a:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105c70:	50                   	push   %eax
+  105c71:	e8 5c b1 ff ff       	call   100dd2 <debug_panic>
+	pte_t *zpte0 = pmap_walk(parent, zva, 0);
+  105c76:	83 ec 04             	sub    $0x4,%esp
+  105c79:	6a 00                	push   $0x0
+  105c7b:	ff 75 d4             	push   -0x2c(%ebp)
+  105c7e:	ff 75 ec             	push   -0x14(%ebp)
+  105c81:	e8 62 ee ff ff       	call   104ae8 <pmap_walk>
+  105c86:	83 c4 10             	add    $0x10,%esp
+  105c89:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	pte_t *zpte1 = pmap_walk(parent, zva + PAGESIZE, 0);
+  105c8c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  105c8f:	05 00 10 00 00       	add    $0x1000,%eax
+  105c94:	83 ec 04             	sub    $0x4,%esp
+  105c97:	6a 00                	push   $0x0
+  105c99:	50                   	push   %eax
+  105c9a:	ff 75 ec             	push   -0x14(%ebp)
+  105c9d:	e8 46 ee ff ff       	call   104ae8 <pmap_walk>
+  105ca2:	83 c4 10             	add    $0x10,%esp
+  105ca5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	assert(((volatile char *) zva)[PAGESIZE-1] == 0);
+  105ca8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  105cab:	05 ff 0f 00 00       	add    $0xfff,%eax
+  105cb0:	0f b6 00             	movzbl (%eax),%eax
+  105cb3:	84 c0                	test   %al,%al
+  105cb5:	74 1f                	je     105cd6 <pmap_check+0x5b5>
+  105cb7:	8d 83 6c c3 ff ff    	lea    -0x3c94(%ebx),%eax
+  105cbd:	50                   	push   %eax
+  105cbe:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105cc4:	50                   	push   %eax
+  105cc5:	68 a1 01 00 00       	push   $0x1a1
+  105cca:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105cd0:	50                   	push   %eax
+  105cd1:	e8 fc b0 ff ff       	call   100dd2 <debug_panic>
+	assert(PGADDR(*zpte0) == mem_phys(pmap_zero));
+  105cd6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105cd9:	8b 00                	mov    (%eax),%eax
+  105cdb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105ce0:	89 c2                	mov    %eax,%edx
+  105ce2:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  105ce8:	39 c2                	cmp    %eax,%edx
+  105cea:	74 1f                	je     105d0b <pmap_check+0x5ea>
+  105cec:	8d 83 98 c3 ff ff    	lea    -0x3c68(%ebx),%eax
+  105cf2:	50                   	push   %eax
+  105cf3:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105cf9:	50                   	push   %eax
+  105cfa:	68 a2 01 00 00       	push   $0x1a2
+  105cff:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105d05:	50                   	push   %eax
+  105d06:	e8 c7 b0 ff ff       	call   100dd2 <debug_panic>
+	*(volatile char *) zva = 'z';
+  105d0b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  105d0e:	c6 00 7a             	movb   $0x7a,(%eax)
+	asm volatile("" ::: "memory");
+	assert(PGADDR(*zpte0) != mem_phys(pmap_zero));
+  105d11:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105d14:	8b 00                	mov    (%eax),%eax
+  105d16:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105d1b:	89 c2                	mov    %eax,%edx
+  105d1d:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  105d23:	39 c2                	cmp    %eax,%edx
+  105d25:	75 1f                	jne    105d46 <pmap_check+0x625>
+  105d27:	8d 83 c0 c3 ff ff    	lea    -0x3c40(%ebx),%eax
+  105d2d:	50                   	push   %eax
+  105d2e:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105d34:	50                   	push   %eax
+  105d35:	68 a5 01 00 00       	push   $0x1a5
+  105d3a:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105d40:	50                   	push   %eax
+  105d41:	e8 8c b0 ff ff       	call   100dd2 <debug_panic>
+	assert(mem_phys2pi(PGADDR(*zpte0))->refcount == 1);
+  105d46:	c7 c0 54 34 12 00    	mov    $0x123454,%eax
+  105d4c:	8b 10                	mov    (%eax),%edx
+  105d4e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105d51:	8b 00                	mov    (%eax),%eax
+  105d53:	c1 e8 0c             	shr    $0xc,%eax
+  105d56:	c1 e0 03             	shl    $0x3,%eax
+  105d59:	01 d0                	add    %edx,%eax
+  105d5b:	8b 40 04             	mov    0x4(%eax),%eax
+  105d5e:	83 f8 01             	cmp    $0x1,%eax
+  105d61:	74 1f                	je     105d82 <pmap_check+0x661>
+  105d63:	8d 83 e8 c3 ff ff    	lea    -0x3c18(%ebx),%eax
+  105d69:	50                   	push   %eax
+  105d6a:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105d70:	50                   	push   %eax
+  105d71:	68 a6 01 00 00       	push   $0x1a6
+  105d76:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105d7c:	50                   	push   %eax
+  105d7d:	e8 50 b0 ff ff       	call   100dd2 <debug_panic>
+	assert(((char *) mem_ptr(PGADDR(*zpte0)))[0] == 'z');
+  105d82:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105d85:	8b 00                	mov    (%eax),%eax
+  105d87:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105d8c:	0f b6 00             	movzbl (%eax),%eax
+  105d8f:	3c 7a                	cmp    $0x7a,%al
+  105d91:	74 1f                	je     105db2 <pmap_check+0x691>
+  105d93:	8d 83 14 c4 ff ff    	lea    -0x3bec(%ebx),%eax
+  105d99:	50                   	push   %eax
+  105d9a:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105da0:	50                   	push   %eax
+  105da1:	68 a7 01 00 00       	push   $0x1a7
+  105da6:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105dac:	50                   	push   %eax
+  105dad:	e8 20 b0 ff ff       	call   100dd2 <debug_panic>
+	assert(((char *) mem_ptr(PGADDR(*zpte0)))[1] == 0);
+  105db2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105db5:	8b 00                	mov    (%eax),%eax
+  105db7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105dbc:	83 c0 01             	add    $0x1,%eax
+  105dbf:	0f b6 00             	movzbl (%eax),%eax
+  105dc2:	84 c0                	test   %al,%al
+  105dc4:	74 1f                	je     105de5 <pmap_check+0x6c4>
+  105dc6:	8d 83 44 c4 ff ff    	lea    -0x3bbc(%ebx),%eax
+  105dcc:	50                   	push   %eax
+  105dcd:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105dd3:	50                   	push   %eax
+  105dd4:	68 a8 01 00 00       	push   $0x1a8
+  105dd9:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105ddf:	50                   	push   %eax
+  105de0:	e8 ed af ff ff       	call   100dd2 <debug_panic>
+	assert(PGADDR(*zpte1) == mem_phys(pmap_zero));
+  105de5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  105de8:	8b 00                	mov    (%eax),%eax
+  105dea:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  105def:	89 c2                	mov    %eax,%edx
+  105df1:	8d 83 0c a0 02 00    	lea    0x2a00c(%ebx),%eax
+  105df7:	39 c2                	cmp    %eax,%edx
+  105df9:	74 1f                	je     105e1a <pmap_check+0x6f9>
+  105dfb:	8d 83 70 c4 ff ff    	lea    -0x3b90(%ebx),%eax
+  105e01:	50                   	push   %eax
+  105e02:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105e08:	50                   	push   %eax
+  105e09:	68 a9 01 00 00       	push   $0x1a9
+  105e0e:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105e14:	50                   	push   %eax
+  105e15:	e8 b8 af ff ff       	call   100dd2 <debug_panic>
+	assert(pmap_zero[0] == 0);
+  105e1a:	0f b6 83 0c a0 02 00 	movzbl 0x2a00c(%ebx),%eax
+  105e21:	84 c0                	test   %al,%al
+  105e23:	74 1f                	je     105e44 <pmap_check+0x723>
+  105e25:	8d 83 96 c4 ff ff    	lea    -0x3b6a(%ebx),%eax
+  105e2b:	50                   	push   %eax
+  105e2c:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105e32:	50                   	push   %eax
+  105e33:	68 aa 01 00 00       	push   $0x1aa
+  105e38:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105e3e:	50                   	push   %eax
+  105e3f:	e8 8e af ff ff       	call   100dd2 <debug_panic>
+  105e44:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  105e47:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+  105e4a:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  105e4d:	0f 22 d8             	mov    %eax,%cr3
+}
+  105e50:	90                   	nop
+	lcr3(cr3);
+
+	pmap_freepdir(child);
+  105e51:	83 ec 0c             	sub    $0xc,%esp
+  105e54:	ff 75 e8             	push   -0x18(%ebp)
+  105e57:	e8 3d ec ff ff       	call   104a99 <pmap_freepdir>
+  105e5c:	83 c4 10             	add    $0x10,%esp
+	pmap_freepdir(parent);
+  105e5f:	83 ec 0c             	sub    $0xc,%esp
+  105e62:	ff 75 ec             	push   -0x14(%ebp)
+  105e65:	e8 2f ec ff ff       	call   104a99 <pmap_freepdir>
+  105e6a:	83 c4 10             	add    $0x10,%esp
+	assert(pi->refcount == 0 && ro->refcount == 0);
+  105e6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105e70:	8b 40 04             	mov    0x4(%eax),%eax
+  105e73:	85 c0                	test   %eax,%eax
+  105e75:	75 0a                	jne    105e81 <pmap_check+0x760>
+  105e77:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  105e7a:	8b 40 04             	mov    0x4(%eax),%eax
+  105e7d:	85 c0                	test   %eax,%eax
+  105e7f:	74 1f                	je     105ea0 <pmap_check+0x77f>
+  105e81:	8d 83 a8 c4 ff ff    	lea    -0x3b58(%ebx),%eax
+  105e87:	50                   	push   %eax
+  105e88:	8d 83 26 be ff ff    	lea    -0x41da(%ebx),%eax
+  105e8e:	50                   	push   %eax
+  105e8f:	68 af 01 00 00       	push   $0x1af
+  105e94:	8d 83 6a be ff ff    	lea    -0x4196(%ebx),%eax
+  105e9a:	50                   	push   %eax
+  105e9b:	e8 32 af ff ff       	call   100dd2 <debug_panic>
+
+	cprintf("pmap_check() succeeded!\n");
+  105ea0:	83 ec 0c             	sub    $0xc,%esp
+  105ea3:	8d 83 cf c4 ff ff    	lea    -0x3b31(%ebx),%eax
+  105ea9:	50                   	push   %eax
+  105eaa:	e8 66 1d 00 00       	call   107c15 <cprintf>
+  105eaf:	83 c4 10             	add    $0x10,%esp
+}
+  105eb2:	90                   	nop
+  105eb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  105eb6:	c9                   	leave
+  105eb7:	c3                   	ret
+
+00105eb8 <video_dirty>:
+static void video_scroll(void);
+
+// Note that cells [lo,hi) of crt_buf need copying to crt_hwbuf.
+static inline void
+video_dirty(uint16_t lo, uint16_t hi)
+{
+  105eb8:	55                   	push   %ebp
+  105eb9:	89 e5                	mov    %esp,%ebp
+  105ebb:	83 ec 08             	sub    $0x8,%esp
+  105ebe:	e8 4d a5 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  105ec3:	05 31 81 00 00       	add    $0x8131,%eax
+  105ec8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  105ecb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  105ece:	66 89 4d fc          	mov    %cx,-0x4(%ebp)
+  105ed2:	66 89 55 f8          	mov    %dx,-0x8(%ebp)
+	if (lo < crt_dirtylo)
+  105ed6:	0f b7 90 4c 30 03 00 	movzwl 0x3304c(%eax),%edx
+  105edd:	66 39 55 fc          	cmp    %dx,-0x4(%ebp)
+  105ee1:	73 0b                	jae    105eee <video_dirty+0x36>
+		crt_dirtylo = lo;
+  105ee3:	0f b7 55 fc          	movzwl -0x4(%ebp),%edx
+  105ee7:	66 89 90 4c 30 03 00 	mov    %dx,0x3304c(%eax)
+	if (hi > crt_dirtyhi)
+  105eee:	0f b7 90 4e 30 03 00 	movzwl 0x3304e(%eax),%edx
+  105ef5:	66 3b 55 f8          	cmp    -0x8(%ebp),%dx
+  105ef9:	73 0b                	jae    105f06 <video_dirty+0x4e>
+		crt_dirtyhi = hi;
+  105efb:	0f b7 55 f8          	movzwl -0x8(%ebp),%edx
+  105eff:	66 89 90 4e 30 03 00 	mov    %dx,0x3304e(%eax)
+}
+  105f06:	90                   	nop
+  105f07:	c9                   	leave
+  105f08:	c3                   	ret
+
+00105f09 <video_init>:
+
+void
+video_init(void)
+{
+  105f09:	55                   	push   %ebp
+  105f0a:	89 e5                	mov    %esp,%ebp
+  105f0c:	53                   	push   %ebx
+  105f0d:	83 ec 54             	sub    $0x54,%esp
+  105f10:	e8 ff a4 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  105f15:	81 c3 df 80 00 00    	add    $0x80df,%ebx
+	volatile uint16_t *cp;
+	uint16_t was;
+	unsigned pos, start;
+
+	/* Get a pointer to the memory-mapped text display buffer. */
+	cp = (uint16_t*) mem_ptr(CGA_BUF);
+  105f1b:	c7 45 f4 00 80 0b 00 	movl   $0xb8000,-0xc(%ebp)
+	was = *cp;
+  105f22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105f25:	0f b7 00             	movzwl (%eax),%eax
+  105f28:	66 89 45 ea          	mov    %ax,-0x16(%ebp)
+	*cp = (uint16_t) 0xA55A;
+  105f2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105f2f:	66 c7 00 5a a5       	movw   $0xa55a,(%eax)
+	if (*cp != 0xA55A) {
+  105f34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105f37:	0f b7 00             	movzwl (%eax),%eax
+  105f3a:	66 3d 5a a5          	cmp    $0xa55a,%ax
+  105f3e:	74 1c                	je     105f5c <video_init+0x53>
+		cp = (uint16_t*) mem_ptr(MONO_BUF);
+  105f40:	c7 45 f4 00 00 0b 00 	movl   $0xb0000,-0xc(%ebp)
+		addr_6845 = MONO_BASE;
+  105f47:	c7 83 0c b0 02 00 b4 	movl   $0x3b4,0x2b00c(%ebx)
+  105f4e:	03 00 00 
+		crt_bufsize = CRT_SIZE;		// no room to scroll in
+  105f51:	66 c7 83 1e b0 02 00 	movw   $0x7d0,0x2b01e(%ebx)
+  105f58:	d0 07 
+  105f5a:	eb 1d                	jmp    105f79 <video_init+0x70>
+	} else {
+		*cp = was;
+  105f5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  105f5f:	0f b7 55 ea          	movzwl -0x16(%ebp),%edx
+  105f63:	66 89 10             	mov    %dx,(%eax)
+		addr_6845 = CGA_BASE;
+  105f66:	c7 83 0c b0 02 00 d4 	movl   $0x3d4,0x2b00c(%ebx)
+  105f6d:	03 00 00 
+		crt_bufsize = CGA_BUFSIZE;
+  105f70:	66 c7 83 1e b0 02 00 	movw   $0x4000,0x2b01e(%ebx)
+  105f77:	00 40 
+	}
+	
+	/* Extract cursor location */
+	outb(addr_6845, 14);
+  105f79:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  105f7f:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  105f82:	c6 45 ab 0e          	movb   $0xe,-0x55(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  105f86:	0f b6 45 ab          	movzbl -0x55(%ebp),%eax
+  105f8a:	8b 55 ac             	mov    -0x54(%ebp),%edx
+  105f8d:	ee                   	out    %al,(%dx)
+}
+  105f8e:	90                   	nop
+	pos = inb(addr_6845 + 1) << 8;
+  105f8f:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  105f95:	83 c0 01             	add    $0x1,%eax
+  105f98:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  105f9b:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  105f9e:	89 c2                	mov    %eax,%edx
+  105fa0:	ec                   	in     (%dx),%al
+  105fa1:	88 45 b3             	mov    %al,-0x4d(%ebp)
+	return data;
+  105fa4:	0f b6 45 b3          	movzbl -0x4d(%ebp),%eax
+  105fa8:	0f b6 c0             	movzbl %al,%eax
+  105fab:	c1 e0 08             	shl    $0x8,%eax
+  105fae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	outb(addr_6845, 15);
+  105fb1:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  105fb7:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  105fba:	c6 45 bb 0f          	movb   $0xf,-0x45(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  105fbe:	0f b6 45 bb          	movzbl -0x45(%ebp),%eax
+  105fc2:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  105fc5:	ee                   	out    %al,(%dx)
+}
+  105fc6:	90                   	nop
+	pos |= inb(addr_6845 + 1);
+  105fc7:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  105fcd:	83 c0 01             	add    $0x1,%eax
+  105fd0:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  105fd3:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  105fd6:	89 c2                	mov    %eax,%edx
+  105fd8:	ec                   	in     (%dx),%al
+  105fd9:	88 45 c3             	mov    %al,-0x3d(%ebp)
+	return data;
+  105fdc:	0f b6 45 c3          	movzbl -0x3d(%ebp),%eax
+  105fe0:	0f b6 c0             	movzbl %al,%eax
+  105fe3:	09 45 f0             	or     %eax,-0x10(%ebp)
+
+	/* Extract display start address */
+	outb(addr_6845, 12);
+  105fe6:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  105fec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  105fef:	c6 45 cb 0c          	movb   $0xc,-0x35(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  105ff3:	0f b6 45 cb          	movzbl -0x35(%ebp),%eax
+  105ff7:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  105ffa:	ee                   	out    %al,(%dx)
+}
+  105ffb:	90                   	nop
+	start = inb(addr_6845 + 1) << 8;
+  105ffc:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  106002:	83 c0 01             	add    $0x1,%eax
+  106005:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106008:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  10600b:	89 c2                	mov    %eax,%edx
+  10600d:	ec                   	in     (%dx),%al
+  10600e:	88 45 d3             	mov    %al,-0x2d(%ebp)
+	return data;
+  106011:	0f b6 45 d3          	movzbl -0x2d(%ebp),%eax
+  106015:	0f b6 c0             	movzbl %al,%eax
+  106018:	c1 e0 08             	shl    $0x8,%eax
+  10601b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	outb(addr_6845, 13);
+  10601e:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  106024:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  106027:	c6 45 db 0d          	movb   $0xd,-0x25(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10602b:	0f b6 45 db          	movzbl -0x25(%ebp),%eax
+  10602f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  106032:	ee                   	out    %al,(%dx)
+}
+  106033:	90                   	nop
+	start |= inb(addr_6845 + 1);
+  106034:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  10603a:	83 c0 01             	add    $0x1,%eax
+  10603d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106040:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  106043:	89 c2                	mov    %eax,%edx
+  106045:	ec                   	in     (%dx),%al
+  106046:	88 45 e3             	mov    %al,-0x1d(%ebp)
+	return data;
+  106049:	0f b6 45 e3          	movzbl -0x1d(%ebp),%eax
+  10604d:	0f b6 c0             	movzbl %al,%eax
+  106050:	09 45 ec             	or     %eax,-0x14(%ebp)
+	if (start + CRT_SIZE > crt_bufsize || pos < start
+  106053:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  106056:	05 d0 07 00 00       	add    $0x7d0,%eax
+  10605b:	0f b7 93 1e b0 02 00 	movzwl 0x2b01e(%ebx),%edx
+  106062:	0f b7 d2             	movzwl %dx,%edx
+  106065:	39 c2                	cmp    %eax,%edx
+  106067:	72 15                	jb     10607e <video_init+0x175>
+  106069:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  10606c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+  10606f:	72 0d                	jb     10607e <video_init+0x175>
+			|| pos >= start + CRT_SIZE)
+  106071:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  106074:	05 d0 07 00 00       	add    $0x7d0,%eax
+  106079:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+  10607c:	72 0d                	jb     10608b <video_init+0x182>
+		start = pos = 0;	// not a state we left: start over
+  10607e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  106085:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  106088:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+	crt_hwbuf = (uint16_t*) cp;
+  10608b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  10608e:	89 83 10 b0 02 00    	mov    %eax,0x2b010(%ebx)
+	crt_buf = crt_shadow;
+  106094:	8d 83 4c b0 02 00    	lea    0x2b04c(%ebx),%eax
+  10609a:	89 83 14 b0 02 00    	mov    %eax,0x2b014(%ebx)
+	memmove(crt_buf, crt_hwbuf, crt_bufsize * sizeof(uint16_t));
+  1060a0:	0f b7 83 1e b0 02 00 	movzwl 0x2b01e(%ebx),%eax
+  1060a7:	0f b7 c0             	movzwl %ax,%eax
+  1060aa:	8d 0c 00             	lea    (%eax,%eax,1),%ecx
+  1060ad:	8b 93 10 b0 02 00    	mov    0x2b010(%ebx),%edx
+  1060b3:	8b 83 14 b0 02 00    	mov    0x2b014(%ebx),%eax
+  1060b9:	83 ec 04             	sub    $0x4,%esp
+  1060bc:	51                   	push   %ecx
+  1060bd:	52                   	push   %edx
+  1060be:	50                   	push   %eax
+  1060bf:	e8 64 1e 00 00       	call   107f28 <memmove>
+  1060c4:	83 c4 10             	add    $0x10,%esp
+	crt_dirtylo = crt_bufsize;
+  1060c7:	0f b7 83 1e b0 02 00 	movzwl 0x2b01e(%ebx),%eax
+  1060ce:	66 89 83 4c 30 03 00 	mov    %ax,0x3304c(%ebx)
+	crt_dirtyhi = 0;
+  1060d5:	66 c7 83 4e 30 03 00 	movw   $0x0,0x3304e(%ebx)
+  1060dc:	00 00 
+
+	crt_pos = pos;
+  1060de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  1060e1:	66 89 83 18 b0 02 00 	mov    %ax,0x2b018(%ebx)
+	crt_start = crt_hwstart = start;
+  1060e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1060eb:	66 89 83 1c b0 02 00 	mov    %ax,0x2b01c(%ebx)
+  1060f2:	0f b7 83 1c b0 02 00 	movzwl 0x2b01c(%ebx),%eax
+  1060f9:	66 89 83 1a b0 02 00 	mov    %ax,0x2b01a(%ebx)
+}
+  106100:	90                   	nop
+  106101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106104:	c9                   	leave
+  106105:	c3                   	ret
+
+00106106 <video_emit>:
+
+// Store one character in the display buffer,
+// scrolling if necessary, but without moving the hardware cursor.
+static void
+video_emit(int c)
+{
+  106106:	55                   	push   %ebp
+  106107:	89 e5                	mov    %esp,%ebp
+  106109:	56                   	push   %esi
+  10610a:	53                   	push   %ebx
+  10610b:	83 ec 10             	sub    $0x10,%esp
+  10610e:	e8 01 a3 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106113:	81 c3 e1 7e 00 00    	add    $0x7ee1,%ebx
+	// if no attribute given, then use black on white
+	if (!(c & ~0xFF))
+  106119:	8b 45 08             	mov    0x8(%ebp),%eax
+  10611c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  106121:	77 07                	ja     10612a <video_emit+0x24>
+		c |= 0x0700;
+  106123:	81 4d 08 00 07 00 00 	orl    $0x700,0x8(%ebp)
+
+	switch (c & 0xff) {
+  10612a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10612d:	0f b6 c0             	movzbl %al,%eax
+  106130:	83 f8 0d             	cmp    $0xd,%eax
+  106133:	0f 84 b0 00 00 00    	je     1061e9 <video_emit+0xe3>
+  106139:	83 f8 0d             	cmp    $0xd,%eax
+  10613c:	0f 8f 5f 01 00 00    	jg     1062a1 <video_emit+0x19b>
+  106142:	83 f8 0a             	cmp    $0xa,%eax
+  106145:	0f 84 8d 00 00 00    	je     1061d8 <video_emit+0xd2>
+  10614b:	83 f8 0a             	cmp    $0xa,%eax
+  10614e:	0f 8f 4d 01 00 00    	jg     1062a1 <video_emit+0x19b>
+  106154:	83 f8 08             	cmp    $0x8,%eax
+  106157:	74 0e                	je     106167 <video_emit+0x61>
+  106159:	83 f8 09             	cmp    $0x9,%eax
+  10615c:	0f 84 d7 00 00 00    	je     106239 <video_emit+0x133>
+  106162:	e9 3a 01 00 00       	jmp    1062a1 <video_emit+0x19b>
+	case '\b':
+		if (crt_pos > crt_start) {
+  106167:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  10616e:	0f b7 93 1a b0 02 00 	movzwl 0x2b01a(%ebx),%edx
+  106175:	66 39 c2             	cmp    %ax,%dx
+  106178:	0f 83 6d 01 00 00    	jae    1062eb <video_emit+0x1e5>
+			crt_pos--;
+  10617e:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  106185:	83 e8 01             	sub    $0x1,%eax
+  106188:	66 89 83 18 b0 02 00 	mov    %ax,0x2b018(%ebx)
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+  10618f:	8b 45 08             	mov    0x8(%ebp),%eax
+  106192:	b0 00                	mov    $0x0,%al
+  106194:	83 c8 20             	or     $0x20,%eax
+  106197:	89 c1                	mov    %eax,%ecx
+  106199:	8b 83 14 b0 02 00    	mov    0x2b014(%ebx),%eax
+  10619f:	0f b7 93 18 b0 02 00 	movzwl 0x2b018(%ebx),%edx
+  1061a6:	0f b7 d2             	movzwl %dx,%edx
+  1061a9:	01 d2                	add    %edx,%edx
+  1061ab:	01 d0                	add    %edx,%eax
+  1061ad:	89 ca                	mov    %ecx,%edx
+  1061af:	66 89 10             	mov    %dx,(%eax)
+			video_dirty(crt_pos, crt_pos + 1);
+  1061b2:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1061b9:	83 c0 01             	add    $0x1,%eax
+  1061bc:	0f b7 d0             	movzwl %ax,%edx
+  1061bf:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1061c6:	0f b7 c0             	movzwl %ax,%eax
+  1061c9:	52                   	push   %edx
+  1061ca:	50                   	push   %eax
+  1061cb:	e8 e8 fc ff ff       	call   105eb8 <video_dirty>
+  1061d0:	83 c4 08             	add    $0x8,%esp
+		}
+		break;
+  1061d3:	e9 13 01 00 00       	jmp    1062eb <video_emit+0x1e5>
+	case '\n':
+		crt_pos += CRT_COLS;
+  1061d8:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1061df:	83 c0 50             	add    $0x50,%eax
+  1061e2:	66 89 83 18 b0 02 00 	mov    %ax,0x2b018(%ebx)
+		/* fallthru */
+	case '\r':
+		crt_pos -= ((crt_pos - crt_start) % CRT_COLS);
+  1061e9:	0f b7 b3 18 b0 02 00 	movzwl 0x2b018(%ebx),%esi
+  1061f0:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1061f7:	0f b7 d0             	movzwl %ax,%edx
+  1061fa:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106201:	0f b7 c0             	movzwl %ax,%eax
+  106204:	89 d1                	mov    %edx,%ecx
+  106206:	29 c1                	sub    %eax,%ecx
+  106208:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  10620d:	89 c8                	mov    %ecx,%eax
+  10620f:	f7 ea                	imul   %edx
+  106211:	c1 fa 05             	sar    $0x5,%edx
+  106214:	89 c8                	mov    %ecx,%eax
+  106216:	c1 f8 1f             	sar    $0x1f,%eax
+  106219:	29 c2                	sub    %eax,%edx
+  10621b:	89 d0                	mov    %edx,%eax
+  10621d:	c1 e0 02             	shl    $0x2,%eax
+  106220:	01 d0                	add    %edx,%eax
+  106222:	c1 e0 04             	shl    $0x4,%eax
+  106225:	29 c1                	sub    %eax,%ecx
+  106227:	89 ca                	mov    %ecx,%edx
+  106229:	89 f0                	mov    %esi,%eax
+  10622b:	29 d0                	sub    %edx,%eax
+  10622d:	66 89 83 18 b0 02 00 	mov    %ax,0x2b018(%ebx)
+		break;
+  106234:	e9 b3 00 00 00       	jmp    1062ec <video_emit+0x1e6>
+	case '\t': {
+		// Expand to TAB_SIZE spaces in place.
+		int i;
+		for (i = 0; i < TAB_SIZE; i++) {
+  106239:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  106240:	eb 57                	jmp    106299 <video_emit+0x193>
+			video_dirty(crt_pos, crt_pos + 1);
+  106242:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  106249:	83 c0 01             	add    $0x1,%eax
+  10624c:	0f b7 d0             	movzwl %ax,%edx
+  10624f:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  106256:	0f b7 c0             	movzwl %ax,%eax
+  106259:	52                   	push   %edx
+  10625a:	50                   	push   %eax
+  10625b:	e8 58 fc ff ff       	call   105eb8 <video_dirty>
+  106260:	83 c4 08             	add    $0x8,%esp
+			crt_buf[crt_pos++] = (c & ~0xff) | ' ';
+  106263:	8b 45 08             	mov    0x8(%ebp),%eax
+  106266:	b0 00                	mov    $0x0,%al
+  106268:	83 c8 20             	or     $0x20,%eax
+  10626b:	89 c6                	mov    %eax,%esi
+  10626d:	8b 8b 14 b0 02 00    	mov    0x2b014(%ebx),%ecx
+  106273:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  10627a:	8d 50 01             	lea    0x1(%eax),%edx
+  10627d:	66 89 93 18 b0 02 00 	mov    %dx,0x2b018(%ebx)
+  106284:	0f b7 c0             	movzwl %ax,%eax
+  106287:	01 c0                	add    %eax,%eax
+  106289:	01 c8                	add    %ecx,%eax
+  10628b:	89 f2                	mov    %esi,%edx
+  10628d:	66 89 10             	mov    %dx,(%eax)
+			video_scroll();
+  106290:	e8 64 00 00 00       	call   1062f9 <video_scroll>
+		for (i = 0; i < TAB_SIZE; i++) {
+  106295:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  106299:	83 7d f4 04          	cmpl   $0x4,-0xc(%ebp)
+  10629d:	7e a3                	jle    106242 <video_emit+0x13c>
+		}
+		break;
+  10629f:	eb 4b                	jmp    1062ec <video_emit+0x1e6>
+	}
+	default:
+		video_dirty(crt_pos, crt_pos + 1);
+  1062a1:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1062a8:	83 c0 01             	add    $0x1,%eax
+  1062ab:	0f b7 d0             	movzwl %ax,%edx
+  1062ae:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1062b5:	0f b7 c0             	movzwl %ax,%eax
+  1062b8:	83 ec 08             	sub    $0x8,%esp
+  1062bb:	52                   	push   %edx
+  1062bc:	50                   	push   %eax
+  1062bd:	e8 f6 fb ff ff       	call   105eb8 <video_dirty>
+  1062c2:	83 c4 10             	add    $0x10,%esp
+		crt_buf[crt_pos++] = c;		/* write the character */
+  1062c5:	8b 8b 14 b0 02 00    	mov    0x2b014(%ebx),%ecx
+  1062cb:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1062d2:	8d 50 01             	lea    0x1(%eax),%edx
+  1062d5:	66 89 93 18 b0 02 00 	mov    %dx,0x2b018(%ebx)
+  1062dc:	0f b7 c0             	movzwl %ax,%eax
+  1062df:	01 c0                	add    %eax,%eax
+  1062e1:	01 c8                	add    %ecx,%eax
+  1062e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  1062e6:	66 89 10             	mov    %dx,(%eax)
+		break;
+  1062e9:	eb 01                	jmp    1062ec <video_emit+0x1e6>
+		break;
+  1062eb:	90                   	nop
+	}
+
+	video_scroll();
+  1062ec:	e8 08 00 00 00       	call   1062f9 <video_scroll>
+}
+  1062f1:	90                   	nop
+  1062f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  1062f5:	5b                   	pop    %ebx
+  1062f6:	5e                   	pop    %esi
+  1062f7:	5d                   	pop    %ebp
+  1062f8:	c3                   	ret
+
+001062f9 <video_scroll>:
+// We scroll by moving the 6845's display start address down through
+// text memory, and only copy the screen back to the beginning
+// when the window reaches the end of text memory.
+static void
+video_scroll(void)
+{
+  1062f9:	55                   	push   %ebp
+  1062fa:	89 e5                	mov    %esp,%ebp
+  1062fc:	53                   	push   %ebx
+  1062fd:	83 ec 14             	sub    $0x14,%esp
+  106300:	e8 0f a1 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106305:	81 c3 ef 7c 00 00    	add    $0x7cef,%ebx
+	if (crt_pos >= crt_start + CRT_SIZE) {
+  10630b:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106312:	0f b7 c0             	movzwl %ax,%eax
+  106315:	8d 90 cf 07 00 00    	lea    0x7cf(%eax),%edx
+  10631b:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  106322:	0f b7 c0             	movzwl %ax,%eax
+  106325:	39 c2                	cmp    %eax,%edx
+  106327:	0f 8d fc 00 00 00    	jge    106429 <video_scroll+0x130>
+		int i;
+
+		if (crt_start + CRT_SIZE + CRT_COLS <= crt_bufsize)
+  10632d:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106334:	0f b7 c0             	movzwl %ax,%eax
+  106337:	8d 90 1f 08 00 00    	lea    0x81f(%eax),%edx
+  10633d:	0f b7 83 1e b0 02 00 	movzwl 0x2b01e(%ebx),%eax
+  106344:	0f b7 c0             	movzwl %ax,%eax
+  106347:	39 c2                	cmp    %eax,%edx
+  106349:	7d 13                	jge    10635e <video_scroll+0x65>
+			crt_start += CRT_COLS;
+  10634b:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106352:	83 c0 50             	add    $0x50,%eax
+  106355:	66 89 83 1a b0 02 00 	mov    %ax,0x2b01a(%ebx)
+  10635c:	eb 64                	jmp    1063c2 <video_scroll+0xc9>
+		else {
+			memmove(crt_buf, crt_buf + crt_start + CRT_COLS,
+  10635e:	8b 83 14 b0 02 00    	mov    0x2b014(%ebx),%eax
+  106364:	0f b7 93 1a b0 02 00 	movzwl 0x2b01a(%ebx),%edx
+  10636b:	0f b7 d2             	movzwl %dx,%edx
+  10636e:	83 c2 50             	add    $0x50,%edx
+  106371:	01 d2                	add    %edx,%edx
+  106373:	01 c2                	add    %eax,%edx
+  106375:	8b 83 14 b0 02 00    	mov    0x2b014(%ebx),%eax
+  10637b:	83 ec 04             	sub    $0x4,%esp
+  10637e:	68 00 0f 00 00       	push   $0xf00
+  106383:	52                   	push   %edx
+  106384:	50                   	push   %eax
+  106385:	e8 9e 1b 00 00       	call   107f28 <memmove>
+  10638a:	83 c4 10             	add    $0x10,%esp
+				(CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+			crt_pos -= crt_start + CRT_COLS;
+  10638d:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  106394:	0f b7 93 1a b0 02 00 	movzwl 0x2b01a(%ebx),%edx
+  10639b:	29 d0                	sub    %edx,%eax
+  10639d:	83 e8 50             	sub    $0x50,%eax
+  1063a0:	66 89 83 18 b0 02 00 	mov    %ax,0x2b018(%ebx)
+			crt_start = 0;
+  1063a7:	66 c7 83 1a b0 02 00 	movw   $0x0,0x2b01a(%ebx)
+  1063ae:	00 00 
+			video_dirty(0, CRT_SIZE);
+  1063b0:	83 ec 08             	sub    $0x8,%esp
+  1063b3:	68 d0 07 00 00       	push   $0x7d0
+  1063b8:	6a 00                	push   $0x0
+  1063ba:	e8 f9 fa ff ff       	call   105eb8 <video_dirty>
+  1063bf:	83 c4 10             	add    $0x10,%esp
+		}
+		for (i = crt_start + CRT_SIZE - CRT_COLS;
+  1063c2:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  1063c9:	0f b7 c0             	movzwl %ax,%eax
+  1063cc:	05 80 07 00 00       	add    $0x780,%eax
+  1063d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1063d4:	eb 16                	jmp    1063ec <video_scroll+0xf3>
+				i < crt_start + CRT_SIZE; i++)
+			crt_buf[i] = 0x0700 | ' ';
+  1063d6:	8b 83 14 b0 02 00    	mov    0x2b014(%ebx),%eax
+  1063dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1063df:	01 d2                	add    %edx,%edx
+  1063e1:	01 d0                	add    %edx,%eax
+  1063e3:	66 c7 00 20 07       	movw   $0x720,(%eax)
+				i < crt_start + CRT_SIZE; i++)
+  1063e8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  1063ec:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  1063f3:	0f b7 c0             	movzwl %ax,%eax
+  1063f6:	05 cf 07 00 00       	add    $0x7cf,%eax
+  1063fb:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  1063fe:	7e d6                	jle    1063d6 <video_scroll+0xdd>
+		video_dirty(crt_start + CRT_SIZE - CRT_COLS,
+				crt_start + CRT_SIZE);
+  106400:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106407:	66 05 d0 07          	add    $0x7d0,%ax
+		video_dirty(crt_start + CRT_SIZE - CRT_COLS,
+  10640b:	0f b7 d0             	movzwl %ax,%edx
+  10640e:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106415:	66 05 80 07          	add    $0x780,%ax
+  106419:	0f b7 c0             	movzwl %ax,%eax
+  10641c:	83 ec 08             	sub    $0x8,%esp
+  10641f:	52                   	push   %edx
+  106420:	50                   	push   %eax
+  106421:	e8 92 fa ff ff       	call   105eb8 <video_dirty>
+  106426:	83 c4 10             	add    $0x10,%esp
+	}
+}
+  106429:	90                   	nop
+  10642a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10642d:	c9                   	leave
+  10642e:	c3                   	ret
+
+0010642f <video_update>:
+// Copy changed cells to video memory, then move the display window
+// to crt_start if we've scrolled and the hardware cursor to crt_pos.
+// Each outb is a VM exit when virtualized, so do this once per write.
+static void
+video_update(void)
+{
+  10642f:	55                   	push   %ebp
+  106430:	89 e5                	mov    %esp,%ebp
+  106432:	56                   	push   %esi
+  106433:	53                   	push   %ebx
+  106434:	83 ec 50             	sub    $0x50,%esp
+  106437:	e8 d8 9f ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  10643c:	81 c3 b8 7b 00 00    	add    $0x7bb8,%ebx
+	if (crt_dirtylo < crt_dirtyhi) {
+  106442:	0f b7 93 4c 30 03 00 	movzwl 0x3304c(%ebx),%edx
+  106449:	0f b7 83 4e 30 03 00 	movzwl 0x3304e(%ebx),%eax
+  106450:	66 39 c2             	cmp    %ax,%dx
+  106453:	0f 83 8c 00 00 00    	jae    1064e5 <video_update+0xb6>
+		// Widen to whole 32-bit words so memmove can use movsl.
+		uint16_t lo = crt_dirtylo & ~1;
+  106459:	0f b7 83 4c 30 03 00 	movzwl 0x3304c(%ebx),%eax
+  106460:	83 e0 fe             	and    $0xfffffffe,%eax
+  106463:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+		uint16_t hi = MIN((crt_dirtyhi + 1) & ~1, crt_bufsize);
+  106467:	0f b7 83 4e 30 03 00 	movzwl 0x3304e(%ebx),%eax
+  10646e:	0f b7 c0             	movzwl %ax,%eax
+  106471:	83 c0 01             	add    $0x1,%eax
+  106474:	83 e0 fe             	and    $0xfffffffe,%eax
+  106477:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  10647a:	0f b7 83 1e b0 02 00 	movzwl 0x2b01e(%ebx),%eax
+  106481:	66 89 45 ee          	mov    %ax,-0x12(%ebp)
+  106485:	0f b7 55 ee          	movzwl -0x12(%ebp),%edx
+  106489:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  10648c:	39 c2                	cmp    %eax,%edx
+  10648e:	0f 4e c2             	cmovle %edx,%eax
+  106491:	66 89 45 ec          	mov    %ax,-0x14(%ebp)
+		memmove(crt_hwbuf + lo, crt_buf + lo,
+			(hi - lo) * sizeof(uint16_t));
+  106495:	0f b7 55 ec          	movzwl -0x14(%ebp),%edx
+  106499:	0f b7 45 f6          	movzwl -0xa(%ebp),%eax
+  10649d:	29 c2                	sub    %eax,%edx
+  10649f:	89 d0                	mov    %edx,%eax
+		memmove(crt_hwbuf + lo, crt_buf + lo,
+  1064a1:	8d 0c 00             	lea    (%eax,%eax,1),%ecx
+  1064a4:	8b 83 14 b0 02 00    	mov    0x2b014(%ebx),%eax
+  1064aa:	0f b7 55 f6          	movzwl -0xa(%ebp),%edx
+  1064ae:	01 d2                	add    %edx,%edx
+  1064b0:	01 c2                	add    %eax,%edx
+  1064b2:	8b 83 10 b0 02 00    	mov    0x2b010(%ebx),%eax
+  1064b8:	0f b7 75 f6          	movzwl -0xa(%ebp),%esi
+  1064bc:	01 f6                	add    %esi,%esi
+  1064be:	01 f0                	add    %esi,%eax
+  1064c0:	83 ec 04             	sub    $0x4,%esp
+  1064c3:	51                   	push   %ecx
+  1064c4:	52                   	push   %edx
+  1064c5:	50                   	push   %eax
+  1064c6:	e8 5d 1a 00 00       	call   107f28 <memmove>
+  1064cb:	83 c4 10             	add    $0x10,%esp
+		crt_dirtylo = crt_bufsize;
+  1064ce:	0f b7 83 1e b0 02 00 	movzwl 0x2b01e(%ebx),%eax
+  1064d5:	66 89 83 4c 30 03 00 	mov    %ax,0x3304c(%ebx)
+		crt_dirtyhi = 0;
+  1064dc:	66 c7 83 4e 30 03 00 	movw   $0x0,0x3304e(%ebx)
+  1064e3:	00 00 
+	}
+
+	if (crt_start != crt_hwstart) {
+  1064e5:	0f b7 93 1a b0 02 00 	movzwl 0x2b01a(%ebx),%edx
+  1064ec:	0f b7 83 1c b0 02 00 	movzwl 0x2b01c(%ebx),%eax
+  1064f3:	66 39 c2             	cmp    %ax,%dx
+  1064f6:	0f 84 82 00 00 00    	je     10657e <video_update+0x14f>
+		outb(addr_6845, 12);
+  1064fc:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  106502:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  106505:	c6 45 cf 0c          	movb   $0xc,-0x31(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106509:	0f b6 45 cf          	movzbl -0x31(%ebp),%eax
+  10650d:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  106510:	ee                   	out    %al,(%dx)
+}
+  106511:	90                   	nop
+		outb(addr_6845 + 1, crt_start >> 8);
+  106512:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106519:	66 c1 e8 08          	shr    $0x8,%ax
+  10651d:	0f b6 c0             	movzbl %al,%eax
+  106520:	8b 93 0c b0 02 00    	mov    0x2b00c(%ebx),%edx
+  106526:	83 c2 01             	add    $0x1,%edx
+  106529:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  10652c:	88 45 d7             	mov    %al,-0x29(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10652f:	0f b6 45 d7          	movzbl -0x29(%ebp),%eax
+  106533:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  106536:	ee                   	out    %al,(%dx)
+}
+  106537:	90                   	nop
+		outb(addr_6845, 13);
+  106538:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  10653e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  106541:	c6 45 df 0d          	movb   $0xd,-0x21(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106545:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+  106549:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  10654c:	ee                   	out    %al,(%dx)
+}
+  10654d:	90                   	nop
+		outb(addr_6845 + 1, crt_start);
+  10654e:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106555:	0f b6 c0             	movzbl %al,%eax
+  106558:	8b 93 0c b0 02 00    	mov    0x2b00c(%ebx),%edx
+  10655e:	83 c2 01             	add    $0x1,%edx
+  106561:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  106564:	88 45 e7             	mov    %al,-0x19(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106567:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  10656b:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  10656e:	ee                   	out    %al,(%dx)
+}
+  10656f:	90                   	nop
+		crt_hwstart = crt_start;
+  106570:	0f b7 83 1a b0 02 00 	movzwl 0x2b01a(%ebx),%eax
+  106577:	66 89 83 1c b0 02 00 	mov    %ax,0x2b01c(%ebx)
+	}
+
+	/* move that little blinky thing */
+	outb(addr_6845, 14);
+  10657e:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  106584:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  106587:	c6 45 af 0e          	movb   $0xe,-0x51(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10658b:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+  10658f:	8b 55 b0             	mov    -0x50(%ebp),%edx
+  106592:	ee                   	out    %al,(%dx)
+}
+  106593:	90                   	nop
+	outb(addr_6845 + 1, crt_pos >> 8);
+  106594:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  10659b:	66 c1 e8 08          	shr    $0x8,%ax
+  10659f:	0f b6 c0             	movzbl %al,%eax
+  1065a2:	8b 93 0c b0 02 00    	mov    0x2b00c(%ebx),%edx
+  1065a8:	83 c2 01             	add    $0x1,%edx
+  1065ab:	89 55 b8             	mov    %edx,-0x48(%ebp)
+  1065ae:	88 45 b7             	mov    %al,-0x49(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1065b1:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+  1065b5:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  1065b8:	ee                   	out    %al,(%dx)
+}
+  1065b9:	90                   	nop
+	outb(addr_6845, 15);
+  1065ba:	8b 83 0c b0 02 00    	mov    0x2b00c(%ebx),%eax
+  1065c0:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  1065c3:	c6 45 bf 0f          	movb   $0xf,-0x41(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1065c7:	0f b6 45 bf          	movzbl -0x41(%ebp),%eax
+  1065cb:	8b 55 c0             	mov    -0x40(%ebp),%edx
+  1065ce:	ee                   	out    %al,(%dx)
+}
+  1065cf:	90                   	nop
+	outb(addr_6845 + 1, crt_pos);
+  1065d0:	0f b7 83 18 b0 02 00 	movzwl 0x2b018(%ebx),%eax
+  1065d7:	0f b6 c0             	movzbl %al,%eax
+  1065da:	8b 93 0c b0 02 00    	mov    0x2b00c(%ebx),%edx
+  1065e0:	83 c2 01             	add    $0x1,%edx
+  1065e3:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  1065e6:	88 45 c7             	mov    %al,-0x39(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1065e9:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+  1065ed:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  1065f0:	ee                   	out    %al,(%dx)
+}
+  1065f1:	90                   	nop
+}
+  1065f2:	90                   	nop
+  1065f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  1065f6:	5b                   	pop    %ebx
+  1065f7:	5e                   	pop    %esi
+  1065f8:	5d                   	pop    %ebp
+  1065f9:	c3                   	ret
+
+001065fa <video_putc>:
+
+void
+video_putc(int c)
+{
+  1065fa:	55                   	push   %ebp
+  1065fb:	89 e5                	mov    %esp,%ebp
+  1065fd:	83 ec 08             	sub    $0x8,%esp
+  106600:	e8 0b 9e ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  106605:	05 ef 79 00 00       	add    $0x79ef,%eax
+	video_emit(c);
+  10660a:	83 ec 0c             	sub    $0xc,%esp
+  10660d:	ff 75 08             	push   0x8(%ebp)
+  106610:	e8 f1 fa ff ff       	call   106106 <video_emit>
+  106615:	83 c4 10             	add    $0x10,%esp
+	video_update();
+  106618:	e8 12 fe ff ff       	call   10642f <video_update>
+}
+  10661d:	90                   	nop
+  10661e:	c9                   	leave
+  10661f:	c3                   	ret
+
+00106620 <video_write>:
+
+void
+video_write(const char *s, size_t len)
+{
+  106620:	55                   	push   %ebp
+  106621:	89 e5                	mov    %esp,%ebp
+  106623:	83 ec 08             	sub    $0x8,%esp
+  106626:	e8 e5 9d ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10662b:	05 c9 79 00 00       	add    $0x79c9,%eax
+	while (len-- > 0)
+  106630:	eb 1b                	jmp    10664d <video_write+0x2d>
+		video_emit(*(const uint8_t *) s++);
+  106632:	8b 45 08             	mov    0x8(%ebp),%eax
+  106635:	8d 50 01             	lea    0x1(%eax),%edx
+  106638:	89 55 08             	mov    %edx,0x8(%ebp)
+  10663b:	0f b6 00             	movzbl (%eax),%eax
+  10663e:	0f b6 c0             	movzbl %al,%eax
+  106641:	83 ec 0c             	sub    $0xc,%esp
+  106644:	50                   	push   %eax
+  106645:	e8 bc fa ff ff       	call   106106 <video_emit>
+  10664a:	83 c4 10             	add    $0x10,%esp
+	while (len-- > 0)
+  10664d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  106650:	8d 50 ff             	lea    -0x1(%eax),%edx
+  106653:	89 55 0c             	mov    %edx,0xc(%ebp)
+  106656:	85 c0                	test   %eax,%eax
+  106658:	75 d8                	jne    106632 <video_write+0x12>
+	video_update();
+  10665a:	e8 d0 fd ff ff       	call   10642f <video_update>
+}
+  10665f:	90                   	nop
+  106660:	c9                   	leave
+  106661:	c3                   	ret
+
+00106662 <kbd_ready>:
+#define KBD_MAXSTALE	32	// Most stale scan codes kbd_init() discards
+
+// Return true if the controller has a byte of input waiting.
+static bool
+kbd_ready(void)
+{
+  106662:	55                   	push   %ebp
+  106663:	89 e5                	mov    %esp,%ebp
+  106665:	83 ec 10             	sub    $0x10,%esp
+  106668:	e8 a3 9d ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10666d:	05 87 79 00 00       	add    $0x7987,%eax
+  106672:	c7 45 f8 64 00 00 00 	movl   $0x64,-0x8(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106679:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  10667c:	89 c2                	mov    %eax,%edx
+  10667e:	ec                   	in     (%dx),%al
+  10667f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	return data;
+  106682:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+	uint8_t stat = inb(KBSTATP);
+  106686:	88 45 ff             	mov    %al,-0x1(%ebp)
+	return stat != 0xFF && (stat & KBS_DIB);
+  106689:	80 7d ff ff          	cmpb   $0xff,-0x1(%ebp)
+  10668d:	74 12                	je     1066a1 <kbd_ready+0x3f>
+  10668f:	0f b6 45 ff          	movzbl -0x1(%ebp),%eax
+  106693:	83 e0 01             	and    $0x1,%eax
+  106696:	85 c0                	test   %eax,%eax
+  106698:	74 07                	je     1066a1 <kbd_ready+0x3f>
+  10669a:	b8 01 00 00 00       	mov    $0x1,%eax
+  10669f:	eb 05                	jmp    1066a6 <kbd_ready+0x44>
+  1066a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  1066a6:	c9                   	leave
+  1066a7:	c3                   	ret
+
+001066a8 <kbd_proc_data>:
+ * Get data from the keyboard.  If we finish a character, return it.  Else 0.
+ * Return -1 if no data.
+ */
+static int
+kbd_proc_data(void)
+{
+  1066a8:	55                   	push   %ebp
+  1066a9:	89 e5                	mov    %esp,%ebp
+  1066ab:	53                   	push   %ebx
+  1066ac:	83 ec 24             	sub    $0x24,%esp
+  1066af:	e8 60 9d ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  1066b4:	81 c3 40 79 00 00    	add    $0x7940,%ebx
+	int c;
+	uint8_t data;
+	static uint32_t shift;
+
+	if (!kbd_ready())
+  1066ba:	e8 a3 ff ff ff       	call   106662 <kbd_ready>
+  1066bf:	85 c0                	test   %eax,%eax
+  1066c1:	75 0a                	jne    1066cd <kbd_proc_data+0x25>
+		return -1;
+  1066c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  1066c8:	e9 72 01 00 00       	jmp    10683f <kbd_proc_data+0x197>
+  1066cd:	c7 45 ec 60 00 00 00 	movl   $0x60,-0x14(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  1066d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1066d7:	89 c2                	mov    %eax,%edx
+  1066d9:	ec                   	in     (%dx),%al
+  1066da:	88 45 eb             	mov    %al,-0x15(%ebp)
+	return data;
+  1066dd:	0f b6 45 eb          	movzbl -0x15(%ebp),%eax
+
+	data = inb(KBDATAP);
+  1066e1:	88 45 f3             	mov    %al,-0xd(%ebp)
+
+	if (data == 0xE0) {
+  1066e4:	80 7d f3 e0          	cmpb   $0xe0,-0xd(%ebp)
+  1066e8:	75 19                	jne    106703 <kbd_proc_data+0x5b>
+		// E0 escape character
+		shift |= E0ESC;
+  1066ea:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  1066f0:	83 c8 40             	or     $0x40,%eax
+  1066f3:	89 83 50 30 03 00    	mov    %eax,0x33050(%ebx)
+		return 0;
+  1066f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  1066fe:	e9 3c 01 00 00       	jmp    10683f <kbd_proc_data+0x197>
+	} else if (data & 0x80) {
+  106703:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  106707:	84 c0                	test   %al,%al
+  106709:	79 4b                	jns    106756 <kbd_proc_data+0xae>
+		// Key released
+		data = (shift & E0ESC ? data : data & 0x7F);
+  10670b:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  106711:	83 e0 40             	and    $0x40,%eax
+  106714:	85 c0                	test   %eax,%eax
+  106716:	75 09                	jne    106721 <kbd_proc_data+0x79>
+  106718:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  10671c:	83 e0 7f             	and    $0x7f,%eax
+  10671f:	eb 04                	jmp    106725 <kbd_proc_data+0x7d>
+  106721:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  106725:	88 45 f3             	mov    %al,-0xd(%ebp)
+		shift &= ~(shiftcode[data] | E0ESC);
+  106728:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  10672c:	0f b6 84 03 4c 21 00 	movzbl 0x214c(%ebx,%eax,1),%eax
+  106733:	00 
+  106734:	83 c8 40             	or     $0x40,%eax
+  106737:	0f b6 c0             	movzbl %al,%eax
+  10673a:	f7 d0                	not    %eax
+  10673c:	89 c2                	mov    %eax,%edx
+  10673e:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  106744:	21 d0                	and    %edx,%eax
+  106746:	89 83 50 30 03 00    	mov    %eax,0x33050(%ebx)
+		return 0;
+  10674c:	b8 00 00 00 00       	mov    $0x0,%eax
+  106751:	e9 e9 00 00 00       	jmp    10683f <kbd_proc_data+0x197>
+	} else if (shift & E0ESC) {
+  106756:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  10675c:	83 e0 40             	and    $0x40,%eax
+  10675f:	85 c0                	test   %eax,%eax
+  106761:	74 13                	je     106776 <kbd_proc_data+0xce>
+		// Last character was an E0 escape; or with 0x80
+		data |= 0x80;
+  106763:	80 4d f3 80          	orb    $0x80,-0xd(%ebp)
+		shift &= ~E0ESC;
+  106767:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  10676d:	83 e0 bf             	and    $0xffffffbf,%eax
+  106770:	89 83 50 30 03 00    	mov    %eax,0x33050(%ebx)
+	}
+
+	shift |= shiftcode[data];
+  106776:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  10677a:	0f b6 84 03 4c 21 00 	movzbl 0x214c(%ebx,%eax,1),%eax
+  106781:	00 
+  106782:	0f b6 d0             	movzbl %al,%edx
+  106785:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  10678b:	09 d0                	or     %edx,%eax
+  10678d:	89 83 50 30 03 00    	mov    %eax,0x33050(%ebx)
+	shift ^= togglecode[data];
+  106793:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  106797:	0f b6 84 03 4c 22 00 	movzbl 0x224c(%ebx,%eax,1),%eax
+  10679e:	00 
+  10679f:	0f b6 d0             	movzbl %al,%edx
+  1067a2:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  1067a8:	31 d0                	xor    %edx,%eax
+  1067aa:	89 83 50 30 03 00    	mov    %eax,0x33050(%ebx)
+
+	c = charcode[shift & (CTL | SHIFT)][data];
+  1067b0:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  1067b6:	83 e0 03             	and    $0x3,%eax
+  1067b9:	8b 94 83 4c 26 00 00 	mov    0x264c(%ebx,%eax,4),%edx
+  1067c0:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  1067c4:	01 d0                	add    %edx,%eax
+  1067c6:	0f b6 00             	movzbl (%eax),%eax
+  1067c9:	0f b6 c0             	movzbl %al,%eax
+  1067cc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if (shift & CAPSLOCK) {
+  1067cf:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  1067d5:	83 e0 08             	and    $0x8,%eax
+  1067d8:	85 c0                	test   %eax,%eax
+  1067da:	74 22                	je     1067fe <kbd_proc_data+0x156>
+		if ('a' <= c && c <= 'z')
+  1067dc:	83 7d f4 60          	cmpl   $0x60,-0xc(%ebp)
+  1067e0:	7e 0c                	jle    1067ee <kbd_proc_data+0x146>
+  1067e2:	83 7d f4 7a          	cmpl   $0x7a,-0xc(%ebp)
+  1067e6:	7f 06                	jg     1067ee <kbd_proc_data+0x146>
+			c += 'A' - 'a';
+  1067e8:	83 6d f4 20          	subl   $0x20,-0xc(%ebp)
+  1067ec:	eb 10                	jmp    1067fe <kbd_proc_data+0x156>
+		else if ('A' <= c && c <= 'Z')
+  1067ee:	83 7d f4 40          	cmpl   $0x40,-0xc(%ebp)
+  1067f2:	7e 0a                	jle    1067fe <kbd_proc_data+0x156>
+  1067f4:	83 7d f4 5a          	cmpl   $0x5a,-0xc(%ebp)
+  1067f8:	7f 04                	jg     1067fe <kbd_proc_data+0x156>
+			c += 'a' - 'A';
+  1067fa:	83 45 f4 20          	addl   $0x20,-0xc(%ebp)
+	}
+
+	// Process special keys
+	// Ctrl-Alt-Del: reboot
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+  1067fe:	8b 83 50 30 03 00    	mov    0x33050(%ebx),%eax
+  106804:	f7 d0                	not    %eax
+  106806:	83 e0 06             	and    $0x6,%eax
+  106809:	85 c0                	test   %eax,%eax
+  10680b:	75 2f                	jne    10683c <kbd_proc_data+0x194>
+  10680d:	81 7d f4 e9 00 00 00 	cmpl   $0xe9,-0xc(%ebp)
+  106814:	75 26                	jne    10683c <kbd_proc_data+0x194>
+		cprintf("Rebooting!\n");
+  106816:	83 ec 0c             	sub    $0xc,%esp
+  106819:	8d 83 e8 c4 ff ff    	lea    -0x3b18(%ebx),%eax
+  10681f:	50                   	push   %eax
+  106820:	e8 f0 13 00 00       	call   107c15 <cprintf>
+  106825:	83 c4 10             	add    $0x10,%esp
+  106828:	c7 45 e4 92 00 00 00 	movl   $0x92,-0x1c(%ebp)
+  10682f:	c6 45 e3 03          	movb   $0x3,-0x1d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106833:	0f b6 45 e3          	movzbl -0x1d(%ebp),%eax
+  106837:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  10683a:	ee                   	out    %al,(%dx)
+}
+  10683b:	90                   	nop
+		outb(0x92, 0x3); // courtesy of Chris Frost
+	}
+
+	return c;
+  10683c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  10683f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106842:	c9                   	leave
+  106843:	c3                   	ret
+
+00106844 <kbd_intr>:
+
+void
+kbd_intr(void)
+{
+  106844:	55                   	push   %ebp
+  106845:	89 e5                	mov    %esp,%ebp
+  106847:	53                   	push   %ebx
+  106848:	83 ec 14             	sub    $0x14,%esp
+  10684b:	e8 c0 9b ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  106850:	05 a4 77 00 00       	add    $0x77a4,%eax
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  106855:	9c                   	pushf
+  106856:	5a                   	pop    %edx
+  106857:	89 55 ec             	mov    %edx,-0x14(%ebp)
+        return eflags;
+  10685a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+	uint32_t eflags = read_eflags();
+  10685d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	asm volatile("cli");
+  106860:	fa                   	cli
+}
+  106861:	90                   	nop
+	cli();
+	cons_intr(kbd_proc_data);
+  106862:	83 ec 0c             	sub    $0xc,%esp
+  106865:	8d 90 b4 86 ff ff    	lea    -0x794c(%eax),%edx
+  10686b:	52                   	push   %edx
+  10686c:	89 c3                	mov    %eax,%ebx
+  10686e:	e8 64 9c ff ff       	call   1004d7 <cons_intr>
+  106873:	83 c4 10             	add    $0x10,%esp
+  106876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  106879:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  10687c:	ff 75 f0             	push   -0x10(%ebp)
+  10687f:	9d                   	popf
+}
+  106880:	90                   	nop
+	write_eflags(eflags);
+}
+  106881:	90                   	nop
+  106882:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106885:	c9                   	leave
+  106886:	c3                   	ret
+
+00106887 <kbd_init>:
+
+void
+kbd_init(void)
+{
+  106887:	55                   	push   %ebp
+  106888:	89 e5                	mov    %esp,%ebp
+  10688a:	83 ec 10             	sub    $0x10,%esp
+  10688d:	e8 7e 9b ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  106892:	05 62 77 00 00       	add    $0x7762,%eax
+	// Discard anything typed before we were ready for it,
+	// but no more than the controller could have buffered.
+	int i;
+	for (i = 0; i < KBD_MAXSTALE && kbd_ready(); i++)
+  106897:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  10689e:	eb 15                	jmp    1068b5 <kbd_init+0x2e>
+  1068a0:	c7 45 f8 60 00 00 00 	movl   $0x60,-0x8(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  1068a7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  1068aa:	89 c2                	mov    %eax,%edx
+  1068ac:	ec                   	in     (%dx),%al
+  1068ad:	88 45 f7             	mov    %al,-0x9(%ebp)
+	return data;
+  1068b0:	90                   	nop
+  1068b1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  1068b5:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%ebp)
+  1068b9:	7f 09                	jg     1068c4 <kbd_init+0x3d>
+  1068bb:	e8 a2 fd ff ff       	call   106662 <kbd_ready>
+  1068c0:	85 c0                	test   %eax,%eax
+  1068c2:	75 dc                	jne    1068a0 <kbd_init+0x19>
+		(void) inb(KBDATAP);
+}
+  1068c4:	90                   	nop
+  1068c5:	c9                   	leave
+  1068c6:	c3                   	ret
+
+001068c7 <kbd_intenable>:
+
+void
+kbd_intenable(void)
+{
+  1068c7:	55                   	push   %ebp
+  1068c8:	89 e5                	mov    %esp,%ebp
+  1068ca:	53                   	push   %ebx
+  1068cb:	83 ec 04             	sub    $0x4,%esp
+  1068ce:	e8 3d 9b ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1068d3:	05 21 77 00 00       	add    $0x7721,%eax
+	pic_enable(IRQ_KBD);
+  1068d8:	83 ec 0c             	sub    $0xc,%esp
+  1068db:	6a 01                	push   $0x1
+  1068dd:	89 c3                	mov    %eax,%ebx
+  1068df:	e8 16 08 00 00       	call   1070fa <pic_enable>
+  1068e4:	83 c4 10             	add    $0x10,%esp
+
+	// Pick up any key pressed since kbd_init().
+	kbd_intr();
+  1068e7:	e8 58 ff ff ff       	call   106844 <kbd_intr>
+}
+  1068ec:	90                   	nop
+  1068ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1068f0:	c9                   	leave
+  1068f1:	c3                   	ret
+
+001068f2 <xchg>:
+  1068f2:	55                   	push   %ebp
+  1068f3:	89 e5                	mov    %esp,%ebp
+  1068f5:	83 ec 10             	sub    $0x10,%esp
+  1068f8:	e8 13 9b ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1068fd:	05 f7 76 00 00       	add    $0x76f7,%eax
+  106902:	8b 55 08             	mov    0x8(%ebp),%edx
+  106905:	8b 45 0c             	mov    0xc(%ebp),%eax
+  106908:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  10690b:	f0 87 02             	lock xchg %eax,(%edx)
+  10690e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  106911:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  106914:	c9                   	leave
+  106915:	c3                   	ret
+
+00106916 <pause>:
+  106916:	55                   	push   %ebp
+  106917:	89 e5                	mov    %esp,%ebp
+  106919:	e8 f2 9a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10691e:	05 d6 76 00 00       	add    $0x76d6,%eax
+  106923:	f3 90                	pause
+  106925:	90                   	nop
+  106926:	5d                   	pop    %ebp
+  106927:	c3                   	ret
+
+00106928 <serial_lock>:
+{
+  106928:	55                   	push   %ebp
+  106929:	89 e5                	mov    %esp,%ebp
+  10692b:	53                   	push   %ebx
+  10692c:	e8 e3 9a ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106931:	81 c3 c3 76 00 00    	add    $0x76c3,%ebx
+	while (xchg(&serial_locked, 1) != 0)
+  106937:	eb 05                	jmp    10693e <serial_lock+0x16>
+		pause();
+  106939:	e8 d8 ff ff ff       	call   106916 <pause>
+	while (xchg(&serial_locked, 1) != 0)
+  10693e:	6a 01                	push   $0x1
+  106940:	8d 83 a0 40 03 00    	lea    0x340a0(%ebx),%eax
+  106946:	50                   	push   %eax
+  106947:	e8 a6 ff ff ff       	call   1068f2 <xchg>
+  10694c:	83 c4 08             	add    $0x8,%esp
+  10694f:	85 c0                	test   %eax,%eax
+  106951:	75 e6                	jne    106939 <serial_lock+0x11>
+}
+  106953:	90                   	nop
+  106954:	90                   	nop
+  106955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106958:	c9                   	leave
+  106959:	c3                   	ret
+
+0010695a <serial_unlock>:
+{
+  10695a:	55                   	push   %ebp
+  10695b:	89 e5                	mov    %esp,%ebp
+  10695d:	e8 ae 9a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  106962:	05 92 76 00 00       	add    $0x7692,%eax
+	xchg(&serial_locked, 0);
+  106967:	6a 00                	push   $0x0
+  106969:	8d 80 a0 40 03 00    	lea    0x340a0(%eax),%eax
+  10696f:	50                   	push   %eax
+  106970:	e8 7d ff ff ff       	call   1068f2 <xchg>
+  106975:	83 c4 08             	add    $0x8,%esp
+}
+  106978:	90                   	nop
+  106979:	c9                   	leave
+  10697a:	c3                   	ret
+
+0010697b <delay>:
+{
+  10697b:	55                   	push   %ebp
+  10697c:	89 e5                	mov    %esp,%ebp
+  10697e:	83 ec 20             	sub    $0x20,%esp
+  106981:	e8 8a 9a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  106986:	05 6e 76 00 00       	add    $0x766e,%eax
+  10698b:	c7 45 e4 84 00 00 00 	movl   $0x84,-0x1c(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106992:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  106995:	89 c2                	mov    %eax,%edx
+  106997:	ec                   	in     (%dx),%al
+  106998:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  10699b:	c7 45 ec 84 00 00 00 	movl   $0x84,-0x14(%ebp)
+  1069a2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  1069a5:	89 c2                	mov    %eax,%edx
+  1069a7:	ec                   	in     (%dx),%al
+  1069a8:	88 45 eb             	mov    %al,-0x15(%ebp)
+  1069ab:	c7 45 f4 84 00 00 00 	movl   $0x84,-0xc(%ebp)
+  1069b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1069b5:	89 c2                	mov    %eax,%edx
+  1069b7:	ec                   	in     (%dx),%al
+  1069b8:	88 45 f3             	mov    %al,-0xd(%ebp)
+  1069bb:	c7 45 fc 84 00 00 00 	movl   $0x84,-0x4(%ebp)
+  1069c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  1069c5:	89 c2                	mov    %eax,%edx
+  1069c7:	ec                   	in     (%dx),%al
+  1069c8:	88 45 fb             	mov    %al,-0x5(%ebp)
+}
+  1069cb:	90                   	nop
+  1069cc:	c9                   	leave
+  1069cd:	c3                   	ret
+
+001069ce <serial_proc_data>:
+{
+  1069ce:	55                   	push   %ebp
+  1069cf:	89 e5                	mov    %esp,%ebp
+  1069d1:	83 ec 10             	sub    $0x10,%esp
+  1069d4:	e8 37 9a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1069d9:	05 1b 76 00 00       	add    $0x761b,%eax
+	if (serial_rxavail > 0)
+  1069de:	8b 90 98 40 03 00    	mov    0x34098(%eax),%edx
+  1069e4:	85 d2                	test   %edx,%edx
+  1069e6:	7e 11                	jle    1069f9 <serial_proc_data+0x2b>
+		serial_rxavail--;
+  1069e8:	8b 90 98 40 03 00    	mov    0x34098(%eax),%edx
+  1069ee:	83 ea 01             	sub    $0x1,%edx
+  1069f1:	89 90 98 40 03 00    	mov    %edx,0x34098(%eax)
+  1069f7:	eb 25                	jmp    106a1e <serial_proc_data+0x50>
+  1069f9:	c7 45 fc fd 03 00 00 	movl   $0x3fd,-0x4(%ebp)
+  106a00:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  106a03:	89 c2                	mov    %eax,%edx
+  106a05:	ec                   	in     (%dx),%al
+  106a06:	88 45 fb             	mov    %al,-0x5(%ebp)
+	return data;
+  106a09:	0f b6 45 fb          	movzbl -0x5(%ebp),%eax
+	else if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+  106a0d:	0f b6 c0             	movzbl %al,%eax
+  106a10:	83 e0 01             	and    $0x1,%eax
+  106a13:	85 c0                	test   %eax,%eax
+  106a15:	75 07                	jne    106a1e <serial_proc_data+0x50>
+		return -1;
+  106a17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  106a1c:	eb 17                	jmp    106a35 <serial_proc_data+0x67>
+  106a1e:	c7 45 f4 f8 03 00 00 	movl   $0x3f8,-0xc(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106a25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  106a28:	89 c2                	mov    %eax,%edx
+  106a2a:	ec                   	in     (%dx),%al
+  106a2b:	88 45 f3             	mov    %al,-0xd(%ebp)
+	return data;
+  106a2e:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+	return inb(COM1+COM_RX);
+  106a32:	0f b6 c0             	movzbl %al,%eax
+}
+  106a35:	c9                   	leave
+  106a36:	c3                   	ret
+
+00106a37 <serial_txwait>:
+{
+  106a37:	55                   	push   %ebp
+  106a38:	89 e5                	mov    %esp,%ebp
+  106a3a:	83 ec 10             	sub    $0x10,%esp
+  106a3d:	e8 ce 99 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  106a42:	05 b2 75 00 00       	add    $0x75b2,%eax
+	for (i = 0;
+  106a47:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  106a4e:	eb 09                	jmp    106a59 <serial_txwait+0x22>
+		delay();
+  106a50:	e8 26 ff ff ff       	call   10697b <delay>
+	     i++)
+  106a55:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  106a59:	c7 45 f8 fd 03 00 00 	movl   $0x3fd,-0x8(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106a60:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  106a63:	89 c2                	mov    %eax,%edx
+  106a65:	ec                   	in     (%dx),%al
+  106a66:	88 45 f7             	mov    %al,-0x9(%ebp)
+	return data;
+  106a69:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+  106a6d:	0f b6 c0             	movzbl %al,%eax
+  106a70:	83 e0 20             	and    $0x20,%eax
+  106a73:	85 c0                	test   %eax,%eax
+  106a75:	75 09                	jne    106a80 <serial_txwait+0x49>
+  106a77:	81 7d fc ff 31 00 00 	cmpl   $0x31ff,-0x4(%ebp)
+  106a7e:	7e d0                	jle    106a50 <serial_txwait+0x19>
+}
+  106a80:	90                   	nop
+  106a81:	c9                   	leave
+  106a82:	c3                   	ret
+
+00106a83 <serial_txkick>:
+{
+  106a83:	55                   	push   %ebp
+  106a84:	89 e5                	mov    %esp,%ebp
+  106a86:	83 ec 30             	sub    $0x30,%esp
+  106a89:	e8 81 c6 ff ff       	call   10310f <__x86.get_pc_thunk.cx>
+  106a8e:	81 c1 66 75 00 00    	add    $0x7566,%ecx
+  106a94:	c7 45 f0 fd 03 00 00 	movl   $0x3fd,-0x10(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106a9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  106a9e:	89 c2                	mov    %eax,%edx
+  106aa0:	ec                   	in     (%dx),%al
+  106aa1:	88 45 ef             	mov    %al,-0x11(%ebp)
+	return data;
+  106aa4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+	bool ready = (inb(COM1+COM_LSR) & COM_LSR_TXRDY) != 0;
+  106aa8:	0f b6 c0             	movzbl %al,%eax
+  106aab:	83 e0 20             	and    $0x20,%eax
+  106aae:	85 c0                	test   %eax,%eax
+  106ab0:	0f 95 c0             	setne  %al
+  106ab3:	0f b6 c0             	movzbl %al,%eax
+  106ab6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	if (ready)
+  106ab9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  106abd:	74 55                	je     106b14 <serial_txkick+0x91>
+		for (n = 0; n < COM_FIFOSIZE && serial_tx.rpos != serial_tx.wpos;
+  106abf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  106ac6:	eb 36                	jmp    106afe <serial_txkick+0x7b>
+			outb(COM1+COM_TX, serial_tx.buf[serial_tx.rpos++
+  106ac8:	8b 81 8c 40 03 00    	mov    0x3408c(%ecx),%eax
+  106ace:	8d 50 01             	lea    0x1(%eax),%edx
+  106ad1:	89 91 8c 40 03 00    	mov    %edx,0x3408c(%ecx)
+						% SERIAL_TXBUFSIZE]);
+  106ad7:	25 ff 0f 00 00       	and    $0xfff,%eax
+			outb(COM1+COM_TX, serial_tx.buf[serial_tx.rpos++
+  106adc:	0f b6 84 01 8c 30 03 	movzbl 0x3308c(%ecx,%eax,1),%eax
+  106ae3:	00 
+  106ae4:	0f b6 c0             	movzbl %al,%eax
+  106ae7:	c7 45 e8 f8 03 00 00 	movl   $0x3f8,-0x18(%ebp)
+  106aee:	88 45 e7             	mov    %al,-0x19(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106af1:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  106af5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  106af8:	ee                   	out    %al,(%dx)
+}
+  106af9:	90                   	nop
+				n++)
+  106afa:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+		for (n = 0; n < COM_FIFOSIZE && serial_tx.rpos != serial_tx.wpos;
+  106afe:	83 7d fc 0f          	cmpl   $0xf,-0x4(%ebp)
+  106b02:	7f 10                	jg     106b14 <serial_txkick+0x91>
+  106b04:	8b 91 8c 40 03 00    	mov    0x3408c(%ecx),%edx
+  106b0a:	8b 81 90 40 03 00    	mov    0x34090(%ecx),%eax
+  106b10:	39 c2                	cmp    %eax,%edx
+  106b12:	75 b4                	jne    106ac8 <serial_txkick+0x45>
+	uint8_t ier = serial_ier & ~COM_IER_TXRDY;
+  106b14:	0f b6 81 94 40 03 00 	movzbl 0x34094(%ecx),%eax
+  106b1b:	83 e0 fd             	and    $0xfffffffd,%eax
+  106b1e:	88 45 fb             	mov    %al,-0x5(%ebp)
+	if (serial_tx.rpos != serial_tx.wpos)
+  106b21:	8b 91 8c 40 03 00    	mov    0x3408c(%ecx),%edx
+  106b27:	8b 81 90 40 03 00    	mov    0x34090(%ecx),%eax
+  106b2d:	39 c2                	cmp    %eax,%edx
+  106b2f:	74 04                	je     106b35 <serial_txkick+0xb2>
+		ier |= COM_IER_TXRDY;
+  106b31:	80 4d fb 02          	orb    $0x2,-0x5(%ebp)
+	if (ier != serial_ier)
+  106b35:	0f b6 81 94 40 03 00 	movzbl 0x34094(%ecx),%eax
+  106b3c:	38 45 fb             	cmp    %al,-0x5(%ebp)
+  106b3f:	74 27                	je     106b68 <serial_txkick+0xe5>
+		outb(COM1+COM_IER, serial_ier = ier);
+  106b41:	0f b6 45 fb          	movzbl -0x5(%ebp),%eax
+  106b45:	88 81 94 40 03 00    	mov    %al,0x34094(%ecx)
+  106b4b:	0f b6 81 94 40 03 00 	movzbl 0x34094(%ecx),%eax
+  106b52:	0f b6 c0             	movzbl %al,%eax
+  106b55:	c7 45 e0 f9 03 00 00 	movl   $0x3f9,-0x20(%ebp)
+  106b5c:	88 45 df             	mov    %al,-0x21(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106b5f:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+  106b63:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  106b66:	ee                   	out    %al,(%dx)
+}
+  106b67:	90                   	nop
+	return ready;
+  106b68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  106b6b:	c9                   	leave
+  106b6c:	c3                   	ret
+
+00106b6d <serial_txflush>:
+{
+  106b6d:	55                   	push   %ebp
+  106b6e:	89 e5                	mov    %esp,%ebp
+  106b70:	53                   	push   %ebx
+  106b71:	e8 9e 98 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106b76:	81 c3 7e 74 00 00    	add    $0x747e,%ebx
+	while (serial_tx.rpos != serial_tx.wpos) {
+  106b7c:	eb 1a                	jmp    106b98 <serial_txflush+0x2b>
+		serial_txwait();
+  106b7e:	e8 b4 fe ff ff       	call   106a37 <serial_txwait>
+		if (!serial_txkick())
+  106b83:	e8 fb fe ff ff       	call   106a83 <serial_txkick>
+  106b88:	85 c0                	test   %eax,%eax
+  106b8a:	75 0c                	jne    106b98 <serial_txflush+0x2b>
+			serial_tx.rpos = serial_tx.wpos;  // stuck: give up
+  106b8c:	8b 83 90 40 03 00    	mov    0x34090(%ebx),%eax
+  106b92:	89 83 8c 40 03 00    	mov    %eax,0x3408c(%ebx)
+	while (serial_tx.rpos != serial_tx.wpos) {
+  106b98:	8b 93 8c 40 03 00    	mov    0x3408c(%ebx),%edx
+  106b9e:	8b 83 90 40 03 00    	mov    0x34090(%ebx),%eax
+  106ba4:	39 c2                	cmp    %eax,%edx
+  106ba6:	75 d6                	jne    106b7e <serial_txflush+0x11>
+}
+  106ba8:	90                   	nop
+  106ba9:	90                   	nop
+  106baa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106bad:	c9                   	leave
+  106bae:	c3                   	ret
+
+00106baf <serial_intr>:
+{
+  106baf:	55                   	push   %ebp
+  106bb0:	89 e5                	mov    %esp,%ebp
+  106bb2:	53                   	push   %ebx
+  106bb3:	83 ec 34             	sub    $0x34,%esp
+  106bb6:	e8 59 98 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106bbb:	81 c3 39 74 00 00    	add    $0x7439,%ebx
+	if (!serial_exists)
+  106bc1:	8b 83 6c 30 03 00    	mov    0x3306c(%ebx),%eax
+  106bc7:	85 c0                	test   %eax,%eax
+  106bc9:	0f 84 00 01 00 00    	je     106ccf <serial_intr+0x120>
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  106bcf:	9c                   	pushf
+  106bd0:	58                   	pop    %eax
+  106bd1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        return eflags;
+  106bd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+	uint32_t eflags = read_eflags();
+  106bd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	asm volatile("cli");
+  106bda:	fa                   	cli
+}
+  106bdb:	90                   	nop
+	serial_lock();
+  106bdc:	e8 47 fd ff ff       	call   106928 <serial_lock>
+	while (!((iir = inb(COM1+COM_IIR)) & COM_IIR_NOPEND)) {
+  106be1:	e9 9c 00 00 00       	jmp    106c82 <serial_intr+0xd3>
+		switch (iir & COM_IIR_ID) {
+  106be6:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  106bea:	83 e0 0e             	and    $0xe,%eax
+  106bed:	83 f8 0c             	cmp    $0xc,%eax
+  106bf0:	74 64                	je     106c56 <serial_intr+0xa7>
+  106bf2:	83 f8 0c             	cmp    $0xc,%eax
+  106bf5:	7f 7a                	jg     106c71 <serial_intr+0xc2>
+  106bf7:	83 f8 06             	cmp    $0x6,%eax
+  106bfa:	74 2d                	je     106c29 <serial_intr+0x7a>
+  106bfc:	83 f8 06             	cmp    $0x6,%eax
+  106bff:	7f 70                	jg     106c71 <serial_intr+0xc2>
+  106c01:	83 f8 02             	cmp    $0x2,%eax
+  106c04:	74 64                	je     106c6a <serial_intr+0xbb>
+  106c06:	83 f8 04             	cmp    $0x4,%eax
+  106c09:	75 66                	jne    106c71 <serial_intr+0xc2>
+			serial_rxavail = COM_RXTRIGGER;
+  106c0b:	c7 83 98 40 03 00 0e 	movl   $0xe,0x34098(%ebx)
+  106c12:	00 00 00 
+			cons_intr(serial_proc_data);
+  106c15:	83 ec 0c             	sub    $0xc,%esp
+  106c18:	8d 83 da 89 ff ff    	lea    -0x7626(%ebx),%eax
+  106c1e:	50                   	push   %eax
+  106c1f:	e8 b3 98 ff ff       	call   1004d7 <cons_intr>
+  106c24:	83 c4 10             	add    $0x10,%esp
+			break;
+  106c27:	eb 59                	jmp    106c82 <serial_intr+0xd3>
+  106c29:	c7 45 e8 fd 03 00 00 	movl   $0x3fd,-0x18(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106c30:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  106c33:	89 c2                	mov    %eax,%edx
+  106c35:	ec                   	in     (%dx),%al
+  106c36:	88 45 e7             	mov    %al,-0x19(%ebp)
+	return data;
+  106c39:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+			if (inb(COM1+COM_LSR) & COM_LSR_OE)
+  106c3d:	0f b6 c0             	movzbl %al,%eax
+  106c40:	83 e0 02             	and    $0x2,%eax
+  106c43:	85 c0                	test   %eax,%eax
+  106c45:	74 0f                	je     106c56 <serial_intr+0xa7>
+				serial_overruns++;
+  106c47:	8b 83 70 30 03 00    	mov    0x33070(%ebx),%eax
+  106c4d:	83 c0 01             	add    $0x1,%eax
+  106c50:	89 83 70 30 03 00    	mov    %eax,0x33070(%ebx)
+			cons_intr(serial_proc_data);
+  106c56:	83 ec 0c             	sub    $0xc,%esp
+  106c59:	8d 83 da 89 ff ff    	lea    -0x7626(%ebx),%eax
+  106c5f:	50                   	push   %eax
+  106c60:	e8 72 98 ff ff       	call   1004d7 <cons_intr>
+  106c65:	83 c4 10             	add    $0x10,%esp
+			break;
+  106c68:	eb 18                	jmp    106c82 <serial_intr+0xd3>
+			serial_txkick();
+  106c6a:	e8 14 fe ff ff       	call   106a83 <serial_txkick>
+			break;
+  106c6f:	eb 11                	jmp    106c82 <serial_intr+0xd3>
+  106c71:	c7 45 e0 fe 03 00 00 	movl   $0x3fe,-0x20(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106c78:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  106c7b:	89 c2                	mov    %eax,%edx
+  106c7d:	ec                   	in     (%dx),%al
+  106c7e:	88 45 df             	mov    %al,-0x21(%ebp)
+			break;
+  106c81:	90                   	nop
+  106c82:	c7 45 d8 fa 03 00 00 	movl   $0x3fa,-0x28(%ebp)
+  106c89:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  106c8c:	89 c2                	mov    %eax,%edx
+  106c8e:	ec                   	in     (%dx),%al
+  106c8f:	88 45 d7             	mov    %al,-0x29(%ebp)
+	return data;
+  106c92:	0f b6 45 d7          	movzbl -0x29(%ebp),%eax
+	while (!((iir = inb(COM1+COM_IIR)) & COM_IIR_NOPEND)) {
+  106c96:	88 45 f3             	mov    %al,-0xd(%ebp)
+  106c99:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  106c9d:	83 e0 01             	and    $0x1,%eax
+  106ca0:	85 c0                	test   %eax,%eax
+  106ca2:	0f 84 3e ff ff ff    	je     106be6 <serial_intr+0x37>
+	if (!(serial_ier & COM_IER_TXRDY))
+  106ca8:	0f b6 83 94 40 03 00 	movzbl 0x34094(%ebx),%eax
+  106caf:	0f b6 c0             	movzbl %al,%eax
+  106cb2:	83 e0 02             	and    $0x2,%eax
+  106cb5:	85 c0                	test   %eax,%eax
+  106cb7:	75 05                	jne    106cbe <serial_intr+0x10f>
+		serial_txkick();
+  106cb9:	e8 c5 fd ff ff       	call   106a83 <serial_txkick>
+	serial_unlock();
+  106cbe:	e8 97 fc ff ff       	call   10695a <serial_unlock>
+  106cc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  106cc6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  106cc9:	ff 75 d0             	push   -0x30(%ebp)
+  106ccc:	9d                   	popf
+}
+  106ccd:	eb 01                	jmp    106cd0 <serial_intr+0x121>
+		return;
+  106ccf:	90                   	nop
+}
+  106cd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106cd3:	c9                   	leave
+  106cd4:	c3                   	ret
+
+00106cd5 <serial_putc>:
+{
+  106cd5:	55                   	push   %ebp
+  106cd6:	89 e5                	mov    %esp,%ebp
+  106cd8:	53                   	push   %ebx
+  106cd9:	83 ec 10             	sub    $0x10,%esp
+  106cdc:	e8 33 97 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106ce1:	81 c3 13 73 00 00    	add    $0x7313,%ebx
+	if (!serial_exists)
+  106ce7:	8b 83 6c 30 03 00    	mov    0x3306c(%ebx),%eax
+  106ced:	85 c0                	test   %eax,%eax
+  106cef:	0f 84 a7 00 00 00    	je     106d9c <serial_putc+0xc7>
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  106cf5:	9c                   	pushf
+  106cf6:	58                   	pop    %eax
+  106cf7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        return eflags;
+  106cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+	uint32_t eflags = read_eflags();
+  106cfd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+	asm volatile("cli");
+  106d00:	fa                   	cli
+}
+  106d01:	90                   	nop
+	serial_lock();
+  106d02:	e8 21 fc ff ff       	call   106928 <serial_lock>
+	if (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+  106d07:	8b 93 90 40 03 00    	mov    0x34090(%ebx),%edx
+  106d0d:	8b 83 8c 40 03 00    	mov    0x3408c(%ebx),%eax
+  106d13:	29 c2                	sub    %eax,%edx
+  106d15:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  106d1b:	75 1d                	jne    106d3a <serial_putc+0x65>
+		serial_txwait();
+  106d1d:	e8 15 fd ff ff       	call   106a37 <serial_txwait>
+		if (!serial_txkick())
+  106d22:	e8 5c fd ff ff       	call   106a83 <serial_txkick>
+  106d27:	85 c0                	test   %eax,%eax
+  106d29:	75 0f                	jne    106d3a <serial_putc+0x65>
+			serial_tx.rpos++;
+  106d2b:	8b 83 8c 40 03 00    	mov    0x3408c(%ebx),%eax
+  106d31:	83 c0 01             	add    $0x1,%eax
+  106d34:	89 83 8c 40 03 00    	mov    %eax,0x3408c(%ebx)
+	serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = c;
+  106d3a:	8b 83 90 40 03 00    	mov    0x34090(%ebx),%eax
+  106d40:	8d 50 01             	lea    0x1(%eax),%edx
+  106d43:	89 93 90 40 03 00    	mov    %edx,0x34090(%ebx)
+  106d49:	25 ff 0f 00 00       	and    $0xfff,%eax
+  106d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  106d51:	88 94 03 8c 30 03 00 	mov    %dl,0x3308c(%ebx,%eax,1)
+	if (serial_txsync)
+  106d58:	8b 83 9c 40 03 00    	mov    0x3409c(%ebx),%eax
+  106d5e:	85 c0                	test   %eax,%eax
+  106d60:	74 07                	je     106d69 <serial_putc+0x94>
+		serial_txflush();
+  106d62:	e8 06 fe ff ff       	call   106b6d <serial_txflush>
+  106d67:	eb 22                	jmp    106d8b <serial_putc+0xb6>
+	else if (!(serial_ier & COM_IER_TXRDY) || !(eflags & FL_IF))
+  106d69:	0f b6 83 94 40 03 00 	movzbl 0x34094(%ebx),%eax
+  106d70:	0f b6 c0             	movzbl %al,%eax
+  106d73:	83 e0 02             	and    $0x2,%eax
+  106d76:	85 c0                	test   %eax,%eax
+  106d78:	74 0c                	je     106d86 <serial_putc+0xb1>
+  106d7a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  106d7d:	25 00 02 00 00       	and    $0x200,%eax
+  106d82:	85 c0                	test   %eax,%eax
+  106d84:	75 05                	jne    106d8b <serial_putc+0xb6>
+		serial_txkick();
+  106d86:	e8 f8 fc ff ff       	call   106a83 <serial_txkick>
+	serial_unlock();
+  106d8b:	e8 ca fb ff ff       	call   10695a <serial_unlock>
+  106d90:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  106d93:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  106d96:	ff 75 f0             	push   -0x10(%ebp)
+  106d99:	9d                   	popf
+}
+  106d9a:	eb 01                	jmp    106d9d <serial_putc+0xc8>
+		return;
+  106d9c:	90                   	nop
+}
+  106d9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106da0:	c9                   	leave
+  106da1:	c3                   	ret
+
+00106da2 <serial_sync>:
+{
+  106da2:	55                   	push   %ebp
+  106da3:	89 e5                	mov    %esp,%ebp
+  106da5:	53                   	push   %ebx
+  106da6:	83 ec 10             	sub    $0x10,%esp
+  106da9:	e8 66 96 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  106dae:	81 c3 46 72 00 00    	add    $0x7246,%ebx
+	if (!serial_exists)
+  106db4:	8b 83 6c 30 03 00    	mov    0x3306c(%ebx),%eax
+  106dba:	85 c0                	test   %eax,%eax
+  106dbc:	74 32                	je     106df0 <serial_sync+0x4e>
+        __asm __volatile("pushfl; popl %0" : "=rm" (eflags));
+  106dbe:	9c                   	pushf
+  106dbf:	58                   	pop    %eax
+  106dc0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        return eflags;
+  106dc3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+	uint32_t eflags = read_eflags();
+  106dc6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+	asm volatile("cli");
+  106dc9:	fa                   	cli
+}
+  106dca:	90                   	nop
+	serial_lock();
+  106dcb:	e8 58 fb ff ff       	call   106928 <serial_lock>
+	serial_txsync = 1;
+  106dd0:	c7 83 9c 40 03 00 01 	movl   $0x1,0x3409c(%ebx)
+  106dd7:	00 00 00 
+	serial_txflush();
+  106dda:	e8 8e fd ff ff       	call   106b6d <serial_txflush>
+	serial_unlock();
+  106ddf:	e8 76 fb ff ff       	call   10695a <serial_unlock>
+  106de4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  106de7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        __asm __volatile("pushl %0; popfl" : : "rm" (eflags));
+  106dea:	ff 75 f4             	push   -0xc(%ebp)
+  106ded:	9d                   	popf
+}
+  106dee:	eb 01                	jmp    106df1 <serial_sync+0x4f>
+		return;
+  106df0:	90                   	nop
+}
+  106df1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106df4:	c9                   	leave
+  106df5:	c3                   	ret
+
+00106df6 <serial_init>:
+{
+  106df6:	55                   	push   %ebp
+  106df7:	89 e5                	mov    %esp,%ebp
+  106df9:	83 ec 50             	sub    $0x50,%esp
+  106dfc:	e8 0e c3 ff ff       	call   10310f <__x86.get_pc_thunk.cx>
+  106e01:	81 c1 f3 71 00 00    	add    $0x71f3,%ecx
+  106e07:	c7 45 b4 fa 03 00 00 	movl   $0x3fa,-0x4c(%ebp)
+  106e0e:	c6 45 b3 c7          	movb   $0xc7,-0x4d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e12:	0f b6 45 b3          	movzbl -0x4d(%ebp),%eax
+  106e16:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  106e19:	ee                   	out    %al,(%dx)
+}
+  106e1a:	90                   	nop
+  106e1b:	c7 45 bc fb 03 00 00 	movl   $0x3fb,-0x44(%ebp)
+  106e22:	c6 45 bb 80          	movb   $0x80,-0x45(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e26:	0f b6 45 bb          	movzbl -0x45(%ebp),%eax
+  106e2a:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  106e2d:	ee                   	out    %al,(%dx)
+}
+  106e2e:	90                   	nop
+  106e2f:	c7 45 c4 f8 03 00 00 	movl   $0x3f8,-0x3c(%ebp)
+  106e36:	c6 45 c3 01          	movb   $0x1,-0x3d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e3a:	0f b6 45 c3          	movzbl -0x3d(%ebp),%eax
+  106e3e:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  106e41:	ee                   	out    %al,(%dx)
+}
+  106e42:	90                   	nop
+  106e43:	c7 45 cc f9 03 00 00 	movl   $0x3f9,-0x34(%ebp)
+  106e4a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e4e:	0f b6 45 cb          	movzbl -0x35(%ebp),%eax
+  106e52:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  106e55:	ee                   	out    %al,(%dx)
+}
+  106e56:	90                   	nop
+  106e57:	c7 45 d4 fb 03 00 00 	movl   $0x3fb,-0x2c(%ebp)
+  106e5e:	c6 45 d3 03          	movb   $0x3,-0x2d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e62:	0f b6 45 d3          	movzbl -0x2d(%ebp),%eax
+  106e66:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  106e69:	ee                   	out    %al,(%dx)
+}
+  106e6a:	90                   	nop
+  106e6b:	c7 45 dc fc 03 00 00 	movl   $0x3fc,-0x24(%ebp)
+  106e72:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e76:	0f b6 45 db          	movzbl -0x25(%ebp),%eax
+  106e7a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  106e7d:	ee                   	out    %al,(%dx)
+}
+  106e7e:	90                   	nop
+	serial_ier = COM_IER_RDI | COM_IER_RLSI;
+  106e7f:	c6 81 94 40 03 00 05 	movb   $0x5,0x34094(%ecx)
+	outb(COM1+COM_IER, serial_ier);
+  106e86:	0f b6 81 94 40 03 00 	movzbl 0x34094(%ecx),%eax
+  106e8d:	0f b6 c0             	movzbl %al,%eax
+  106e90:	c7 45 e4 f9 03 00 00 	movl   $0x3f9,-0x1c(%ebp)
+  106e97:	88 45 e3             	mov    %al,-0x1d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106e9a:	0f b6 45 e3          	movzbl -0x1d(%ebp),%eax
+  106e9e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  106ea1:	ee                   	out    %al,(%dx)
+}
+  106ea2:	90                   	nop
+  106ea3:	c7 45 ec fd 03 00 00 	movl   $0x3fd,-0x14(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106eaa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  106ead:	89 c2                	mov    %eax,%edx
+  106eaf:	ec                   	in     (%dx),%al
+  106eb0:	88 45 eb             	mov    %al,-0x15(%ebp)
+	return data;
+  106eb3:	0f b6 45 eb          	movzbl -0x15(%ebp),%eax
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+  106eb7:	3c ff                	cmp    $0xff,%al
+  106eb9:	0f 95 c0             	setne  %al
+  106ebc:	0f b6 c0             	movzbl %al,%eax
+  106ebf:	89 81 6c 30 03 00    	mov    %eax,0x3306c(%ecx)
+  106ec5:	c7 45 f4 fa 03 00 00 	movl   $0x3fa,-0xc(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  106ecc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  106ecf:	89 c2                	mov    %eax,%edx
+  106ed1:	ec                   	in     (%dx),%al
+  106ed2:	88 45 f3             	mov    %al,-0xd(%ebp)
+  106ed5:	c7 45 fc f8 03 00 00 	movl   $0x3f8,-0x4(%ebp)
+  106edc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  106edf:	89 c2                	mov    %eax,%edx
+  106ee1:	ec                   	in     (%dx),%al
+  106ee2:	88 45 fb             	mov    %al,-0x5(%ebp)
+}
+  106ee5:	90                   	nop
+  106ee6:	c9                   	leave
+  106ee7:	c3                   	ret
+
+00106ee8 <serial_intenable>:
+{
+  106ee8:	55                   	push   %ebp
+  106ee9:	89 e5                	mov    %esp,%ebp
+  106eeb:	53                   	push   %ebx
+  106eec:	83 ec 14             	sub    $0x14,%esp
+  106eef:	e8 1b c2 ff ff       	call   10310f <__x86.get_pc_thunk.cx>
+  106ef4:	81 c1 00 71 00 00    	add    $0x7100,%ecx
+	if (!serial_exists)
+  106efa:	8b 81 6c 30 03 00    	mov    0x3306c(%ecx),%eax
+  106f00:	85 c0                	test   %eax,%eax
+  106f02:	74 2a                	je     106f2e <serial_intenable+0x46>
+  106f04:	c7 45 f4 fc 03 00 00 	movl   $0x3fc,-0xc(%ebp)
+  106f0b:	c6 45 f3 08          	movb   $0x8,-0xd(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106f0f:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  106f13:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  106f16:	ee                   	out    %al,(%dx)
+}
+  106f17:	90                   	nop
+	pic_enable(IRQ_SERIAL);
+  106f18:	83 ec 0c             	sub    $0xc,%esp
+  106f1b:	6a 04                	push   $0x4
+  106f1d:	89 cb                	mov    %ecx,%ebx
+  106f1f:	e8 d6 01 00 00       	call   1070fa <pic_enable>
+  106f24:	83 c4 10             	add    $0x10,%esp
+	serial_intr();
+  106f27:	e8 83 fc ff ff       	call   106baf <serial_intr>
+  106f2c:	eb 01                	jmp    106f2f <serial_intenable+0x47>
+		return;
+  106f2e:	90                   	nop
+}
+  106f2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106f32:	c9                   	leave
+  106f33:	c3                   	ret
+
+00106f34 <pic_init>:
+static bool didinit;
+
+// Initialize the 8259A interrupt controllers.
+void
+pic_init(void)
+{
+  106f34:	55                   	push   %ebp
+  106f35:	89 e5                	mov    %esp,%ebp
+  106f37:	83 ec 78             	sub    $0x78,%esp
+  106f3a:	e8 d0 c1 ff ff       	call   10310f <__x86.get_pc_thunk.cx>
+  106f3f:	81 c1 b5 70 00 00    	add    $0x70b5,%ecx
+	if (didinit)		// only do once on bootstrap CPU
+  106f45:	8b 81 a4 40 03 00    	mov    0x340a4(%ecx),%eax
+  106f4b:	85 c0                	test   %eax,%eax
+  106f4d:	0f 85 47 01 00 00    	jne    10709a <pic_init+0x166>
+		return;
+	didinit = 1;
+  106f53:	c7 81 a4 40 03 00 01 	movl   $0x1,0x340a4(%ecx)
+  106f5a:	00 00 00 
+  106f5d:	c7 45 8c 21 00 00 00 	movl   $0x21,-0x74(%ebp)
+  106f64:	c6 45 8b ff          	movb   $0xff,-0x75(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106f68:	0f b6 45 8b          	movzbl -0x75(%ebp),%eax
+  106f6c:	8b 55 8c             	mov    -0x74(%ebp),%edx
+  106f6f:	ee                   	out    %al,(%dx)
+}
+  106f70:	90                   	nop
+  106f71:	c7 45 94 a1 00 00 00 	movl   $0xa1,-0x6c(%ebp)
+  106f78:	c6 45 93 ff          	movb   $0xff,-0x6d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106f7c:	0f b6 45 93          	movzbl -0x6d(%ebp),%eax
+  106f80:	8b 55 94             	mov    -0x6c(%ebp),%edx
+  106f83:	ee                   	out    %al,(%dx)
+}
+  106f84:	90                   	nop
+  106f85:	c7 45 9c 20 00 00 00 	movl   $0x20,-0x64(%ebp)
+  106f8c:	c6 45 9b 11          	movb   $0x11,-0x65(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106f90:	0f b6 45 9b          	movzbl -0x65(%ebp),%eax
+  106f94:	8b 55 9c             	mov    -0x64(%ebp),%edx
+  106f97:	ee                   	out    %al,(%dx)
+}
+  106f98:	90                   	nop
+  106f99:	c7 45 a4 21 00 00 00 	movl   $0x21,-0x5c(%ebp)
+  106fa0:	c6 45 a3 20          	movb   $0x20,-0x5d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106fa4:	0f b6 45 a3          	movzbl -0x5d(%ebp),%eax
+  106fa8:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  106fab:	ee                   	out    %al,(%dx)
+}
+  106fac:	90                   	nop
+  106fad:	c7 45 ac 21 00 00 00 	movl   $0x21,-0x54(%ebp)
+  106fb4:	c6 45 ab 04          	movb   $0x4,-0x55(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106fb8:	0f b6 45 ab          	movzbl -0x55(%ebp),%eax
+  106fbc:	8b 55 ac             	mov    -0x54(%ebp),%edx
+  106fbf:	ee                   	out    %al,(%dx)
+}
+  106fc0:	90                   	nop
+  106fc1:	c7 45 b4 21 00 00 00 	movl   $0x21,-0x4c(%ebp)
+  106fc8:	c6 45 b3 03          	movb   $0x3,-0x4d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106fcc:	0f b6 45 b3          	movzbl -0x4d(%ebp),%eax
+  106fd0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  106fd3:	ee                   	out    %al,(%dx)
+}
+  106fd4:	90                   	nop
+  106fd5:	c7 45 bc a0 00 00 00 	movl   $0xa0,-0x44(%ebp)
+  106fdc:	c6 45 bb 11          	movb   $0x11,-0x45(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106fe0:	0f b6 45 bb          	movzbl -0x45(%ebp),%eax
+  106fe4:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  106fe7:	ee                   	out    %al,(%dx)
+}
+  106fe8:	90                   	nop
+  106fe9:	c7 45 c4 a1 00 00 00 	movl   $0xa1,-0x3c(%ebp)
+  106ff0:	c6 45 c3 28          	movb   $0x28,-0x3d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  106ff4:	0f b6 45 c3          	movzbl -0x3d(%ebp),%eax
+  106ff8:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  106ffb:	ee                   	out    %al,(%dx)
+}
+  106ffc:	90                   	nop
+  106ffd:	c7 45 cc a1 00 00 00 	movl   $0xa1,-0x34(%ebp)
+  107004:	c6 45 cb 02          	movb   $0x2,-0x35(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107008:	0f b6 45 cb          	movzbl -0x35(%ebp),%eax
+  10700c:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  10700f:	ee                   	out    %al,(%dx)
+}
+  107010:	90                   	nop
+  107011:	c7 45 d4 a1 00 00 00 	movl   $0xa1,-0x2c(%ebp)
+  107018:	c6 45 d3 01          	movb   $0x1,-0x2d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10701c:	0f b6 45 d3          	movzbl -0x2d(%ebp),%eax
+  107020:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  107023:	ee                   	out    %al,(%dx)
+}
+  107024:	90                   	nop
+  107025:	c7 45 dc 20 00 00 00 	movl   $0x20,-0x24(%ebp)
+  10702c:	c6 45 db 68          	movb   $0x68,-0x25(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107030:	0f b6 45 db          	movzbl -0x25(%ebp),%eax
+  107034:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  107037:	ee                   	out    %al,(%dx)
+}
+  107038:	90                   	nop
+  107039:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%ebp)
+  107040:	c6 45 e3 0a          	movb   $0xa,-0x1d(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107044:	0f b6 45 e3          	movzbl -0x1d(%ebp),%eax
+  107048:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  10704b:	ee                   	out    %al,(%dx)
+}
+  10704c:	90                   	nop
+  10704d:	c7 45 ec a0 00 00 00 	movl   $0xa0,-0x14(%ebp)
+  107054:	c6 45 eb 68          	movb   $0x68,-0x15(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107058:	0f b6 45 eb          	movzbl -0x15(%ebp),%eax
+  10705c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  10705f:	ee                   	out    %al,(%dx)
+}
+  107060:	90                   	nop
+  107061:	c7 45 f4 a0 00 00 00 	movl   $0xa0,-0xc(%ebp)
+  107068:	c6 45 f3 0a          	movb   $0xa,-0xd(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10706c:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  107070:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  107073:	ee                   	out    %al,(%dx)
+}
+  107074:	90                   	nop
+	outb(IO_PIC1, 0x0a);             /* read IRR by default */
+
+	outb(IO_PIC2, 0x68);               /* OCW3 */
+	outb(IO_PIC2, 0x0a);               /* OCW3 */
+
+	if (irqmask != 0xFFFF)
+  107075:	0f b7 81 5c 26 00 00 	movzwl 0x265c(%ecx),%eax
+  10707c:	66 83 f8 ff          	cmp    $0xffff,%ax
+  107080:	74 19                	je     10709b <pic_init+0x167>
+		pic_setmask(irqmask);
+  107082:	0f b7 81 5c 26 00 00 	movzwl 0x265c(%ecx),%eax
+  107089:	0f b7 c0             	movzwl %ax,%eax
+  10708c:	83 ec 0c             	sub    $0xc,%esp
+  10708f:	50                   	push   %eax
+  107090:	e8 08 00 00 00       	call   10709d <pic_setmask>
+  107095:	83 c4 10             	add    $0x10,%esp
+  107098:	eb 01                	jmp    10709b <pic_init+0x167>
+		return;
+  10709a:	90                   	nop
+}
+  10709b:	c9                   	leave
+  10709c:	c3                   	ret
+
+0010709d <pic_setmask>:
+
+void
+pic_setmask(uint16_t mask)
+{
+  10709d:	55                   	push   %ebp
+  10709e:	89 e5                	mov    %esp,%ebp
+  1070a0:	83 ec 14             	sub    $0x14,%esp
+  1070a3:	e8 68 93 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1070a8:	05 4c 6f 00 00       	add    $0x6f4c,%eax
+  1070ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  1070b0:	66 89 55 ec          	mov    %dx,-0x14(%ebp)
+	irqmask = mask;
+  1070b4:	0f b7 55 ec          	movzwl -0x14(%ebp),%edx
+  1070b8:	66 89 90 5c 26 00 00 	mov    %dx,0x265c(%eax)
+	outb(IO_PIC1+1, (char)mask);
+  1070bf:	0f b7 45 ec          	movzwl -0x14(%ebp),%eax
+  1070c3:	0f b6 c0             	movzbl %al,%eax
+  1070c6:	c7 45 f4 21 00 00 00 	movl   $0x21,-0xc(%ebp)
+  1070cd:	88 45 f3             	mov    %al,-0xd(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1070d0:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  1070d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  1070d7:	ee                   	out    %al,(%dx)
+}
+  1070d8:	90                   	nop
+	outb(IO_PIC2+1, (char)(mask >> 8));
+  1070d9:	0f b7 45 ec          	movzwl -0x14(%ebp),%eax
+  1070dd:	66 c1 e8 08          	shr    $0x8,%ax
+  1070e1:	0f b6 c0             	movzbl %al,%eax
+  1070e4:	c7 45 fc a1 00 00 00 	movl   $0xa1,-0x4(%ebp)
+  1070eb:	88 45 fb             	mov    %al,-0x5(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1070ee:	0f b6 45 fb          	movzbl -0x5(%ebp),%eax
+  1070f2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  1070f5:	ee                   	out    %al,(%dx)
+}
+  1070f6:	90                   	nop
+}
+  1070f7:	90                   	nop
+  1070f8:	c9                   	leave
+  1070f9:	c3                   	ret
+
+001070fa <pic_enable>:
+
+void
+pic_enable(int irq)
+{
+  1070fa:	55                   	push   %ebp
+  1070fb:	89 e5                	mov    %esp,%ebp
+  1070fd:	53                   	push   %ebx
+  1070fe:	83 ec 04             	sub    $0x4,%esp
+  107101:	e8 0a 93 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107106:	05 ee 6e 00 00       	add    $0x6eee,%eax
+	assert(irq >= 0 && irq < MAX_IRQS);
+  10710b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  10710f:	78 06                	js     107117 <pic_enable+0x1d>
+  107111:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+  107115:	7e 1e                	jle    107135 <pic_enable+0x3b>
+  107117:	8d 90 f4 c4 ff ff    	lea    -0x3b0c(%eax),%edx
+  10711d:	52                   	push   %edx
+  10711e:	8d 90 0f c5 ff ff    	lea    -0x3af1(%eax),%edx
+  107124:	52                   	push   %edx
+  107125:	6a 5d                	push   $0x5d
+  107127:	8d 90 24 c5 ff ff    	lea    -0x3adc(%eax),%edx
+  10712d:	52                   	push   %edx
+  10712e:	89 c3                	mov    %eax,%ebx
+  107130:	e8 9d 9c ff ff       	call   100dd2 <debug_panic>
+	pic_setmask(irqmask & ~(1 << irq));
+  107135:	8b 55 08             	mov    0x8(%ebp),%edx
+  107138:	bb 01 00 00 00       	mov    $0x1,%ebx
+  10713d:	89 d1                	mov    %edx,%ecx
+  10713f:	d3 e3                	shl    %cl,%ebx
+  107141:	89 da                	mov    %ebx,%edx
+  107143:	f7 d2                	not    %edx
+  107145:	0f b7 80 5c 26 00 00 	movzwl 0x265c(%eax),%eax
+  10714c:	21 d0                	and    %edx,%eax
+  10714e:	0f b7 c0             	movzwl %ax,%eax
+  107151:	83 ec 0c             	sub    $0xc,%esp
+  107154:	50                   	push   %eax
+  107155:	e8 43 ff ff ff       	call   10709d <pic_setmask>
+  10715a:	83 c4 10             	add    $0x10,%esp
+}
+  10715d:	90                   	nop
+  10715e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  107161:	c9                   	leave
+  107162:	c3                   	ret
+
+00107163 <nvram_read>:
+#include <dev/nvram.h>
+
+
+unsigned
+nvram_read(unsigned reg)
+{
+  107163:	55                   	push   %ebp
+  107164:	89 e5                	mov    %esp,%ebp
+  107166:	83 ec 10             	sub    $0x10,%esp
+  107169:	e8 a2 92 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10716e:	05 86 6e 00 00       	add    $0x6e86,%eax
+	outb(IO_RTC, reg);
+  107173:	8b 45 08             	mov    0x8(%ebp),%eax
+  107176:	0f b6 c0             	movzbl %al,%eax
+  107179:	c7 45 f4 70 00 00 00 	movl   $0x70,-0xc(%ebp)
+  107180:	88 45 f3             	mov    %al,-0xd(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107183:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  107187:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  10718a:	ee                   	out    %al,(%dx)
+}
+  10718b:	90                   	nop
+  10718c:	c7 45 fc 71 00 00 00 	movl   $0x71,-0x4(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  107193:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  107196:	89 c2                	mov    %eax,%edx
+  107198:	ec                   	in     (%dx),%al
+  107199:	88 45 fb             	mov    %al,-0x5(%ebp)
+	return data;
+  10719c:	0f b6 45 fb          	movzbl -0x5(%ebp),%eax
+	return inb(IO_RTC+1);
+  1071a0:	0f b6 c0             	movzbl %al,%eax
+}
+  1071a3:	c9                   	leave
+  1071a4:	c3                   	ret
+
+001071a5 <nvram_read16>:
+
+unsigned
+nvram_read16(unsigned r)
+{
+  1071a5:	55                   	push   %ebp
+  1071a6:	89 e5                	mov    %esp,%ebp
+  1071a8:	53                   	push   %ebx
+  1071a9:	e8 62 92 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1071ae:	05 46 6e 00 00       	add    $0x6e46,%eax
+	return nvram_read(r) | (nvram_read(r + 1) << 8);
+  1071b3:	ff 75 08             	push   0x8(%ebp)
+  1071b6:	e8 a8 ff ff ff       	call   107163 <nvram_read>
+  1071bb:	83 c4 04             	add    $0x4,%esp
+  1071be:	89 c3                	mov    %eax,%ebx
+  1071c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  1071c3:	83 c0 01             	add    $0x1,%eax
+  1071c6:	50                   	push   %eax
+  1071c7:	e8 97 ff ff ff       	call   107163 <nvram_read>
+  1071cc:	83 c4 04             	add    $0x4,%esp
+  1071cf:	c1 e0 08             	shl    $0x8,%eax
+  1071d2:	09 d8                	or     %ebx,%eax
+}
+  1071d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1071d7:	c9                   	leave
+  1071d8:	c3                   	ret
+
+001071d9 <nvram_write>:
+
+void
+nvram_write(unsigned reg, unsigned datum)
+{
+  1071d9:	55                   	push   %ebp
+  1071da:	89 e5                	mov    %esp,%ebp
+  1071dc:	83 ec 10             	sub    $0x10,%esp
+  1071df:	e8 2c 92 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1071e4:	05 10 6e 00 00       	add    $0x6e10,%eax
+	outb(IO_RTC, reg);
+  1071e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  1071ec:	0f b6 c0             	movzbl %al,%eax
+  1071ef:	c7 45 f4 70 00 00 00 	movl   $0x70,-0xc(%ebp)
+  1071f6:	88 45 f3             	mov    %al,-0xd(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1071f9:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  1071fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  107200:	ee                   	out    %al,(%dx)
+}
+  107201:	90                   	nop
+	outb(IO_RTC+1, datum);
+  107202:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107205:	0f b6 c0             	movzbl %al,%eax
+  107208:	c7 45 fc 71 00 00 00 	movl   $0x71,-0x4(%ebp)
+  10720f:	88 45 fb             	mov    %al,-0x5(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107212:	0f b6 45 fb          	movzbl -0x5(%ebp),%eax
+  107216:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  107219:	ee                   	out    %al,(%dx)
+}
+  10721a:	90                   	nop
+}
+  10721b:	90                   	nop
+  10721c:	c9                   	leave
+  10721d:	c3                   	ret
+
+0010721e <lapicw>:
+volatile uint32_t *lapic;
+
+
+static void
+lapicw(int index, int value)
+{
+  10721e:	55                   	push   %ebp
+  10721f:	89 e5                	mov    %esp,%ebp
+  107221:	e8 ea 91 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107226:	05 ce 6d 00 00       	add    $0x6dce,%eax
+	lapic[index] = value;
+  10722b:	8b 90 a8 40 03 00    	mov    0x340a8(%eax),%edx
+  107231:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  107234:	c1 e1 02             	shl    $0x2,%ecx
+  107237:	01 d1                	add    %edx,%ecx
+  107239:	8b 55 0c             	mov    0xc(%ebp),%edx
+  10723c:	89 11                	mov    %edx,(%ecx)
+	lapic[ID];  // wait for write to finish, by reading
+  10723e:	8b 80 a8 40 03 00    	mov    0x340a8(%eax),%eax
+  107244:	83 c0 20             	add    $0x20,%eax
+  107247:	8b 00                	mov    (%eax),%eax
+}
+  107249:	90                   	nop
+  10724a:	5d                   	pop    %ebp
+  10724b:	c3                   	ret
+
+0010724c <microdelay>:
+
+// Spin for roughly the given number of microseconds.
+// Each access to the unused POST port 0x84 takes about a microsecond.
+static void
+microdelay(int us)
+{
+  10724c:	55                   	push   %ebp
+  10724d:	89 e5                	mov    %esp,%ebp
+  10724f:	83 ec 10             	sub    $0x10,%esp
+  107252:	e8 b9 91 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107257:	05 9d 6d 00 00       	add    $0x6d9d,%eax
+	while (us-- > 0)
+  10725c:	eb 11                	jmp    10726f <microdelay+0x23>
+  10725e:	c7 45 fc 84 00 00 00 	movl   $0x84,-0x4(%ebp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  107265:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  107268:	89 c2                	mov    %eax,%edx
+  10726a:	ec                   	in     (%dx),%al
+  10726b:	88 45 fb             	mov    %al,-0x5(%ebp)
+	return data;
+  10726e:	90                   	nop
+  10726f:	8b 45 08             	mov    0x8(%ebp),%eax
+  107272:	8d 50 ff             	lea    -0x1(%eax),%edx
+  107275:	89 55 08             	mov    %edx,0x8(%ebp)
+  107278:	85 c0                	test   %eax,%eax
+  10727a:	7f e2                	jg     10725e <microdelay+0x12>
+		inb(0x84);
+}
+  10727c:	90                   	nop
+  10727d:	90                   	nop
+  10727e:	c9                   	leave
+  10727f:	c3                   	ret
+
+00107280 <lapic_ipi>:
+
+// Send an interprocessor interrupt and wait for it to be delivered.
+static void
+lapic_ipi(uint32_t cmd)
+{
+  107280:	55                   	push   %ebp
+  107281:	89 e5                	mov    %esp,%ebp
+  107283:	53                   	push   %ebx
+  107284:	e8 8b 91 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  107289:	81 c3 6b 6d 00 00    	add    $0x6d6b,%ebx
+	lapicw(ICRHI, 0);
+  10728f:	6a 00                	push   $0x0
+  107291:	68 c4 00 00 00       	push   $0xc4
+  107296:	e8 83 ff ff ff       	call   10721e <lapicw>
+  10729b:	83 c4 08             	add    $0x8,%esp
+	lapicw(ICRLO, cmd);
+  10729e:	8b 45 08             	mov    0x8(%ebp),%eax
+  1072a1:	50                   	push   %eax
+  1072a2:	68 c0 00 00 00       	push   $0xc0
+  1072a7:	e8 72 ff ff ff       	call   10721e <lapicw>
+  1072ac:	83 c4 08             	add    $0x8,%esp
+	while (lapic[ICRLO] & DELIVS)
+  1072af:	90                   	nop
+  1072b0:	8b 83 a8 40 03 00    	mov    0x340a8(%ebx),%eax
+  1072b6:	05 00 03 00 00       	add    $0x300,%eax
+  1072bb:	8b 00                	mov    (%eax),%eax
+  1072bd:	25 00 10 00 00       	and    $0x1000,%eax
+  1072c2:	85 c0                	test   %eax,%eax
+  1072c4:	75 ea                	jne    1072b0 <lapic_ipi+0x30>
+		;
+}
+  1072c6:	90                   	nop
+  1072c7:	90                   	nop
+  1072c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1072cb:	c9                   	leave
+  1072cc:	c3                   	ret
+
+001072cd <lapic_init>:
+
+void
+lapic_init(void)
+{
+  1072cd:	55                   	push   %ebp
+  1072ce:	89 e5                	mov    %esp,%ebp
+  1072d0:	e8 3b 91 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1072d5:	05 1f 6d 00 00       	add    $0x6d1f,%eax
+	if (!lapic) 
+  1072da:	8b 80 a8 40 03 00    	mov    0x340a8(%eax),%eax
+  1072e0:	85 c0                	test   %eax,%eax
+  1072e2:	74 4d                	je     107331 <lapic_init+0x64>
+		return;
+
+	// Enable local APIC; set spurious interrupt vector.
+	lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+  1072e4:	68 27 01 00 00       	push   $0x127
+  1072e9:	6a 3c                	push   $0x3c
+  1072eb:	e8 2e ff ff ff       	call   10721e <lapicw>
+  1072f0:	83 c4 08             	add    $0x8,%esp
+
+	// We don't use the APIC timer yet.
+	lapicw(TIMER, MASKED);
+  1072f3:	68 00 00 01 00       	push   $0x10000
+  1072f8:	68 c8 00 00 00       	push   $0xc8
+  1072fd:	e8 1c ff ff ff       	call   10721e <lapicw>
+  107302:	83 c4 08             	add    $0x8,%esp
+
+	// Clear error status register (requires back-to-back writes).
+	lapicw(ESR, 0);
+  107305:	6a 00                	push   $0x0
+  107307:	68 a0 00 00 00       	push   $0xa0
+  10730c:	e8 0d ff ff ff       	call   10721e <lapicw>
+  107311:	83 c4 08             	add    $0x8,%esp
+	lapicw(ESR, 0);
+  107314:	6a 00                	push   $0x0
+  107316:	68 a0 00 00 00       	push   $0xa0
+  10731b:	e8 fe fe ff ff       	call   10721e <lapicw>
+  107320:	83 c4 08             	add    $0x8,%esp
+
+	// Accept all interrupts.
+	lapicw(TPR, 0);
+  107323:	6a 00                	push   $0x0
+  107325:	6a 20                	push   $0x20
+  107327:	e8 f2 fe ff ff       	call   10721e <lapicw>
+  10732c:	83 c4 08             	add    $0x8,%esp
+  10732f:	eb 01                	jmp    107332 <lapic_init+0x65>
+		return;
+  107331:	90                   	nop
+}
+  107332:	c9                   	leave
+  107333:	c3                   	ret
+
+00107334 <lapic_id>:
+
+int
+lapic_id(void)
+{
+  107334:	55                   	push   %ebp
+  107335:	89 e5                	mov    %esp,%ebp
+  107337:	e8 d4 90 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10733c:	05 b8 6c 00 00       	add    $0x6cb8,%eax
+	if (!lapic)
+  107341:	8b 90 a8 40 03 00    	mov    0x340a8(%eax),%edx
+  107347:	85 d2                	test   %edx,%edx
+  107349:	75 07                	jne    107352 <lapic_id+0x1e>
+		return 0;
+  10734b:	b8 00 00 00 00       	mov    $0x0,%eax
+  107350:	eb 0e                	jmp    107360 <lapic_id+0x2c>
+	return lapic[ID] >> 24;
+  107352:	8b 80 a8 40 03 00    	mov    0x340a8(%eax),%eax
+  107358:	83 c0 20             	add    $0x20,%eax
+  10735b:	8b 00                	mov    (%eax),%eax
+  10735d:	c1 e8 18             	shr    $0x18,%eax
+}
+  107360:	5d                   	pop    %ebp
+  107361:	c3                   	ret
+
+00107362 <lapic_startaps>:
+
+void
+lapic_startaps(uint32_t addr)
+{
+  107362:	55                   	push   %ebp
+  107363:	89 e5                	mov    %esp,%ebp
+  107365:	53                   	push   %ebx
+  107366:	83 ec 14             	sub    $0x14,%esp
+  107369:	e8 a2 90 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10736e:	05 86 6c 00 00       	add    $0x6c86,%eax
+	assert(lapic && (addr & 0xFFF00FFF) == 0);
+  107373:	8b 90 a8 40 03 00    	mov    0x340a8(%eax),%edx
+  107379:	85 d2                	test   %edx,%edx
+  10737b:	74 0d                	je     10738a <lapic_startaps+0x28>
+  10737d:	8b 55 08             	mov    0x8(%ebp),%edx
+  107380:	81 e2 ff 0f f0 ff    	and    $0xfff00fff,%edx
+  107386:	85 d2                	test   %edx,%edx
+  107388:	74 1e                	je     1073a8 <lapic_startaps+0x46>
+  10738a:	8d 90 30 c5 ff ff    	lea    -0x3ad0(%eax),%edx
+  107390:	52                   	push   %edx
+  107391:	8d 90 52 c5 ff ff    	lea    -0x3aae(%eax),%edx
+  107397:	52                   	push   %edx
+  107398:	6a 61                	push   $0x61
+  10739a:	8d 90 67 c5 ff ff    	lea    -0x3a99(%eax),%edx
+  1073a0:	52                   	push   %edx
+  1073a1:	89 c3                	mov    %eax,%ebx
+  1073a3:	e8 2a 9a ff ff       	call   100dd2 <debug_panic>
+
+	// The "universal startup algorithm" of the MP specification,
+	// but broadcast to all other processors rather than sent
+	// to each in turn: an INIT to reset them, a 10ms wait,
+	// then two STARTUP IPIs giving the page to start at.
+	lapic_ipi(OTHERS | INIT | LEVEL | ASSERT);
+  1073a8:	83 ec 0c             	sub    $0xc,%esp
+  1073ab:	68 00 c5 0c 00       	push   $0xcc500
+  1073b0:	e8 cb fe ff ff       	call   107280 <lapic_ipi>
+  1073b5:	83 c4 10             	add    $0x10,%esp
+	microdelay(200);
+  1073b8:	83 ec 0c             	sub    $0xc,%esp
+  1073bb:	68 c8 00 00 00       	push   $0xc8
+  1073c0:	e8 87 fe ff ff       	call   10724c <microdelay>
+  1073c5:	83 c4 10             	add    $0x10,%esp
+	lapic_ipi(OTHERS | INIT | LEVEL | DEASSERT);
+  1073c8:	83 ec 0c             	sub    $0xc,%esp
+  1073cb:	68 00 85 0c 00       	push   $0xc8500
+  1073d0:	e8 ab fe ff ff       	call   107280 <lapic_ipi>
+  1073d5:	83 c4 10             	add    $0x10,%esp
+	microdelay(10000);
+  1073d8:	83 ec 0c             	sub    $0xc,%esp
+  1073db:	68 10 27 00 00       	push   $0x2710
+  1073e0:	e8 67 fe ff ff       	call   10724c <microdelay>
+  1073e5:	83 c4 10             	add    $0x10,%esp
+
+	int i;
+	for (i = 0; i < 2; i++) {
+  1073e8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  1073ef:	eb 2b                	jmp    10741c <lapic_startaps+0xba>
+		lapic_ipi(OTHERS | STARTUP | (addr >> 12));
+  1073f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  1073f4:	c1 e8 0c             	shr    $0xc,%eax
+  1073f7:	0d 00 06 0c 00       	or     $0xc0600,%eax
+  1073fc:	83 ec 0c             	sub    $0xc,%esp
+  1073ff:	50                   	push   %eax
+  107400:	e8 7b fe ff ff       	call   107280 <lapic_ipi>
+  107405:	83 c4 10             	add    $0x10,%esp
+		microdelay(200);
+  107408:	83 ec 0c             	sub    $0xc,%esp
+  10740b:	68 c8 00 00 00       	push   $0xc8
+  107410:	e8 37 fe ff ff       	call   10724c <microdelay>
+  107415:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 2; i++) {
+  107418:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  10741c:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+  107420:	7e cf                	jle    1073f1 <lapic_startaps+0x8f>
+	}
+}
+  107422:	90                   	nop
+  107423:	90                   	nop
+  107424:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  107427:	c9                   	leave
+  107428:	c3                   	ret
+
+00107429 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  107429:	55                   	push   %ebp
+  10742a:	89 e5                	mov    %esp,%ebp
+  10742c:	57                   	push   %edi
+  10742d:	56                   	push   %esi
+  10742e:	53                   	push   %ebx
+  10742f:	83 ec 1c             	sub    $0x1c,%esp
+  107432:	e8 97 99 ff ff       	call   100dce <__x86.get_pc_thunk.si>
+  107437:	81 c6 bd 6b 00 00    	add    $0x6bbd,%esi
+  10743d:	8b 45 10             	mov    0x10(%ebp),%eax
+  107440:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  107443:	8b 45 14             	mov    0x14(%ebp),%eax
+  107446:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  107449:	8b 45 18             	mov    0x18(%ebp),%eax
+  10744c:	ba 00 00 00 00       	mov    $0x0,%edx
+  107451:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  107454:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+  107457:	19 d1                	sbb    %edx,%ecx
+  107459:	72 4d                	jb     1074a8 <printnum+0x7f>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  10745b:	8b 45 1c             	mov    0x1c(%ebp),%eax
+  10745e:	8d 78 ff             	lea    -0x1(%eax),%edi
+  107461:	8b 45 18             	mov    0x18(%ebp),%eax
+  107464:	ba 00 00 00 00       	mov    $0x0,%edx
+  107469:	52                   	push   %edx
+  10746a:	50                   	push   %eax
+  10746b:	ff 75 e4             	push   -0x1c(%ebp)
+  10746e:	ff 75 e0             	push   -0x20(%ebp)
+  107471:	89 f3                	mov    %esi,%ebx
+  107473:	e8 88 0e 00 00       	call   108300 <__udivdi3>
+  107478:	83 c4 10             	add    $0x10,%esp
+  10747b:	83 ec 04             	sub    $0x4,%esp
+  10747e:	ff 75 20             	push   0x20(%ebp)
+  107481:	57                   	push   %edi
+  107482:	ff 75 18             	push   0x18(%ebp)
+  107485:	52                   	push   %edx
+  107486:	50                   	push   %eax
+  107487:	ff 75 0c             	push   0xc(%ebp)
+  10748a:	ff 75 08             	push   0x8(%ebp)
+  10748d:	e8 97 ff ff ff       	call   107429 <printnum>
+  107492:	83 c4 20             	add    $0x20,%esp
+  107495:	eb 1b                	jmp    1074b2 <printnum+0x89>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  107497:	83 ec 08             	sub    $0x8,%esp
+  10749a:	ff 75 0c             	push   0xc(%ebp)
+  10749d:	ff 75 20             	push   0x20(%ebp)
+  1074a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  1074a3:	ff d0                	call   *%eax
+  1074a5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  1074a8:	83 6d 1c 01          	subl   $0x1,0x1c(%ebp)
+  1074ac:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  1074b0:	7f e5                	jg     107497 <printnum+0x6e>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  1074b2:	8b 4d 18             	mov    0x18(%ebp),%ecx
+  1074b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1074ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1074bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  1074c0:	53                   	push   %ebx
+  1074c1:	51                   	push   %ecx
+  1074c2:	52                   	push   %edx
+  1074c3:	50                   	push   %eax
+  1074c4:	89 f3                	mov    %esi,%ebx
+  1074c6:	e8 f5 0e 00 00       	call   1083c0 <__umoddi3>
+  1074cb:	83 c4 10             	add    $0x10,%esp
+  1074ce:	8d 8e 74 c5 ff ff    	lea    -0x3a8c(%esi),%ecx
+  1074d4:	01 c8                	add    %ecx,%eax
+  1074d6:	0f b6 00             	movzbl (%eax),%eax
+  1074d9:	0f be c0             	movsbl %al,%eax
+  1074dc:	83 ec 08             	sub    $0x8,%esp
+  1074df:	ff 75 0c             	push   0xc(%ebp)
+  1074e2:	50                   	push   %eax
+  1074e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  1074e6:	ff d0                	call   *%eax
+  1074e8:	83 c4 10             	add    $0x10,%esp
+}
+  1074eb:	90                   	nop
+  1074ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1074ef:	5b                   	pop    %ebx
+  1074f0:	5e                   	pop    %esi
+  1074f1:	5f                   	pop    %edi
+  1074f2:	5d                   	pop    %ebp
+  1074f3:	c3                   	ret
+
+001074f4 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  1074f4:	55                   	push   %ebp
+  1074f5:	89 e5                	mov    %esp,%ebp
+  1074f7:	e8 14 8f ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1074fc:	05 f8 6a 00 00       	add    $0x6af8,%eax
+	if (lflag >= 2)
+  107501:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+  107505:	7e 1c                	jle    107523 <getuint+0x2f>
+		return va_arg(*ap, unsigned long long);
+  107507:	8b 45 08             	mov    0x8(%ebp),%eax
+  10750a:	8b 00                	mov    (%eax),%eax
+  10750c:	8d 50 08             	lea    0x8(%eax),%edx
+  10750f:	8b 45 08             	mov    0x8(%ebp),%eax
+  107512:	89 10                	mov    %edx,(%eax)
+  107514:	8b 45 08             	mov    0x8(%ebp),%eax
+  107517:	8b 00                	mov    (%eax),%eax
+  107519:	83 e8 08             	sub    $0x8,%eax
+  10751c:	8b 50 04             	mov    0x4(%eax),%edx
+  10751f:	8b 00                	mov    (%eax),%eax
+  107521:	eb 40                	jmp    107563 <getuint+0x6f>
+	else if (lflag)
+  107523:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  107527:	74 1e                	je     107547 <getuint+0x53>
+		return va_arg(*ap, unsigned long);
+  107529:	8b 45 08             	mov    0x8(%ebp),%eax
+  10752c:	8b 00                	mov    (%eax),%eax
+  10752e:	8d 50 04             	lea    0x4(%eax),%edx
+  107531:	8b 45 08             	mov    0x8(%ebp),%eax
+  107534:	89 10                	mov    %edx,(%eax)
+  107536:	8b 45 08             	mov    0x8(%ebp),%eax
+  107539:	8b 00                	mov    (%eax),%eax
+  10753b:	83 e8 04             	sub    $0x4,%eax
+  10753e:	8b 00                	mov    (%eax),%eax
+  107540:	ba 00 00 00 00       	mov    $0x0,%edx
+  107545:	eb 1c                	jmp    107563 <getuint+0x6f>
+	else
+		return va_arg(*ap, unsigned int);
+  107547:	8b 45 08             	mov    0x8(%ebp),%eax
+  10754a:	8b 00                	mov    (%eax),%eax
+  10754c:	8d 50 04             	lea    0x4(%eax),%edx
+  10754f:	8b 45 08             	mov    0x8(%ebp),%eax
+  107552:	89 10                	mov    %edx,(%eax)
+  107554:	8b 45 08             	mov    0x8(%ebp),%eax
+  107557:	8b 00                	mov    (%eax),%eax
+  107559:	83 e8 04             	sub    $0x4,%eax
+  10755c:	8b 00                	mov    (%eax),%eax
+  10755e:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  107563:	5d                   	pop    %ebp
+  107564:	c3                   	ret
+
+00107565 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  107565:	55                   	push   %ebp
+  107566:	89 e5                	mov    %esp,%ebp
+  107568:	e8 a3 8e ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10756d:	05 87 6a 00 00       	add    $0x6a87,%eax
+	if (lflag >= 2)
+  107572:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+  107576:	7e 1c                	jle    107594 <getint+0x2f>
+		return va_arg(*ap, long long);
+  107578:	8b 45 08             	mov    0x8(%ebp),%eax
+  10757b:	8b 00                	mov    (%eax),%eax
+  10757d:	8d 50 08             	lea    0x8(%eax),%edx
+  107580:	8b 45 08             	mov    0x8(%ebp),%eax
+  107583:	89 10                	mov    %edx,(%eax)
+  107585:	8b 45 08             	mov    0x8(%ebp),%eax
+  107588:	8b 00                	mov    (%eax),%eax
+  10758a:	83 e8 08             	sub    $0x8,%eax
+  10758d:	8b 50 04             	mov    0x4(%eax),%edx
+  107590:	8b 00                	mov    (%eax),%eax
+  107592:	eb 38                	jmp    1075cc <getint+0x67>
+	else if (lflag)
+  107594:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  107598:	74 1a                	je     1075b4 <getint+0x4f>
+		return va_arg(*ap, long);
+  10759a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10759d:	8b 00                	mov    (%eax),%eax
+  10759f:	8d 50 04             	lea    0x4(%eax),%edx
+  1075a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  1075a5:	89 10                	mov    %edx,(%eax)
+  1075a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1075aa:	8b 00                	mov    (%eax),%eax
+  1075ac:	83 e8 04             	sub    $0x4,%eax
+  1075af:	8b 00                	mov    (%eax),%eax
+  1075b1:	99                   	cltd
+  1075b2:	eb 18                	jmp    1075cc <getint+0x67>
+	else
+		return va_arg(*ap, int);
+  1075b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  1075b7:	8b 00                	mov    (%eax),%eax
+  1075b9:	8d 50 04             	lea    0x4(%eax),%edx
+  1075bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  1075bf:	89 10                	mov    %edx,(%eax)
+  1075c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  1075c4:	8b 00                	mov    (%eax),%eax
+  1075c6:	83 e8 04             	sub    $0x4,%eax
+  1075c9:	8b 00                	mov    (%eax),%eax
+  1075cb:	99                   	cltd
+}
+  1075cc:	5d                   	pop    %ebp
+  1075cd:	c3                   	ret
+
+001075ce <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  1075ce:	55                   	push   %ebp
+  1075cf:	89 e5                	mov    %esp,%ebp
+  1075d1:	57                   	push   %edi
+  1075d2:	56                   	push   %esi
+  1075d3:	53                   	push   %ebx
+  1075d4:	83 ec 2c             	sub    $0x2c,%esp
+  1075d7:	e8 4c 05 00 00       	call   107b28 <__x86.get_pc_thunk.di>
+  1075dc:	81 c7 18 6a 00 00    	add    $0x6a18,%edi
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  1075e2:	eb 17                	jmp    1075fb <vprintfmt+0x2d>
+			if (ch == '\0')
+  1075e4:	85 db                	test   %ebx,%ebx
+  1075e6:	0f 84 63 03 00 00    	je     10794f <.L21+0x2d>
+				return;
+			putch(ch, putdat);
+  1075ec:	83 ec 08             	sub    $0x8,%esp
+  1075ef:	ff 75 0c             	push   0xc(%ebp)
+  1075f2:	53                   	push   %ebx
+  1075f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  1075f6:	ff d0                	call   *%eax
+  1075f8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  1075fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  1075fe:	8d 50 01             	lea    0x1(%eax),%edx
+  107601:	89 55 10             	mov    %edx,0x10(%ebp)
+  107604:	0f b6 00             	movzbl (%eax),%eax
+  107607:	0f b6 d8             	movzbl %al,%ebx
+  10760a:	83 fb 25             	cmp    $0x25,%ebx
+  10760d:	75 d5                	jne    1075e4 <vprintfmt+0x16>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  10760f:	c6 45 cb 20          	movb   $0x20,-0x35(%ebp)
+		width = -1;
+  107613:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		precision = -1;
+  10761a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		lflag = 0;
+  107621:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		altflag = 0;
+  107628:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  10762f:	eb 04                	jmp    107635 <vprintfmt+0x67>
+			goto process_precision;
+
+		case '.':
+			if (width < 0)
+				width = 0;
+			goto reswitch;
+  107631:	90                   	nop
+  107632:	eb 01                	jmp    107635 <vprintfmt+0x67>
+			goto reswitch;
+
+		process_precision:
+			if (width < 0)
+				width = precision, precision = -1;
+			goto reswitch;
+  107634:	90                   	nop
+		switch (ch = *(unsigned char *) fmt++) {
+  107635:	8b 45 10             	mov    0x10(%ebp),%eax
+  107638:	8d 50 01             	lea    0x1(%eax),%edx
+  10763b:	89 55 10             	mov    %edx,0x10(%ebp)
+  10763e:	0f b6 00             	movzbl (%eax),%eax
+  107641:	0f b6 d8             	movzbl %al,%ebx
+  107644:	8d 43 dd             	lea    -0x23(%ebx),%eax
+  107647:	83 f8 55             	cmp    $0x55,%eax
+  10764a:	0f 87 d2 02 00 00    	ja     107922 <.L21>
+  107650:	c1 e0 02             	shl    $0x2,%eax
+  107653:	8b 84 38 8c c5 ff ff 	mov    -0x3a74(%eax,%edi,1),%eax
+  10765a:	01 f8                	add    %edi,%eax
+  10765c:	ff e0                	jmp    *%eax
+
+0010765e <.L34>:
+			padc = '-';
+  10765e:	c6 45 cb 2d          	movb   $0x2d,-0x35(%ebp)
+			goto reswitch;
+  107662:	eb d1                	jmp    107635 <vprintfmt+0x67>
+
+00107664 <.L32>:
+			padc = '0';
+  107664:	c6 45 cb 30          	movb   $0x30,-0x35(%ebp)
+			goto reswitch;
+  107668:	eb cb                	jmp    107635 <vprintfmt+0x67>
+
+0010766a <.L31>:
+			for (precision = 0; ; ++fmt) {
+  10766a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+				precision = precision * 10 + ch - '0';
+  107671:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  107674:	89 d0                	mov    %edx,%eax
+  107676:	c1 e0 02             	shl    $0x2,%eax
+  107679:	01 d0                	add    %edx,%eax
+  10767b:	01 c0                	add    %eax,%eax
+  10767d:	01 d8                	add    %ebx,%eax
+  10767f:	83 e8 30             	sub    $0x30,%eax
+  107682:	89 45 d0             	mov    %eax,-0x30(%ebp)
+				ch = *fmt;
+  107685:	8b 45 10             	mov    0x10(%ebp),%eax
+  107688:	0f b6 00             	movzbl (%eax),%eax
+  10768b:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  10768e:	83 fb 2f             	cmp    $0x2f,%ebx
+  107691:	7e 43                	jle    1076d6 <.L37+0xc>
+  107693:	83 fb 39             	cmp    $0x39,%ebx
+  107696:	7f 3e                	jg     1076d6 <.L37+0xc>
+			for (precision = 0; ; ++fmt) {
+  107698:	83 45 10 01          	addl   $0x1,0x10(%ebp)
+				precision = precision * 10 + ch - '0';
+  10769c:	eb d3                	jmp    107671 <.L31+0x7>
+
+0010769e <.L35>:
+			precision = va_arg(ap, int);
+  10769e:	8b 45 14             	mov    0x14(%ebp),%eax
+  1076a1:	83 c0 04             	add    $0x4,%eax
+  1076a4:	89 45 14             	mov    %eax,0x14(%ebp)
+  1076a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  1076aa:	83 e8 04             	sub    $0x4,%eax
+  1076ad:	8b 00                	mov    (%eax),%eax
+  1076af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+			goto process_precision;
+  1076b2:	eb 23                	jmp    1076d7 <.L37+0xd>
+
+001076b4 <.L33>:
+			if (width < 0)
+  1076b4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  1076b8:	0f 89 73 ff ff ff    	jns    107631 <vprintfmt+0x63>
+				width = 0;
+  1076be:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+			goto reswitch;
+  1076c5:	e9 67 ff ff ff       	jmp    107631 <vprintfmt+0x63>
+
+001076ca <.L37>:
+			altflag = 1;
+  1076ca:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%ebp)
+			goto reswitch;
+  1076d1:	e9 5f ff ff ff       	jmp    107635 <vprintfmt+0x67>
+			goto process_precision;
+  1076d6:	90                   	nop
+			if (width < 0)
+  1076d7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  1076db:	0f 89 53 ff ff ff    	jns    107634 <vprintfmt+0x66>
+				width = precision, precision = -1;
+  1076e1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  1076e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  1076e7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+			goto reswitch;
+  1076ee:	e9 41 ff ff ff       	jmp    107634 <vprintfmt+0x66>
+
+001076f3 <.L28>:
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  1076f3:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  1076f7:	e9 39 ff ff ff       	jmp    107635 <vprintfmt+0x67>
+
+001076fc <.L30>:
+
+		// character
+		case 'c':
+			putch(va_arg(ap, int), putdat);
+  1076fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  1076ff:	83 c0 04             	add    $0x4,%eax
+  107702:	89 45 14             	mov    %eax,0x14(%ebp)
+  107705:	8b 45 14             	mov    0x14(%ebp),%eax
+  107708:	83 e8 04             	sub    $0x4,%eax
+  10770b:	8b 00                	mov    (%eax),%eax
+  10770d:	83 ec 08             	sub    $0x8,%esp
+  107710:	ff 75 0c             	push   0xc(%ebp)
+  107713:	50                   	push   %eax
+  107714:	8b 45 08             	mov    0x8(%ebp),%eax
+  107717:	ff d0                	call   *%eax
+  107719:	83 c4 10             	add    $0x10,%esp
+			break;
+  10771c:	e9 29 02 00 00       	jmp    10794a <.L21+0x28>
+
+00107721 <.L25>:
+
+		// string
+		case 's':
+			if ((p = va_arg(ap, char *)) == NULL)
+  107721:	8b 45 14             	mov    0x14(%ebp),%eax
+  107724:	83 c0 04             	add    $0x4,%eax
+  107727:	89 45 14             	mov    %eax,0x14(%ebp)
+  10772a:	8b 45 14             	mov    0x14(%ebp),%eax
+  10772d:	83 e8 04             	sub    $0x4,%eax
+  107730:	8b 30                	mov    (%eax),%esi
+  107732:	85 f6                	test   %esi,%esi
+  107734:	75 06                	jne    10773c <.L25+0x1b>
+				p = "(null)";
+  107736:	8d b7 85 c5 ff ff    	lea    -0x3a7b(%edi),%esi
+			if (width > 0 && padc != '-')
+  10773c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  107740:	7e 71                	jle    1077b3 <.L25+0x92>
+  107742:	80 7d cb 2d          	cmpb   $0x2d,-0x35(%ebp)
+  107746:	74 6b                	je     1077b3 <.L25+0x92>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  107748:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  10774b:	83 ec 08             	sub    $0x8,%esp
+  10774e:	50                   	push   %eax
+  10774f:	56                   	push   %esi
+  107750:	89 fb                	mov    %edi,%ebx
+  107752:	e8 1e 05 00 00       	call   107c75 <strnlen>
+  107757:	83 c4 10             	add    $0x10,%esp
+  10775a:	29 45 d4             	sub    %eax,-0x2c(%ebp)
+  10775d:	eb 17                	jmp    107776 <.L25+0x55>
+					putch(padc, putdat);
+  10775f:	0f be 45 cb          	movsbl -0x35(%ebp),%eax
+  107763:	83 ec 08             	sub    $0x8,%esp
+  107766:	ff 75 0c             	push   0xc(%ebp)
+  107769:	50                   	push   %eax
+  10776a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10776d:	ff d0                	call   *%eax
+  10776f:	83 c4 10             	add    $0x10,%esp
+				for (width -= strnlen(p, precision); width > 0; width--)
+  107772:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+  107776:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  10777a:	7f e3                	jg     10775f <.L25+0x3e>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  10777c:	eb 35                	jmp    1077b3 <.L25+0x92>
+				if (altflag && (ch < ' ' || ch > '~'))
+  10777e:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+  107782:	74 1c                	je     1077a0 <.L25+0x7f>
+  107784:	83 fb 1f             	cmp    $0x1f,%ebx
+  107787:	7e 05                	jle    10778e <.L25+0x6d>
+  107789:	83 fb 7e             	cmp    $0x7e,%ebx
+  10778c:	7e 12                	jle    1077a0 <.L25+0x7f>
+					putch('?', putdat);
+  10778e:	83 ec 08             	sub    $0x8,%esp
+  107791:	ff 75 0c             	push   0xc(%ebp)
+  107794:	6a 3f                	push   $0x3f
+  107796:	8b 45 08             	mov    0x8(%ebp),%eax
+  107799:	ff d0                	call   *%eax
+  10779b:	83 c4 10             	add    $0x10,%esp
+  10779e:	eb 0f                	jmp    1077af <.L25+0x8e>
+				else
+					putch(ch, putdat);
+  1077a0:	83 ec 08             	sub    $0x8,%esp
+  1077a3:	ff 75 0c             	push   0xc(%ebp)
+  1077a6:	53                   	push   %ebx
+  1077a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1077aa:	ff d0                	call   *%eax
+  1077ac:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  1077af:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+  1077b3:	89 f0                	mov    %esi,%eax
+  1077b5:	8d 70 01             	lea    0x1(%eax),%esi
+  1077b8:	0f b6 00             	movzbl (%eax),%eax
+  1077bb:	0f be d8             	movsbl %al,%ebx
+  1077be:	85 db                	test   %ebx,%ebx
+  1077c0:	74 26                	je     1077e8 <.L25+0xc7>
+  1077c2:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  1077c6:	78 b6                	js     10777e <.L25+0x5d>
+  1077c8:	83 6d d0 01          	subl   $0x1,-0x30(%ebp)
+  1077cc:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  1077d0:	79 ac                	jns    10777e <.L25+0x5d>
+			for (; width > 0; width--)
+  1077d2:	eb 14                	jmp    1077e8 <.L25+0xc7>
+				putch(' ', putdat);
+  1077d4:	83 ec 08             	sub    $0x8,%esp
+  1077d7:	ff 75 0c             	push   0xc(%ebp)
+  1077da:	6a 20                	push   $0x20
+  1077dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  1077df:	ff d0                	call   *%eax
+  1077e1:	83 c4 10             	add    $0x10,%esp
+			for (; width > 0; width--)
+  1077e4:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+  1077e8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  1077ec:	7f e6                	jg     1077d4 <.L25+0xb3>
+			break;
+  1077ee:	e9 57 01 00 00       	jmp    10794a <.L21+0x28>
+
+001077f3 <.L29>:
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&ap, lflag);
+  1077f3:	83 ec 08             	sub    $0x8,%esp
+  1077f6:	ff 75 d8             	push   -0x28(%ebp)
+  1077f9:	8d 45 14             	lea    0x14(%ebp),%eax
+  1077fc:	50                   	push   %eax
+  1077fd:	e8 63 fd ff ff       	call   107565 <getint>
+  107802:	83 c4 10             	add    $0x10,%esp
+  107805:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  107808:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			if ((long long) num < 0) {
+  10780b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  10780e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  107811:	85 d2                	test   %edx,%edx
+  107813:	79 23                	jns    107838 <.L29+0x45>
+				putch('-', putdat);
+  107815:	83 ec 08             	sub    $0x8,%esp
+  107818:	ff 75 0c             	push   0xc(%ebp)
+  10781b:	6a 2d                	push   $0x2d
+  10781d:	8b 45 08             	mov    0x8(%ebp),%eax
+  107820:	ff d0                	call   *%eax
+  107822:	83 c4 10             	add    $0x10,%esp
+				num = -(long long) num;
+  107825:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  107828:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  10782b:	f7 d8                	neg    %eax
+  10782d:	83 d2 00             	adc    $0x0,%edx
+  107830:	f7 da                	neg    %edx
+  107832:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  107835:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			}
+			base = 10;
+  107838:	c7 45 dc 0a 00 00 00 	movl   $0xa,-0x24(%ebp)
+			goto number;
+  10783f:	e9 a8 00 00 00       	jmp    1078ec <.L22+0x1f>
+
+00107844 <.L24>:
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&ap, lflag);
+  107844:	83 ec 08             	sub    $0x8,%esp
+  107847:	ff 75 d8             	push   -0x28(%ebp)
+  10784a:	8d 45 14             	lea    0x14(%ebp),%eax
+  10784d:	50                   	push   %eax
+  10784e:	e8 a1 fc ff ff       	call   1074f4 <getuint>
+  107853:	83 c4 10             	add    $0x10,%esp
+  107856:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  107859:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			base = 10;
+  10785c:	c7 45 dc 0a 00 00 00 	movl   $0xa,-0x24(%ebp)
+			goto number;
+  107863:	e9 84 00 00 00       	jmp    1078ec <.L22+0x1f>
+
+00107868 <.L27>:
+
+		// (unsigned) octal
+		case 'o':
+			num = getuint(&ap, lflag);
+  107868:	83 ec 08             	sub    $0x8,%esp
+  10786b:	ff 75 d8             	push   -0x28(%ebp)
+  10786e:	8d 45 14             	lea    0x14(%ebp),%eax
+  107871:	50                   	push   %eax
+  107872:	e8 7d fc ff ff       	call   1074f4 <getuint>
+  107877:	83 c4 10             	add    $0x10,%esp
+  10787a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  10787d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			base = 8;
+  107880:	c7 45 dc 08 00 00 00 	movl   $0x8,-0x24(%ebp)
+			goto number;
+  107887:	eb 63                	jmp    1078ec <.L22+0x1f>
+
+00107889 <.L26>:
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  107889:	83 ec 08             	sub    $0x8,%esp
+  10788c:	ff 75 0c             	push   0xc(%ebp)
+  10788f:	6a 30                	push   $0x30
+  107891:	8b 45 08             	mov    0x8(%ebp),%eax
+  107894:	ff d0                	call   *%eax
+  107896:	83 c4 10             	add    $0x10,%esp
+			putch('x', putdat);
+  107899:	83 ec 08             	sub    $0x8,%esp
+  10789c:	ff 75 0c             	push   0xc(%ebp)
+  10789f:	6a 78                	push   $0x78
+  1078a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  1078a4:	ff d0                	call   *%eax
+  1078a6:	83 c4 10             	add    $0x10,%esp
+			num = (unsigned long long)
+				(uintptr_t) va_arg(ap, void *);
+  1078a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  1078ac:	83 c0 04             	add    $0x4,%eax
+  1078af:	89 45 14             	mov    %eax,0x14(%ebp)
+  1078b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  1078b5:	83 e8 04             	sub    $0x4,%eax
+  1078b8:	8b 00                	mov    (%eax),%eax
+			num = (unsigned long long)
+  1078ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  1078bd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			base = 16;
+  1078c4:	c7 45 dc 10 00 00 00 	movl   $0x10,-0x24(%ebp)
+			goto number;
+  1078cb:	eb 1f                	jmp    1078ec <.L22+0x1f>
+
+001078cd <.L22>:
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&ap, lflag);
+  1078cd:	83 ec 08             	sub    $0x8,%esp
+  1078d0:	ff 75 d8             	push   -0x28(%ebp)
+  1078d3:	8d 45 14             	lea    0x14(%ebp),%eax
+  1078d6:	50                   	push   %eax
+  1078d7:	e8 18 fc ff ff       	call   1074f4 <getuint>
+  1078dc:	83 c4 10             	add    $0x10,%esp
+  1078df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  1078e2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			base = 16;
+  1078e5:	c7 45 dc 10 00 00 00 	movl   $0x10,-0x24(%ebp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  1078ec:	0f be 55 cb          	movsbl -0x35(%ebp),%edx
+  1078f0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  1078f3:	83 ec 04             	sub    $0x4,%esp
+  1078f6:	52                   	push   %edx
+  1078f7:	ff 75 d4             	push   -0x2c(%ebp)
+  1078fa:	50                   	push   %eax
+  1078fb:	ff 75 e4             	push   -0x1c(%ebp)
+  1078fe:	ff 75 e0             	push   -0x20(%ebp)
+  107901:	ff 75 0c             	push   0xc(%ebp)
+  107904:	ff 75 08             	push   0x8(%ebp)
+  107907:	e8 1d fb ff ff       	call   107429 <printnum>
+  10790c:	83 c4 20             	add    $0x20,%esp
+			break;
+  10790f:	eb 39                	jmp    10794a <.L21+0x28>
+
+00107911 <.L36>:
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  107911:	83 ec 08             	sub    $0x8,%esp
+  107914:	ff 75 0c             	push   0xc(%ebp)
+  107917:	53                   	push   %ebx
+  107918:	8b 45 08             	mov    0x8(%ebp),%eax
+  10791b:	ff d0                	call   *%eax
+  10791d:	83 c4 10             	add    $0x10,%esp
+			break;
+  107920:	eb 28                	jmp    10794a <.L21+0x28>
+
+00107922 <.L21>:
+			
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  107922:	83 ec 08             	sub    $0x8,%esp
+  107925:	ff 75 0c             	push   0xc(%ebp)
+  107928:	6a 25                	push   $0x25
+  10792a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10792d:	ff d0                	call   *%eax
+  10792f:	83 c4 10             	add    $0x10,%esp
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  107932:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+  107936:	eb 04                	jmp    10793c <.L21+0x1a>
+  107938:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+  10793c:	8b 45 10             	mov    0x10(%ebp),%eax
+  10793f:	83 e8 01             	sub    $0x1,%eax
+  107942:	0f b6 00             	movzbl (%eax),%eax
+  107945:	3c 25                	cmp    $0x25,%al
+  107947:	75 ef                	jne    107938 <.L21+0x16>
+				/* do nothing */;
+			break;
+  107949:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  10794a:	e9 ac fc ff ff       	jmp    1075fb <vprintfmt+0x2d>
+				return;
+  10794f:	90                   	nop
+		}
+	}
+}
+  107950:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  107953:	5b                   	pop    %ebx
+  107954:	5e                   	pop    %esi
+  107955:	5f                   	pop    %edi
+  107956:	5d                   	pop    %ebp
+  107957:	c3                   	ret
+
+00107958 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  107958:	55                   	push   %ebp
+  107959:	89 e5                	mov    %esp,%ebp
+  10795b:	83 ec 18             	sub    $0x18,%esp
+  10795e:	e8 ad 8a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107963:	05 91 66 00 00       	add    $0x6691,%eax
+	va_list ap;
+
+	va_start(ap, fmt);
+  107968:	8d 45 10             	lea    0x10(%ebp),%eax
+  10796b:	83 c0 04             	add    $0x4,%eax
+  10796e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	vprintfmt(putch, putdat, fmt, ap);
+  107971:	8b 45 10             	mov    0x10(%ebp),%eax
+  107974:	ff 75 f4             	push   -0xc(%ebp)
+  107977:	50                   	push   %eax
+  107978:	ff 75 0c             	push   0xc(%ebp)
+  10797b:	ff 75 08             	push   0x8(%ebp)
+  10797e:	e8 4b fc ff ff       	call   1075ce <vprintfmt>
+  107983:	83 c4 10             	add    $0x10,%esp
+	va_end(ap);
+}
+  107986:	90                   	nop
+  107987:	c9                   	leave
+  107988:	c3                   	ret
+
+00107989 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  107989:	55                   	push   %ebp
+  10798a:	89 e5                	mov    %esp,%ebp
+  10798c:	e8 7f 8a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107991:	05 63 66 00 00       	add    $0x6663,%eax
+	b->cnt++;
+  107996:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107999:	8b 40 08             	mov    0x8(%eax),%eax
+  10799c:	8d 50 01             	lea    0x1(%eax),%edx
+  10799f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1079a2:	89 50 08             	mov    %edx,0x8(%eax)
+	if (b->buf < b->ebuf)
+  1079a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1079a8:	8b 10                	mov    (%eax),%edx
+  1079aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1079ad:	8b 40 04             	mov    0x4(%eax),%eax
+  1079b0:	39 c2                	cmp    %eax,%edx
+  1079b2:	73 12                	jae    1079c6 <sprintputch+0x3d>
+		*b->buf++ = ch;
+  1079b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1079b7:	8b 00                	mov    (%eax),%eax
+  1079b9:	8d 48 01             	lea    0x1(%eax),%ecx
+  1079bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1079bf:	89 0a                	mov    %ecx,(%edx)
+  1079c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  1079c4:	88 10                	mov    %dl,(%eax)
+}
+  1079c6:	90                   	nop
+  1079c7:	5d                   	pop    %ebp
+  1079c8:	c3                   	ret
+
+001079c9 <vsprintf>:
+
+int
+vsprintf(char *buf, const char *fmt, va_list ap)
+{
+  1079c9:	55                   	push   %ebp
+  1079ca:	89 e5                	mov    %esp,%ebp
+  1079cc:	53                   	push   %ebx
+  1079cd:	83 ec 14             	sub    $0x14,%esp
+  1079d0:	e8 3b 8a ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1079d5:	05 1f 66 00 00       	add    $0x661f,%eax
+	assert(buf != NULL);
+  1079da:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  1079de:	75 21                	jne    107a01 <vsprintf+0x38>
+  1079e0:	8d 90 e4 c6 ff ff    	lea    -0x391c(%eax),%edx
+  1079e6:	52                   	push   %edx
+  1079e7:	8d 90 f0 c6 ff ff    	lea    -0x3910(%eax),%edx
+  1079ed:	52                   	push   %edx
+  1079ee:	68 03 01 00 00       	push   $0x103
+  1079f3:	8d 90 05 c7 ff ff    	lea    -0x38fb(%eax),%edx
+  1079f9:	52                   	push   %edx
+  1079fa:	89 c3                	mov    %eax,%ebx
+  1079fc:	e8 d1 93 ff ff       	call   100dd2 <debug_panic>
+	struct sprintbuf b = {buf, (char*)(intptr_t)~0, 0};
+  107a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  107a04:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  107a07:	c7 45 f0 ff ff ff ff 	movl   $0xffffffff,-0x10(%ebp)
+  107a0e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  107a15:	ff 75 10             	push   0x10(%ebp)
+  107a18:	ff 75 0c             	push   0xc(%ebp)
+  107a1b:	8d 55 ec             	lea    -0x14(%ebp),%edx
+  107a1e:	52                   	push   %edx
+  107a1f:	8d 80 95 99 ff ff    	lea    -0x666b(%eax),%eax
+  107a25:	50                   	push   %eax
+  107a26:	e8 a3 fb ff ff       	call   1075ce <vprintfmt>
+  107a2b:	83 c4 10             	add    $0x10,%esp
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  107a2e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107a31:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  107a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  107a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  107a3a:	c9                   	leave
+  107a3b:	c3                   	ret
+
+00107a3c <sprintf>:
+
+int
+sprintf(char *buf, const char *fmt, ...)
+{
+  107a3c:	55                   	push   %ebp
+  107a3d:	89 e5                	mov    %esp,%ebp
+  107a3f:	83 ec 18             	sub    $0x18,%esp
+  107a42:	e8 c9 89 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107a47:	05 ad 65 00 00       	add    $0x65ad,%eax
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  107a4c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  107a4f:	83 c0 04             	add    $0x4,%eax
+  107a52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	rc = vsprintf(buf, fmt, ap);
+  107a55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107a58:	83 ec 04             	sub    $0x4,%esp
+  107a5b:	ff 75 f4             	push   -0xc(%ebp)
+  107a5e:	50                   	push   %eax
+  107a5f:	ff 75 08             	push   0x8(%ebp)
+  107a62:	e8 62 ff ff ff       	call   1079c9 <vsprintf>
+  107a67:	83 c4 10             	add    $0x10,%esp
+  107a6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	va_end(ap);
+
+	return rc;
+  107a6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  107a70:	c9                   	leave
+  107a71:	c3                   	ret
+
+00107a72 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  107a72:	55                   	push   %ebp
+  107a73:	89 e5                	mov    %esp,%ebp
+  107a75:	53                   	push   %ebx
+  107a76:	83 ec 14             	sub    $0x14,%esp
+  107a79:	e8 92 89 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107a7e:	05 76 65 00 00       	add    $0x6576,%eax
+	assert(buf != NULL && n > 0);
+  107a83:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  107a87:	74 06                	je     107a8f <vsnprintf+0x1d>
+  107a89:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  107a8d:	7f 21                	jg     107ab0 <vsnprintf+0x3e>
+  107a8f:	8d 90 14 c7 ff ff    	lea    -0x38ec(%eax),%edx
+  107a95:	52                   	push   %edx
+  107a96:	8d 90 f0 c6 ff ff    	lea    -0x3910(%eax),%edx
+  107a9c:	52                   	push   %edx
+  107a9d:	68 1f 01 00 00       	push   $0x11f
+  107aa2:	8d 90 05 c7 ff ff    	lea    -0x38fb(%eax),%edx
+  107aa8:	52                   	push   %edx
+  107aa9:	89 c3                	mov    %eax,%ebx
+  107aab:	e8 22 93 ff ff       	call   100dd2 <debug_panic>
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  107ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+  107ab3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  107ab6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  107ab9:	8d 4a ff             	lea    -0x1(%edx),%ecx
+  107abc:	8b 55 08             	mov    0x8(%ebp),%edx
+  107abf:	01 ca                	add    %ecx,%edx
+  107ac1:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  107ac4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  107acb:	ff 75 14             	push   0x14(%ebp)
+  107ace:	ff 75 10             	push   0x10(%ebp)
+  107ad1:	8d 55 ec             	lea    -0x14(%ebp),%edx
+  107ad4:	52                   	push   %edx
+  107ad5:	8d 80 95 99 ff ff    	lea    -0x666b(%eax),%eax
+  107adb:	50                   	push   %eax
+  107adc:	e8 ed fa ff ff       	call   1075ce <vprintfmt>
+  107ae1:	83 c4 10             	add    $0x10,%esp
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  107ae4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107ae7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  107aea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  107aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  107af0:	c9                   	leave
+  107af1:	c3                   	ret
+
+00107af2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  107af2:	55                   	push   %ebp
+  107af3:	89 e5                	mov    %esp,%ebp
+  107af5:	83 ec 18             	sub    $0x18,%esp
+  107af8:	e8 13 89 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107afd:	05 f7 64 00 00       	add    $0x64f7,%eax
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  107b02:	8d 45 10             	lea    0x10(%ebp),%eax
+  107b05:	83 c0 04             	add    $0x4,%eax
+  107b08:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  107b0b:	8b 45 10             	mov    0x10(%ebp),%eax
+  107b0e:	ff 75 f4             	push   -0xc(%ebp)
+  107b11:	50                   	push   %eax
+  107b12:	ff 75 0c             	push   0xc(%ebp)
+  107b15:	ff 75 08             	push   0x8(%ebp)
+  107b18:	e8 55 ff ff ff       	call   107a72 <vsnprintf>
+  107b1d:	83 c4 10             	add    $0x10,%esp
+  107b20:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	va_end(ap);
+
+	return rc;
+  107b23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  107b26:	c9                   	leave
+  107b27:	c3                   	ret
+
+00107b28 <__x86.get_pc_thunk.di>:
+  107b28:	8b 3c 24             	mov    (%esp),%edi
+  107b2b:	c3                   	ret
+
+00107b2c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  107b2c:	55                   	push   %ebp
+  107b2d:	89 e5                	mov    %esp,%ebp
+  107b2f:	53                   	push   %ebx
+  107b30:	83 ec 04             	sub    $0x4,%esp
+  107b33:	e8 36 cd ff ff       	call   10486e <__x86.get_pc_thunk.dx>
+  107b38:	81 c2 bc 64 00 00    	add    $0x64bc,%edx
+	b->buf[b->idx++] = ch;
+  107b3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b41:	8b 00                	mov    (%eax),%eax
+  107b43:	8d 58 01             	lea    0x1(%eax),%ebx
+  107b46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  107b49:	89 19                	mov    %ebx,(%ecx)
+  107b4b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  107b4e:	89 cb                	mov    %ecx,%ebx
+  107b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  107b53:	88 5c 01 08          	mov    %bl,0x8(%ecx,%eax,1)
+	if (b->idx == SYS_CPUTS_MAX-1) {
+  107b57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b5a:	8b 00                	mov    (%eax),%eax
+  107b5c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  107b61:	75 2a                	jne    107b8d <putch+0x61>
+		b->buf[b->idx] = 0;
+  107b63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b66:	8b 00                	mov    (%eax),%eax
+  107b68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  107b6b:	c6 44 01 08 00       	movb   $0x0,0x8(%ecx,%eax,1)
+		cputs(b->buf);
+  107b70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b73:	83 c0 08             	add    $0x8,%eax
+  107b76:	83 ec 0c             	sub    $0xc,%esp
+  107b79:	50                   	push   %eax
+  107b7a:	89 d3                	mov    %edx,%ebx
+  107b7c:	e8 ad 91 ff ff       	call   100d2e <cputs>
+  107b81:	83 c4 10             	add    $0x10,%esp
+		b->idx = 0;
+  107b84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b87:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	}
+	b->cnt++;
+  107b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b90:	8b 40 04             	mov    0x4(%eax),%eax
+  107b93:	8d 50 01             	lea    0x1(%eax),%edx
+  107b96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107b99:	89 50 04             	mov    %edx,0x4(%eax)
+}
+  107b9c:	90                   	nop
+  107b9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  107ba0:	c9                   	leave
+  107ba1:	c3                   	ret
+
+00107ba2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  107ba2:	55                   	push   %ebp
+  107ba3:	89 e5                	mov    %esp,%ebp
+  107ba5:	53                   	push   %ebx
+  107ba6:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  107bac:	e8 63 88 ff ff       	call   100414 <__x86.get_pc_thunk.bx>
+  107bb1:	81 c3 43 64 00 00    	add    $0x6443,%ebx
+	struct printbuf b;
+
+	b.idx = 0;
+  107bb7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  107bbe:	00 00 00 
+	b.cnt = 0;
+  107bc1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  107bc8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  107bcb:	ff 75 0c             	push   0xc(%ebp)
+  107bce:	ff 75 08             	push   0x8(%ebp)
+  107bd1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  107bd7:	50                   	push   %eax
+  107bd8:	8d 83 38 9b ff ff    	lea    -0x64c8(%ebx),%eax
+  107bde:	50                   	push   %eax
+  107bdf:	e8 ea f9 ff ff       	call   1075ce <vprintfmt>
+  107be4:	83 c4 10             	add    $0x10,%esp
+
+	b.buf[b.idx] = 0;
+  107be7:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  107bed:	c6 84 05 f8 fe ff ff 	movb   $0x0,-0x108(%ebp,%eax,1)
+  107bf4:	00 
+	cputs(b.buf);
+  107bf5:	83 ec 0c             	sub    $0xc,%esp
+  107bf8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  107bfe:	83 c0 08             	add    $0x8,%eax
+  107c01:	50                   	push   %eax
+  107c02:	e8 27 91 ff ff       	call   100d2e <cputs>
+  107c07:	83 c4 10             	add    $0x10,%esp
+
+	return b.cnt;
+  107c0a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  107c10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  107c13:	c9                   	leave
+  107c14:	c3                   	ret
+
+00107c15 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  107c15:	55                   	push   %ebp
+  107c16:	89 e5                	mov    %esp,%ebp
+  107c18:	83 ec 18             	sub    $0x18,%esp
+  107c1b:	e8 f0 87 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107c20:	05 d4 63 00 00       	add    $0x63d4,%eax
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  107c25:	8d 45 0c             	lea    0xc(%ebp),%eax
+  107c28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+	cnt = vcprintf(fmt, ap);
+  107c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  107c2e:	83 ec 08             	sub    $0x8,%esp
+  107c31:	ff 75 f4             	push   -0xc(%ebp)
+  107c34:	50                   	push   %eax
+  107c35:	e8 68 ff ff ff       	call   107ba2 <vcprintf>
+  107c3a:	83 c4 10             	add    $0x10,%esp
+  107c3d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	va_end(ap);
+
+	return cnt;
+  107c40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  107c43:	c9                   	leave
+  107c44:	c3                   	ret
+
+00107c45 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  107c45:	55                   	push   %ebp
+  107c46:	89 e5                	mov    %esp,%ebp
+  107c48:	83 ec 10             	sub    $0x10,%esp
+  107c4b:	e8 c0 87 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107c50:	05 a4 63 00 00       	add    $0x63a4,%eax
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  107c55:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  107c5c:	eb 08                	jmp    107c66 <strlen+0x21>
+		n++;
+  107c5e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+	for (n = 0; *s != '\0'; s++)
+  107c62:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  107c66:	8b 45 08             	mov    0x8(%ebp),%eax
+  107c69:	0f b6 00             	movzbl (%eax),%eax
+  107c6c:	84 c0                	test   %al,%al
+  107c6e:	75 ee                	jne    107c5e <strlen+0x19>
+	return n;
+  107c70:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  107c73:	c9                   	leave
+  107c74:	c3                   	ret
+
+00107c75 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  107c75:	55                   	push   %ebp
+  107c76:	89 e5                	mov    %esp,%ebp
+  107c78:	83 ec 10             	sub    $0x10,%esp
+  107c7b:	e8 90 87 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107c80:	05 74 63 00 00       	add    $0x6374,%eax
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  107c85:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  107c8c:	eb 0c                	jmp    107c9a <strnlen+0x25>
+		n++;
+  107c8e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  107c92:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  107c96:	83 6d 0c 01          	subl   $0x1,0xc(%ebp)
+  107c9a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  107c9e:	74 0a                	je     107caa <strnlen+0x35>
+  107ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  107ca3:	0f b6 00             	movzbl (%eax),%eax
+  107ca6:	84 c0                	test   %al,%al
+  107ca8:	75 e4                	jne    107c8e <strnlen+0x19>
+	return n;
+  107caa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  107cad:	c9                   	leave
+  107cae:	c3                   	ret
+
+00107caf <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  107caf:	55                   	push   %ebp
+  107cb0:	89 e5                	mov    %esp,%ebp
+  107cb2:	83 ec 10             	sub    $0x10,%esp
+  107cb5:	e8 56 87 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107cba:	05 3a 63 00 00       	add    $0x633a,%eax
+	char *ret;
+
+	ret = dst;
+  107cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  107cc2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	while ((*dst++ = *src++) != '\0')
+  107cc5:	90                   	nop
+  107cc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  107cc9:	8d 42 01             	lea    0x1(%edx),%eax
+  107ccc:	89 45 0c             	mov    %eax,0xc(%ebp)
+  107ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  107cd2:	8d 48 01             	lea    0x1(%eax),%ecx
+  107cd5:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  107cd8:	0f b6 12             	movzbl (%edx),%edx
+  107cdb:	88 10                	mov    %dl,(%eax)
+  107cdd:	0f b6 00             	movzbl (%eax),%eax
+  107ce0:	84 c0                	test   %al,%al
+  107ce2:	75 e2                	jne    107cc6 <strcpy+0x17>
+		/* do nothing */;
+	return ret;
+  107ce4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  107ce7:	c9                   	leave
+  107ce8:	c3                   	ret
+
+00107ce9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  107ce9:	55                   	push   %ebp
+  107cea:	89 e5                	mov    %esp,%ebp
+  107cec:	83 ec 10             	sub    $0x10,%esp
+  107cef:	e8 1c 87 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107cf4:	05 00 63 00 00       	add    $0x6300,%eax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  107cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  107cfc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+	for (i = 0; i < size; i++) {
+  107cff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  107d06:	eb 23                	jmp    107d2b <strncpy+0x42>
+		*dst++ = *src;
+  107d08:	8b 45 08             	mov    0x8(%ebp),%eax
+  107d0b:	8d 50 01             	lea    0x1(%eax),%edx
+  107d0e:	89 55 08             	mov    %edx,0x8(%ebp)
+  107d11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  107d14:	0f b6 12             	movzbl (%edx),%edx
+  107d17:	88 10                	mov    %dl,(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  107d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107d1c:	0f b6 00             	movzbl (%eax),%eax
+  107d1f:	84 c0                	test   %al,%al
+  107d21:	74 04                	je     107d27 <strncpy+0x3e>
+			src++;
+  107d23:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+	for (i = 0; i < size; i++) {
+  107d27:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  107d2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  107d2e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  107d31:	72 d5                	jb     107d08 <strncpy+0x1f>
+	}
+	return ret;
+  107d33:	8b 45 f8             	mov    -0x8(%ebp),%eax
+}
+  107d36:	c9                   	leave
+  107d37:	c3                   	ret
+
+00107d38 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  107d38:	55                   	push   %ebp
+  107d39:	89 e5                	mov    %esp,%ebp
+  107d3b:	83 ec 10             	sub    $0x10,%esp
+  107d3e:	e8 cd 86 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107d43:	05 b1 62 00 00       	add    $0x62b1,%eax
+	char *dst_in;
+
+	dst_in = dst;
+  107d48:	8b 45 08             	mov    0x8(%ebp),%eax
+  107d4b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	if (size > 0) {
+  107d4e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  107d52:	74 33                	je     107d87 <strlcpy+0x4f>
+		while (--size > 0 && *src != '\0')
+  107d54:	eb 17                	jmp    107d6d <strlcpy+0x35>
+			*dst++ = *src++;
+  107d56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  107d59:	8d 42 01             	lea    0x1(%edx),%eax
+  107d5c:	89 45 0c             	mov    %eax,0xc(%ebp)
+  107d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  107d62:	8d 48 01             	lea    0x1(%eax),%ecx
+  107d65:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  107d68:	0f b6 12             	movzbl (%edx),%edx
+  107d6b:	88 10                	mov    %dl,(%eax)
+		while (--size > 0 && *src != '\0')
+  107d6d:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+  107d71:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  107d75:	74 0a                	je     107d81 <strlcpy+0x49>
+  107d77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107d7a:	0f b6 00             	movzbl (%eax),%eax
+  107d7d:	84 c0                	test   %al,%al
+  107d7f:	75 d5                	jne    107d56 <strlcpy+0x1e>
+		*dst = '\0';
+  107d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  107d84:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  107d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  107d8a:	2b 45 fc             	sub    -0x4(%ebp),%eax
+}
+  107d8d:	c9                   	leave
+  107d8e:	c3                   	ret
+
+00107d8f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  107d8f:	55                   	push   %ebp
+  107d90:	89 e5                	mov    %esp,%ebp
+  107d92:	e8 79 86 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107d97:	05 5d 62 00 00       	add    $0x625d,%eax
+	while (*p && *p == *q)
+  107d9c:	eb 08                	jmp    107da6 <strcmp+0x17>
+		p++, q++;
+  107d9e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  107da2:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+	while (*p && *p == *q)
+  107da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  107da9:	0f b6 00             	movzbl (%eax),%eax
+  107dac:	84 c0                	test   %al,%al
+  107dae:	74 10                	je     107dc0 <strcmp+0x31>
+  107db0:	8b 45 08             	mov    0x8(%ebp),%eax
+  107db3:	0f b6 10             	movzbl (%eax),%edx
+  107db6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107db9:	0f b6 00             	movzbl (%eax),%eax
+  107dbc:	38 c2                	cmp    %al,%dl
+  107dbe:	74 de                	je     107d9e <strcmp+0xf>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  107dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  107dc3:	0f b6 00             	movzbl (%eax),%eax
+  107dc6:	0f b6 d0             	movzbl %al,%edx
+  107dc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107dcc:	0f b6 00             	movzbl (%eax),%eax
+  107dcf:	0f b6 c0             	movzbl %al,%eax
+  107dd2:	29 c2                	sub    %eax,%edx
+  107dd4:	89 d0                	mov    %edx,%eax
+}
+  107dd6:	5d                   	pop    %ebp
+  107dd7:	c3                   	ret
+
+00107dd8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  107dd8:	55                   	push   %ebp
+  107dd9:	89 e5                	mov    %esp,%ebp
+  107ddb:	e8 30 86 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107de0:	05 14 62 00 00       	add    $0x6214,%eax
+	while (n > 0 && *p && *p == *q)
+  107de5:	eb 0c                	jmp    107df3 <strncmp+0x1b>
+		n--, p++, q++;
+  107de7:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+  107deb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  107def:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+	while (n > 0 && *p && *p == *q)
+  107df3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  107df7:	74 1a                	je     107e13 <strncmp+0x3b>
+  107df9:	8b 45 08             	mov    0x8(%ebp),%eax
+  107dfc:	0f b6 00             	movzbl (%eax),%eax
+  107dff:	84 c0                	test   %al,%al
+  107e01:	74 10                	je     107e13 <strncmp+0x3b>
+  107e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e06:	0f b6 10             	movzbl (%eax),%edx
+  107e09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107e0c:	0f b6 00             	movzbl (%eax),%eax
+  107e0f:	38 c2                	cmp    %al,%dl
+  107e11:	74 d4                	je     107de7 <strncmp+0xf>
+	if (n == 0)
+  107e13:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  107e17:	75 07                	jne    107e20 <strncmp+0x48>
+		return 0;
+  107e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  107e1e:	eb 14                	jmp    107e34 <strncmp+0x5c>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  107e20:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e23:	0f b6 00             	movzbl (%eax),%eax
+  107e26:	0f b6 d0             	movzbl %al,%edx
+  107e29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107e2c:	0f b6 00             	movzbl (%eax),%eax
+  107e2f:	0f b6 c0             	movzbl %al,%eax
+  107e32:	29 c2                	sub    %eax,%edx
+}
+  107e34:	89 d0                	mov    %edx,%eax
+  107e36:	5d                   	pop    %ebp
+  107e37:	c3                   	ret
+
+00107e38 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  107e38:	55                   	push   %ebp
+  107e39:	89 e5                	mov    %esp,%ebp
+  107e3b:	83 ec 04             	sub    $0x4,%esp
+  107e3e:	e8 cd 85 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107e43:	05 b1 61 00 00       	add    $0x61b1,%eax
+  107e48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107e4b:	88 45 fc             	mov    %al,-0x4(%ebp)
+	for (; *s; s++)
+  107e4e:	eb 14                	jmp    107e64 <strchr+0x2c>
+		if (*s == c)
+  107e50:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e53:	0f b6 00             	movzbl (%eax),%eax
+  107e56:	38 45 fc             	cmp    %al,-0x4(%ebp)
+  107e59:	75 05                	jne    107e60 <strchr+0x28>
+			return (char *) s;
+  107e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e5e:	eb 13                	jmp    107e73 <strchr+0x3b>
+	for (; *s; s++)
+  107e60:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  107e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e67:	0f b6 00             	movzbl (%eax),%eax
+  107e6a:	84 c0                	test   %al,%al
+  107e6c:	75 e2                	jne    107e50 <strchr+0x18>
+	return 0;
+  107e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  107e73:	c9                   	leave
+  107e74:	c3                   	ret
+
+00107e75 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  107e75:	55                   	push   %ebp
+  107e76:	89 e5                	mov    %esp,%ebp
+  107e78:	83 ec 04             	sub    $0x4,%esp
+  107e7b:	e8 90 85 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107e80:	05 74 61 00 00       	add    $0x6174,%eax
+  107e85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107e88:	88 45 fc             	mov    %al,-0x4(%ebp)
+	for (; *s; s++)
+  107e8b:	eb 0f                	jmp    107e9c <strfind+0x27>
+		if (*s == c)
+  107e8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e90:	0f b6 00             	movzbl (%eax),%eax
+  107e93:	38 45 fc             	cmp    %al,-0x4(%ebp)
+  107e96:	74 10                	je     107ea8 <strfind+0x33>
+	for (; *s; s++)
+  107e98:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  107e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  107e9f:	0f b6 00             	movzbl (%eax),%eax
+  107ea2:	84 c0                	test   %al,%al
+  107ea4:	75 e7                	jne    107e8d <strfind+0x18>
+  107ea6:	eb 01                	jmp    107ea9 <strfind+0x34>
+			break;
+  107ea8:	90                   	nop
+	return (char *) s;
+  107ea9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  107eac:	c9                   	leave
+  107ead:	c3                   	ret
+
+00107eae <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  107eae:	55                   	push   %ebp
+  107eaf:	89 e5                	mov    %esp,%ebp
+  107eb1:	57                   	push   %edi
+  107eb2:	e8 59 85 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107eb7:	05 3d 61 00 00       	add    $0x613d,%eax
+	char *p;
+
+	if (n == 0)
+  107ebc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  107ec0:	75 05                	jne    107ec7 <memset+0x19>
+		return v;
+  107ec2:	8b 45 08             	mov    0x8(%ebp),%eax
+  107ec5:	eb 5c                	jmp    107f23 <memset+0x75>
+	if ((int)v%4 == 0 && n%4 == 0) {
+  107ec7:	8b 45 08             	mov    0x8(%ebp),%eax
+  107eca:	83 e0 03             	and    $0x3,%eax
+  107ecd:	85 c0                	test   %eax,%eax
+  107ecf:	75 41                	jne    107f12 <memset+0x64>
+  107ed1:	8b 45 10             	mov    0x10(%ebp),%eax
+  107ed4:	83 e0 03             	and    $0x3,%eax
+  107ed7:	85 c0                	test   %eax,%eax
+  107ed9:	75 37                	jne    107f12 <memset+0x64>
+		c &= 0xFF;
+  107edb:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  107ee2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107ee5:	c1 e0 18             	shl    $0x18,%eax
+  107ee8:	89 c2                	mov    %eax,%edx
+  107eea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107eed:	c1 e0 10             	shl    $0x10,%eax
+  107ef0:	09 c2                	or     %eax,%edx
+  107ef2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107ef5:	c1 e0 08             	shl    $0x8,%eax
+  107ef8:	09 d0                	or     %edx,%eax
+  107efa:	09 45 0c             	or     %eax,0xc(%ebp)
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  107efd:	8b 45 10             	mov    0x10(%ebp),%eax
+  107f00:	c1 e8 02             	shr    $0x2,%eax
+  107f03:	89 c1                	mov    %eax,%ecx
+		asm volatile("cld; rep stosl\n"
+  107f05:	8b 55 08             	mov    0x8(%ebp),%edx
+  107f08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107f0b:	89 d7                	mov    %edx,%edi
+  107f0d:	fc                   	cld
+  107f0e:	f3 ab                	rep stos %eax,%es:(%edi)
+  107f10:	eb 0e                	jmp    107f20 <memset+0x72>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  107f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  107f15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107f18:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  107f1b:	89 d7                	mov    %edx,%edi
+  107f1d:	fc                   	cld
+  107f1e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+  107f20:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  107f23:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  107f26:	c9                   	leave
+  107f27:	c3                   	ret
+
+00107f28 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  107f28:	55                   	push   %ebp
+  107f29:	89 e5                	mov    %esp,%ebp
+  107f2b:	57                   	push   %edi
+  107f2c:	56                   	push   %esi
+  107f2d:	53                   	push   %ebx
+  107f2e:	83 ec 10             	sub    $0x10,%esp
+  107f31:	e8 da 84 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  107f36:	05 be 60 00 00       	add    $0x60be,%eax
+	const char *s;
+	char *d;
+	
+	s = src;
+  107f3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107f3e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	d = dst;
+  107f41:	8b 45 08             	mov    0x8(%ebp),%eax
+  107f44:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	if (s < d && s + n > d) {
+  107f47:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  107f4a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+  107f4d:	73 6d                	jae    107fbc <memmove+0x94>
+  107f4f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  107f52:	8b 45 10             	mov    0x10(%ebp),%eax
+  107f55:	01 d0                	add    %edx,%eax
+  107f57:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+  107f5a:	73 60                	jae    107fbc <memmove+0x94>
+		s += n;
+  107f5c:	8b 45 10             	mov    0x10(%ebp),%eax
+  107f5f:	01 45 f0             	add    %eax,-0x10(%ebp)
+		d += n;
+  107f62:	8b 45 10             	mov    0x10(%ebp),%eax
+  107f65:	01 45 ec             	add    %eax,-0x14(%ebp)
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  107f68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  107f6b:	83 e0 03             	and    $0x3,%eax
+  107f6e:	85 c0                	test   %eax,%eax
+  107f70:	75 2f                	jne    107fa1 <memmove+0x79>
+  107f72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107f75:	83 e0 03             	and    $0x3,%eax
+  107f78:	85 c0                	test   %eax,%eax
+  107f7a:	75 25                	jne    107fa1 <memmove+0x79>
+  107f7c:	8b 45 10             	mov    0x10(%ebp),%eax
+  107f7f:	83 e0 03             	and    $0x3,%eax
+  107f82:	85 c0                	test   %eax,%eax
+  107f84:	75 1b                	jne    107fa1 <memmove+0x79>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  107f86:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107f89:	83 e8 04             	sub    $0x4,%eax
+  107f8c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  107f8f:	83 ea 04             	sub    $0x4,%edx
+  107f92:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  107f95:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  107f98:	89 c7                	mov    %eax,%edi
+  107f9a:	89 d6                	mov    %edx,%esi
+  107f9c:	fd                   	std
+  107f9d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  107f9f:	eb 18                	jmp    107fb9 <memmove+0x91>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  107fa1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107fa4:	8d 50 ff             	lea    -0x1(%eax),%edx
+  107fa7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  107faa:	8d 58 ff             	lea    -0x1(%eax),%ebx
+			asm volatile("std; rep movsb\n"
+  107fad:	8b 45 10             	mov    0x10(%ebp),%eax
+  107fb0:	89 d7                	mov    %edx,%edi
+  107fb2:	89 de                	mov    %ebx,%esi
+  107fb4:	89 c1                	mov    %eax,%ecx
+  107fb6:	fd                   	std
+  107fb7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  107fb9:	fc                   	cld
+  107fba:	eb 45                	jmp    108001 <memmove+0xd9>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  107fbc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  107fbf:	83 e0 03             	and    $0x3,%eax
+  107fc2:	85 c0                	test   %eax,%eax
+  107fc4:	75 2b                	jne    107ff1 <memmove+0xc9>
+  107fc6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107fc9:	83 e0 03             	and    $0x3,%eax
+  107fcc:	85 c0                	test   %eax,%eax
+  107fce:	75 21                	jne    107ff1 <memmove+0xc9>
+  107fd0:	8b 45 10             	mov    0x10(%ebp),%eax
+  107fd3:	83 e0 03             	and    $0x3,%eax
+  107fd6:	85 c0                	test   %eax,%eax
+  107fd8:	75 17                	jne    107ff1 <memmove+0xc9>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  107fda:	8b 45 10             	mov    0x10(%ebp),%eax
+  107fdd:	c1 e8 02             	shr    $0x2,%eax
+  107fe0:	89 c1                	mov    %eax,%ecx
+			asm volatile("cld; rep movsl\n"
+  107fe2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107fe5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  107fe8:	89 c7                	mov    %eax,%edi
+  107fea:	89 d6                	mov    %edx,%esi
+  107fec:	fc                   	cld
+  107fed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  107fef:	eb 10                	jmp    108001 <memmove+0xd9>
+		else
+			asm volatile("cld; rep movsb\n"
+  107ff1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  107ff4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  107ff7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  107ffa:	89 c7                	mov    %eax,%edi
+  107ffc:	89 d6                	mov    %edx,%esi
+  107ffe:	fc                   	cld
+  107fff:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  108001:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  108004:	83 c4 10             	add    $0x10,%esp
+  108007:	5b                   	pop    %ebx
+  108008:	5e                   	pop    %esi
+  108009:	5f                   	pop    %edi
+  10800a:	5d                   	pop    %ebp
+  10800b:	c3                   	ret
+
+0010800c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  10800c:	55                   	push   %ebp
+  10800d:	89 e5                	mov    %esp,%ebp
+  10800f:	e8 fc 83 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  108014:	05 e0 5f 00 00       	add    $0x5fe0,%eax
+	return memmove(dst, src, n);
+  108019:	ff 75 10             	push   0x10(%ebp)
+  10801c:	ff 75 0c             	push   0xc(%ebp)
+  10801f:	ff 75 08             	push   0x8(%ebp)
+  108022:	e8 01 ff ff ff       	call   107f28 <memmove>
+  108027:	83 c4 0c             	add    $0xc,%esp
+}
+  10802a:	c9                   	leave
+  10802b:	c3                   	ret
+
+0010802c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  10802c:	55                   	push   %ebp
+  10802d:	89 e5                	mov    %esp,%ebp
+  10802f:	83 ec 10             	sub    $0x10,%esp
+  108032:	e8 d9 83 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  108037:	05 bd 5f 00 00       	add    $0x5fbd,%eax
+	const uint8_t *s1 = (const uint8_t *) v1;
+  10803c:	8b 45 08             	mov    0x8(%ebp),%eax
+  10803f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  108042:	8b 45 0c             	mov    0xc(%ebp),%eax
+  108045:	89 45 f8             	mov    %eax,-0x8(%ebp)
+
+	while (n-- > 0) {
+  108048:	eb 2e                	jmp    108078 <memcmp+0x4c>
+		if (*s1 != *s2)
+  10804a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  10804d:	0f b6 10             	movzbl (%eax),%edx
+  108050:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  108053:	0f b6 00             	movzbl (%eax),%eax
+  108056:	38 c2                	cmp    %al,%dl
+  108058:	74 16                	je     108070 <memcmp+0x44>
+			return (int) *s1 - (int) *s2;
+  10805a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  10805d:	0f b6 00             	movzbl (%eax),%eax
+  108060:	0f b6 d0             	movzbl %al,%edx
+  108063:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  108066:	0f b6 00             	movzbl (%eax),%eax
+  108069:	0f b6 c0             	movzbl %al,%eax
+  10806c:	29 c2                	sub    %eax,%edx
+  10806e:	eb 1a                	jmp    10808a <memcmp+0x5e>
+		s1++, s2++;
+  108070:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  108074:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+	while (n-- > 0) {
+  108078:	8b 45 10             	mov    0x10(%ebp),%eax
+  10807b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  10807e:	89 55 10             	mov    %edx,0x10(%ebp)
+  108081:	85 c0                	test   %eax,%eax
+  108083:	75 c5                	jne    10804a <memcmp+0x1e>
+	}
+
+	return 0;
+  108085:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  10808a:	89 d0                	mov    %edx,%eax
+  10808c:	c9                   	leave
+  10808d:	c3                   	ret
+
+0010808e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  10808e:	55                   	push   %ebp
+  10808f:	89 e5                	mov    %esp,%ebp
+  108091:	83 ec 10             	sub    $0x10,%esp
+  108094:	e8 77 83 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  108099:	05 5b 5f 00 00       	add    $0x5f5b,%eax
+	const void *ends = (const char *) s + n;
+  10809e:	8b 55 08             	mov    0x8(%ebp),%edx
+  1080a1:	8b 45 10             	mov    0x10(%ebp),%eax
+  1080a4:	01 d0                	add    %edx,%eax
+  1080a6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+	for (; s < ends; s++)
+  1080a9:	eb 11                	jmp    1080bc <memfind+0x2e>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  1080ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  1080ae:	0f b6 00             	movzbl (%eax),%eax
+  1080b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1080b4:	38 d0                	cmp    %dl,%al
+  1080b6:	74 0e                	je     1080c6 <memfind+0x38>
+	for (; s < ends; s++)
+  1080b8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  1080bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  1080bf:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+  1080c2:	72 e7                	jb     1080ab <memfind+0x1d>
+  1080c4:	eb 01                	jmp    1080c7 <memfind+0x39>
+			break;
+  1080c6:	90                   	nop
+	return (void *) s;
+  1080c7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  1080ca:	c9                   	leave
+  1080cb:	c3                   	ret
+
+001080cc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  1080cc:	55                   	push   %ebp
+  1080cd:	89 e5                	mov    %esp,%ebp
+  1080cf:	83 ec 10             	sub    $0x10,%esp
+  1080d2:	e8 39 83 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1080d7:	05 1d 5f 00 00       	add    $0x5f1d,%eax
+	int neg = 0;
+  1080dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+	long val = 0;
+  1080e3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  1080ea:	eb 04                	jmp    1080f0 <strtol+0x24>
+		s++;
+  1080ec:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+	while (*s == ' ' || *s == '\t')
+  1080f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  1080f3:	0f b6 00             	movzbl (%eax),%eax
+  1080f6:	3c 20                	cmp    $0x20,%al
+  1080f8:	74 f2                	je     1080ec <strtol+0x20>
+  1080fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  1080fd:	0f b6 00             	movzbl (%eax),%eax
+  108100:	3c 09                	cmp    $0x9,%al
+  108102:	74 e8                	je     1080ec <strtol+0x20>
+
+	// plus/minus sign
+	if (*s == '+')
+  108104:	8b 45 08             	mov    0x8(%ebp),%eax
+  108107:	0f b6 00             	movzbl (%eax),%eax
+  10810a:	3c 2b                	cmp    $0x2b,%al
+  10810c:	75 06                	jne    108114 <strtol+0x48>
+		s++;
+  10810e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  108112:	eb 15                	jmp    108129 <strtol+0x5d>
+	else if (*s == '-')
+  108114:	8b 45 08             	mov    0x8(%ebp),%eax
+  108117:	0f b6 00             	movzbl (%eax),%eax
+  10811a:	3c 2d                	cmp    $0x2d,%al
+  10811c:	75 0b                	jne    108129 <strtol+0x5d>
+		s++, neg = 1;
+  10811e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  108122:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%ebp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  108129:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10812d:	74 06                	je     108135 <strtol+0x69>
+  10812f:	83 7d 10 10          	cmpl   $0x10,0x10(%ebp)
+  108133:	75 24                	jne    108159 <strtol+0x8d>
+  108135:	8b 45 08             	mov    0x8(%ebp),%eax
+  108138:	0f b6 00             	movzbl (%eax),%eax
+  10813b:	3c 30                	cmp    $0x30,%al
+  10813d:	75 1a                	jne    108159 <strtol+0x8d>
+  10813f:	8b 45 08             	mov    0x8(%ebp),%eax
+  108142:	83 c0 01             	add    $0x1,%eax
+  108145:	0f b6 00             	movzbl (%eax),%eax
+  108148:	3c 78                	cmp    $0x78,%al
+  10814a:	75 0d                	jne    108159 <strtol+0x8d>
+		s += 2, base = 16;
+  10814c:	83 45 08 02          	addl   $0x2,0x8(%ebp)
+  108150:	c7 45 10 10 00 00 00 	movl   $0x10,0x10(%ebp)
+  108157:	eb 2a                	jmp    108183 <strtol+0xb7>
+	else if (base == 0 && s[0] == '0')
+  108159:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10815d:	75 17                	jne    108176 <strtol+0xaa>
+  10815f:	8b 45 08             	mov    0x8(%ebp),%eax
+  108162:	0f b6 00             	movzbl (%eax),%eax
+  108165:	3c 30                	cmp    $0x30,%al
+  108167:	75 0d                	jne    108176 <strtol+0xaa>
+		s++, base = 8;
+  108169:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  10816d:	c7 45 10 08 00 00 00 	movl   $0x8,0x10(%ebp)
+  108174:	eb 0d                	jmp    108183 <strtol+0xb7>
+	else if (base == 0)
+  108176:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10817a:	75 07                	jne    108183 <strtol+0xb7>
+		base = 10;
+  10817c:	c7 45 10 0a 00 00 00 	movl   $0xa,0x10(%ebp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  108183:	8b 45 08             	mov    0x8(%ebp),%eax
+  108186:	0f b6 00             	movzbl (%eax),%eax
+  108189:	3c 2f                	cmp    $0x2f,%al
+  10818b:	7e 1b                	jle    1081a8 <strtol+0xdc>
+  10818d:	8b 45 08             	mov    0x8(%ebp),%eax
+  108190:	0f b6 00             	movzbl (%eax),%eax
+  108193:	3c 39                	cmp    $0x39,%al
+  108195:	7f 11                	jg     1081a8 <strtol+0xdc>
+			dig = *s - '0';
+  108197:	8b 45 08             	mov    0x8(%ebp),%eax
+  10819a:	0f b6 00             	movzbl (%eax),%eax
+  10819d:	0f be c0             	movsbl %al,%eax
+  1081a0:	83 e8 30             	sub    $0x30,%eax
+  1081a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1081a6:	eb 48                	jmp    1081f0 <strtol+0x124>
+		else if (*s >= 'a' && *s <= 'z')
+  1081a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  1081ab:	0f b6 00             	movzbl (%eax),%eax
+  1081ae:	3c 60                	cmp    $0x60,%al
+  1081b0:	7e 1b                	jle    1081cd <strtol+0x101>
+  1081b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  1081b5:	0f b6 00             	movzbl (%eax),%eax
+  1081b8:	3c 7a                	cmp    $0x7a,%al
+  1081ba:	7f 11                	jg     1081cd <strtol+0x101>
+			dig = *s - 'a' + 10;
+  1081bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  1081bf:	0f b6 00             	movzbl (%eax),%eax
+  1081c2:	0f be c0             	movsbl %al,%eax
+  1081c5:	83 e8 57             	sub    $0x57,%eax
+  1081c8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1081cb:	eb 23                	jmp    1081f0 <strtol+0x124>
+		else if (*s >= 'A' && *s <= 'Z')
+  1081cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  1081d0:	0f b6 00             	movzbl (%eax),%eax
+  1081d3:	3c 40                	cmp    $0x40,%al
+  1081d5:	7e 3c                	jle    108213 <strtol+0x147>
+  1081d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  1081da:	0f b6 00             	movzbl (%eax),%eax
+  1081dd:	3c 5a                	cmp    $0x5a,%al
+  1081df:	7f 32                	jg     108213 <strtol+0x147>
+			dig = *s - 'A' + 10;
+  1081e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  1081e4:	0f b6 00             	movzbl (%eax),%eax
+  1081e7:	0f be c0             	movsbl %al,%eax
+  1081ea:	83 e8 37             	sub    $0x37,%eax
+  1081ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		else
+			break;
+		if (dig >= base)
+  1081f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1081f3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  1081f6:	7d 1a                	jge    108212 <strtol+0x146>
+			break;
+		s++, val = (val * base) + dig;
+  1081f8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  1081fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  1081ff:	0f af 45 10          	imul   0x10(%ebp),%eax
+  108203:	89 c2                	mov    %eax,%edx
+  108205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  108208:	01 d0                	add    %edx,%eax
+  10820a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+	while (1) {
+  10820d:	e9 71 ff ff ff       	jmp    108183 <strtol+0xb7>
+			break;
+  108212:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  108213:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  108217:	74 08                	je     108221 <strtol+0x155>
+		*endptr = (char *) s;
+  108219:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10821c:	8b 55 08             	mov    0x8(%ebp),%edx
+  10821f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  108221:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+  108225:	74 07                	je     10822e <strtol+0x162>
+  108227:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  10822a:	f7 d8                	neg    %eax
+  10822c:	eb 03                	jmp    108231 <strtol+0x165>
+  10822e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+}
+  108231:	c9                   	leave
+  108232:	c3                   	ret
+
+00108233 <sys_cputs>:
+#include <inc/syscall.h>
+
+
+void
+sys_cputs(const char *s)
+{
+  108233:	55                   	push   %ebp
+  108234:	89 e5                	mov    %esp,%ebp
+  108236:	53                   	push   %ebx
+  108237:	e8 d4 81 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10823c:	05 b8 5d 00 00       	add    $0x5db8,%eax
+	asm volatile("int %0" :
+  108241:	b8 00 00 00 00       	mov    $0x0,%eax
+  108246:	8b 55 08             	mov    0x8(%ebp),%edx
+  108249:	89 d3                	mov    %edx,%ebx
+  10824b:	cd 30                	int    $0x30
+		: "i" (T_SYSCALL),
+		  "a" (SYS_CPUTS),
+		  "b" (s)
+		: "cc", "memory");
+}
+  10824d:	90                   	nop
+  10824e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  108251:	c9                   	leave
+  108252:	c3                   	ret
+
+00108253 <sys_put>:
+
+void
+sys_put(uint32_t flags, uint16_t child, cpustate *cpu,
+	void *localsrc, void *childdest, size_t size)
+{
+  108253:	55                   	push   %ebp
+  108254:	89 e5                	mov    %esp,%ebp
+  108256:	57                   	push   %edi
+  108257:	56                   	push   %esi
+  108258:	53                   	push   %ebx
+  108259:	83 ec 04             	sub    $0x4,%esp
+  10825c:	e8 af 81 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  108261:	05 93 5d 00 00       	add    $0x5d93,%eax
+  108266:	8b 45 0c             	mov    0xc(%ebp),%eax
+  108269:	66 89 45 f0          	mov    %ax,-0x10(%ebp)
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_PUT | flags),
+  10826d:	8b 45 08             	mov    0x8(%ebp),%eax
+  108270:	83 c8 01             	or     $0x1,%eax
+	asm volatile("int %0" :
+  108273:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  108276:	0f b7 55 f0          	movzwl -0x10(%ebp),%edx
+  10827a:	8b 75 14             	mov    0x14(%ebp),%esi
+  10827d:	8b 7d 18             	mov    0x18(%ebp),%edi
+  108280:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+  108283:	cd 30                	int    $0x30
+		  "d" (child),
+		  "S" (localsrc),
+		  "D" (childdest),
+		  "c" (size)
+		: "cc", "memory");
+}
+  108285:	90                   	nop
+  108286:	83 c4 04             	add    $0x4,%esp
+  108289:	5b                   	pop    %ebx
+  10828a:	5e                   	pop    %esi
+  10828b:	5f                   	pop    %edi
+  10828c:	5d                   	pop    %ebp
+  10828d:	c3                   	ret
+
+0010828e <sys_get>:
+
+void
+sys_get(uint32_t flags, uint16_t child, cpustate *cpu,
+	void *childsrc, void *localdest, size_t size)
+{
+  10828e:	55                   	push   %ebp
+  10828f:	89 e5                	mov    %esp,%ebp
+  108291:	57                   	push   %edi
+  108292:	56                   	push   %esi
+  108293:	53                   	push   %ebx
+  108294:	83 ec 04             	sub    $0x4,%esp
+  108297:	e8 74 81 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  10829c:	05 58 5d 00 00       	add    $0x5d58,%eax
+  1082a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1082a4:	66 89 45 f0          	mov    %ax,-0x10(%ebp)
+	asm volatile("int %0" :
+		: "i" (T_SYSCALL),
+		  "a" (SYS_GET | flags),
+  1082a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  1082ab:	83 c8 02             	or     $0x2,%eax
+	asm volatile("int %0" :
+  1082ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  1082b1:	0f b7 55 f0          	movzwl -0x10(%ebp),%edx
+  1082b5:	8b 75 14             	mov    0x14(%ebp),%esi
+  1082b8:	8b 7d 18             	mov    0x18(%ebp),%edi
+  1082bb:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+  1082be:	cd 30                	int    $0x30
+		  "d" (child),
+		  "S" (childsrc),
+		  "D" (localdest),
+		  "c" (size)
+		: "cc", "memory");
+}
+  1082c0:	90                   	nop
+  1082c1:	83 c4 04             	add    $0x4,%esp
+  1082c4:	5b                   	pop    %ebx
+  1082c5:	5e                   	pop    %esi
+  1082c6:	5f                   	pop    %edi
+  1082c7:	5d                   	pop    %ebp
+  1082c8:	c3                   	ret
+
+001082c9 <sys_ret>:
+
+void
+sys_ret(void)
+{
+  1082c9:	55                   	push   %ebp
+  1082ca:	89 e5                	mov    %esp,%ebp
+  1082cc:	e8 3f 81 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1082d1:	05 23 5d 00 00       	add    $0x5d23,%eax
+	asm volatile("int %0" :
+  1082d6:	b8 03 00 00 00       	mov    $0x3,%eax
+  1082db:	cd 30                	int    $0x30
+		: "i" (T_SYSCALL),
+		  "a" (SYS_RET));
+}
+  1082dd:	90                   	nop
+  1082de:	5d                   	pop    %ebp
+  1082df:	c3                   	ret
+
+001082e0 <sys_ring>:
+
+void
+sys_ring(sysring *ring)
+{
+  1082e0:	55                   	push   %ebp
+  1082e1:	89 e5                	mov    %esp,%ebp
+  1082e3:	53                   	push   %ebx
+  1082e4:	e8 27 81 ff ff       	call   100410 <__x86.get_pc_thunk.ax>
+  1082e9:	05 0b 5d 00 00       	add    $0x5d0b,%eax
+	asm volatile("int %0" :
+  1082ee:	b8 00 01 00 00       	mov    $0x100,%eax
+  1082f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  1082f6:	89 d3                	mov    %edx,%ebx
+  1082f8:	cd 30                	int    $0x30
+		: "i" (T_SYSCALL),
+		  "a" (SYS_RING),
+		  "b" (ring)
+		: "cc", "memory");
+}
+  1082fa:	90                   	nop
+  1082fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1082fe:	c9                   	leave
+  1082ff:	c3                   	ret
+
+00108300 <__udivdi3>:
+  108300:	57                   	push   %edi
+  108301:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  108306:	56                   	push   %esi
+  108307:	53                   	push   %ebx
+  108308:	83 ec 20             	sub    $0x20,%esp
+  10830b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  10830f:	8b 54 24 34          	mov    0x34(%esp),%edx
+  108313:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  10831a:	00 
+  10831b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  108322:	00 
+  108323:	89 44 24 08          	mov    %eax,0x8(%esp)
+  108327:	8b 44 24 38          	mov    0x38(%esp),%eax
+  10832b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  10832f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  108333:	89 44 24 10          	mov    %eax,0x10(%esp)
+  108337:	31 c0                	xor    %eax,%eax
+  108339:	89 54 24 14          	mov    %edx,0x14(%esp)
+  10833d:	31 d2                	xor    %edx,%edx
+  10833f:	90                   	nop
+  108340:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  108344:	01 c0                	add    %eax,%eax
+  108346:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  10834d:	00 
+  10834e:	89 c6                	mov    %eax,%esi
+  108350:	89 d7                	mov    %edx,%edi
+  108352:	8b 44 24 08          	mov    0x8(%esp),%eax
+  108356:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  10835a:	0f ad d0             	shrd   %cl,%edx,%eax
+  10835d:	d3 ea                	shr    %cl,%edx
+  10835f:	f6 c1 20             	test   $0x20,%cl
+  108362:	0f 45 c2             	cmovne %edx,%eax
+  108365:	8b 54 24 04          	mov    0x4(%esp),%edx
+  108369:	83 e0 01             	and    $0x1,%eax
+  10836c:	09 fa                	or     %edi,%edx
+  10836e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  108372:	89 04 24             	mov    %eax,(%esp)
+  108375:	8b 04 24             	mov    (%esp),%eax
+  108378:	89 d3                	mov    %edx,%ebx
+  10837a:	09 f0                	or     %esi,%eax
+  10837c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  108380:	39 f0                	cmp    %esi,%eax
+  108382:	19 fb                	sbb    %edi,%ebx
+  108384:	72 1d                	jb     1083a3 <__udivdi3+0xa3>
+  108386:	29 f0                	sub    %esi,%eax
+  108388:	19 fa                	sbb    %edi,%edx
+  10838a:	89 cf                	mov    %ecx,%edi
+  10838c:	c1 ef 05             	shr    $0x5,%edi
+  10838f:	83 e7 01             	and    $0x1,%edi
+  108392:	89 fe                	mov    %edi,%esi
+  108394:	d3 e7                	shl    %cl,%edi
+  108396:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  10839a:	83 f6 01             	xor    $0x1,%esi
+  10839d:	d3 e6                	shl    %cl,%esi
+  10839f:	09 74 24 18          	or     %esi,0x18(%esp)
+  1083a3:	83 e9 01             	sub    $0x1,%ecx
+  1083a6:	73 98                	jae    108340 <__udivdi3+0x40>
+  1083a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  1083ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  1083b0:	83 c4 20             	add    $0x20,%esp
+  1083b3:	5b                   	pop    %ebx
+  1083b4:	5e                   	pop    %esi
+  1083b5:	5f                   	pop    %edi
+  1083b6:	c3                   	ret
+  1083b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  1083be:	66 90                	xchg   %ax,%ax
+
+001083c0 <__umoddi3>:
+  1083c0:	57                   	push   %edi
+  1083c1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  1083c6:	56                   	push   %esi
+  1083c7:	53                   	push   %ebx
+  1083c8:	83 ec 18             	sub    $0x18,%esp
+  1083cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  1083cf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  1083d3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  1083d7:	8b 44 24 30          	mov    0x30(%esp),%eax
+  1083db:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  1083df:	8b 54 24 34          	mov    0x34(%esp),%edx
+  1083e3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  1083e7:	31 c0                	xor    %eax,%eax
+  1083e9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  1083ed:	31 d2                	xor    %edx,%edx
+  1083ef:	90                   	nop
+  1083f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  1083f4:	01 c0                	add    %eax,%eax
+  1083f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  1083fd:	00 
+  1083fe:	89 c6                	mov    %eax,%esi
+  108400:	89 d7                	mov    %edx,%edi
+  108402:	8b 44 24 08          	mov    0x8(%esp),%eax
+  108406:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  10840a:	0f ad d0             	shrd   %cl,%edx,%eax
+  10840d:	d3 ea                	shr    %cl,%edx
+  10840f:	f6 c1 20             	test   $0x20,%cl
+  108412:	0f 45 c2             	cmovne %edx,%eax
+  108415:	8b 54 24 04          	mov    0x4(%esp),%edx
+  108419:	83 e0 01             	and    $0x1,%eax
+  10841c:	09 fa                	or     %edi,%edx
+  10841e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  108422:	89 04 24             	mov    %eax,(%esp)
+  108425:	8b 04 24             	mov    (%esp),%eax
+  108428:	89 d3                	mov    %edx,%ebx
+  10842a:	09 f0                	or     %esi,%eax
+  10842c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  108430:	39 f0                	cmp    %esi,%eax
+  108432:	19 fb                	sbb    %edi,%ebx
+  108434:	72 04                	jb     10843a <__umoddi3+0x7a>
+  108436:	29 f0                	sub    %esi,%eax
+  108438:	19 fa                	sbb    %edi,%edx
+  10843a:	83 e9 01             	sub    $0x1,%ecx
+  10843d:	73 b1                	jae    1083f0 <__umoddi3+0x30>
+  10843f:	83 c4 18             	add    $0x18,%esp
+  108442:	5b                   	pop    %ebx
+  108443:	5e                   	pop    %esi
+  108444:	5f                   	pop    %edi
+  108445:	c3                   	ret
@@ -0,0 +1,214 @@
+/*
+ * Build a compressed kernel image for the second-stage boot loader:
+ * LZ4-compress each loadable segment of a 32-bit ELF kernel,
+ * in the format described in boot/zimage.h.  Usage:
+ *
+ *	mkzimage obj/kern/kernel obj/kern/kernel.z
+ *
+ * Each segment is decompressed again with the boot loader's own
+ * decompressor before we write anything, so a bad image never gets built.
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <elf.h>
+
+#include <boot/zimage.h>
+
+#define SECTSIZE	512
+
+#define HASH_BITS	16
+#define MINMATCH	4
+#define LASTLITERALS	5	// the last 5 bytes are always literals
+#define MFLIMIT		12	// and no match starts in the last 12
+
+
+static void *
+readfile(const char *name, size_t *size)
+{
+	FILE *f = fopen(name, "rb");
+	if (f == NULL) {
+		perror(name);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	*size = ftell(f);
+	rewind(f);
+	void *buf = malloc(*size);
+	if (buf == NULL || fread(buf, 1, *size, f) != *size) {
+		fprintf(stderr, "%s: read error\n", name);
+		exit(1);
+	}
+	fclose(f);
+	return buf;
+}
+
+static uint32_t
+read32(const uint8_t *p)
+{
+	uint32_t v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+// Append an LZ4 length continuation for a length field that hit 15.
+static uint8_t *
+putlen(uint8_t *op, size_t len)
+{
+	for (len -= 15; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = len;
+	return op;
+}
+
+// Emit one sequence: literals [lit, lit+litlen), then, unless this is
+// the last sequence (matchlen 0), a match of matchlen bytes at offset.
+static uint8_t *
+putseq(uint8_t *op, const uint8_t *lit, size_t litlen,
+	size_t offset, size_t matchlen)
+{
+	size_t ml = matchlen ? matchlen - MINMATCH : 0;
+	*op++ = (litlen < 15 ? litlen : 15) << 4 | (ml < 15 ? ml : 15);
+	if (litlen >= 15)
+		op = putlen(op, litlen);
+	memcpy(op, lit, litlen);
+	op += litlen;
+	if (matchlen) {
+		*op++ = offset;
+		*op++ = offset >> 8;
+		if (ml >= 15)
+			op = putlen(op, ml);
+	}
+	return op;
+}
+
+// Compress n bytes at src into a single LZ4 block at dst,
+// which must have room for n + n/255 + 16 bytes.
+// A simple greedy matcher: we care about speed of decompression,
+// which is the same however hard we try here.
+static size_t
+lz4_compress(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	static uint32_t table[1 << HASH_BITS];	// position + 1, or 0
+	const uint8_t *ip = src, *anchor = src, *end = src + n;
+	uint8_t *op = dst;
+
+	memset(table, 0, sizeof(table));
+	while (n > MFLIMIT && ip < end - MFLIMIT) {
+		uint32_t seq = read32(ip);
+		uint32_t h = (seq * 2654435761U) >> (32 - HASH_BITS);
+		uint32_t cand = table[h];
+		table[h] = ip - src + 1;
+
+		const uint8_t *ref = src + cand - 1;
+		if (cand == 0 || ip - ref > 65535 || read32(ref) != seq) {
+			ip++;
+			continue;
+		}
+
+		const uint8_t *mp = ip + MINMATCH, *rp = ref + MINMATCH;
+		while (mp < end - LASTLITERALS && *mp == *rp)
+			mp++, rp++;
+		op = putseq(op, anchor, ip - anchor, ip - ref, mp - ip);
+		ip = anchor = mp;
+	}
+	op = putseq(op, anchor, end - anchor, 0, 0);
+	return op - dst;
+}
+
+int
+main(int argc, char **argv)
+{
+	size_t ksize;
+	uint8_t *k;
+	zimage_hdr hdr;
+	int i;
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s <kernel> <output>\n", argv[0]);
+		return 1;
+	}
+
+	k = readfile(argv[1], &ksize);
+	Elf32_Ehdr *eh = (Elf32_Ehdr *) k;
+	if (ksize < sizeof(*eh) || memcmp(eh->e_ident, ELFMAG, SELFMAG)
+			|| eh->e_ident[EI_CLASS] != ELFCLASS32
+			|| eh->e_phoff + eh->e_phnum * sizeof(Elf32_Phdr)
+				> ksize) {
+		fprintf(stderr, "%s: not a 32-bit ELF image\n", argv[1]);
+		return 1;
+	}
+	Elf32_Phdr *ph = (Elf32_Phdr *) (k + eh->e_phoff);
+
+	FILE *out = fopen(argv[2], "wb");
+	if (out == NULL) {
+		perror(argv[2]);
+		return 1;
+	}
+
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = ZIMAGE_MAGIC;
+	hdr.entry = eh->e_entry;
+
+	// Segment data starts in the sector after the header.
+	uint32_t zoffset = SECTSIZE;
+	size_t totalin = 0;
+	for (i = 0; i < eh->e_phnum; i++) {
+		if (ph[i].p_type != PT_LOAD || ph[i].p_memsz == 0)
+			continue;
+		if (ph[i].p_offset + ph[i].p_filesz > ksize) {
+			fprintf(stderr, "%s: truncated segment\n", argv[1]);
+			return 1;
+		}
+		if (hdr.nsegs == ZIMAGE_MAXSEGS) {
+			fprintf(stderr, "%s: more than %d segments\n",
+				argv[1], ZIMAGE_MAXSEGS);
+			return 1;
+		}
+
+		const uint8_t *data = k + ph[i].p_offset;
+		size_t n = ph[i].p_filesz;
+		uint8_t *z = malloc(n + n/255 + 16);
+		uint8_t *check = malloc(n + 1);
+		size_t zsize = lz4_compress(data, n, z);
+		if (lz4_decompress(check, z, zsize) != check + n
+				|| memcmp(check, data, n) != 0) {
+			fprintf(stderr, "%s: segment %d failed to decompress\n",
+				argv[1], i);
+			return 1;
+		}
+
+		zimage_seg *s = &hdr.segs[hdr.nsegs++];
+		s->va = ph[i].p_vaddr;
+		s->filesz = n;
+		s->memsz = ph[i].p_memsz;
+		s->zoffset = zoffset;
+		s->zsize = zsize;
+
+		fseek(out, zoffset, SEEK_SET);
+		fwrite(z, 1, zsize, out);
+		zoffset += (zsize + SECTSIZE - 1) & ~(SECTSIZE - 1);
+		totalin += n;
+		free(z);
+		free(check);
+	}
+
+	// Pad to a whole sector, and write the header last.
+	fseek(out, zoffset - 1, SEEK_SET);
+	fputc(0, out);
+	rewind(out);
+	fwrite(&hdr, sizeof(hdr), 1, out);
+	if (fclose(out) != 0) {
+		perror(argv[2]);
+		return 1;
+	}
+
+	fprintf(stderr, "kernel compressed from %zu to %u bytes (%u sectors)\n",
+		totalin, zoffset, zoffset / SECTSIZE);
+	return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * Off-line formatter for the kernel's binary trace log (kern/trace.c).
+ *
+ * Reads the kernel ELF image and a raw memory image of its tracebufs array,
+ * as saved for example from gdb with:
+ *
+ *	dump binary value tracebufs.bin tracebufs
+ *
+ * and prints the logged records oldest first, looking up format strings
+ * and %s arguments in the kernel image.  Usage:
+ *
+ *	tracedump obj/kern/kernel tracebufs.bin
+ *
+ * Copyright (C) 2010 Yale University.
+ * See section "MIT License" in the file LICENSES for licensing terms.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <elf.h>
+
+#include <kern/tracerec.h>
+
+
+static uint8_t *kimg;		// Contents of the kernel ELF file
+static size_t kimgsize;
+static Elf32_Phdr *kph;		// Its program headers
+static int kphnum;
+
+
+static void *
+readfile(const char *name, size_t *size)
+{
+	FILE *f = fopen(name, "rb");
+	if (f == NULL) {
+		perror(name);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	*size = ftell(f);
+	rewind(f);
+	void *buf = malloc(*size + 1);
+	if (buf == NULL || fread(buf, 1, *size, f) != *size) {
+		fprintf(stderr, "%s: read error\n", name);
+		exit(1);
+	}
+	fclose(f);
+	return buf;
+}
+
+// Find the string at kernel virtual address va in the kernel image,
+// or return NULL if it's not in any of the image's loaded segments.
+static const char *
+kstring(uint32_t va)
+{
+	int i;
+	for (i = 0; i < kphnum; i++) {
+		Elf32_Phdr *ph = &kph[i];
+		if (ph->p_type != PT_LOAD || va < ph->p_vaddr
+				|| va >= ph->p_vaddr + ph->p_filesz)
+			continue;
+		const char *s = (const char *) kimg + ph->p_offset
+				+ (va - ph->p_vaddr);
+		const char *end = (const char *) kimg + ph->p_offset
+				+ ph->p_filesz;
+		if (memchr(s, 0, end - s) == NULL)
+			return NULL;
+		return s;
+	}
+	return NULL;
+}
+
+// Format one record like the kernel's vprintfmt would,
+// consuming argument words as the format string calls for them.
+// Longs are 32 bits in the kernel, so only %ll takes two words.
+static void
+format(const tracerec *r)
+{
+	const char *fmt = kstring(r->fmt);
+	int argi = 0;
+
+	if (fmt == NULL) {
+		printf("<bad format string at 0x%08x>", r->fmt);
+		return;
+	}
+
+#define NEXTARG() (argi < TRACE_MAXARGS ? r->args[argi++] : 0)
+
+	while (*fmt) {
+		if (*fmt != '%') {
+			putchar(*fmt++);
+			continue;
+		}
+
+		// Copy flags, width and precision into a host format spec.
+		char spec[32];
+		int n = 0;
+		spec[n++] = *fmt++;
+		while (*fmt && strchr("-0#.123456789", *fmt) && n < 24)
+			spec[n++] = *fmt++;
+		int lflag = 0;
+		while (*fmt == 'l')
+			lflag++, fmt++;
+
+		char conv = *fmt;
+		if (conv)
+			fmt++;
+		uint64_t v;
+		switch (conv) {
+		case 'd':
+		case 'u':
+		case 'o':
+		case 'x':
+			v = NEXTARG();
+			if (lflag >= 2)
+				v |= (uint64_t) NEXTARG() << 32;
+			else if (conv == 'd')
+				v = (int64_t) (int32_t) v;
+			spec[n++] = 'l';
+			spec[n++] = 'l';
+			spec[n++] = conv;
+			spec[n] = 0;
+			printf(spec, (unsigned long long) v);
+			break;
+		case 'p':
+			printf("0x%x", NEXTARG());
+			break;
+		case 'c':
+			spec[n++] = 'c';
+			spec[n] = 0;
+			printf(spec, (int) NEXTARG());
+			break;
+		case 's': {
+			uint32_t va = NEXTARG();
+			const char *s = va ? kstring(va) : "(null)";
+			if (s == NULL) {
+				printf("<string at 0x%08x>", va);
+				break;
+			}
+			spec[n++] = 's';
+			spec[n] = 0;
+			printf(spec, s);
+			break;
+		}
+		case '%':
+			putchar('%');
+			break;
+		default:
+			spec[n] = 0;
+			fputs(spec, stdout);
+			if (conv)
+				putchar(conv);
+			break;
+		}
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	size_t dumpsize;
+	tracebuf *bufs;
+	uint32_t *next;
+	uint64_t t0 = 0;
+	int i, ncpus;
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s <kernel> <tracebufs-dump>\n",
+			argv[0]);
+		return 1;
+	}
+
+	kimg = readfile(argv[1], &kimgsize);
+	Elf32_Ehdr *eh = (Elf32_Ehdr *) kimg;
+	if (kimgsize < sizeof(*eh) || memcmp(eh->e_ident, ELFMAG, SELFMAG)
+			|| eh->e_ident[EI_CLASS] != ELFCLASS32
+			|| eh->e_phoff + eh->e_phnum * sizeof(Elf32_Phdr)
+				> kimgsize) {
+		fprintf(stderr, "%s: not a 32-bit ELF image\n", argv[1]);
+		return 1;
+	}
+	kph = (Elf32_Phdr *) (kimg + eh->e_phoff);
+	kphnum = eh->e_phnum;
+
+	bufs = readfile(argv[2], &dumpsize);
+	// The dump holds one tracebuf for each of the kernel's MAX_CPUS.
+	if (dumpsize == 0 || dumpsize % sizeof(tracebuf) != 0) {
+		fprintf(stderr, "%s: %zu bytes is not a whole number of "
+			"%zu-byte tracebufs; does tracedump match the kernel?\n",
+			argv[2], dumpsize, sizeof(tracebuf));
+		return 1;
+	}
+	ncpus = dumpsize / sizeof(tracebuf);
+	next = calloc(ncpus, sizeof(*next));
+
+	for (i = 0; i < ncpus; i++) {
+		uint32_t head = bufs[i].head;
+		next[i] = head > TRACE_NRECS ? head - TRACE_NRECS : 0;
+	}
+
+	while (1) {
+		tracerec *r, *oldest = NULL;
+		int oldestcpu = 0;
+
+		for (i = 0; i < ncpus; i++) {
+			if (next[i] == bufs[i].head)
+				continue;
+			r = &bufs[i].recs[next[i] & (TRACE_NRECS-1)];
+			if (oldest == NULL || r->tsc < oldest->tsc)
+				oldest = r, oldestcpu = i;
+		}
+		if (oldest == NULL)
+			break;
+		next[oldestcpu]++;
+
+		if (t0 == 0)
+			t0 = oldest->tsc;
+		printf("[%d %10llu] ", oldestcpu,
+			(unsigned long long) (oldest->tsc - t0));
+		format(oldest);
+		putchar('\n');
+	}
+	return 0;
+}